@@ -0,0 +1,54 @@
+//	Copyright (c) 2008-2025 Ryo Suzuki.
+//	Copyright (c) 2016-2025 OpenSiv3D Project.
+//	Licensed under the MIT License.
+
+# version 410
+
+//
+//	VSInput
+//
+layout(location = 0) in vec4 VertexPosition;
+layout(location = 1) in vec3 VertexNormal;
+layout(location = 2) in vec2 VertexUV;
+
+//
+//	VSOutput
+//
+layout(location = 0) out vec3 WorldPosition;
+layout(location = 1) out vec2 UV;
+layout(location = 2) out vec3 Normal;
+layout(location = 3) flat out vec4 InstanceDiffuseColor;
+
+//
+//	Constant Buffer
+//
+layout(std140) uniform VSPerView
+{
+	mat4x4 g_worldToProjected;
+};
+
+layout(std140) uniform VSPerMaterial
+{
+	vec4 g_uvTransform;
+};
+
+layout(std140) uniform VSPerInstance
+{
+	mat4x4 g_localToWorld[128];
+	vec4 g_diffuseColor[128];
+};
+
+//
+//	Functions
+//
+void main()
+{
+	mat4x4 localToWorld = g_localToWorld[gl_InstanceID];
+	vec4 worldPosition = VertexPosition * localToWorld;
+
+	gl_Position				= worldPosition * g_worldToProjected;
+	WorldPosition			= worldPosition.xyz;
+	UV						= (VertexUV * g_uvTransform.xy + g_uvTransform.zw);
+	Normal					= VertexNormal * mat3x3(localToWorld);
+	InstanceDiffuseColor	= g_diffuseColor[gl_InstanceID];
+}
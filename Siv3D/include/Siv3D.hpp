@@ -189,6 +189,9 @@
 // スレッド | Thread
 # include <Siv3D/Threading.hpp>
 
+// タスクグループ | Task group
+# include <Siv3D/TaskGroup.hpp>
+
 // 非同期タスク | Asynchronous task
 # include <Siv3D/AsyncTask.hpp>
 
@@ -348,6 +351,9 @@
 // プロファイラー | Profiler
 # include <Siv3D/Profiler.hpp>
 
+// スコープ単位の処理時間の記録 | Scoped profile zones
+# include <Siv3D/ProfileZone.hpp>
+
 // 処理にかかった時間の測定 | Clock counter in milliseconds
 # include <Siv3D/MillisecClock.hpp>
 
@@ -450,6 +456,9 @@
 // Zstandard 方式による可逆圧縮 | Lossless compression with Zstandard algorithm
 # include <Siv3D/Compression.hpp>
 
+// Zstandard 方式の圧縮に使う辞書 | Dictionary for Zstandard compression
+# include <Siv3D/CompressionDictionary.hpp>
+
 // ZIP 圧縮ファイルの読み込み | ZIP reader
 # include <Siv3D/ZIPReader.hpp>
 
@@ -474,12 +483,18 @@
 // CSV データの読み書き | CSV reader/writer
 # include <Siv3D/CSV.hpp>
 
+// 型付きの列を持つ CSV データの高速な読み込み | Columnar CSV reader
+# include <Siv3D/ColumnarCSV.hpp>
+
 // INI データの読み書き | INI reader/writer
 # include <Siv3D/INI.hpp>
 
 // JSON データの読み書き | JSON reader/writer
 # include <Siv3D/JSON.hpp>
 
+// JSON データの逐次読み込み | JSON SAX visitor
+# include <Siv3D/JSONVisitor.hpp>
+
 // JSON データの検証 | JSON validation
 # include <Siv3D/JSONValidator.hpp>
 
@@ -729,6 +744,9 @@
 // 2D 描画バッファ | Native 2D drawing buffer
 # include <Siv3D/Buffer2D.hpp>
 
+// 2D 描画コマンドリスト | 2D drawing command list
+# include <Siv3D/CommandList2D.hpp>
+
 // 2D 幾何 | 2D geometry processing
 # include <Siv3D/Geometry2D.hpp>
 
@@ -1315,12 +1333,18 @@
 // 音声のグローバル設定 | Global audio setting
 # include <Siv3D/GlobalAudio.hpp>
 
+// デコード結果のキャッシュの使用状況 | Decoded wave cache statistics
+# include <Siv3D/DecodedWaveCacheStats.hpp>
+
 // オーディオストリームのインタフェース | Audio stream interface
 # include <Siv3D/IAudioStream.hpp>
 
 // 音声 | Audio
 # include <Siv3D/Audio.hpp>
 
+// オフラインの音声レンダリング | Offline audio renderer
+# include <Siv3D/OfflineAudioRenderer.hpp>
+
 //////////////////////////////////////////////////
 //
 //	入力デバイス | Input Device
@@ -1415,6 +1439,10 @@
 
 # include <Siv3D/AssetInfo.hpp>
 
+# include <Siv3D/AssetLoadPriority.hpp>
+
+# include <Siv3D/AssetLoadStats.hpp>
+
 # include <Siv3D/Asset.hpp>
 
 # include <Siv3D/AudioAssetData.hpp>
@@ -1639,8 +1667,17 @@
 // フォント | Font
 # include <Siv3D/Font.hpp>
 
+// グリフアトラスの使用状況 | Glyph atlas statistics
+# include <Siv3D/GlyphAtlasStats.hpp>
+
+// テキストの整形結果のキャッシュの使用状況 | Shaped text cache statistics
+# include <Siv3D/ShapedTextCacheStats.hpp>
+
 # include <Siv3D/TextStyle.hpp>
 # include <Siv3D/DrawableText.hpp>
+
+// 整形と行の配置を済ませたテキスト | Text layout
+# include <Siv3D/TextLayout.hpp>
 # include <Siv3D/Print.hpp>
 # include <Siv3D/PutText.hpp>
 # include <Siv3D/Icon.hpp>
@@ -1681,6 +1718,9 @@
 // 3D モデル | 3D model
 # include <Siv3D/Model.hpp>
 
+// メッシュのインスタンス描画 | Batched mesh instance drawing
+# include <Siv3D/MeshInstanceBatch.hpp>
+
 //////////////////////////////////////////////////
 //
 //	GUI | GUI
@@ -1772,7 +1812,10 @@
 # include <Siv3D/Physics2D/P2ContactPair.hpp>
 # include <Siv3D/Physics2D/P2Contact.hpp>
 # include <Siv3D/Physics2D/P2Collision.hpp>
+# include <Siv3D/Physics2D/P2CollisionMode.hpp>
+# include <Siv3D/Physics2D/P2ContactRecord.hpp>
 # include <Siv3D/Physics2D/P2World.hpp>
+# include <Siv3D/Physics2D/P2WorldGroup.hpp>
 # include <Siv3D/Physics2D/P2Body.hpp>
 # include <Siv3D/Physics2D/P2Shape.hpp>
 # include <Siv3D/Physics2D/P2Line.hpp>
@@ -16,10 +16,7 @@
 # endif
 # include <vector>
 # ifndef SIV3D_NO_CONCURRENT_API
-	# include <future>
-	# if SIV3D_PLATFORM(WINDOWS)
-	#	include <execution>
-	# endif
+	# include <atomic>
 # endif
 # include <unordered_set>
 # include "String.hpp"
@@ -1101,32 +1098,36 @@ namespace s3d
 
 	# ifndef SIV3D_NO_CONCURRENT_API
 
-		/// @brief 
-		/// @tparam Fty 
-		/// @param f 
-		/// @return 
+		/// @brief 条件を満たす要素の個数を、エンジンのスレッドプールを使って並列に数えます。
+		/// @tparam Fty 条件を記述した関数の型
+		/// @param f 条件を記述した関数
+		/// @param grainSize 1 回のタスクで処理する要素の最小数。0 の場合は自動で決定
+		/// @return 条件を満たす要素の個数
 		template <class Fty, std::enable_if_t<std::is_invocable_r_v<bool, Fty, Type>>* = nullptr>
 		[[nodiscard]]
-		size_t parallel_count_if(Fty f) const;
+		size_t parallel_count_if(Fty f, size_t grainSize = 0) const;
 
-		/// @brief 
-		/// @tparam Fty 
-		/// @param f 
+		/// @brief 全ての要素を引数に関数を、エンジンのスレッドプールを使って並列に呼び出します。
+		/// @tparam Fty 呼び出す関数の型
+		/// @param f 呼び出す関数
+		/// @param grainSize 1 回のタスクで処理する要素の最小数。0 の場合は自動で決定
 		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type&>>* = nullptr>
-		void parallel_each(Fty f);
+		void parallel_each(Fty f, size_t grainSize = 0);
 
-		/// @brief 
-		/// @tparam Fty 
-		/// @param f 
+		/// @brief 全ての要素を引数に関数を、エンジンのスレッドプールを使って並列に呼び出します。
+		/// @tparam Fty 呼び出す関数の型
+		/// @param f 呼び出す関数
+		/// @param grainSize 1 回のタスクで処理する要素の最小数。0 の場合は自動で決定
 		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>* = nullptr>
-		void parallel_each(Fty f) const;
+		void parallel_each(Fty f, size_t grainSize = 0) const;
 
-		/// @brief 
-		/// @tparam Fty 
-		/// @param f 
-		/// @return 
+		/// @brief 全ての要素に関数を適用した結果からなる新しい配列を、エンジンのスレッドプールを使って並列に作成します。
+		/// @tparam Fty 適用する関数の型
+		/// @param f 適用する関数
+		/// @param grainSize 1 回のタスクで処理する要素の最小数。0 の場合は自動で決定
+		/// @return 新しい配列
 		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>* = nullptr>
-		auto parallel_map(Fty f) const;
+		auto parallel_map(Fty f, size_t grainSize = 0) const;
 
 	# endif
 
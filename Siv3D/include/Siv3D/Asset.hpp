@@ -10,11 +10,14 @@
 //-----------------------------------------------
 
 # pragma once
+# include <functional>
 # include "Common.hpp"
 # include "String.hpp"
 # include "Array.hpp"
 # include "AssetState.hpp"
 # include "AssetInfo.hpp"
+# include "AssetLoadPriority.hpp"
+# include "AssetLoadStats.hpp"
 
 namespace s3d
 {
@@ -48,6 +51,20 @@ namespace s3d
 		[[nodiscard]]
 		bool isFinished() const;
 
+		/// @brief 次の非同期ロードの優先度を設定します。
+		/// @param priority 優先度
+		void setLoadPriority(AssetLoadPriority priority);
+
+		/// @brief 非同期ロードの優先度を返します。
+		/// @return 非同期ロードの優先度
+		[[nodiscard]]
+		AssetLoadPriority getLoadPriority() const;
+
+		/// @brief 開始していない非同期ロードを取り消します。
+		/// @remark 取り消したアセットは、ロード前の状態に戻ります。
+		/// @return 取り消した場合 true, ロードが既に始まっているか、非同期ロード中でない場合は false
+		bool cancelAsync();
+
 	protected:
 
 		[[nodiscard]]
@@ -58,10 +75,53 @@ namespace s3d
 
 		void setState(AssetState state);
 
+		/// @brief 非同期ロードをアセットローダーに登録し、状態を `AssetState::AsyncLoading` にします。
+		/// @param read ファイルの読み込みを行う関数。読み込んだバイト数を返します。不要な場合は空にします
+		/// @param decode `read` の後に実行される、ロードの残りを行う関数。成功した場合 true を返します
+		void requestAsyncLoad(std::function<uint64()> read, std::function<bool()> decode);
+
+		/// @brief 非同期ロードが完了するまで待機します。
+		/// @remark ロードがまだ始まっていない場合は、呼び出したスレッドでロードします。
+		void waitAsyncLoad();
+
 	private:
 
 		class IAssetDetail;
 
 		std::shared_ptr<IAssetDetail> pImpl;
 	};
+
+	namespace Asset
+	{
+		/// @brief 非同期ロードに使うスレッドの数を設定します。
+		/// @param readThreads ファイルの読み込みを行うスレッドの数
+		/// @param decodeThreads デコードを行うスレッドの数
+		/// @remark 実行中のロードが完了するまで待ってからスレッドを作り直します。
+		void SetLoaderThreadCount(size_t readThreads, size_t decodeThreads);
+
+		/// @brief 1 フレームあたりに GPU に転送するテクスチャデータの上限を設定します。
+		/// @param bytes 1 フレームあたりの上限（バイト）
+		/// @remark 上限を超えるテクスチャも、1 フレームに 1 つは転送されます。
+		/// @remark メインスレッドでしかテクスチャを作成できない環境（OpenGL など）でのみ有効です。
+		void SetUploadBudget(size_t bytes);
+
+		/// @brief 1 フレームあたりに GPU に転送するテクスチャデータの上限を返します。
+		/// @return 1 フレームあたりの上限（バイト）
+		[[nodiscard]]
+		size_t GetUploadBudget();
+
+		/// @brief 完了していない非同期ロードの数を返します。
+		/// @return 完了していない非同期ロードの数
+		[[nodiscard]]
+		size_t GetLoadQueueDepth();
+
+		/// @brief 非同期ロードの状況を返します。
+		/// @return 非同期ロードの状況
+		[[nodiscard]]
+		AssetLoadStats GetLoadStats();
+
+		/// @brief 開始していないすべての非同期ロードを取り消します。
+		/// @return 取り消したロードの数
+		size_t CancelAllLoads();
+	}
 }
@@ -0,0 +1,30 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief アセットの非同期ロードの優先度
+	/// @remark 優先度が高いものから順にロードされます。同じ優先度のものは要求した順にロードされます。
+	enum class AssetLoadPriority : uint8
+	{
+		/// @brief 低い（先読みなど）
+		Low,
+
+		/// @brief 通常
+		Normal,
+
+		/// @brief 高い（すぐに画面に表示されるものなど）
+		High,
+	};
+}
@@ -0,0 +1,58 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief アセットの非同期ロードの状況
+	struct AssetLoadStats
+	{
+		/// @brief ファイルの読み込みを待っているロードの数
+		size_t queuedRead = 0;
+
+		/// @brief デコードを待っているロードの数
+		size_t queuedDecode = 0;
+
+		/// @brief 実行中のロードの数
+		size_t running = 0;
+
+		/// @brief 完了したロードの累計
+		uint64 completed = 0;
+
+		/// @brief 取り消されたロードの累計
+		uint64 canceled = 0;
+
+		/// @brief ファイルから読み込んだデータの累計（バイト）
+		uint64 readBytes = 0;
+
+		/// @brief GPU に転送したテクスチャデータの累計（バイト）
+		uint64 uploadedBytes = 0;
+
+		/// @brief 直近 1 秒間に完了したロードの数
+		double completedPerSecond = 0.0;
+
+		/// @brief 直近 1 秒間にファイルから読み込んだデータ（バイト）
+		double readBytesPerSecond = 0.0;
+
+		/// @brief 直近 1 秒間に GPU に転送したテクスチャデータ（バイト）
+		double uploadedBytesPerSecond = 0.0;
+
+		/// @brief 完了していないロードの数を返します。
+		/// @return 完了していないロードの数
+		[[nodiscard]]
+		constexpr size_t queueDepth() const noexcept
+		{
+			return (queuedRead + queuedDecode + running);
+		}
+	};
+}
@@ -84,6 +84,16 @@ namespace s3d
 
 		static void LoadAsync(AssetNameView name);
 
+		/// @brief 優先度を指定して、指定したオーディオアセットの非同期ロードを開始します。
+		/// @param name オーディオアセット名
+		/// @param priority 優先度
+		static void LoadAsync(AssetNameView name, AssetLoadPriority priority);
+
+		/// @brief 指定したオーディオアセットの、開始していない非同期ロードを取り消します。
+		/// @param name オーディオアセット名
+		/// @return 取り消した場合 true, それ以外の場合は false
+		static bool CancelLoadAsync(AssetNameView name);
+
 		static void Wait(AssetNameView name);
 
 		[[nodiscard]]
@@ -13,7 +13,6 @@
 # include "Common.hpp"
 # include "Asset.hpp"
 # include "Audio.hpp"
-# include "AsyncTask.hpp"
 
 namespace s3d
 {
@@ -69,9 +68,5 @@ namespace s3d
 		static bool DefaultLoad(AudioAssetData& asset, const String& hint);
 
 		static void DefaultRelease(AudioAssetData& asset);
-
-	private:
-
-		AsyncTask<void> m_task;
 	};
 }
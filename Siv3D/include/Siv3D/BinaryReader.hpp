@@ -26,6 +26,10 @@ namespace s3d
 	{
 	public:
 
+		/// @brief この大きさ以上のファイルは、メモリマップして読み込みます。
+		/// @remark メモリマップしたファイルの read() と lookahead() はメモリからのコピーになり、readView() はコピーせずに参照します。
+		static constexpr int64 MemoryMapThreshold = (64 * 1024);
+
 		/// @brief デフォルトコンストラクタ
 		SIV3D_NODISCARD_CXX20
 		BinaryReader();
@@ -119,6 +123,23 @@ namespace s3d
 		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
 		bool lookahead(TriviallyCopyable& dst);
 
+		/// @brief データをコピーせずに参照する読み込みをサポートしているかを返します。
+		/// @return ファイルをメモリマップしている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool supportsReadView() const noexcept override;
+
+		/// @brief ファイルのデータをコピーせずに参照し、読み込み位置を進めます。
+		/// @param size 参照するサイズ（バイト）
+		/// @return 参照したデータ。終端を超える分は含みません。ファイルをメモリマップしていない場合は空
+		/// @remark 参照したデータは、ファイルを閉じるまで有効です。
+		[[nodiscard]]
+		std::span<const Byte> readView(int64 size) override;
+
+		/// @brief ファイルをメモリマップして読み込んでいるかを返します。
+		/// @return ファイルをメモリマップしている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isMemoryMapped() const noexcept;
+
 		/// @brief 開いているファイルのパスを返します。
 		/// @return 開いているファイルのパス。ファイルが開いていない場合は空の文字列
 		[[nodiscard]]
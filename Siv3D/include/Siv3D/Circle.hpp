@@ -12,6 +12,7 @@
 # pragma once
 # include "Common.hpp"
 # include "PointVector.hpp"
+# include "Array.hpp"
 # include "ColorHSV.hpp"
 # include "LineStyle.hpp"
 # include "PredefinedYesNo.hpp"
@@ -551,6 +552,17 @@ namespace s3d
 		/// @return *this
 		const Circle& drawShadow(const Vec2& offset, double blur, double spread = 0.0, const ColorF& color = ColorF{ 0.0, 0.5 }) const;
 
+		/// @brief 複数の円をまとめて描きます。
+		/// @param circles 円の配列
+		/// @param color 色
+		/// @remark 1 つずつ `draw()` を呼ぶよりも、1 個あたりのオーバーヘッドが小さくなります。
+		static void DrawBatch(const Array<Circle>& circles, const ColorF& color = Palette::White);
+
+		/// @brief 複数の円をそれぞれの色でまとめて描きます。
+		/// @param circles 円の配列
+		/// @param colors 円ごとの色。`circles` と同じ要素数である必要があります。
+		static void DrawBatch(const Array<Circle>& circles, const Array<ColorF>& colors);
+
 		[[nodiscard]]
 		TexturedCircle operator ()(const Texture& texture) const;
 
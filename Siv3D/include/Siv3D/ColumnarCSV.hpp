@@ -0,0 +1,153 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "Optional.hpp"
+# include "PredefinedYesNo.hpp"
+
+namespace s3d
+{
+	/// @brief ColumnarCSV の列の型
+	enum class CSVColumnType : uint8
+	{
+		/// @brief 文字列
+		String,
+
+		/// @brief 64-bit 符号付き整数
+		Int64,
+
+		/// @brief 浮動小数点数
+		Double,
+	};
+
+	/// @brief 列ごとに型を指定して CSV を読み込み、列単位の配列として保持するクラス
+	/// @remark UTF-8 のファイルを複数のチャンクに分割し、並列にパースします。セルごとの String は、文字列型の列にしか作成しません。
+	/// @remark 引用符 `"` で囲まれたセルと、その中の `""` に対応します。引用符の中の改行には対応しません。
+	/// @remark 数値として読めなかったセルや、行に存在しないセルは 0 または空の文字列になります。
+	class ColumnarCSV
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		ColumnarCSV() = default;
+
+		/// @brief CSV ファイルを読み込みます。
+		/// @param path ファイルパス
+		/// @param columnTypes 各列の型。この数を超える列は無視されます
+		/// @param hasHeader 1 行目を見出しとして扱う場合 `HasHeader::Yes`
+		/// @param separator 区切り文字（ASCII 文字）
+		SIV3D_NODISCARD_CXX20
+		ColumnarCSV(FilePathView path, const Array<CSVColumnType>& columnTypes, HasHeader hasHeader = HasHeader::Yes, char32 separator = U',');
+
+		/// @brief CSV ファイルを読み込みます。
+		/// @param path ファイルパス
+		/// @param columnTypes 各列の型。この数を超える列は無視されます
+		/// @param hasHeader 1 行目を見出しとして扱う場合 `HasHeader::Yes`
+		/// @param separator 区切り文字（ASCII 文字）
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		bool load(FilePathView path, const Array<CSVColumnType>& columnTypes, HasHeader hasHeader = HasHeader::Yes, char32 separator = U',');
+
+		/// @brief 読み込んだデータを消去します。
+		void clear() noexcept;
+
+		/// @brief データが空であるかを返します。
+		/// @return データが空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief データが空でないかを返します。
+		/// @return データが空でない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 行数を返します。見出しの行は含みません。
+		/// @return 行数
+		[[nodiscard]]
+		size_t rows() const noexcept;
+
+		/// @brief 列数を返します。
+		/// @return 列数
+		[[nodiscard]]
+		size_t columns() const noexcept;
+
+		/// @brief 見出しの一覧を返します。
+		/// @return 見出しの一覧。見出しが無い場合は空の配列
+		[[nodiscard]]
+		const Array<String>& header() const noexcept;
+
+		/// @brief 指定した見出しを持つ列のインデックスを返します。
+		/// @param name 見出し
+		/// @return 列のインデックス。見つからなかった場合は none
+		[[nodiscard]]
+		Optional<size_t> columnIndex(StringView name) const;
+
+		/// @brief 指定した列の型を返します。
+		/// @param column 列
+		/// @return 列の型
+		[[nodiscard]]
+		CSVColumnType columnType(size_t column) const;
+
+		/// @brief 整数型の列のデータを返します。
+		/// @param column 列
+		/// @throw Error 列が範囲外であるか、整数型でない場合
+		/// @return 列のデータ
+		[[nodiscard]]
+		const Array<int64>& getInt64Column(size_t column) const;
+
+		/// @brief 浮動小数点数型の列のデータを返します。
+		/// @param column 列
+		/// @throw Error 列が範囲外であるか、浮動小数点数型でない場合
+		/// @return 列のデータ
+		[[nodiscard]]
+		const Array<double>& getDoubleColumn(size_t column) const;
+
+		/// @brief 文字列型の列のデータを返します。
+		/// @param column 列
+		/// @throw Error 列が範囲外であるか、文字列型でない場合
+		/// @return 列のデータ
+		[[nodiscard]]
+		const Array<String>& getStringColumn(size_t column) const;
+
+		/// @brief 直前の読み込みで、指定した型として読めなかったセルの数を返します。
+		/// @return 型として読めなかったセルの数
+		[[nodiscard]]
+		size_t invalidCellCount() const noexcept;
+
+	private:
+
+		struct Column
+		{
+			CSVColumnType type = CSVColumnType::String;
+
+			Array<int64> int64s;
+
+			Array<double> doubles;
+
+			Array<String> strings;
+		};
+
+		Array<Column> m_columns;
+
+		Array<String> m_header;
+
+		size_t m_rows = 0;
+
+		size_t m_invalidCellCount = 0;
+
+		[[nodiscard]]
+		const Column& getColumn(size_t column, CSVColumnType type) const;
+
+		bool loadFromUTF8(std::string_view data, const Array<CSVColumnType>& columnTypes, HasHeader hasHeader, char separator);
+	};
+}
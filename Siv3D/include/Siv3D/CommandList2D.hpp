@@ -0,0 +1,206 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "Array.hpp"
+# include "Vertex2D.hpp"
+# include "TriangleIndex.hpp"
+# include "ColorHSV.hpp"
+# include "PredefinedYesNo.hpp"
+
+namespace s3d
+{
+	struct Line;
+	struct Triangle;
+	struct RectF;
+	struct Circle;
+	struct Ellipse;
+	struct Quad;
+	class LineString;
+	class Polygon;
+
+	/// @brief 2D 描画コマンドリスト
+	/// @remark 図形の頂点生成をメインスレッド以外で行うためのクラスです。
+	/// @remark `add` 系の関数はエンジンの状態に触れないため、別々のコマンドリストであれば複数のスレッドから同時に呼べます。
+	/// @remark 記録した内容は、メインスレッドで `draw()` を呼んだ時点で現在の 2D 描画に追加されます。複数のコマンドリストは `draw()` を呼んだ順に描画されます。
+	class CommandList2D
+	{
+	public:
+
+		/// @brief 記録済みの頂点とインデックスのまとまり。1 回の描画で扱える頂点数とインデックス数の上限ごとに区切られます。
+		struct Segment
+		{
+			uint32 vertexOffset = 0;
+
+			uint32 vertexCount = 0;
+
+			uint32 triangleOffset = 0;
+
+			uint32 triangleCount = 0;
+		};
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		CommandList2D();
+
+		SIV3D_NODISCARD_CXX20
+		CommandList2D(const CommandList2D& other);
+
+		SIV3D_NODISCARD_CXX20
+		CommandList2D(CommandList2D&& other) noexcept;
+
+		/// @brief 曲線の分割数の基準となる拡大率を指定してコマンドリストを作成します。
+		/// @param maxScaling 描画時の座標変換の最大拡大率
+		/// @remark メインスレッドで `Graphics2D::GetMaxScaling()` を取得して渡してください。
+		SIV3D_NODISCARD_CXX20
+		explicit CommandList2D(double maxScaling);
+
+		~CommandList2D();
+
+		CommandList2D& operator =(const CommandList2D& other);
+
+		CommandList2D& operator =(CommandList2D&& other) noexcept;
+
+		/// @brief 線分を追加します。
+		/// @param line 線分
+		/// @param thickness 線の太さ
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addLine(const Line& line, double thickness, const ColorF& color);
+
+		/// @brief 線分を追加します。
+		/// @param line 線分
+		/// @param thickness 線の太さ
+		/// @param colorBegin 始点側の色
+		/// @param colorEnd 終点側の色
+		/// @return *this
+		CommandList2D& addLine(const Line& line, double thickness, const ColorF& colorBegin, const ColorF& colorEnd);
+
+		/// @brief 三角形を追加します。
+		/// @param triangle 三角形
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addTriangle(const Triangle& triangle, const ColorF& color);
+
+		/// @brief 長方形を追加します。
+		/// @param rect 長方形
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addRect(const RectF& rect, const ColorF& color);
+
+		/// @brief 長方形の枠を追加します。
+		/// @param rect 長方形
+		/// @param thickness 枠の太さ
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addRectFrame(const RectF& rect, double thickness, const ColorF& color);
+
+		/// @brief 円を追加します。
+		/// @param circle 円
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addCircle(const Circle& circle, const ColorF& color);
+
+		/// @brief 円を追加します。
+		/// @param circle 円
+		/// @param innerColor 内側の色
+		/// @param outerColor 外側の色
+		/// @return *this
+		CommandList2D& addCircle(const Circle& circle, const ColorF& innerColor, const ColorF& outerColor);
+
+		/// @brief 円の枠を追加します。
+		/// @param circle 円
+		/// @param thickness 枠の太さ
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addCircleFrame(const Circle& circle, double thickness, const ColorF& color);
+
+		/// @brief 楕円を追加します。
+		/// @param ellipse 楕円
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addEllipse(const Ellipse& ellipse, const ColorF& color);
+
+		/// @brief 凸四角形を追加します。
+		/// @param quad 凸四角形
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addQuad(const Quad& quad, const ColorF& color);
+
+		/// @brief 線分列を追加します。
+		/// @param lineString 線分列
+		/// @param thickness 線の太さ
+		/// @param color 色
+		/// @param closeRing 終点と始点を結ぶか
+		/// @return *this
+		CommandList2D& addLineString(const LineString& lineString, double thickness, const ColorF& color, CloseRing closeRing = CloseRing::No);
+
+		/// @brief 多角形を追加します。
+		/// @param polygon 多角形
+		/// @param color 色
+		/// @return *this
+		CommandList2D& addPolygon(const Polygon& polygon, const ColorF& color);
+
+		/// @brief 頂点とインデックスを直接追加します。
+		/// @param vertices 頂点配列の先頭ポインタ
+		/// @param vertexCount 頂点の個数
+		/// @param indices インデックス配列の先頭ポインタ
+		/// @param num_triangles 三角形の個数
+		/// @return *this
+		CommandList2D& addVertices(const Vertex2D* vertices, size_t vertexCount, const TriangleIndex* indices, size_t num_triangles);
+
+		/// @brief 記録した内容を消去します。
+		/// @remark 確保済みのメモリは解放されないため、毎フレーム同じコマンドリストを再利用できます。
+		void clear() noexcept;
+
+		/// @brief 頂点とインデックスのメモリを予約します。
+		/// @param vertexSize 頂点の個数
+		/// @param num_triangles 三角形の個数
+		void reserve(size_t vertexSize, size_t num_triangles);
+
+		/// @brief 何も記録されていないかを返します。
+		/// @return 何も記録されていない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 何か記録されているかを返します。
+		/// @return 何か記録されている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 記録済みの頂点の個数を返します。
+		/// @return 記録済みの頂点の個数
+		[[nodiscard]]
+		size_t num_vertices() const noexcept;
+
+		/// @brief 記録済みの三角形の個数を返します。
+		/// @return 記録済みの三角形の個数
+		[[nodiscard]]
+		size_t num_triangles() const noexcept;
+
+		/// @brief 記録済みのセグメントを返します。
+		/// @return 記録済みのセグメント
+		[[nodiscard]]
+		const Array<Segment>& segments() const noexcept;
+
+		/// @brief 記録した内容を描画します。
+		/// @remark メインスレッドから呼ぶ必要があります。
+		void draw() const;
+
+	private:
+
+		class CommandList2DDetail;
+
+		std::unique_ptr<CommandList2DDetail> pImpl;
+	};
+}
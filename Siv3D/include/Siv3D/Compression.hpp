@@ -16,6 +16,10 @@
 
 namespace s3d
 {
+	class IReader;
+	class IWriter;
+	class CompressionDictionary;
+
 	namespace Compression
 	{
 		inline constexpr int32 MinLevel = 1;
@@ -24,6 +28,12 @@ namespace s3d
 
 		inline constexpr int32 MaxLevel = 22;
 
+		/// @brief ワーカースレッドを使わずに、呼び出したスレッドで圧縮することを示す値
+		inline constexpr int32 NoWorkers = 0;
+
+		/// @brief ワーカースレッドの数を CPU の論理コア数に合わせることを示す値
+		inline constexpr int32 AutoWorkers = -1;
+
 		[[nodiscard]]
 		Blob Compress(const void* data, size_t size, int32 compressionLevel = DefaultLevel);
 
@@ -43,7 +53,39 @@ namespace s3d
 
 		bool CompressToFile(const Blob& blob, FilePathView outputPath, int32 compressionLevel = DefaultLevel);
 
-		bool CompressFileToFile(FilePathView inputPath, FilePathView outputPath, int32 compressionLevel = DefaultLevel);
+		bool CompressFileToFile(FilePathView inputPath, FilePathView outputPath, int32 compressionLevel = DefaultLevel, int32 numWorkers = NoWorkers);
+
+		/// @brief IReader の現在位置から末尾までのデータを圧縮して、IWriter に書き込みます。
+		/// @param reader 圧縮するデータ
+		/// @param writer 圧縮したデータの書き込み先
+		/// @param compressionLevel 圧縮レベル
+		/// @param numWorkers 圧縮に使うワーカースレッドの数。`NoWorkers` の場合は呼び出したスレッドで圧縮し、`AutoWorkers` の場合は論理コア数に合わせる
+		/// @return 圧縮に成功した場合 true, それ以外の場合は false
+		/// @remark データ全体をメモリに読み込まずに、少しずつ圧縮します。
+		bool Compress(IReader& reader, IWriter& writer, int32 compressionLevel = DefaultLevel, int32 numWorkers = NoWorkers);
+
+		/// @brief 辞書を使って、IReader の現在位置から末尾までのデータを圧縮して、IWriter に書き込みます。
+		/// @param reader 圧縮するデータ
+		/// @param writer 圧縮したデータの書き込み先
+		/// @param dictionary 辞書
+		/// @return 圧縮に成功した場合 true, それ以外の場合は false
+		bool Compress(IReader& reader, IWriter& writer, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使ってデータを圧縮します。
+		/// @param data 圧縮するデータの先頭ポインタ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @param dictionary 辞書
+		/// @return 圧縮したデータ。失敗した場合は空の Blob
+		/// @remark 小さなデータを繰り返し圧縮する場合は、辞書を使うと圧縮率と速度が向上します。
+		[[nodiscard]]
+		Blob Compress(const void* data, size_t size, const CompressionDictionary& dictionary);
+
+		bool Compress(const void* data, size_t size, Blob& dst, const CompressionDictionary& dictionary);
+
+		[[nodiscard]]
+		Blob Compress(const Blob& blob, const CompressionDictionary& dictionary);
+
+		bool Compress(const Blob& blob, Blob& dst, const CompressionDictionary& dictionary);
 
 		[[nodiscard]]
 		Blob Decompress(const void* data, size_t size);
@@ -65,5 +107,53 @@ namespace s3d
 		bool DecompressToFile(const Blob& blob, FilePathView outputPath);
 
 		bool DecompressFileToFile(FilePathView inputPath, FilePathView outputPath);
+
+		/// @brief IReader の現在位置から末尾までの圧縮データを展開して、IWriter に書き込みます。
+		/// @param reader 圧縮されたデータ
+		/// @param writer 展開したデータの書き込み先
+		/// @return 展開に成功した場合 true, それ以外の場合は false
+		/// @remark データ全体をメモリに読み込まずに、少しずつ展開します。
+		bool Decompress(IReader& reader, IWriter& writer);
+
+		/// @brief 辞書を使って、IReader の現在位置から末尾までの圧縮データを展開して、IWriter に書き込みます。
+		/// @param reader 圧縮されたデータ
+		/// @param writer 展開したデータの書き込み先
+		/// @param dictionary 圧縮に使った辞書
+		/// @return 展開に成功した場合 true, それ以外の場合は false
+		bool Decompress(IReader& reader, IWriter& writer, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使って圧縮されたデータを展開します。
+		/// @param data 圧縮されたデータの先頭ポインタ
+		/// @param size 圧縮されたデータのサイズ（バイト）
+		/// @param dictionary 圧縮に使った辞書
+		/// @return 展開したデータ。失敗した場合は空の Blob
+		[[nodiscard]]
+		Blob Decompress(const void* data, size_t size, const CompressionDictionary& dictionary);
+
+		bool Decompress(const void* data, size_t size, Blob& dst, const CompressionDictionary& dictionary);
+
+		[[nodiscard]]
+		Blob Decompress(const Blob& blob, const CompressionDictionary& dictionary);
+
+		bool Decompress(const Blob& blob, Blob& dst, const CompressionDictionary& dictionary);
+	}
+
+	/// @brief Compression の圧縮レベルのプリセット
+	namespace CompressionLevel
+	{
+		/// @brief 最も速く、圧縮率が最も低い
+		inline constexpr int32 Fastest = Compression::MinLevel;
+
+		/// @brief 速度を重視する
+		inline constexpr int32 Fast = 3;
+
+		/// @brief 速度と圧縮率のバランスをとる
+		inline constexpr int32 Default = Compression::DefaultLevel;
+
+		/// @brief 圧縮率を重視する
+		inline constexpr int32 High = 19;
+
+		/// @brief 最も圧縮率が高く、最も遅い
+		inline constexpr int32 Max = Compression::MaxLevel;
 	}
 }
@@ -0,0 +1,100 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "Array.hpp"
+# include "Blob.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	/// @brief Compression で使う学習済みの辞書
+	/// @remark 似た内容の小さなデータ（セーブデータやネットワークのパケットなど）を多数圧縮する場合に、圧縮率と速度が向上します。
+	/// @remark 圧縮と展開には同じ辞書を使う必要があります。
+	/// @remark 作成後は読み取り専用なので、複数のスレッドから同時に使うことができます。
+	class CompressionDictionary
+	{
+	public:
+
+		/// @brief 学習に使うデータの合計サイズが不足しないよう推奨される辞書の最大サイズ（バイト）
+		static constexpr size_t DefaultCapacity = (110 * 1024);
+
+		SIV3D_NODISCARD_CXX20
+		CompressionDictionary();
+
+		/// @brief 辞書のデータから辞書を作成します。
+		/// @param dictionary 辞書のデータ
+		/// @param compressionLevel この辞書で圧縮するときの圧縮レベル
+		SIV3D_NODISCARD_CXX20
+		explicit CompressionDictionary(const Blob& dictionary, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 辞書のデータから辞書を作成します。
+		/// @param dictionary 辞書のデータ
+		/// @param compressionLevel この辞書で圧縮するときの圧縮レベル
+		SIV3D_NODISCARD_CXX20
+		explicit CompressionDictionary(Blob&& dictionary, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 辞書のファイルを読み込んで辞書を作成します。
+		/// @param path 辞書のファイルパス
+		/// @param compressionLevel この辞書で圧縮するときの圧縮レベル
+		SIV3D_NODISCARD_CXX20
+		explicit CompressionDictionary(FilePathView path, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 辞書が空であるかを返します。
+		/// @return 辞書が空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 辞書が空でないかを返します。
+		/// @return 辞書が空でない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 辞書の ID を返します。
+		/// @return 辞書の ID。圧縮されたデータに記録され、展開時に辞書が正しいかの確認に使われます。
+		[[nodiscard]]
+		uint32 id() const noexcept;
+
+		/// @brief この辞書で圧縮するときの圧縮レベルを返します。
+		/// @return 圧縮レベル
+		[[nodiscard]]
+		int32 compressionLevel() const noexcept;
+
+		/// @brief 辞書のデータを返します。
+		/// @return 辞書のデータ
+		[[nodiscard]]
+		const Blob& getBlob() const noexcept;
+
+		/// @brief 辞書のデータをファイルに保存します。
+		/// @param path 保存するファイルパス
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool save(FilePathView path) const;
+
+		/// @brief サンプルのデータから辞書を学習します。
+		/// @param samples 学習に使うサンプルのデータ。辞書の最大サイズのおよそ 100 倍の合計サイズがあることが推奨されます。
+		/// @param capacity 辞書の最大サイズ（バイト）
+		/// @param compressionLevel この辞書で圧縮するときの圧縮レベル
+		/// @return 学習した辞書。失敗した場合は空の辞書
+		[[nodiscard]]
+		static CompressionDictionary Train(const Array<Blob>& samples, size_t capacity = DefaultCapacity, int32 compressionLevel = Compression::DefaultLevel);
+
+		class CompressionDictionaryDetail;
+
+		[[nodiscard]]
+		const CompressionDictionaryDetail* _detail() const noexcept;
+
+	private:
+
+		std::shared_ptr<CompressionDictionaryDetail> pImpl;
+	};
+}
@@ -0,0 +1,48 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief ファイルから作成した Audio のデコード結果のキャッシュの使用状況
+	/// @remark 同じファイルから作成した Audio は、キャッシュされたデコード結果を共有します。
+	struct DecodedWaveCacheStats
+	{
+		/// @brief キャッシュされているファイルの数
+		size_t entries = 0;
+
+		/// @brief キャッシュが保持している波形のメモリ（バイト）
+		size_t usedBytes = 0;
+
+		/// @brief キャッシュが使用できるメモリの上限（バイト）
+		size_t capacityBytes = 0;
+
+		/// @brief 検索でキャッシュが見つかった回数の累計
+		uint64 hits = 0;
+
+		/// @brief 検索でキャッシュが見つからなかった回数の累計
+		uint64 misses = 0;
+
+		/// @brief 容量の上限を超えたために取り除かれたエントリの数の累計
+		uint64 evictions = 0;
+
+		/// @brief 検索でキャッシュが見つかった割合を返します。
+		/// @return 検索でキャッシュが見つかった割合。検索が一度も無い場合は 0.0
+		[[nodiscard]]
+		constexpr double hitRate() const noexcept
+		{
+			const uint64 total = (hits + misses);
+			return (total ? (static_cast<double>(hits) / total) : 0.0);
+		}
+	};
+}
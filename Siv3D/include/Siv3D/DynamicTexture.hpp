@@ -58,6 +58,20 @@ namespace s3d
 
 		bool fillRegionIfNotBusy(const Image& image, const Rect& rect);
 
+		/// @brief 動的テクスチャの中身を同じ大きさの画像で更新する予約をします。
+		/// @param image 画像
+		/// @remark 更新は後のフレームで、1 フレームあたりの転送量を制限しながら行われます。
+		/// @remark 前回の予約がまだ転送されていない場合、その予約は新しい画像で置き換えられます。動画のように毎フレーム更新する場合に適しています。
+		/// @return 予約に成功した場合 true, それ以外の場合は false
+		bool fillAsync(const Image& image);
+
+		/// @brief 動的テクスチャの中身を同じ大きさの画像で更新する予約をします。
+		/// @param image 画像
+		/// @remark 更新は後のフレームで、1 フレームあたりの転送量を制限しながら行われます。
+		/// @remark 前回の予約がまだ転送されていない場合、その予約は新しい画像で置き換えられます。動画のように毎フレーム更新する場合に適しています。
+		/// @return 予約に成功した場合 true, それ以外の場合は false
+		bool fillAsync(Image&& image);
+
 		/// @brief ミップマップを生成します。
 		/// @remark この関数は、テクスチャの作成時に MipMap を有効にした場合にのみ効果があります。
 		void generateMips();
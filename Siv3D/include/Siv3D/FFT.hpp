@@ -11,10 +11,12 @@
 
 # pragma once
 # include "Common.hpp"
+# include "Array.hpp"
 # include "FFTResult.hpp"
 # include "Scene.hpp"
 # include "FFTSampleLength.hpp"
 # include "WaveSample.hpp"
+# include "MixBus.hpp"
 
 namespace s3d
 {
@@ -47,5 +49,18 @@ namespace s3d
 		/// @param sampleRate 入力波形のサンプリングレート
 		/// @param sampleLength FFT サンプル数
 		void Analyze(FFTResult& result, const float* input, size_t length, uint32 sampleRate, FFTSampleLength sampleLength = FFTSampleLength::Default);
+
+		/// @brief 複数の波形の FFT を、複数のスレッドで並列に実行します。
+		/// @param results 結果の出力先。inputs と同じ要素数にリサイズされます。
+		/// @param inputs 入力の波形の一覧
+		/// @param sampleRate 入力波形のサンプリングレート
+		/// @param sampleLength FFT サンプル数
+		void AnalyzeMany(Array<FFTResult>& results, const Array<Array<float>>& inputs, uint32 sampleRate, FFTSampleLength sampleLength = FFTSampleLength::Default);
+
+		/// @brief 複数のバスの直近のサンプルでの FFT を、複数のスレッドで並列に実行します。
+		/// @param results 結果の出力先。buses と同じ要素数にリサイズされます。
+		/// @param buses バスの一覧
+		/// @param sampleLength FFT サンプル数
+		void AnalyzeMany(Array<FFTResult>& results, const Array<MixBus>& buses, FFTSampleLength sampleLength = FFTSampleLength::Default);
 	}
 }
@@ -20,6 +20,8 @@
 # include "TextStyle.hpp"
 # include "Glyph.hpp"
 # include "PredefinedYesNo.hpp"
+# include "GlyphAtlasStats.hpp"
+# include "ShapedTextCacheStats.hpp"
 
 namespace s3d
 {
@@ -405,7 +407,23 @@ namespace s3d
 		/// @return 事前生成に成功した場合 true, それ以外の場合は false
 		bool preload(StringView chars) const;
 
+		/// @brief 指定した文字列のためのグリフをレンダリングし、ファイルに保存します。
+		/// @param chars 文字列
+		/// @param path 保存するファイルのパス
+		/// @remark SDF / MSDF フォントのグリフは複数のスレッドで並列にレンダリングします。
+		/// @remark 保存したファイルは `loadBakedAtlas()` で読み込めます。
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool bakeAtlas(StringView chars, FilePathView path) const;
+
+		/// @brief `bakeAtlas()` で保存したグリフのファイルを読み込みます。
+		/// @param path ファイルのパス
+		/// @remark 読み込んだグリフは、必要になったときにレンダリングせずにグリフアトラスに追加されます。
+		/// @remark 同じフォントファイル、同じ大きさ、同じ描画方式で保存したファイルである必要があります。
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		bool loadBakedAtlas(FilePathView path) const;
+
 		/// @brief フォントの内部でキャッシュされているテクスチャを返します。
+		/// @remark グリフは同じ描画方式のすべてのフォントで共有するグリフアトラスに格納されます。アトラスが複数のページを持つ場合は、このフォントが最初にキャッシュしたグリフのあるページを返します。
 		/// @return フォントの内部でキャッシュされているテクスチャ
 		[[nodiscard]]
 		const Texture& getTexture() const;
@@ -468,6 +486,24 @@ namespace s3d
 
 		[[nodiscard]]
 		static bool IsAvailable(Typeface typeface);
+
+		/// @brief グリフアトラスの使用状況を返します。
+		/// @param method フォントのレンダリング方式
+		/// @remark グリフアトラスは、同じレンダリング方式のすべてのフォントで共有されます。
+		/// @return 指定したレンダリング方式のグリフアトラスの使用状況
+		[[nodiscard]]
+		static GlyphAtlasStats GetGlyphAtlasStats(FontMethod method);
+
+		/// @brief テキストの整形結果のキャッシュが使用できるメモリの上限を設定します。
+		/// @param capacityBytes メモリの上限（バイト）
+		/// @remark キャッシュはすべてのフォントで共有されます。デフォルトでは 4 MiB です。
+		/// @remark 上限を超えると、最も長く使われていない整形結果から取り除かれます。
+		static void SetShapedTextCacheCapacity(size_t capacityBytes);
+
+		/// @brief テキストの整形結果のキャッシュの使用状況を返します。
+		/// @return テキストの整形結果のキャッシュの使用状況
+		[[nodiscard]]
+		static ShapedTextCacheStats GetShapedTextCacheStats();
 	};
 }
 
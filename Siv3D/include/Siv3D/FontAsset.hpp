@@ -60,6 +60,17 @@ namespace s3d
 
 		static void LoadAsync(AssetNameView name, StringView preloadText = U"");
 
+		/// @brief 優先度を指定して、指定したフォントアセットの非同期ロードを開始します。
+		/// @param name フォントアセット名
+		/// @param priority 優先度
+		/// @param preloadText 事前にグリフを作成しておく文字列
+		static void LoadAsync(AssetNameView name, AssetLoadPriority priority, StringView preloadText = U"");
+
+		/// @brief 指定したフォントアセットの、開始していない非同期ロードを取り消します。
+		/// @param name フォントアセット名
+		/// @return 取り消した場合 true, それ以外の場合は false
+		static bool CancelLoadAsync(AssetNameView name);
+
 		/// @brief 指定したフォントアセットのロードが完了するまで待機します。
 		/// @param name フォントアセット名
 		static void Wait(AssetNameView name);
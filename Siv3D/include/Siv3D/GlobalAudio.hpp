@@ -14,8 +14,10 @@
 # include "Duration.hpp"
 # include "Array.hpp"
 # include "FFTResult.hpp"
+# include "FFTSampleLength.hpp"
 # include "AudioGroup.hpp"
 # include "MixBus.hpp"
+# include "DecodedWaveCacheStats.hpp"
 
 namespace s3d
 {
@@ -55,6 +57,12 @@ namespace s3d
 		/// @param samples 最終出力の直近 256 サンプルを格納する配列
 		void GetSamples(Array<float>& samples);
 
+		/// @brief 最終出力の直近のサンプルを取得します。
+		/// @param samples 最終出力の直近のサンプルを古い順に格納する配列
+		/// @param length 取得するサンプル数（最大 16384）
+		/// @remark ミキサーの処理を止めずに取得します。samples の容量が足りていればメモリを確保しません。
+		void GetSamples(Array<float>& samples, size_t length);
+
 		[[nodiscard]]
 		FFTResult GetFFT();
 
@@ -62,6 +70,11 @@ namespace s3d
 		/// @return FFT 結果の格納先
 		void GetFFT(FFTResult& result);
 
+		/// @brief 最終出力の直近のサンプルでの FFT 結果を取得します。
+		/// @param result FFT 結果の格納先
+		/// @param sampleLength FFT サンプル数
+		void GetFFT(FFTResult& result, FFTSampleLength sampleLength);
+
 		[[nodiscard]]
 		Array<float> BusGetSamples(MixBus busIndex);
 
@@ -70,6 +83,12 @@ namespace s3d
 		/// @param samples 指定したバスの直近 256 サンプルを格納する配列
 		void BusGetSamples(MixBus busIndex, Array<float>& samples);
 
+		/// @brief 指定したバスの直近のサンプルを取得します。
+		/// @param busIndex バスのインデックス
+		/// @param samples 指定したバスの直近のサンプルを古い順に格納する配列
+		/// @param length 取得するサンプル数（最大 16384）
+		void BusGetSamples(MixBus busIndex, Array<float>& samples, size_t length);
+
 		[[nodiscard]]
 		FFTResult BusGetFFT(MixBus busIndex);
 
@@ -78,6 +97,12 @@ namespace s3d
 		/// @param result FFT 結果の格納先
 		void BusGetFFT(MixBus busIndex, FFTResult& result);
 
+		/// @brief 指定したバスの直近のサンプルでの FFT 結果を取得します。
+		/// @param busIndex バスのインデックス
+		/// @param result FFT 結果の格納先
+		/// @param sampleLength FFT サンプル数
+		void BusGetFFT(MixBus busIndex, FFTResult& result, FFTSampleLength sampleLength);
+
 		[[nodiscard]]
 		double BusGetVolume(MixBus busIndex);
 
@@ -101,5 +126,18 @@ namespace s3d
 		/// @return ピッチシフトフィルタを利用できる場合 true, それ以外の場合は false
 		[[nodiscard]]
 		bool SupportsPitchShift();
+
+		/// @brief ファイルから作成した Audio のデコード結果のキャッシュが使用できるメモリの上限を設定します。
+		/// @param capacityBytes メモリの上限（バイト）。0 の場合はキャッシュしません。
+		/// @remark 上限を超えると、最近使われていないファイルから取り除かれます。取り除かれても、作成済みの Audio には影響しません。
+		void SetDecodedWaveCacheCapacity(size_t capacityBytes);
+
+		/// @brief ファイルから作成した Audio のデコード結果のキャッシュの使用状況を返します。
+		/// @return キャッシュの使用状況
+		[[nodiscard]]
+		DecodedWaveCacheStats GetDecodedWaveCacheStats();
+
+		/// @brief ファイルから作成した Audio のデコード結果のキャッシュを空にします。
+		void ClearDecodedWaveCache();
 	}
 }
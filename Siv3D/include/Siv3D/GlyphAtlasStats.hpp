@@ -0,0 +1,62 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief グリフアトラスの使用状況
+	/// @remark グリフアトラスは同じ描画方式のすべてのフォントで共有されます。
+	struct GlyphAtlasStats
+	{
+		/// @brief アトラスに格納されているグリフの数
+		size_t glyphs = 0;
+
+		/// @brief アトラスのページ（テクスチャ）の数
+		size_t pages = 0;
+
+		/// @brief グリフが占めているピクセル数
+		uint64 usedPixels = 0;
+
+		/// @brief 確保されているページのピクセル数の合計
+		uint64 capacityPixels = 0;
+
+		/// @brief グリフの検索で、アトラスにグリフが見つかった回数の累計
+		uint64 hits = 0;
+
+		/// @brief グリフの検索で、グリフを新たにレンダリングした回数の累計
+		uint64 misses = 0;
+
+		/// @brief 空き領域を確保するためにアトラスから取り除かれたグリフの数の累計
+		uint64 evictions = 0;
+
+		/// @brief GPU に転送したデータの累計（バイト）
+		uint64 uploadedBytes = 0;
+
+		/// @brief グリフの検索でアトラスにグリフが見つかった割合を返します。
+		/// @return グリフの検索でアトラスにグリフが見つかった割合。検索が一度も無い場合は 0.0
+		[[nodiscard]]
+		constexpr double hitRate() const noexcept
+		{
+			const uint64 total = (hits + misses);
+			return (total ? (static_cast<double>(hits) / total) : 0.0);
+		}
+
+		/// @brief 確保されているページのうち、グリフが占めている割合を返します。
+		/// @return 確保されているページのうち、グリフが占めている割合。ページが無い場合は 0.0
+		[[nodiscard]]
+		constexpr double occupancy() const noexcept
+		{
+			return (capacityPixels ? (static_cast<double>(usedPixels) / capacityPixels) : 0.0);
+		}
+	};
+}
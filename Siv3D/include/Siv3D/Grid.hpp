@@ -390,6 +390,23 @@ namespace s3d
 		[[nodiscard]]
 		bool none(Fty f = Identity) const;
 
+	# ifndef SIV3D_NO_CONCURRENT_API
+
+		template <class Fty, std::enable_if_t<std::is_invocable_r_v<bool, Fty, Type>>* = nullptr>
+		[[nodiscard]]
+		size_t parallel_count_if(Fty f, size_t grainSize = 0) const;
+
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type&>>* = nullptr>
+		Grid& parallel_each(Fty f, size_t grainSize = 0);
+
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>* = nullptr>
+		const Grid& parallel_each(Fty f, size_t grainSize = 0) const;
+
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>* = nullptr>
+		auto parallel_map(Fty f, size_t grainSize = 0) const;
+
+	# endif
+
 		template <class Fty, class R = std::decay_t<std::invoke_result_t<Fty, Type, Type>>>
 		auto reduce(Fty f, R init) const;
 
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <new>
 # include "Common.hpp"
 # include "Uncopyable.hpp"
 
@@ -25,5 +26,38 @@ namespace s3d
 		/// @param timeSec エフェクトの発生からの時間
 		/// @return エフェクトを継続する場合は true を、破棄する場合は false を返します。
 		virtual bool update(double timeSec) = 0;
+
+		/// @brief エフェクト用のメモリプールからメモリを確保します。
+		/// @param size 確保するサイズ（バイト）
+		/// @remark 小さなエフェクトは、サイズごとに用意された連続したメモリ領域から確保され、破棄後に再利用されます。
+		/// @return 確保したメモリ領域の先頭ポインタ
+		[[nodiscard]]
+		static void* operator new(size_t size);
+
+		/// @brief エフェクト用のメモリプールからメモリを確保します。
+		/// @param size 確保するサイズ（バイト）
+		/// @param alignment アライメント（バイト）
+		/// @return 確保したメモリ領域の先頭ポインタ
+		[[nodiscard]]
+		static void* operator new(size_t size, std::align_val_t alignment);
+
+		[[nodiscard]]
+		static void* operator new(size_t, void* p) noexcept
+		{
+			return p;
+		}
+
+		/// @brief `operator new` で確保したメモリ領域を解放します。
+		/// @param p 解放するメモリ領域の先頭ポインタ
+		/// @param size 確保したサイズ（バイト）
+		static void operator delete(void* p, size_t size) noexcept;
+
+		/// @brief `operator new` で確保したメモリ領域を解放します。
+		/// @param p 解放するメモリ領域の先頭ポインタ
+		/// @param size 確保したサイズ（バイト）
+		/// @param alignment アライメント（バイト）
+		static void operator delete(void* p, size_t size, std::align_val_t alignment) noexcept;
+
+		static void operator delete(void*, void*) noexcept {}
 	};
 }
@@ -49,6 +49,24 @@ namespace s3d
 		[[nodiscard]]
 		virtual Image decode(IReader& reader, FilePathView pathHint) const = 0;
 
+		/// @brief 画像データをデコードし、既存の Image に書き込みます。
+		/// @param reader 画像データの IReader インタフェース
+		/// @param pathHint ファイルパス（オプション）
+		/// @param image 書き込み先の Image
+		/// @remark デフォルトの実装は `decode()` の結果を `image` にムーブします。`image` のメモリを再利用するデコーダはこの関数をオーバーライドします。
+		/// @return デコードに成功した場合 true, それ以外の場合は false
+		virtual bool decodeInto(IReader& reader, FilePathView pathHint, Image& image) const;
+
+		/// @brief 画像データを、可能であれば縮小しながらデコードします。
+		/// @param reader 画像データの IReader インタフェース
+		/// @param pathHint ファイルパス（オプション）
+		/// @param maxSize 最終的に縮小する大きさの上限
+		/// @remark 縮小デコードに対応するデコーダは、`maxSize` に収まるよう縮小した大きさを下回らない範囲で、できるだけ小さな画像を返します。
+		/// @remark デフォルトの実装は `decode()` と同じです。
+		/// @return デコードした画像
+		[[nodiscard]]
+		virtual Image decodeReduced(IReader& reader, FilePathView pathHint, const Size& maxSize) const;
+
 		[[nodiscard]]
 		virtual Grid<uint16> decodeGray16(FilePathView path) const;
 
@@ -11,8 +11,10 @@
 
 # pragma once
 # include <memory>
+# include <span>
 # include "Common.hpp"
 # include "Concepts.hpp"
+# include "Byte.hpp"
 
 namespace s3d
 {
@@ -93,6 +95,18 @@ namespace s3d
 		/// @return 読み込みに成功したら true, それ以外の場合は false
 		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
 		bool lookahead(TriviallyCopyable& dst) const;
+
+		/// @brief データをコピーせずに参照する読み込みをサポートしているかを返します。
+		/// @return readView() をサポートしている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		virtual bool supportsReadView() const noexcept;
+
+		/// @brief Reader のデータをコピーせずに参照し、読み込み位置を進めます。
+		/// @param size 参照するサイズ（バイト）
+		/// @return 参照したデータ。終端を超える分は含みません。readView() をサポートしていない場合は空
+		/// @remark 参照したデータは、Reader を閉じるか破棄するまで有効です。
+		[[nodiscard]]
+		virtual std::span<const Byte> readView(int64 size);
 	};
 }
 
@@ -34,6 +34,51 @@ namespace s3d
 		[[nodiscard]]
 		Image Decode(IReader& reader, ImageFormat imageFormat = ImageFormat::Unspecified);
 
+		/// @brief 画像ファイルをデコードし、既存の Image に書き込みます。
+		/// @param path 画像ファイルのパス
+		/// @param image 書き込み先の Image
+		/// @param imageFormat 画像フォーマット
+		/// @remark PNG, JPEG, WebP は、`image` の容量が足りる場合はメモリを再確保せずに直接書き込みます。
+		/// @remark 同じ Image を使い回してデコードし、`DynamicTexture::fill()` に渡すと、画像ごとのメモリ確保を避けられます。
+		/// @return デコードに成功した場合 true, それ以外の場合は false
+		bool DecodeInto(FilePathView path, Image& image, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 画像データをデコードし、既存の Image に書き込みます。
+		/// @param reader 画像データの IReader インタフェース
+		/// @param image 書き込み先の Image
+		/// @param imageFormat 画像フォーマット
+		/// @remark PNG, JPEG, WebP は、`image` の容量が足りる場合はメモリを再確保せずに直接書き込みます。
+		/// @return デコードに成功した場合 true, それ以外の場合は false
+		bool DecodeInto(IReader& reader, Image& image, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 複数の画像ファイルを、スレッドプールで並列にデコードします。
+		/// @param paths 画像ファイルのパスの一覧
+		/// @param imageFormat 画像フォーマット
+		/// @remark Web 版では順番にデコードします。
+		/// @return デコードした画像の一覧。`paths` と同じ順に並び、失敗したものは空の Image になります。
+		[[nodiscard]]
+		Array<Image> DecodeMany(const Array<FilePath>& paths, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 画像ファイルを、指定した大きさに収まるよう縮小してデコードします。
+		/// @param path 画像ファイルのパス
+		/// @param maxSize 大きさの上限
+		/// @param imageFormat 画像フォーマット
+		/// @remark JPEG は DCT スケーリングにより、元の大きさの画像を展開せずに縮小デコードします。
+		/// @remark 元の画像が `maxSize` に収まる場合は拡大しません。
+		/// @return デコードした画像
+		[[nodiscard]]
+		Image DecodeThumbnail(FilePathView path, const Size& maxSize, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 画像データを、指定した大きさに収まるよう縮小してデコードします。
+		/// @param reader 画像データの IReader インタフェース
+		/// @param maxSize 大きさの上限
+		/// @param imageFormat 画像フォーマット
+		/// @remark JPEG は DCT スケーリングにより、元の大きさの画像を展開せずに縮小デコードします。
+		/// @remark 元の画像が `maxSize` に収まる場合は拡大しません。
+		/// @return デコードした画像
+		[[nodiscard]]
+		Image DecodeThumbnail(IReader& reader, const Size& maxSize, ImageFormat imageFormat = ImageFormat::Unspecified);
+
 		[[nodiscard]]
 		Grid<uint16> DecodeGray16(FilePathView path, ImageFormat imageFormat = ImageFormat::Unspecified);
 
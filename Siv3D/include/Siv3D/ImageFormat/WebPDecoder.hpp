@@ -65,5 +65,13 @@ namespace s3d
 		/// @return 作成した Image
 		[[nodiscard]]
 		Image decode(IReader& reader, FilePathView pathHint = {}) const override;
+
+		/// @brief WebP 形式の画像データをデコードし、既存の Image に書き込みます。
+		/// @param reader 画像データの IReader インタフェース
+		/// @param pathHint ファイルパス
+		/// @param image 書き込み先の Image
+		/// @remark `image` の容量が足りる場合は、メモリを再確保せずに直接書き込みます。
+		/// @return デコードに成功した場合 true, それ以外の場合は false
+		bool decodeInto(IReader& reader, FilePathView pathHint, Image& image) const override;
 	};
 }
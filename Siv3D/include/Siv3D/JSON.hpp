@@ -16,6 +16,7 @@
 # include "String.hpp"
 # include "IReader.hpp"
 # include "Blob.hpp"
+# include "JSONVisitor.hpp"
 # include "PredefinedYesNo.hpp"
 # include "detail/JSONFwd.ipp"
 
@@ -668,6 +669,7 @@ namespace s3d
 		/// @param [in] path ファイルパス
 		/// @param [in] allowExceptions 例外を発生させるか
 		/// @return JSON オブジェクト
+		/// @remark UTF-8 のファイルに含まれる不正なバイト列は、置換文字 (U+FFFD) に置き換えてパースします。
 		[[nodiscard]]
 		static JSON Load(FilePathView path, AllowExceptions allowExceptions = AllowExceptions::No);
 
@@ -685,6 +687,28 @@ namespace s3d
 		[[nodiscard]]
 		static JSON Parse(StringView str, AllowExceptions allowExceptions = AllowExceptions::No);
 
+		/// @brief UTF-8 の JSON 文字列をパースして JSON オブジェクトを返します。
+		/// @param [in] utf8 UTF-8 の文字列
+		/// @param [in] allowExceptions 例外を発生させるか
+		/// @return JSON オブジェクト
+		/// @remark UTF-32 の String を経由しないため、Blob や MemoryMappedFileView のデータを直接パースできます。先頭の BOM は無視されます。
+		/// @remark 不正な UTF-8 のバイト列は、Parse() と同様に置換文字 (U+FFFD) に置き換えてパースします。
+		[[nodiscard]]
+		static JSON ParseUTF8(std::string_view utf8, AllowExceptions allowExceptions = AllowExceptions::No);
+
+		/// @brief JSON ファイルを、DOM を構築せずに先頭から順にパースします。
+		/// @param [in] path ファイルパス
+		/// @param [in] visitor 要素を読むたびに呼ばれるビジタ
+		/// @return 最後までパースできた場合 true, 構文エラーがあったかビジタが中断した場合は false
+		static bool Visit(FilePathView path, JSONVisitor& visitor);
+
+		/// @brief UTF-8 の JSON 文字列を、DOM を構築せずに先頭から順にパースします。
+		/// @param [in] utf8 UTF-8 の文字列
+		/// @param [in] visitor 要素を読むたびに呼ばれるビジタ
+		/// @return 最後までパースできた場合 true, 構文エラーがあったかビジタが中断した場合は false
+		/// @remark 不正な UTF-8 のバイト列は、ParseUTF8() と同様に置換文字 (U+FFFD) に置き換えてパースします。
+		static bool VisitUTF8(std::string_view utf8, JSONVisitor& visitor);
+
 		/// @brief BSON 形式のデータから JSON オブジェクトをデシリアライズします。
 		/// @param [in] bson BSON データ
 		/// @param [in] allowExceptions 例外を発生させるか
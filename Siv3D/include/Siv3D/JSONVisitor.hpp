@@ -0,0 +1,66 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "StringView.hpp"
+
+namespace s3d
+{
+	/// @brief JSON を DOM を構築せずに先頭から順に読むためのビジタ（SAX インタフェース）
+	/// @remark `JSON::Visit()` や `JSON::VisitUTF8()` に渡すと、パーサが要素を読むたびに対応する関数が呼ばれます。
+	/// @remark 各関数が false を返すとパースを中断します。
+	/// @remark 引数の StringView は関数から戻るまでの間だけ有効です。
+	class JSONVisitor
+	{
+	public:
+
+		virtual ~JSONVisitor() = default;
+
+		/// @brief null を読んだときに呼ばれます。
+		virtual bool null() { return true; }
+
+		/// @brief 真偽値を読んだときに呼ばれます。
+		virtual bool boolean(bool) { return true; }
+
+		/// @brief 負の整数を読んだときに呼ばれます。
+		virtual bool signedInteger(int64) { return true; }
+
+		/// @brief 0 以上の整数を読んだときに呼ばれます。
+		virtual bool unsignedInteger(uint64) { return true; }
+
+		/// @brief 浮動小数点数を読んだときに呼ばれます。
+		virtual bool floatingPoint(double) { return true; }
+
+		/// @brief 文字列を読んだときに呼ばれます。
+		virtual bool string(StringView) { return true; }
+
+		/// @brief オブジェクトの開始 `{` を読んだときに呼ばれます。
+		virtual bool startObject() { return true; }
+
+		/// @brief オブジェクトのキーを読んだときに呼ばれます。
+		virtual bool key(StringView) { return true; }
+
+		/// @brief オブジェクトの終了 `}` を読んだときに呼ばれます。
+		virtual bool endObject() { return true; }
+
+		/// @brief 配列の開始 `[` を読んだときに呼ばれます。
+		virtual bool startArray() { return true; }
+
+		/// @brief 配列の終了 `]` を読んだときに呼ばれます。
+		virtual bool endArray() { return true; }
+
+		/// @brief 構文エラーが見つかったときに呼ばれます。
+		/// @param position エラーが見つかった位置（UTF-8 のバイト単位）
+		/// @param message エラーメッセージ
+		virtual void parseError([[maybe_unused]] size_t position, [[maybe_unused]] StringView message) {}
+	};
+}
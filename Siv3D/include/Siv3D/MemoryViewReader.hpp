@@ -96,6 +96,18 @@ namespace s3d
 		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
 		bool lookahead(TriviallyCopyable& dst) const;
 
+		/// @brief データをコピーせずに参照する読み込みをサポートしているかを返します。
+		/// @return readView() をサポートしている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool supportsReadView() const noexcept override;
+
+		/// @brief Reader のデータをコピーせずに参照し、読み込み位置を進めます。
+		/// @param size 参照するサイズ（バイト）
+		/// @return 参照したデータ。終端を超える分は含みません。
+		/// @remark 参照したデータは、参照元のメモリが有効な間は有効です。
+		[[nodiscard]]
+		std::span<const Byte> readView(int64 size) override;
+
 	private:
 
 		int64 m_size = 0;
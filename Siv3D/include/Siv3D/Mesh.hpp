@@ -213,6 +213,59 @@ namespace s3d
 		void drawSubset(uint32 startTriangle, uint32 triangleCount, const Mat4x4& mat, const TextureRegion& textureRegion, const PhongMaterial& material) const;
 
 
+		/// @brief 同じメッシュを、複数の座標変換でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @param color 色
+		/// @remark 描画ステートを共有するため、`draw()` を繰り返し呼ぶよりも描画コマンドが少なくなります。
+		/// @remark OpenGL 版では、カスタム頂点シェーダを使っていない場合、インスタンス描画命令でまとめて描画します。
+		void drawInstanced(const Array<Mat4x4>& transforms, const ColorF& color = Palette::White) const;
+
+		/// @brief 同じメッシュを、複数の座標変換とそれぞれの色でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @param colors 各インスタンスの色
+		/// @remark `transforms` と `colors` の要素数が異なる場合、少ないほうの数だけ描画します。
+		void drawInstanced(const Array<Mat4x4>& transforms, const Array<ColorF>& colors) const;
+
+		/// @brief 同じメッシュを、複数の座標変換でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @param material マテリアル
+		void drawInstanced(const Array<Mat4x4>& transforms, const PhongMaterial& material) const;
+
+		/// @brief 同じメッシュを、複数の座標変換とそれぞれの拡散反射色でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @param material マテリアル。拡散反射色は `colors` で置き換えられます
+		/// @param colors 各インスタンスの拡散反射色
+		/// @remark `transforms` と `colors` の要素数が異なる場合、少ないほうの数だけ描画します。
+		void drawInstanced(const Array<Mat4x4>& transforms, const PhongMaterial& material, const Array<ColorF>& colors) const;
+
+		/// @brief 同じメッシュを、テクスチャを貼って複数の座標変換でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @param texture テクスチャ
+		/// @param color 色
+		void drawInstanced(const Array<Mat4x4>& transforms, const Texture& texture, const ColorF& color = Palette::White) const;
+
+		/// @brief 同じメッシュを、テクスチャを貼って複数の座標変換とそれぞれの色でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @param texture テクスチャ
+		/// @param colors 各インスタンスの色
+		/// @remark `transforms` と `colors` の要素数が異なる場合、少ないほうの数だけ描画します。
+		void drawInstanced(const Array<Mat4x4>& transforms, const Texture& texture, const Array<ColorF>& colors) const;
+
+		/// @brief 同じメッシュを、テクスチャを貼って複数の座標変換でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @param texture テクスチャ
+		/// @param material マテリアル
+		void drawInstanced(const Array<Mat4x4>& transforms, const Texture& texture, const PhongMaterial& material) const;
+
+		/// @brief 同じメッシュを、テクスチャを貼って複数の座標変換とそれぞれの拡散反射色でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @param texture テクスチャ
+		/// @param material マテリアル。拡散反射色は `colors` で置き換えられます
+		/// @param colors 各インスタンスの拡散反射色
+		/// @remark `transforms` と `colors` の要素数が異なる場合、少ないほうの数だけ描画します。
+		void drawInstanced(const Array<Mat4x4>& transforms, const Texture& texture, const PhongMaterial& material, const Array<ColorF>& colors) const;
+
+
 		void swap(Mesh& other) noexcept;
 
 
@@ -0,0 +1,136 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "Array.hpp"
+# include "Mat4x4.hpp"
+# include "ColorHSV.hpp"
+# include "Sphere.hpp"
+# include "Mesh.hpp"
+# include "Texture.hpp"
+# include "PhongMaterial.hpp"
+
+namespace s3d
+{
+	class Model;
+	struct ViewFrustum;
+
+	/// @brief 多数のメッシュの描画を、メッシュ・テクスチャ・マテリアルの組み合わせごとにまとめて描画するクラス
+	/// @remark 拡散反射色だけが異なるインスタンスは同じまとまりになり、`Mesh::drawInstanced()` で一度に描画されます。
+	/// @remark `draw(const ViewFrustum&)` を使うと、視錐台の外にあるインスタンスを描画前に取り除きます。
+	class MeshInstanceBatch
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		MeshInstanceBatch() = default;
+
+		/// @brief インスタンスを追加します。
+		/// @param mesh メッシュ
+		/// @param transform 座標変換行列
+		/// @param color 色
+		/// @return *this
+		MeshInstanceBatch& add(const Mesh& mesh, const Mat4x4& transform, const ColorF& color = Palette::White);
+
+		/// @brief インスタンスを追加します。
+		/// @param mesh メッシュ
+		/// @param transform 座標変換行列
+		/// @param material マテリアル
+		/// @return *this
+		MeshInstanceBatch& add(const Mesh& mesh, const Mat4x4& transform, const PhongMaterial& material);
+
+		/// @brief テクスチャを貼ったインスタンスを追加します。
+		/// @param mesh メッシュ
+		/// @param texture テクスチャ
+		/// @param transform 座標変換行列
+		/// @param color 色
+		/// @return *this
+		MeshInstanceBatch& add(const Mesh& mesh, const Texture& texture, const Mat4x4& transform, const ColorF& color = Palette::White);
+
+		/// @brief テクスチャを貼ったインスタンスを追加します。
+		/// @param mesh メッシュ
+		/// @param texture テクスチャ
+		/// @param transform 座標変換行列
+		/// @param material マテリアル
+		/// @return *this
+		MeshInstanceBatch& add(const Mesh& mesh, const Texture& texture, const Mat4x4& transform, const PhongMaterial& material);
+
+		/// @brief 3D モデルのインスタンスを追加します。
+		/// @param model 3D モデル
+		/// @param transform 座標変換行列
+		/// @remark モデルを構成するパーツごとにインスタンスが追加されます。
+		/// @return *this
+		MeshInstanceBatch& add(const Model& model, const Mat4x4& transform);
+
+		/// @brief 追加したインスタンスを消去します。
+		/// @remark 毎フレーム同じ組み合わせを追加するときにメモリの再確保が起こらないよう、まとまりとメモリは保持されます。
+		void clear() noexcept;
+
+		/// @brief 追加したインスタンスとまとまりをすべて消去し、メモリを解放します。
+		void release();
+
+		/// @brief インスタンスの数を返します。
+		/// @return インスタンスの数
+		[[nodiscard]]
+		size_t num_instances() const noexcept;
+
+		/// @brief インスタンスを持つまとまりの数を返します。
+		/// @return インスタンスを持つまとまりの数
+		[[nodiscard]]
+		size_t num_batches() const noexcept;
+
+		/// @brief すべてのインスタンスを描画します。
+		void draw() const;
+
+		/// @brief 視錐台と交差するインスタンスだけを描画します。
+		/// @param frustum ワールド座標系の視錐台
+		/// @remark 各インスタンスのバウンディングスフィアを、現在の `Transformer3D` を含めた座標変換で判定します。
+		/// @return 描画したインスタンスの数
+		size_t draw(const ViewFrustum& frustum) const;
+
+	private:
+
+		struct Batch
+		{
+			Mesh mesh;
+
+			Texture texture;
+
+			bool textured = false;
+
+			// 拡散反射色は、インスタンスごとの色で置き換えられる
+			PhongMaterial material;
+
+			Sphere boundingSphere{ 0.0 };
+
+			Array<Mat4x4> transforms;
+
+			Array<ColorF> colors;
+		};
+
+		Array<Batch> m_batches;
+
+		size_t m_lastBatchIndex = 0;
+
+		size_t m_instanceCount = 0;
+
+		// draw(const ViewFrustum&) で使う作業用バッファ
+		mutable Array<uint8> m_visibility;
+
+		mutable Array<Mat4x4> m_visibleTransforms;
+
+		mutable Array<ColorF> m_visibleColors;
+
+		[[nodiscard]]
+		Batch& getBatch(const Mesh& mesh, const Texture* texture, const PhongMaterial& material);
+	};
+}
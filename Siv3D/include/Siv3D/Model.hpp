@@ -95,6 +95,11 @@ namespace s3d
 		/// @param mat 座標変換行列
 		void draw(const Mat4x4& mat) const;
 
+		/// @brief 3D モデルを、複数の座標変換でまとめて描画します。
+		/// @param transforms 各インスタンスの座標変換行列
+		/// @remark パーツごとに描画ステートを共有するため、`draw()` を繰り返し呼ぶよりも描画コマンドが少なくなります。
+		void drawInstanced(const Array<Mat4x4>& transforms) const;
+
 		/// @brief 別の 3D モデルと中身を交換します。
 		/// @param other 別の 3D モデル
 		void swap(Model& other) noexcept;
@@ -104,6 +109,31 @@ namespace s3d
 		/// @param textureDesc テクスチャの設定
 		/// @return テクスチャアセットの登録に成功した場合 true, それ以外の場合は false
 		static bool RegisterDiffuseTextures(const Model& model, TextureDesc textureDesc = TextureDesc::MippedSRGB);
+
+		/// @brief 3D モデルを読み込み、法線などを計算済みのバイナリキャッシュファイルを作成します。
+		/// @param path ファイルのパス（対応している形式は Wavefront OBJ）
+		/// @param cachePath 作成するキャッシュファイルのパス
+		/// @param colorOption 色空間
+		/// @remark GPU のリソースを作成しないため、エンジンの起動前やツールからも使えます。
+		/// @return キャッシュファイルの作成に成功した場合 true, それ以外の場合は false
+		static bool Bake(FilePathView path, FilePathView cachePath, ColorOption colorOption = ColorOption::Default);
+
+		/// @brief キャッシュファイルを使って 3D モデルを読み込みます。
+		/// @param path ファイルのパス（対応している形式は Wavefront OBJ）
+		/// @param cachePath キャッシュファイルのパス
+		/// @param colorOption 色空間
+		/// @remark キャッシュファイルが無いか、元のファイル（参照している MTL ファイルを含む）の内容と一致しない場合は、元のファイルを読み込んでキャッシュファイルを作り直します。
+		/// @remark 元のファイルが存在しない場合は、キャッシュファイルを確認せずにそのまま使います。
+		/// @return 3D モデル
+		[[nodiscard]]
+		static Model LoadCached(FilePathView path, FilePathView cachePath, ColorOption colorOption = ColorOption::Default);
+
+	private:
+
+		struct Cached {};
+
+		SIV3D_NODISCARD_CXX20
+		Model(Cached, FilePathView path, FilePathView cachePath, ColorOption colorOption);
 	};
 }
 
@@ -17,6 +17,7 @@
 # include "Box.hpp"
 # include "Sphere.hpp"
 # include "Material.hpp"
+# include "Mat4x4.hpp"
 
 namespace s3d
 {
@@ -31,5 +32,7 @@ namespace s3d
 		Box boundingBox{ 0.0 };
 
 		void draw(const Array<Material>& materials) const;
+
+		void drawInstanced(const Array<Mat4x4>& transforms, const Array<Material>& materials) const;
 	};
 }
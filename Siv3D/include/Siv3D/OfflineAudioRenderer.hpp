@@ -0,0 +1,134 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <functional>
+# include "Common.hpp"
+# include "Array.hpp"
+# include "Duration.hpp"
+# include "Wave.hpp"
+# include "MixBus.hpp"
+# include "IAudioStream.hpp"
+# include "PredefinedNamedParameter.hpp"
+
+namespace s3d
+{
+	class Audio;
+
+	/// @brief 出力デバイスを使わずに、バスとフィルタを含むミキサーの出力を Wave に書き出すクラス
+	/// @remark 実時間を待たずに、CPU が処理できる速さでレンダリングします。
+	/// @remark 異なる OfflineAudioRenderer は、それぞれ別のスレッドで同時に使うことができます。
+	class OfflineAudioRenderer
+	{
+	public:
+
+		/// @brief デフォルトのサンプリングレートでレンダラーを作成します。
+		SIV3D_NODISCARD_CXX20
+		OfflineAudioRenderer();
+
+		/// @brief レンダラーを作成します。
+		/// @param sampleRate 出力のサンプリングレート
+		SIV3D_NODISCARD_CXX20
+		explicit OfflineAudioRenderer(Arg::sampleRate_<uint32> sampleRate);
+
+		/// @brief 出力のサンプリングレートを返します。
+		/// @return 出力のサンプリングレート
+		[[nodiscard]]
+		uint32 sampleRate() const noexcept;
+
+		/// @brief これまでにレンダリングしたサンプル数を返します。
+		/// @return これまでにレンダリングしたサンプル数
+		[[nodiscard]]
+		uint64 posSample() const noexcept;
+
+		/// @brief これまでにレンダリングした時間（秒）を返します。
+		/// @return これまでにレンダリングした時間（秒）
+		[[nodiscard]]
+		double posSec() const noexcept;
+
+		/// @brief 波形を再生します。
+		/// @param wave 波形
+		/// @param startTime 再生を開始する時刻。レンダリングの開始時を 0 とします。
+		/// @param busIndex 出力先のバス
+		/// @param volume 音量 [0.0, 1.0]
+		/// @param pan パン [-1.0, 1.0]
+		/// @param speed 再生速度（倍率）
+		/// @return *this
+		OfflineAudioRenderer& play(const Wave& wave, const Duration& startTime = SecondsF{ 0.0 }, MixBus busIndex = MixBus0, double volume = 1.0, double pan = 0.0, double speed = 1.0);
+
+		/// @brief オーディオを再生します。
+		/// @param audio オーディオ。ストリーミング再生のオーディオには対応していません。
+		/// @param startTime 再生を開始する時刻。レンダリングの開始時を 0 とします。
+		/// @param busIndex 出力先のバス
+		/// @param volume 音量 [0.0, 1.0]
+		/// @param pan パン [-1.0, 1.0]
+		/// @param speed 再生速度（倍率）
+		/// @return *this
+		/// @remark オーディオの波形はコピーせずに共有します。ループが設定されている場合はループ再生します。
+		OfflineAudioRenderer& play(const Audio& audio, const Duration& startTime = SecondsF{ 0.0 }, MixBus busIndex = MixBus0, double volume = 1.0, double pan = 0.0, double speed = 1.0);
+
+		/// @brief オーディオストリームを再生します。
+		/// @param pAudioStream オーディオストリーム
+		/// @param sampleRate オーディオストリームのサンプリングレート
+		/// @param startTime 再生を開始する時刻。レンダリングの開始時を 0 とします。
+		/// @param busIndex 出力先のバス
+		/// @param volume 音量 [0.0, 1.0]
+		/// @return *this
+		OfflineAudioRenderer& play(const std::shared_ptr<IAudioStream>& pAudioStream, Arg::sampleRate_<uint32> sampleRate, const Duration& startTime = SecondsF{ 0.0 }, MixBus busIndex = MixBus0, double volume = 1.0);
+
+		/// @brief 最終出力の音量を設定します。
+		/// @param volume 音量 [0.0, 1.0]
+		void setVolume(double volume);
+
+		void busSetVolume(MixBus busIndex, double volume);
+
+		void busClearFilter(MixBus busIndex, size_t filterIndex);
+
+		void busSetLowPassFilter(MixBus busIndex, size_t filterIndex, double cutoffFrequency, double resonance, double wet = 1.0);
+
+		void busSetHighPassFilter(MixBus busIndex, size_t filterIndex, double cutoffFrequency, double resonance, double wet = 1.0);
+
+		void busSetEchoFilter(MixBus busIndex, size_t filterIndex, double delay, double decay, double wet = 1.0);
+
+		void busSetReverbFilter(MixBus busIndex, size_t filterIndex, bool freeze, double roomSize, double damp, double width, double wet = 1.0);
+
+		void busSetPitchShiftFilter(MixBus busIndex, size_t filterIndex, double pitchShift);
+
+		/// @brief 続く時間をレンダリングします。
+		/// @param length レンダリングする時間
+		/// @return レンダリング結果
+		/// @remark 繰り返し呼ぶと、前回の続きからレンダリングします。
+		[[nodiscard]]
+		Wave render(const Duration& length);
+
+		/// @brief 続くサンプルをレンダリングします。
+		/// @param wave レンダリング結果の格納先。samples の長さにリサイズされます。
+		/// @param samples レンダリングするサンプル数
+		/// @remark 繰り返し呼ぶと、前回の続きからレンダリングします。
+		void render(Wave& wave, size_t samples);
+
+		/// @brief 互いに独立した複数のレンダリングを、複数のスレッドで並列に実行します。
+		/// @param count レンダリングの数
+		/// @param setup 各レンダラーに再生する音声やバスの設定を行う関数。レンダリングのインデックスとレンダラーを受け取ります。複数のスレッドから同時に呼ばれます。
+		/// @param length 各レンダリングの時間
+		/// @param sampleRate 出力のサンプリングレート
+		/// @return レンダリング結果の一覧
+		[[nodiscard]]
+		static Array<Wave> RenderMany(size_t count, const std::function<void(size_t, OfflineAudioRenderer&)>& setup, const Duration& length, Arg::sampleRate_<uint32> sampleRate = Wave::DefaultSampleRate);
+
+	private:
+
+		class OfflineAudioRendererDetail;
+
+		std::shared_ptr<OfflineAudioRendererDetail> pImpl;
+	};
+}
@@ -44,8 +44,12 @@ namespace s3d
 
 		BlendState blendState = BlendState::Additive;
 
+		/// @brief 経過時間に応じたパーティクルの大きさを返す関数。空の場合は寿命に比例して小さくなります。
+		/// @remark パーティクルが多い場合は、複数のスレッドから同時に呼ばれます。
 		SizeOverLifeTimeFunc sizeOverLifeTimeFunc;
 
+		/// @brief 経過時間に応じたパーティクルの色を返す関数。空の場合は色が変化しません。
+		/// @remark パーティクルが多い場合は、複数のスレッドから同時に呼ばれます。
 		ColorOverLifeTimeFunc colorOverLifeTimeFunc;
 	};
 }
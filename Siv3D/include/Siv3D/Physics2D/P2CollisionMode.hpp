@@ -0,0 +1,30 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+
+namespace s3d
+{
+	/// @brief 物体の接触情報の収集方法
+	enum class P2CollisionMode : uint8
+	{
+		/// @brief 接触情報を収集しません。
+		None,
+
+		/// @brief 接触している物体のペアごとに接触情報をハッシュテーブルに集めます（デフォルト）。`P2World::getCollisions()` で取得します。
+		PerBodyPair,
+
+		/// @brief `P2World::update()` の後に、接触している部品のペアごとの接触情報を配列に集めます。`P2World::getContactRecords()` で取得します。
+		/// @remark 接触ごとのハッシュテーブルの操作が無いため、接触の多いワールドで効率的です。
+		FlatArray,
+	};
+}
@@ -0,0 +1,30 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+# include "P2Fwd.hpp"
+# include "P2ContactPair.hpp"
+# include "P2Collision.hpp"
+
+namespace s3d
+{
+	/// @brief 接触している部品のペアの、物体の ID と接触情報
+	/// @remark `P2CollisionMode::FlatArray` で収集されます。
+	struct P2ContactRecord
+	{
+		/// @brief 接触している物体の ID のペア
+		P2ContactPair pair;
+
+		/// @brief 接触情報
+		P2Collision collision;
+	};
+}
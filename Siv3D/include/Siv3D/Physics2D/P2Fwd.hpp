@@ -29,10 +29,13 @@ namespace s3d
 	struct P2Filter;
 	enum class P2BodyType : uint8;
 	enum class P2ShapeType : uint8;
+	enum class P2CollisionMode : uint8;
 	struct P2ContactPair;
 	struct P2Contact;
 	class P2Collision;
+	struct P2ContactRecord;
 	class P2World;
+	class P2WorldGroup;
 	class P2Body;
 	class P2Shape;
 	class P2Line;
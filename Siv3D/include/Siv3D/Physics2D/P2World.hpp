@@ -14,9 +14,12 @@
 # include "../Common.hpp"
 # include "../PointVector.hpp"
 # include "../HashTable.hpp"
+# include "../Array.hpp"
 # include "../Scene.hpp"
 # include "P2Fwd.hpp"
 # include "P2BodyType.hpp"
+# include "P2CollisionMode.hpp"
+# include "P2ContactRecord.hpp"
 # include "P2Material.hpp"
 # include "P2Filter.hpp"
 # include "P2Body.hpp"
@@ -396,6 +399,23 @@ namespace s3d
 		[[nodiscard]]
 		const HashTable<P2ContactPair, P2Collision>& getCollisions() const noexcept;
 
+		/// @brief 物体の接触情報の収集方法を設定します。
+		/// @param mode 接触情報の収集方法
+		/// @remark デフォルトは `P2CollisionMode::PerBodyPair` です。
+		void setCollisionMode(P2CollisionMode mode);
+
+		/// @brief 物体の接触情報の収集方法を返します。
+		/// @return 接触情報の収集方法
+		[[nodiscard]]
+		P2CollisionMode getCollisionMode() const noexcept;
+
+		/// @brief 直前の `update()` の後に接触していた部品のペアごとの接触情報の一覧を返します。
+		/// @remark `P2CollisionMode::FlatArray` の場合のみ収集されます。
+		/// @remark 1 組の物体が複数の部品で接触している場合、同じ物体のペアが複数含まれます。
+		/// @return 接触情報の一覧
+		[[nodiscard]]
+		const Array<P2ContactRecord>& getContactRecords() const noexcept;
+
 	private:
 
 		std::shared_ptr<detail::P2WorldDetail> pImpl;
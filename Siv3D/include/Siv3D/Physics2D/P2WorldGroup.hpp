@@ -0,0 +1,73 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+# include "../Array.hpp"
+# include "../Scene.hpp"
+# include "P2World.hpp"
+
+namespace s3d
+{
+	/// @brief 互いに独立した複数の P2World をまとめて並列に更新するグループ
+	/// @remark 試合ごとに 1 つのワールドを持つサーバなど、多数のワールドを同時に扱う場合に使います。
+	/// @remark 同じ物体やジョイントを複数のワールドで共有することはできないため、各ワールドは独立に更新できます。
+	class P2WorldGroup
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		P2WorldGroup() = default;
+
+		/// @brief ワールドをグループに追加します。
+		/// @param world 追加するワールド
+		void add(const P2World& world);
+
+		/// @brief グループからワールドを取り除きます。
+		/// @param index 取り除くワールドのインデックス
+		void remove(size_t index);
+
+		/// @brief グループからすべてのワールドを取り除きます。
+		void clear();
+
+		/// @brief グループのワールドの数を返します。
+		/// @return グループのワールドの数
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief グループが空であるかを返します。
+		/// @return グループが空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief グループのワールドを返します。
+		/// @param index ワールドのインデックス
+		/// @return ワールド
+		[[nodiscard]]
+		const P2World& operator [](size_t index) const;
+
+		/// @brief グループのワールドの一覧を返します。
+		/// @return グループのワールドの一覧
+		[[nodiscard]]
+		const Array<P2World>& worlds() const noexcept;
+
+		/// @brief グループのすべてのワールドの状態を、複数のスレッドで並列に更新します。
+		/// @param timeStep タイムステップ（秒）
+		/// @param velocityIterations 物体の衝突時の速度の補正の回数
+		/// @param positionIterations 物体の衝突時の位置の補正の回数
+		/// @remark すべてのワールドの更新が終わるまで戻りません。
+		void update(double timeStep = Scene::DeltaTime(), int32 velocityIterations = 6, int32 positionIterations = 2) const;
+
+	private:
+
+		Array<P2World> m_worlds;
+	};
+}
@@ -0,0 +1,65 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief プロファイルゾーンの計測地点の情報
+	/// @remark `SIV3D_PROFILE_SCOPE` によって計測地点ごとに 1 つだけ静的に作成され、そのアドレスがゾーンの識別子になります。
+	struct ProfileZoneSite
+	{
+		/// @brief ゾーンの名前
+		const char32* name;
+
+		/// @brief ソースファイル名
+		const char* file;
+
+		/// @brief 行番号
+		uint32 line;
+	};
+
+	/// @brief スコープの開始から終了までの時間を、スレッドごとのリングバッファに記録するクラス
+	/// @remark 通常は `SIV3D_PROFILE_SCOPE` マクロを通して使います。
+	/// @remark `Profiler::EnableZoneProfiling(false)` の間は時刻の取得も行いません。
+	class ProfileZone
+	{
+	public:
+
+		/// @brief 計測を開始します。
+		/// @param site 計測地点の情報。プログラムの終了まで有効である必要があります。
+		SIV3D_NODISCARD_CXX20
+		explicit ProfileZone(const ProfileZoneSite* site) noexcept;
+
+		/// @brief 計測を終了し、結果を記録します。
+		~ProfileZone();
+
+		ProfileZone(const ProfileZone&) = delete;
+
+		ProfileZone& operator =(const ProfileZone&) = delete;
+
+	private:
+
+		const ProfileZoneSite* m_site = nullptr;
+
+		uint64 m_beginNanosec = 0;
+	};
+}
+
+# define SIV3D_PROFILE_ZONE_COMBINE_(X,Y) X##Y
+# define SIV3D_PROFILE_ZONE_COMBINE(X,Y) SIV3D_PROFILE_ZONE_COMBINE_(X,Y)
+
+/// @brief 現在のスコープを、指定した名前のプロファイルゾーンとして計測します。
+/// @param name ゾーンの名前（文字列リテラル）
+# define SIV3D_PROFILE_SCOPE(name)\
+	static constexpr s3d::ProfileZoneSite SIV3D_PROFILE_ZONE_COMBINE(siv3d_profile_zone_site_,__LINE__){ name, __FILE__, __LINE__ };\
+	const s3d::ProfileZone SIV3D_PROFILE_ZONE_COMBINE(siv3d_profile_zone_,__LINE__){ &SIV3D_PROFILE_ZONE_COMBINE(siv3d_profile_zone_site_,__LINE__) }
@@ -11,7 +11,9 @@
 
 # pragma once
 # include "Common.hpp"
+# include "StringView.hpp"
 # include "ProfilerStat.hpp"
+# include "ProfileZone.hpp"
 
 namespace s3d
 {
@@ -29,5 +31,24 @@ namespace s3d
 
 		[[nodiscard]]
 		const ProfilerStat& GetStat();
+
+		/// @brief `SIV3D_PROFILE_SCOPE` によるゾーンの記録の ON / OFF を設定します。
+		/// @param enabled 記録を有効にするか
+		/// @remark デフォルトでは無効です。ゾーンはスレッドごとに直近の 65536 件が保持されます。
+		void EnableZoneProfiling(bool enabled);
+
+		/// @brief ゾーンの記録が有効であるかを返します。
+		/// @return ゾーンの記録が有効である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool IsZoneProfilingEnabled() noexcept;
+
+		/// @brief これまでに記録されたゾーンを破棄します。
+		void ClearZones();
+
+		/// @brief 記録されたゾーンを Chrome のトレースイベント形式の JSON ファイルに保存します。
+		/// @param path 保存するファイルのパス
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		/// @remark 保存したファイルは chrome://tracing や Perfetto UI で開くことができます。
+		bool SaveChromeTrace(FilePathView path);
 	}
 }
@@ -12,6 +12,7 @@
 # pragma once
 # include "Common.hpp"
 # include "PointVector.hpp"
+# include "Array.hpp"
 # include "ColorHSV.hpp"
 # include "NamedParameter.hpp"
 # include "PredefinedNamedParameter.hpp"
@@ -1010,6 +1011,17 @@ namespace s3d
 		/// @return *this
 		const RectF& drawShadow(const Vec2& offset, double blur, double spread = 0.0, const ColorF& color = ColorF{ 0.0, 0.5 }, bool fill = true) const;
 
+		/// @brief 複数の長方形をまとめて描きます。
+		/// @param rects 長方形の配列
+		/// @param color 色
+		/// @remark 1 つずつ `draw()` を呼ぶよりも、1 個あたりのオーバーヘッドが小さくなります。
+		static void DrawBatch(const Array<RectF>& rects, const ColorF& color = Palette::White);
+
+		/// @brief 複数の長方形をそれぞれの色でまとめて描きます。
+		/// @param rects 長方形の配列
+		/// @param colors 長方形ごとの色。`rects` と同じ要素数である必要があります。
+		static void DrawBatch(const Array<RectF>& rects, const Array<ColorF>& colors);
+
 		[[nodiscard]]
 		TexturedQuad operator ()(const Texture& texture) const;
 
@@ -0,0 +1,56 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <functional>
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief エンジンのスレッドプールで実行するタスクのグループ | A group of tasks executed on the engine's thread pool
+	/// @remark スレッドプールが利用できない場合、タスクは `run()` の呼び出し時にその場で実行されます。 | If the thread pool is not available, tasks are executed immediately in `run()`.
+	class TaskGroup
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		TaskGroup();
+
+		/// @brief デストラクタ | Destructor
+		/// @remark 未完了のタスクの完了を待ちます。 | Waits for the pending tasks to complete.
+		~TaskGroup();
+
+		TaskGroup(const TaskGroup&) = delete;
+
+		TaskGroup& operator =(const TaskGroup&) = delete;
+
+		/// @brief タスクをスレッドプールに追加します。 | Adds a task to the thread pool.
+		/// @param task タスク | Task
+		void run(std::function<void()> task);
+
+		/// @brief 追加したすべてのタスクの完了を待ちます。 | Waits for all added tasks to complete.
+		/// @remark 待機中、呼び出し元のスレッドもキューのタスクを処理します。 | While waiting, the calling thread also processes queued tasks.
+		/// @remark タスクが例外を投げた場合、最初の例外を再送出します。 | If a task threw, the first exception is rethrown.
+		void wait();
+
+		/// @brief 未完了のタスクの数を返します。 | Returns the number of tasks that have not completed yet.
+		/// @return 未完了のタスクの数 | Number of tasks that have not completed yet
+		[[nodiscard]]
+		size_t num_pending() const noexcept;
+
+	private:
+
+		class TaskGroupDetail;
+
+		std::shared_ptr<TaskGroupDetail> pImpl;
+	};
+}
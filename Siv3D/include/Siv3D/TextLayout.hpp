@@ -0,0 +1,159 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "Font.hpp"
+# include "TextStyle.hpp"
+# include "GlyphCluster.hpp"
+# include "2DShapes.hpp"
+
+namespace s3d
+{
+	/// @brief 整形と行の配置を済ませたテキスト
+	/// @remark 一度作成すれば、何度描画してもテキストの整形や領域の計算を繰り返しません。
+	/// @remark 同じテキストを毎フレーム描画する場合に、`Font::operator()` で `DrawableText` を毎回作成するよりも効率的です。
+	class TextLayout
+	{
+	public:
+
+		/// @brief テキストの 1 行
+		struct Line
+		{
+			/// @brief 行の最初のグリフクラスタのインデックス
+			size_t clusterBegin = 0;
+
+			/// @brief 行の最後のグリフクラスタの次のインデックス
+			size_t clusterEnd = 0;
+
+			/// @brief テキストの左上を原点とした行の領域
+			RectF region{ 0, 0, 0, 0 };
+		};
+
+		SIV3D_NODISCARD_CXX20
+		TextLayout() = default;
+
+		/// @brief テキストを整形して配置します。
+		/// @param font フォント
+		/// @param text テキスト
+		SIV3D_NODISCARD_CXX20
+		TextLayout(const Font& font, String text);
+
+		/// @brief テキストを整形して配置します。
+		/// @param font フォント
+		/// @param text テキスト
+		/// @param fontSize 描画するフォントの大きさ
+		/// @param lineHeightScale 行の高さの倍率
+		SIV3D_NODISCARD_CXX20
+		TextLayout(const Font& font, String text, double fontSize, double lineHeightScale = 1.0);
+
+		/// @brief テキストが空であるかを返します。
+		/// @return テキストが空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief テキストが空でないかを返します。
+		/// @return テキストが空でない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief フォントを返します。
+		/// @return フォント
+		[[nodiscard]]
+		const Font& font() const noexcept;
+
+		/// @brief テキストを返します。
+		/// @return テキスト
+		[[nodiscard]]
+		const String& text() const noexcept;
+
+		/// @brief 整形したグリフクラスタを返します。
+		/// @return グリフクラスタ
+		[[nodiscard]]
+		const Array<GlyphCluster>& clusters() const noexcept;
+
+		/// @brief 描画するフォントの大きさを返します。
+		/// @return 描画するフォントの大きさ
+		[[nodiscard]]
+		double fontSize() const noexcept;
+
+		/// @brief 行の高さの倍率を返します。
+		/// @return 行の高さの倍率
+		[[nodiscard]]
+		double lineHeightScale() const noexcept;
+
+		/// @brief 各行の配置を返します。
+		/// @return 各行の配置
+		[[nodiscard]]
+		const Array<Line>& lines() const noexcept;
+
+		/// @brief テキスト全体の大きさを返します。
+		/// @return テキスト全体の大きさ
+		[[nodiscard]]
+		SizeF size() const noexcept;
+
+		/// @brief テキストが描画される領域を返します。
+		/// @param pos 描画する左上の座標
+		/// @return テキストが描画される領域
+		[[nodiscard]]
+		RectF region(const Vec2& pos = Vec2{ 0, 0 }) const noexcept;
+
+		/// @brief テキストが描画される領域を返します。
+		/// @param center 描画する中心の座標
+		/// @return テキストが描画される領域
+		[[nodiscard]]
+		RectF regionAt(const Vec2& center) const noexcept;
+
+		/// @brief テキストを描画します。
+		/// @param pos 描画する左上の座標
+		/// @param color テキストの色
+		/// @return テキストが描画された領域
+		RectF draw(const Vec2& pos = Vec2{ 0, 0 }, const ColorF& color = Palette::White) const;
+
+		/// @brief テキストを描画します。
+		/// @param textStyle テキストのスタイル
+		/// @param pos 描画する左上の座標
+		/// @param color テキストの色
+		/// @return テキストが描画された領域
+		RectF draw(const TextStyle& textStyle, const Vec2& pos = Vec2{ 0, 0 }, const ColorF& color = Palette::White) const;
+
+		/// @brief 中心の座標を指定してテキストを描画します。
+		/// @param center 描画する中心の座標
+		/// @param color テキストの色
+		/// @return テキストが描画された領域
+		RectF drawAt(const Vec2& center, const ColorF& color = Palette::White) const;
+
+		/// @brief 中心の座標を指定してテキストを描画します。
+		/// @param textStyle テキストのスタイル
+		/// @param center 描画する中心の座標
+		/// @param color テキストの色
+		/// @return テキストが描画された領域
+		RectF drawAt(const TextStyle& textStyle, const Vec2& center, const ColorF& color = Palette::White) const;
+
+	private:
+
+		Font m_font;
+
+		String m_text;
+
+		Array<GlyphCluster> m_clusters;
+
+		double m_fontSize = 0.0;
+
+		double m_lineHeightScale = 1.0;
+
+		Array<Line> m_lines;
+
+		SizeF m_size{ 0, 0 };
+	};
+}
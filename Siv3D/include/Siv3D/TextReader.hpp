@@ -122,6 +122,13 @@ namespace s3d
 		/// @return 読み込みに成功した場合 true, ファイルの終端や失敗の場合は false
 		bool readAll(String& s);
 
+		/// @brief テキストファイルの残りをすべて読み込み、各行を指す StringView の配列を作成します。
+		/// @param buffer 読み込んだテキストの格納先
+		/// @param lines 各行の格納先。buffer の中を指します
+		/// @remark 行ごとに String を作成しないため、`readLines()` より効率的です。lines は buffer を変更するまで有効です。
+		/// @return 1 行以上読み込んだ場合 true, ファイルの終端や失敗の場合は false
+		bool readLineViews(String& buffer, Array<StringView>& lines);
+
 		/// @brief テキストのエンコーディング形式を返します。
 		/// @return テキストのエンコーディング形式
 		[[nodiscard]]
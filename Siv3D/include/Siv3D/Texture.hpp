@@ -37,6 +37,12 @@ namespace s3d
 	{
 	public:
 
+		/// @brief GPU への転送を後のフレームで行うテクスチャを作成するためのタグ型
+		struct DeferredUpload {};
+
+		/// @brief GPU への転送を後のフレームで行うテクスチャを作成するためのタグ
+		static constexpr DeferredUpload Deferred{};
+
 		SIV3D_NODISCARD_CXX20
 		Texture();
 
@@ -75,6 +81,14 @@ namespace s3d
 		SIV3D_NODISCARD_CXX20
 		explicit Texture(const Icon& icon, int32 size, TextureDesc desc = TextureDesc::Mipped);
 
+		/// @brief 画像からテクスチャを作成します。GPU への転送は後のフレームで、1 フレームあたりの転送量を制限しながら行われます。
+		/// @param image 画像
+		/// @param desc テクスチャの設定
+		/// @remark 任意のスレッドから呼べます。転送が完了するまで `isReady()` は false を返します。
+		/// @remark 1 フレームあたりの転送量は `Asset::SetUploadBudget()` で設定します。
+		SIV3D_NODISCARD_CXX20
+		Texture(DeferredUpload, Image&& image, TextureDesc desc = TextureDesc::Unmipped);
+
 		virtual ~Texture();
 
 		/// @brief テクスチャの幅（ピクセル）を返します。
@@ -122,6 +136,11 @@ namespace s3d
 		[[nodiscard]]
 		bool hasDepth() const;
 
+		/// @brief GPU への転送が完了しているかを返します。
+		/// @return 転送が完了している場合 true, `Texture::Deferred` で作成したテクスチャの転送がまだ完了していない場合は false
+		[[nodiscard]]
+		bool isReady() const;
+
 		[[nodiscard]]
 		Rect region(int32 x, int32 y) const;
 
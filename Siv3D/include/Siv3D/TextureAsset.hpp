@@ -75,6 +75,16 @@ namespace s3d
 		/// @param name テクスチャアセット名
 		static void LoadAsync(AssetNameView name);
 
+		/// @brief 優先度を指定して、指定したテクスチャアセットの非同期ロードを開始します。
+		/// @param name テクスチャアセット名
+		/// @param priority 優先度
+		static void LoadAsync(AssetNameView name, AssetLoadPriority priority);
+
+		/// @brief 指定したテクスチャアセットの、開始していない非同期ロードを取り消します。
+		/// @param name テクスチャアセット名
+		/// @return 取り消した場合 true, それ以外の場合は false
+		static bool CancelLoadAsync(AssetNameView name);
+
 		/// @brief 指定したテクスチャアセットのロードが完了するまで待機します。
 		/// @param name テクスチャアセット名
 		static void Wait(AssetNameView name);
@@ -87,6 +97,7 @@ namespace s3d
 
 		/// @brief 指定したテクスチャアセットについて、ロードしたデータをメモリ上から削除します。登録状態は維持されます。
 		/// @param name テクスチャアセット名
+		/// @remark 非同期ロードが開始していない場合は、ロードを取り消します。
 		static void Release(AssetNameView name);
 
 		/// @brief すべてのテクスチャアセットについて、ロードしたデータをメモリ上から削除します。登録状態は維持されます。
@@ -15,7 +15,7 @@
 # include "Texture.hpp"
 # include "Emoji.hpp"
 # include "Icon.hpp"
-# include "AsyncTask.hpp"
+# include "Blob.hpp"
 
 namespace s3d
 {
@@ -76,6 +76,7 @@ namespace s3d
 
 	private:
 
-		AsyncTask<void> m_task;
+		// I/O ステージで読み込んだファイルの内容
+		Blob m_fileData;
 	};
 }
@@ -10,6 +10,9 @@
 //-----------------------------------------------
 
 # pragma once
+# include <functional>
+# include <type_traits>
+# include "Common.hpp"
 
 namespace s3d
 {
@@ -19,5 +22,28 @@ namespace s3d
 		/// @return サポートされるスレッド数 | Number of concurrent threads supported
 		[[nodiscard]]
 		size_t GetConcurrency() noexcept;
+
+		/// @brief エンジンのスレッドプールのワーカースレッド数を返します。 | Returns the number of worker threads in the engine's thread pool.
+		/// @return ワーカースレッド数。スレッドプールが利用できない場合は 0 | Number of worker threads, or 0 if the thread pool is not available
+		[[nodiscard]]
+		size_t GetWorkerCount() noexcept;
+
+		/// @brief インデックスの範囲 [beginIndex, endIndex) を分割し、エンジンのスレッドプールで並列に処理します。 | Splits the index range [beginIndex, endIndex) and processes it in parallel on the engine's thread pool.
+		/// @tparam Fty 処理する関数の型 | Function type
+		/// @param beginIndex 開始インデックス | Begin index
+		/// @param endIndex 終了インデックス | End index
+		/// @param f `f(index)` または `f(chunkBegin, chunkEnd)` の形式で呼ばれる関数 | Function called as `f(index)` or `f(chunkBegin, chunkEnd)`
+		/// @param grainSize 1 回のタスクで処理するインデックスの最小数。0 の場合は自動で決定 | Minimum number of indices processed per task. If 0, it is determined automatically
+		/// @remark 呼び出し元のスレッドも処理に参加し、すべての処理が完了するまで戻りません。 | The calling thread also participates and does not return until all work is done.
+		/// @remark 関数が例外を投げた場合、最初の例外が呼び出し元で再送出されます。 | If the function throws, the first exception is rethrown on the calling thread.
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t> || std::is_invocable_v<Fty, size_t, size_t>>* = nullptr>
+		void ParallelFor(size_t beginIndex, size_t endIndex, Fty f, size_t grainSize = 0);
+
+		namespace detail
+		{
+			void ParallelForImpl(size_t beginIndex, size_t endIndex, const std::function<void(size_t, size_t)>& f, size_t grainSize);
+		}
 	}
 }
+
+# include "detail/Threading.ipp"
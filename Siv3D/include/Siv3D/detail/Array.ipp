@@ -1541,191 +1541,42 @@ namespace s3d
 
 	template <class Type, class Allocator>
 	template <class Fty, std::enable_if_t<std::is_invocable_r_v<bool, Fty, Type>>*>
-	inline size_t Array<Type, Allocator>::parallel_count_if(Fty f) const
+	inline size_t Array<Type, Allocator>::parallel_count_if(Fty f, const size_t grainSize) const
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
+		std::atomic<size_t> result = 0;
 
-		return std::count_if(std::execution::par, begin(), end(), f);
-
-	# else
-
-		if (isEmpty())
-		{
-			return 0;
-		}
-
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return count_if(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
+		Threading::ParallelFor(0, size(), [this, &f, &result](const size_t chunkBegin, const size_t chunkEnd)
 		{
-			const size_t n = Min(countPerthread, countLeft);
+			const size_t n = static_cast<size_t>(std::count_if((begin() + chunkBegin), (begin() + chunkEnd), f));
+			result.fetch_add(n, std::memory_order_relaxed);
+		}, grainSize);
 
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				return std::count_if(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		size_t result = 0;
-		
-		if (countLeft)
-		{
-			result = std::count_if(it, it + countLeft, f);
-		}
-
-		for (auto& future : futures)
-		{
-			result += future.get();
-		}
-
-		return result;
-
-	# endif
+		return result.load();
 	}
 
 	template <class Type, class Allocator>
 	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type&>>*>
-	inline void Array<Type, Allocator>::parallel_each(Fty f)
+	inline void Array<Type, Allocator>::parallel_each(Fty f, const size_t grainSize)
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
-
-		std::for_each(std::execution::par, begin(), end(), f);
-
-	# else
-
-		if (isEmpty())
-		{
-			return;
-		}
-
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
+		Threading::ParallelFor(0, size(), [this, &f](const size_t chunkBegin, const size_t chunkEnd)
 		{
-			return each(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				std::for_each(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
-		{
-			std::for_each(it, it + countLeft, f);
-		}
-
-		for (auto& future : futures)
-		{
-			future.get();
-		}
-
-	# endif
+			std::for_each((begin() + chunkBegin), (begin() + chunkEnd), f);
+		}, grainSize);
 	}
 
 	template <class Type, class Allocator>
 	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>*>
-	inline void Array<Type, Allocator>::parallel_each(Fty f) const
+	inline void Array<Type, Allocator>::parallel_each(Fty f, const size_t grainSize) const
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
-
-		std::for_each(std::execution::par, begin(), end(), f);
-
-	# else
-
-		if (isEmpty())
-		{
-			return;
-		}
-
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return each(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				std::for_each(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
+		Threading::ParallelFor(0, size(), [this, &f](const size_t chunkBegin, const size_t chunkEnd)
 		{
-			std::for_each(it, it + countLeft, f);
-		}
-
-		for (auto& future : futures)
-		{
-			future.get();
-		}
-
-	# endif
+			std::for_each((begin() + chunkBegin), (begin() + chunkEnd), f);
+		}, grainSize);
 	}
 
 	template <class Type, class Allocator>
 	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>*>
-	inline auto Array<Type, Allocator>::parallel_map(Fty f) const
+	inline auto Array<Type, Allocator>::parallel_map(Fty f, const size_t grainSize) const
 	{
 		using Ret = std::remove_cvref_t<decltype(f((*this)[0]))>;
 
@@ -1734,61 +1585,19 @@ namespace s3d
 			return Array<Ret>{};
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return map(f);
-		}
-
 		Array<Ret> new_array(size());
 
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<void>> futures;
-
-		auto itDst = new_array.begin();
-		auto itSrc = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
+		Threading::ParallelFor(0, size(), [this, &f, &new_array](const size_t chunkBegin, const size_t chunkEnd)
 		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-			{
-				const auto itSrcEnd = itSrc + n;
-
-				while (itSrc != itSrcEnd)
-				{
-					*itDst++ = f(*itSrc++);
-				}
-			}));
-
-			itDst += n;
-			itSrc += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
-		{
-			const auto itSrcEnd = end();
+			auto itDst = (new_array.begin() + chunkBegin);
+			auto itSrc = (begin() + chunkBegin);
+			const auto itSrcEnd = (begin() + chunkEnd);
 
 			while (itSrc != itSrcEnd)
 			{
 				*itDst++ = f(*itSrc++);
 			}
-		}
-
-		for (auto& future : futures)
-		{
-			future.get();
-		}
+		}, grainSize);
 
 		return new_array;
 	}
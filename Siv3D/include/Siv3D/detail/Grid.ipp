@@ -1001,6 +1001,44 @@ namespace s3d
 		return std::none_of(begin(), end(), f);
 	}
 
+# ifndef SIV3D_NO_CONCURRENT_API
+
+	template <class Type, class Allocator>
+	template <class Fty, std::enable_if_t<std::is_invocable_r_v<bool, Fty, Type>>*>
+	inline size_t Grid<Type, Allocator>::parallel_count_if(Fty f, const size_t grainSize) const
+	{
+		return m_data.parallel_count_if(std::move(f), grainSize);
+	}
+
+	template <class Type, class Allocator>
+	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type&>>*>
+	inline Grid<Type, Allocator>& Grid<Type, Allocator>::parallel_each(Fty f, const size_t grainSize)
+	{
+		m_data.parallel_each(std::move(f), grainSize);
+
+		return *this;
+	}
+
+	template <class Type, class Allocator>
+	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>*>
+	inline const Grid<Type, Allocator>& Grid<Type, Allocator>::parallel_each(Fty f, const size_t grainSize) const
+	{
+		m_data.parallel_each(std::move(f), grainSize);
+
+		return *this;
+	}
+
+	template <class Type, class Allocator>
+	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>*>
+	inline auto Grid<Type, Allocator>::parallel_map(Fty f, const size_t grainSize) const
+	{
+		using ResultType = std::remove_cvref_t<decltype(f(m_data[0]))>;
+
+		return Grid<ResultType>(m_width, m_height, m_data.parallel_map(std::move(f), grainSize));
+	}
+
+# endif
+
 	template <class Type, class Allocator>
 	template <class Fty, class R>
 	inline auto Grid<Type, Allocator>::reduce(Fty f, R init) const
@@ -37,6 +37,18 @@ namespace s3d
 		return decode(reader, path);
 	}
 
+	inline bool IImageDecoder::decodeInto(IReader& reader, const FilePathView pathHint, Image& image) const
+	{
+		image = decode(reader, pathHint);
+
+		return (not image.isEmpty());
+	}
+
+	inline Image IImageDecoder::decodeReduced(IReader& reader, const FilePathView pathHint, const Size&) const
+	{
+		return decode(reader, pathHint);
+	}
+
 	inline Grid<uint16> IImageDecoder::decodeGray16(const FilePathView path) const
 	{
 		BinaryReader reader{ path };
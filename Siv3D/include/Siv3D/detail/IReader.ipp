@@ -24,4 +24,14 @@ namespace s3d
 	{
 		return (lookahead(std::addressof(dst), sizeof(TriviallyCopyable)) == sizeof(TriviallyCopyable));
 	}
+
+	inline bool IReader::supportsReadView() const noexcept
+	{
+		return false;
+	}
+
+	inline std::span<const Byte> IReader::readView(int64)
+	{
+		return{};
+	}
 }
@@ -0,0 +1,42 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	namespace Threading
+	{
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t> || std::is_invocable_v<Fty, size_t, size_t>>*>
+		inline void ParallelFor(const size_t beginIndex, const size_t endIndex, Fty f, const size_t grainSize)
+		{
+			if (endIndex <= beginIndex)
+			{
+				return;
+			}
+
+			if constexpr (std::is_invocable_v<Fty, size_t, size_t>)
+			{
+				detail::ParallelForImpl(beginIndex, endIndex, std::ref(f), grainSize);
+			}
+			else
+			{
+				detail::ParallelForImpl(beginIndex, endIndex, [&f](const size_t chunkBegin, const size_t chunkEnd)
+				{
+					for (size_t i = chunkBegin; i < chunkEnd; ++i)
+					{
+						f(i);
+					}
+				}, grainSize);
+			}
+		}
+	}
+}
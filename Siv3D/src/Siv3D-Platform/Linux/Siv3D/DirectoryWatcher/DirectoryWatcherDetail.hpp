@@ -11,6 +11,7 @@
 
 # pragma once
 # include <climits>
+# include <thread>
 # include <Siv3D/DirectoryWatcher.hpp>
 # include <sys/inotify.h>
 # include <boost/bimap.hpp>
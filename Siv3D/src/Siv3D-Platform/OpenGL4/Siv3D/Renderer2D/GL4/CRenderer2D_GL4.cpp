@@ -16,6 +16,7 @@
 # include <Siv3D/ScopeGuard.hpp>
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/ShaderCommon.hpp>
+# include <Siv3D/ProfileZone.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include <Siv3D/Renderer/GL4/CRenderer_GL4.hpp>
 # include <Siv3D/Shader/GL4/CShader_GL4.hpp>
@@ -243,6 +244,42 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_GL4::addRects(const RectF* rects, size_t count, const ColorF* colors, const Float4& color)
+	{
+		while (count)
+		{
+			size_t numBuilt = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildRects(m_bufferCreator, rects, count, colors, color, numBuilt))
+			{
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
+
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->shapeID);
+				}
+
+				m_commandManager.pushDraw(indexCount);
+			}
+
+			if (numBuilt == 0)
+			{
+				break;
+			}
+
+			rects += numBuilt;
+			count -= numBuilt;
+
+			if (colors)
+			{
+				colors += numBuilt;
+			}
+		}
+	}
+
 	void CRenderer2D_GL4::addRectFrame(const FloatRect& rect, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
 		if (const auto indexCount = Vertex2DBuilder::BuildRectFrame(m_bufferCreator, rect, thickness, innerColor, outerColor))
@@ -297,6 +334,44 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_GL4::addCircles(const Circle* circles, size_t count, const ColorF* colors, const Float4& color)
+	{
+		const float scale = getMaxScaling();
+
+		while (count)
+		{
+			size_t numBuilt = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildCircles(m_bufferCreator, circles, count, colors, color, scale, numBuilt))
+			{
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
+
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->shapeID);
+				}
+
+				m_commandManager.pushDraw(indexCount);
+			}
+
+			if (numBuilt == 0)
+			{
+				break;
+			}
+
+			circles += numBuilt;
+			count -= numBuilt;
+
+			if (colors)
+			{
+				colors += numBuilt;
+			}
+		}
+	}
+
 	void CRenderer2D_GL4::addCircleFrame(const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
 		if (const auto indexCount = Vertex2DBuilder::BuildCircleFrame(m_bufferCreator, center, rInner, thickness, innerColor, outerColor, getMaxScaling()))
@@ -802,25 +877,41 @@ namespace s3d
 		}
 	}
 
-	void CRenderer2D_GL4::addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
-		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
-		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
+	void CRenderer2D_GL4::addParticles(const Particle2DBuffer& particles, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
 	{
-		if (const auto indexCount = Vertex2DBuilder::BuildTexturedParticles(m_bufferCreator, particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc))
-		{
-			if (not m_currentCustomVS)
+		Vertex2DBuilder::BuildParticles(m_bufferCreator, particles, colorOverLifeTimeFunc, [&](const Vertex2D::IndexType indexCount)
 			{
-				m_commandManager.pushStandardVS(m_standardVS->spriteID);
-			}
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
 
-			if (not m_currentCustomPS)
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->shapeID);
+				}
+
+				m_commandManager.pushDraw(indexCount);
+			});
+	}
+
+	void CRenderer2D_GL4::addTexturedParticles(const Texture& texture, const Particle2DBuffer& particles, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
+	{
+		Vertex2DBuilder::BuildParticles(m_bufferCreator, particles, colorOverLifeTimeFunc, [&](const Vertex2D::IndexType indexCount)
 			{
-				m_commandManager.pushStandardPS(m_standardPS->textureID);
-			}
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
 
-			m_commandManager.pushPSTexture(0, texture);
-			m_commandManager.pushDraw(indexCount);
-		}
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->textureID);
+				}
+
+				m_commandManager.pushPSTexture(0, texture);
+				m_commandManager.pushDraw(indexCount);
+			});
 	}
 
 	Float4 CRenderer2D_GL4::getColorMul() const
@@ -1064,6 +1155,8 @@ namespace s3d
 
 	void CRenderer2D_GL4::flush()
 	{
+		SIV3D_PROFILE_SCOPE(U"Renderer2D::flush");
+
 		ScopeGuard cleanUp = [this]()
 		{
 			m_batches.reset();
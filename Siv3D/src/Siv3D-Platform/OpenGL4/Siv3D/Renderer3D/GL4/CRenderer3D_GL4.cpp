@@ -54,6 +54,7 @@ namespace s3d
 			LOG_INFO(U"📦 Loading vertex shaders for CRenderer3D_GL4:");
 			m_standardVS = std::make_unique<GL4StandardVS3D>();
 			m_standardVS->forward = GLSL{ Resource(U"engine/shader/glsl/forward3d.vert"), { { U"VSPerView", 1 }, { U"VSPerObject", 2 }, { U"VSPerMaterial", 3 } } };
+			m_standardVS->forwardInstanced = GLSL{ Resource(U"engine/shader/glsl/forward3d_instanced.vert"), { { U"VSPerView", 1 }, { U"VSPerMaterial", 3 }, { U"VSPerInstance", 4 } } };
 			m_standardVS->line3D = GLSL{ Resource(U"engine/shader/glsl/line3d.vert"), { { U"VSPerView", 1 }, { U"VSPerObject", 2 } } };
 
 			if (not m_standardVS->setup())
@@ -67,6 +68,7 @@ namespace s3d
 			LOG_INFO(U"📦 Loading pixel shaders for CRenderer3D_GL4:");
 			m_standardPS = std::make_unique<GL4StandardPS3D>();
 			m_standardPS->forward = GLSL{ Resource(U"engine/shader/glsl/forward3d.frag"), { { U"PSPerFrame", 0 }, { U"PSPerView", 1 }, { U"PSPerMaterial", 3 } } };
+			m_standardPS->forwardInstanced = GLSL{ Resource(U"engine/shader/glsl/forward3d_instanced.frag"), { { U"PSPerFrame", 0 }, { U"PSPerView", 1 }, { U"PSPerMaterial", 3 } } };
 			m_standardPS->line3D = GLSL{ Resource(U"engine/shader/glsl/line3d.frag"), {} };
 
 			if (not m_standardPS->setup())
@@ -157,6 +159,53 @@ namespace s3d
 		m_commandManager.pushDraw(startIndex, indexCount, phong, instanceCount);
 	}
 
+	void CRenderer3D_GL4::addMeshInstances(const uint32 startIndex, const uint32 indexCount, const Mesh& mesh, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, const size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		const bool instancing = pushInstancingShaders(colors != nullptr);
+
+		m_commandManager.pushInputLayout(GL4InputLayout3D::Mesh);
+		m_commandManager.pushMesh(mesh);
+		m_commandManager.pushUVTransform(Float4{ 1.0f, 1.0f, 0.0f, 0.0f });
+
+		if (instancing)
+		{
+			m_commandManager.pushDrawInstanced(startIndex, indexCount, PhongMaterialInternal{ material }, transforms, colors, static_cast<uint32>(count));
+		}
+		else
+		{
+			pushInstances(startIndex, indexCount, material, transforms, colors, count);
+		}
+	}
+
+	void CRenderer3D_GL4::addTexturedMeshInstances(const uint32 startIndex, const uint32 indexCount, const Mesh& mesh, const Texture& texture, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, const size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		const bool instancing = pushInstancingShaders(colors != nullptr);
+
+		m_commandManager.pushInputLayout(GL4InputLayout3D::Mesh);
+		m_commandManager.pushMesh(mesh);
+		m_commandManager.pushUVTransform(Float4{ 1.0f, 1.0f, 0.0f, 0.0f });
+		m_commandManager.pushPSTexture(0, texture);
+
+		if (instancing)
+		{
+			m_commandManager.pushDrawInstanced(startIndex, indexCount, PhongMaterialInternal{ material }, transforms, colors, static_cast<uint32>(count));
+		}
+		else
+		{
+			pushInstances(startIndex, indexCount, material, transforms, colors, count);
+		}
+	}
+
 	void CRenderer3D_GL4::addLine3D(const Float3& begin, const Float3& end, const Float4(&colors)[2])
 	{
 		constexpr VertexLine3D::IndexType vertexSize = 2, indexSize = 2;
@@ -447,6 +496,7 @@ namespace s3d
 		pShader->setConstantBufferVS(1, m_vsPerViewConstants.base());
 		pShader->setConstantBufferVS(2, m_vsPerObjectConstants.base());
 		pShader->setConstantBufferVS(3, m_vsPerMaterialConstants.base());
+		pShader->setConstantBufferVS(4, m_vsPerInstanceConstants.base());
 		pShader->setConstantBufferPS(0, m_psPerFrameConstants.base());
 		pShader->setConstantBufferPS(1, m_psPerViewConstants.base());
 		pShader->setConstantBufferPS(3, m_psPerMaterialConstants.base());
@@ -503,6 +553,42 @@ namespace s3d
 					LOG_COMMAND(U"Draw[{}] indexCount = {}, startIndexLocation = {}"_fmt(command.index, indexCount, startIndexLocation));
 					break;
 				}
+			case GL4Renderer3DCommandType::DrawInstanced:
+				{
+					const GL4DrawInstanced3DCommand& draw = m_commandManager.getDrawInstanced(command.index);
+					const uint32 indexCount = draw.indexCount;
+					const uint32 startIndexLocation = draw.startIndex;
+					const Mat4x4* localToWorlds = m_commandManager.getInstanceLocalToWorlds(draw.firstInstance);
+					const Float4* diffuseColors = m_commandManager.getInstanceDiffuseColors(draw.firstInstance);
+
+					m_psPerMaterialConstants->material = m_commandManager.getDrawInstancedPhongMaterial(command.index);
+
+					m_vsPerViewConstants._update_if_dirty();
+					m_vsPerMaterialConstants._update_if_dirty();
+					m_psPerFrameConstants._update_if_dirty();
+					m_psPerViewConstants._update_if_dirty();
+					m_psPerMaterialConstants._update_if_dirty();
+
+					// カスタムの定数バッファで上書きされている可能性があるので、毎回設定しなおす
+					pShader->setConstantBufferVS(4, m_vsPerInstanceConstants.base());
+
+					constexpr Vertex3D::IndexType* pBase = 0;
+
+					// uniform block に収まる数ずつ、インスタンス描画する
+					for (uint32 offset = 0; offset < draw.instanceCount; offset += VSPerInstanceConstants3D::MaxInstances)
+					{
+						const uint32 instanceCount = Min((draw.instanceCount - offset), VSPerInstanceConstants3D::MaxInstances);
+
+						std::copy_n((localToWorlds + offset), instanceCount, m_vsPerInstanceConstants->localToWorld);
+						std::copy_n((diffuseColors + offset), instanceCount, m_vsPerInstanceConstants->diffuseColor);
+						m_vsPerInstanceConstants._update_if_dirty();
+
+						::glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (pBase + startIndexLocation), instanceCount);
+					}
+
+					LOG_COMMAND(U"DrawInstanced[{}] indexCount = {}, startIndexLocation = {}, instanceCount = {}"_fmt(command.index, indexCount, startIndexLocation, draw.instanceCount));
+					break;
+				}
 			case GL4Renderer3DCommandType::DrawLine3D:
 				{
 					m_line3DBatch.setBuffers();
@@ -846,4 +932,55 @@ namespace s3d
 
 		CheckOpenGLError();
 	}
+
+	bool CRenderer3D_GL4::pushInstancingShaders(const bool hasColors)
+	{
+		// カスタム VS はインスタンスごとの座標変換を、カスタム PS はインスタンスごとの色を受け取れないので、1 つずつ描画する
+		if (m_currentCustomVS || (m_currentCustomPS && hasColors))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->forwardID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->forwardID);
+			}
+
+			return false;
+		}
+
+		m_commandManager.pushStandardVS(m_standardVS->forwardInstancedID);
+
+		if (not m_currentCustomPS)
+		{
+			m_commandManager.pushStandardPS(m_standardPS->forwardInstancedID);
+		}
+
+		return true;
+	}
+
+	void CRenderer3D_GL4::pushInstances(const uint32 startIndex, const uint32 indexCount, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, const size_t count)
+	{
+		// シェーダやメッシュの設定は共有し、インスタンスごとに座標変換とマテリアルの色だけを変える
+		const Mat4x4 baseTransform = m_commandManager.getCurrentLocalTransform();
+
+		PhongMaterialInternal phong{ material };
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			m_commandManager.pushLocalTransform(transforms[i] * baseTransform);
+
+			if (colors)
+			{
+				phong.diffuseColor = colors[i].toFloat4();
+			}
+
+			const uint32 instanceCount = 1;
+			m_commandManager.pushDraw(startIndex, indexCount, phong, instanceCount);
+		}
+
+		m_commandManager.pushLocalTransform(baseTransform);
+	}
 }
@@ -29,16 +29,19 @@ namespace s3d
 	struct GL4StandardVS3D
 	{
 		VertexShader forward;
+		VertexShader forwardInstanced;
 		VertexShader line3D;
 
 		VertexShader::IDType forwardID;
+		VertexShader::IDType forwardInstancedID;
 		VertexShader::IDType line3DID;
 
 		bool setup()
 		{
-			const bool result = (forward && line3D);
+			const bool result = (forward && forwardInstanced && line3D);
 
 			forwardID = forward.id();
+			forwardInstancedID = forwardInstanced.id();
 			line3DID = line3D.id();
 
 			return result;
@@ -48,16 +51,19 @@ namespace s3d
 	struct GL4StandardPS3D
 	{
 		PixelShader forward;
+		PixelShader forwardInstanced;
 		PixelShader line3D;
 
 		PixelShader::IDType forwardID;
+		PixelShader::IDType forwardInstancedID;
 		PixelShader::IDType line3DID;
 
 		bool setup()
 		{
-			const bool result = forward && line3D;
+			const bool result = forward && forwardInstanced && line3D;
 
 			forwardID = forward.id();
+			forwardInstancedID = forwardInstanced.id();
 			line3DID = line3D.id();
 
 			return result;
@@ -82,6 +88,10 @@ namespace s3d
 
 		void addTexturedMesh(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const TextureRegion& textureRegion, const PhongMaterial& material) override;
 
+		void addMeshInstances(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, size_t count) override;
+
+		void addTexturedMeshInstances(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const Texture& texture, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, size_t count) override;
+
 		void addLine3D(const Float3& begin, const Float3& end, const Float4(&colors)[2]) override;
 
 
@@ -173,6 +183,7 @@ namespace s3d
 		ConstantBuffer<VSPerViewConstants3D> m_vsPerViewConstants;
 		ConstantBuffer<VSPerObjectConstants3D> m_vsPerObjectConstants;
 		ConstantBuffer<VSPerMaterialConstants3D> m_vsPerMaterialConstants;
+		ConstantBuffer<VSPerInstanceConstants3D> m_vsPerInstanceConstants;
 		ConstantBuffer<PSPerFrameConstants3D> m_psPerFrameConstants;
 		ConstantBuffer<PSPerViewConstants3D> m_psPerViewConstants;
 		ConstantBuffer<PSPerMaterialConstants3D> m_psPerMaterialConstants;
@@ -185,5 +196,10 @@ namespace s3d
 		Optional<PixelShader> m_currentCustomPS;
 
 		Renderer3DStat m_stat;
+
+		// インスタンス描画用のシェーダを設定する。カスタムシェーダが使えない場合は false を返す
+		bool pushInstancingShaders(bool hasColors);
+
+		void pushInstances(uint32 startIndex, uint32 indexCount, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, size_t count);
 	};
 }
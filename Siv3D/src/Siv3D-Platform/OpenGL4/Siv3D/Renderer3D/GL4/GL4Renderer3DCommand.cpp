@@ -47,6 +47,11 @@ namespace s3d
 			m_draws.clear();
 			m_drawPhongMaterials.clear();
 
+			m_drawInstanceds.clear();
+			m_drawInstancedPhongMaterials.clear();
+			m_instanceLocalToWorlds.clear();
+			m_instanceDiffuseColors.clear();
+
 			m_drawLine3Ds.clear();
 
 			//	m_nullDraws.clear();
@@ -377,6 +382,7 @@ namespace s3d
 	bool GL4Renderer3DCommandManager::hasDraw() const noexcept
 	{
 		return ((not m_draws.isEmpty())
+			|| (not m_drawInstanceds.isEmpty())
 			|| (not m_drawLine3Ds.isEmpty()));
 	}
 
@@ -425,6 +431,52 @@ namespace s3d
 		return m_drawPhongMaterials[index];
 	}
 
+	void GL4Renderer3DCommandManager::pushDrawInstanced(const uint32 startIndex, const uint32 indexCount, const PhongMaterialInternal& material, const Mat4x4* transforms, const ColorF* colors, const uint32 instanceCount)
+	{
+		if (m_changes.hasStateChange())
+		{
+			flush();
+		}
+
+		const uint32 firstInstance = static_cast<uint32>(m_instanceLocalToWorlds.size());
+
+		m_commands.emplace_back(GL4Renderer3DCommandType::DrawInstanced, static_cast<uint32>(m_drawInstanceds.size()));
+		m_drawInstanceds.push_back({ startIndex, indexCount, instanceCount, firstInstance });
+		m_drawInstancedPhongMaterials.push_back(material);
+
+		// シェーダに渡す形（転置済み）で保存する
+		m_instanceLocalToWorlds.reserve(m_instanceLocalToWorlds.size() + instanceCount);
+		m_instanceDiffuseColors.reserve(m_instanceDiffuseColors.size() + instanceCount);
+
+		for (uint32 i = 0; i < instanceCount; ++i)
+		{
+			m_instanceLocalToWorlds.push_back((transforms[i] * m_currentLocalTransform).transposed());
+			m_instanceDiffuseColors.push_back(colors ? colors[i].toFloat4() : material.diffuseColor);
+		}
+
+		m_changes.set(GL4Renderer3DCommandType::DrawInstanced);
+	}
+
+	const GL4DrawInstanced3DCommand& GL4Renderer3DCommandManager::getDrawInstanced(const uint32 index) const noexcept
+	{
+		return m_drawInstanceds[index];
+	}
+
+	const PhongMaterialInternal& GL4Renderer3DCommandManager::getDrawInstancedPhongMaterial(const uint32 index) const noexcept
+	{
+		return m_drawInstancedPhongMaterials[index];
+	}
+
+	const Mat4x4* GL4Renderer3DCommandManager::getInstanceLocalToWorlds(const uint32 firstInstance) const noexcept
+	{
+		return (m_instanceLocalToWorlds.data() + firstInstance);
+	}
+
+	const Float4* GL4Renderer3DCommandManager::getInstanceDiffuseColors(const uint32 firstInstance) const noexcept
+	{
+		return (m_instanceDiffuseColors.data() + firstInstance);
+	}
+
 	void GL4Renderer3DCommandManager::pushDrawLine3D(VertexLine3D::IndexType indexCount)
 	{
 		if (m_changes.hasStateChange())
@@ -40,6 +40,8 @@ namespace s3d
 
 		Draw,
 
+		DrawInstanced,
+
 		DrawLine3D,
 
 		BlendState,
@@ -166,6 +168,18 @@ namespace s3d
 		uint32 instanceCount = 0;
 	};
 
+	struct GL4DrawInstanced3DCommand
+	{
+		uint32 startIndex = 0;
+
+		uint32 indexCount = 0;
+
+		uint32 instanceCount = 0;
+
+		// インスタンスごとのデータの先頭位置
+		uint32 firstInstance = 0;
+	};
+
 	struct GL4DrawLine3DCommand
 	{
 		uint32 indexCount = 0;
@@ -201,6 +215,10 @@ namespace s3d
 		Array<GL4DrawLine3DCommand> m_drawLine3Ds;
 		//Array<uint32> m_nullDraws;
 		Array<PhongMaterialInternal> m_drawPhongMaterials;
+		Array<GL4DrawInstanced3DCommand> m_drawInstanceds;
+		Array<PhongMaterialInternal> m_drawInstancedPhongMaterials;
+		Array<Mat4x4> m_instanceLocalToWorlds;
+		Array<Float4> m_instanceDiffuseColors;
 		Array<BlendState> m_blendStates				= { BlendState::Default3D };
 		Array<RasterizerState> m_rasterizerStates	= { RasterizerState::Default3D };
 		Array<DepthStencilState> m_depthStencilStates = { DepthStencilState::Default3D };
@@ -286,6 +304,12 @@ namespace s3d
 		const GL4Draw3DCommand& getDraw(uint32 index) const noexcept;
 		const PhongMaterialInternal& getDrawPhongMaterial(uint32 index) const noexcept;
 
+		void pushDrawInstanced(uint32 startIndex, uint32 indexCount, const PhongMaterialInternal& material, const Mat4x4* transforms, const ColorF* colors, uint32 instanceCount);
+		const GL4DrawInstanced3DCommand& getDrawInstanced(uint32 index) const noexcept;
+		const PhongMaterialInternal& getDrawInstancedPhongMaterial(uint32 index) const noexcept;
+		const Mat4x4* getInstanceLocalToWorlds(uint32 firstInstance) const noexcept;
+		const Float4* getInstanceDiffuseColors(uint32 firstInstance) const noexcept;
+
 		void pushDrawLine3D(VertexLine3D::IndexType indexCount);
 		const GL4DrawLine3DCommand& getDrawLine3D(uint32 index) const noexcept;
 
@@ -27,6 +27,8 @@ namespace s3d
 	{
 		LOG_SCOPED_TRACE(U"CTexture_GL4::~CTexture_GL4()");
 
+		m_stagingRing.release();
+
 		m_textures.destroy();
 	}
 
@@ -53,15 +55,15 @@ namespace s3d
 		}
 	}
 
-	void CTexture_GL4::updateAsyncTextureLoad(const size_t maxUpdate)
+	size_t CTexture_GL4::updateAsyncTextureLoad(const size_t maxUploadBytes)
 	{
 		if (not isMainThread())
 		{
-			return;
+			return 0;
 		}
 
 		// 終了時は即座に全消去
-		if (maxUpdate == Largest<size_t>)
+		if (maxUploadBytes == Largest<size_t>)
 		{
 			std::lock_guard lock{ m_requestsMutex };
 
@@ -72,16 +74,28 @@ namespace s3d
 
 			m_requests.clear();
 
-			return;
+			{
+				std::lock_guard uploadsLock{ m_uploadsMutex };
+
+				m_pendingUploads.clear();
+			}
+
+			m_inFlightUploads.clear();
+
+			return 0;
 		}
 
 		std::lock_guard lock{ m_requestsMutex };
 
-		const size_t loadCount = Min(maxUpdate, m_requests.size());
+		size_t loadCount = 0;
 
-		for (size_t i = 0; i < loadCount; ++i)
+		size_t uploadedBytes = 0;
+
+		// 大きなテクスチャが永久に待たされないよう、予算に関わらず少なくとも 1 つは作成する
+		while ((loadCount < m_requests.size())
+			&& ((loadCount == 0) || (uploadedBytes < maxUploadBytes)))
 		{
-			auto& request = m_requests[i];
+			auto& request = m_requests[loadCount];
 
 			if (*request.pMipmaps)
 			{
@@ -92,10 +106,24 @@ namespace s3d
 				request.idResult.get() = create(*request.pImage, *request.pDesc);
 			}
 
+			uploadedBytes += request.pImage->size_bytes();
+
+			for (const auto& mipmap : *request.pMipmaps)
+			{
+				uploadedBytes += mipmap.size_bytes();
+			}
+
 			request.waiting.get() = false;
+
+			++loadCount;
 		}
 
 		m_requests.pop_front_N(loadCount);
+
+		// ピクセルバッファオブジェクトを経由した転送には、残りの予算を使う
+		const size_t remainingBytes = ((uploadedBytes < maxUploadBytes) ? (maxUploadBytes - uploadedBytes) : 0);
+
+		return (uploadedBytes + updateDeferredUploads(remainingBytes));
 	}
 
 	size_t CTexture_GL4::getTextureCount() const
@@ -299,6 +327,33 @@ namespace s3d
 		return m_textures.add(std::move(texture), info);
 	}
 
+	Texture::IDType CTexture_GL4::createDeferred(Image&& image, const TextureDesc desc)
+	{
+		if (not image)
+		{
+			return Texture::IDType::NullAsset();
+		}
+
+		// OpenGL の命令は発行しないので、任意のスレッドから作成できる。転送は updateAsyncTextureLoad() で行う
+		auto texture = std::make_unique<GL4Texture>(GL4Texture::Deferred{}, image.size(), desc);
+
+		const String info = U"(type: Default, size: {0}x{1}, format: {2})"_fmt(image.width(), image.height(), texture->getFormat().name());
+		const Texture::IDType id = m_textures.add(std::move(texture), info);
+
+		{
+			std::lock_guard lock{ m_uploadsMutex };
+
+			m_pendingUploads.push_back(PendingUpload{ id, std::move(image), false });
+		}
+
+		return id;
+	}
+
+	bool CTexture_GL4::isReady(const Texture::IDType handleID)
+	{
+		return m_textures[handleID]->isReady();
+	}
+
 	void CTexture_GL4::release(const Texture::IDType handleID)
 	{
 		m_textures.erase(handleID);
@@ -344,6 +399,36 @@ namespace s3d
 		return m_textures[handleID]->fillRegion(src, stride, rect, wait);
 	}
 
+	bool CTexture_GL4::fillAsync(const Texture::IDType handleID, Image&& image)
+	{
+		if (isReleased(handleID))
+		{
+			return false;
+		}
+
+		if (const GL4Texture* texture = m_textures[handleID];
+			(not texture->isDynamic()) || (texture->getSize() != image.size()))
+		{
+			return false;
+		}
+
+		std::lock_guard lock{ m_uploadsMutex };
+
+		// まだ転送していない更新があれば、新しい画像で置き換える
+		for (auto& upload : m_pendingUploads)
+		{
+			if (upload.fill && (upload.id == handleID))
+			{
+				upload.image = std::move(image);
+				return true;
+			}
+		}
+
+		m_pendingUploads.push_back(PendingUpload{ handleID, std::move(image), true });
+
+		return true;
+	}
+
 	void CTexture_GL4::clearRT(const Texture::IDType handleID, const ColorF& color)
 	{
 		m_textures[handleID]->clearRT(color);
@@ -413,4 +498,80 @@ namespace s3d
 
 		return result;
 	}
+
+	size_t CTexture_GL4::updateDeferredUploads(const size_t maxUploadBytes)
+	{
+		// 転送が完了したテクスチャを使用可能にする
+		m_inFlightUploads.remove_if([this](const InFlightUpload& upload)
+			{
+				if (not m_stagingRing.poll(upload.slot))
+				{
+					return false;
+				}
+
+				if (not isReleased(upload.id))
+				{
+					m_textures[upload.id]->finishDeferredUpload();
+				}
+
+				return true;
+			});
+
+		std::lock_guard lock{ m_uploadsMutex };
+
+		size_t uploadCount = 0;
+
+		size_t uploadedBytes = 0;
+
+		// 大きなテクスチャが永久に待たされないよう、予算に関わらず少なくとも 1 つは転送する
+		while ((uploadCount < m_pendingUploads.size())
+			&& ((uploadedBytes == 0) || (uploadedBytes < maxUploadBytes)))
+		{
+			const PendingUpload& upload = m_pendingUploads[uploadCount];
+
+			// 転送前に解放された
+			if (isReleased(upload.id))
+			{
+				++uploadCount;
+				continue;
+			}
+
+			const auto slot = m_stagingRing.stage(upload.image.data(), upload.image.size_bytes());
+
+			// 空いているステージングバッファが無い場合は次のフレームに回す
+			if (not slot)
+			{
+				break;
+			}
+
+			GL4Texture* texture = m_textures[upload.id];
+
+			const bool issued = (upload.fill ? texture->fillFromUnpackBuffer() : texture->createFromUnpackBuffer());
+
+			m_stagingRing.fence(*slot);
+
+			if (issued)
+			{
+				m_inFlightUploads.push_back(InFlightUpload{ upload.id, *slot });
+				uploadedBytes += upload.image.size_bytes();
+			}
+
+			++uploadCount;
+		}
+
+		if (uploadCount)
+		{
+			m_stagingRing.unbind();
+		}
+
+		m_pendingUploads.pop_front_N(uploadCount);
+
+		return uploadedBytes;
+	}
+
+	bool CTexture_GL4::isReleased(const Texture::IDType handleID) const
+	{
+		// 解放済みの ID は Null テクスチャを指す
+		return (m_textures[handleID] == m_textures[Texture::IDType::NullAsset()]);
+	}
 }
@@ -10,10 +10,12 @@
 //-----------------------------------------------
 
 # pragma once
+# include <thread>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Texture/ITexture.hpp>
 # include <Siv3D/AssetHandleManager/AssetHandleManager.hpp>
 # include "GL4Texture.hpp"
+# include "GL4StagingRing.hpp"
 
 namespace s3d
 {
@@ -27,7 +29,7 @@ namespace s3d
 
 		void init();
 
-		void updateAsyncTextureLoad(size_t maxUpdate) override;
+		size_t updateAsyncTextureLoad(size_t maxUploadBytes) override;
 
 		size_t getTextureCount() const override;
 
@@ -51,6 +53,10 @@ namespace s3d
 
 		Texture::IDType createMSRT(const Size& size, const TextureFormat& format, HasDepth hasDepth, HasMipMap hasMipMap) override;
 
+		Texture::IDType createDeferred(Image&& image, TextureDesc desc) override;
+
+		bool isReady(Texture::IDType handleID) override;
+
 		void release(Texture::IDType handleID) override;
 
 		Size getSize(Texture::IDType handleID) override;
@@ -69,6 +75,8 @@ namespace s3d
 
 		bool fillRegion(Texture::IDType handleID, const void* src, uint32 stride, const Rect& rect, bool wait) override;
 
+		bool fillAsync(Texture::IDType handleID, Image&& image) override;
+
 		void clearRT(Texture::IDType handleID, const ColorF& color) override;
 
 		void generateMips(Texture::IDType handleID) override;
@@ -119,9 +127,47 @@ namespace s3d
 		//
 		/////////////////////////////////
 
+		/////////////////////////////////
+		//
+		// createDeferred() と fillAsync() による、ピクセルバッファオブジェクトを経由した転送
+		std::mutex m_uploadsMutex;
+
+		struct PendingUpload
+		{
+			Texture::IDType id;
+
+			Image image;
+
+			// true の場合は動的テクスチャの更新、false の場合はテクスチャの作成
+			bool fill = false;
+		};
+
+		// 転送を待っている要求（m_uploadsMutex で保護）
+		Array<PendingUpload> m_pendingUploads;
+
+		struct InFlightUpload
+		{
+			Texture::IDType id;
+
+			size_t slot = 0;
+		};
+
+		// 転送命令を発行し、完了を待っている要求（メインスレッドのみ）
+		Array<InFlightUpload> m_inFlightUploads;
+
+		GL4StagingRing m_stagingRing;
+		//
+		/////////////////////////////////
+
 		[[nodiscard]]
 		bool isMainThread() const noexcept;
 
 		Texture::IDType pushRequest(const Image& image, const Array<Image>& mipmaps, TextureDesc desc);
+
+		// 完了した転送を仕上げ、待っている要求の転送命令を発行する。発行した転送のデータサイズ（バイト）を返す
+		size_t updateDeferredUploads(size_t maxUploadBytes);
+
+		[[nodiscard]]
+		bool isReleased(Texture::IDType handleID) const;
 	};
 }
@@ -0,0 +1,135 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cstring>
+# include "GL4StagingRing.hpp"
+# include <Siv3D/EngineLog.hpp>
+
+namespace s3d
+{
+	Optional<size_t> GL4StagingRing::stage(const void* data, const size_t size)
+	{
+		for (size_t i = 0; i < SlotCount; ++i)
+		{
+			const size_t index = ((m_next + i) % SlotCount);
+			Slot& slot = m_slots[index];
+
+			if (slot.inUse && (not poll(index)))
+			{
+				continue;
+			}
+
+			if (slot.buffer == 0)
+			{
+				::glGenBuffers(1, &slot.buffer);
+			}
+
+			::glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+
+			if (slot.capacity < size)
+			{
+				::glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+				slot.capacity = size;
+			}
+
+			// フェンスの通過を確認済みなので、同期せずに書き込める
+			void* pDst = ::glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(size),
+				(GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+
+			if (not pDst)
+			{
+				LOG_FAIL(U"GL4StagingRing::stage(): glMapBufferRange() failed");
+				::glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+				return none;
+			}
+
+			std::memcpy(pDst, data, size);
+
+			if (::glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_FALSE)
+			{
+				// バッファの内容が失われた
+				::glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+				return none;
+			}
+
+			slot.inUse = true;
+			m_next = ((index + 1) % SlotCount);
+			return index;
+		}
+
+		return none;
+	}
+
+	void GL4StagingRing::fence(const size_t slot)
+	{
+		Slot& s = m_slots[slot];
+
+		if (s.fence)
+		{
+			::glDeleteSync(s.fence);
+		}
+
+		s.fence = ::glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	bool GL4StagingRing::poll(const size_t slot)
+	{
+		Slot& s = m_slots[slot];
+
+		if (not s.inUse)
+		{
+			return true;
+		}
+
+		if (s.fence)
+		{
+			// 待たずに状態だけを調べる。命令はフレームの終わりにフラッシュされる
+			const GLenum result = ::glClientWaitSync(s.fence, 0, 0);
+
+			if ((result != GL_ALREADY_SIGNALED)
+				&& (result != GL_CONDITION_SATISFIED))
+			{
+				return false;
+			}
+
+			::glDeleteSync(s.fence);
+			s.fence = nullptr;
+		}
+
+		s.inUse = false;
+		return true;
+	}
+
+	void GL4StagingRing::unbind()
+	{
+		::glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	void GL4StagingRing::release()
+	{
+		for (auto& slot : m_slots)
+		{
+			if (slot.fence)
+			{
+				::glDeleteSync(slot.fence);
+			}
+
+			if (slot.buffer)
+			{
+				::glDeleteBuffers(1, &slot.buffer);
+			}
+
+			slot = Slot{};
+		}
+
+		m_next = 0;
+	}
+}
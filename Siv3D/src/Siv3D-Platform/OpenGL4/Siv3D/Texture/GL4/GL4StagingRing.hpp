@@ -0,0 +1,68 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <array>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/Common/OpenGL.hpp>
+
+namespace s3d
+{
+	// テクスチャ転送用のピクセルバッファオブジェクト (GL_PIXEL_UNPACK_BUFFER) のリング
+	// 各スロットは、そのスロットを使った転送命令のフェンスが通過するまで再利用されない
+	class GL4StagingRing
+	{
+	public:
+
+		static constexpr size_t SlotCount = 4;
+
+		GL4StagingRing() = default;
+
+		GL4StagingRing(const GL4StagingRing&) = delete;
+
+		GL4StagingRing& operator =(const GL4StagingRing&) = delete;
+
+		// 空いているスロットにデータを書き込み、そのバッファを GL_PIXEL_UNPACK_BUFFER にバインドしてスロット番号を返す
+		// 空いているスロットが無い場合は none
+		[[nodiscard]]
+		Optional<size_t> stage(const void* data, size_t size);
+
+		// stage() したスロットを読む転送命令を発行した後に呼ぶ
+		void fence(size_t slot);
+
+		// スロットを読む転送命令が完了していれば、スロットを空きにして true を返す
+		[[nodiscard]]
+		bool poll(size_t slot);
+
+		void unbind();
+
+		// すべてのバッファを破棄する。OpenGL コンテキストが有効な間に呼ぶ
+		void release();
+
+	private:
+
+		struct Slot
+		{
+			GLuint buffer = 0;
+
+			size_t capacity = 0;
+
+			GLsync fence = nullptr;
+
+			bool inUse = false;
+		};
+
+		std::array<Slot, SlotCount> m_slots;
+
+		size_t m_next = 0;
+	};
+}
@@ -464,6 +464,15 @@ namespace s3d
 		m_initialized = true;
 	}
 
+	GL4Texture::GL4Texture(Deferred, const Size& size, const TextureDesc desc)
+		: m_size{ size }
+		, m_format{ detail::IsSRGB(desc) ? TextureFormat::R8G8B8A8_Unorm_SRGB : TextureFormat::R8G8B8A8_Unorm }
+		, m_textureDesc{ desc }
+		, m_type{ TextureType::Default }
+		, m_hasMipMap{ detail::HasMipMap(desc) }
+		, m_initialized{ true }
+		, m_ready{ false } {}
+
 	GL4Texture::~GL4Texture()
 	{
 		// [デプステクスチャ] を破棄
@@ -537,6 +546,73 @@ namespace s3d
 		return m_hasDepth;
 	}
 
+	bool GL4Texture::isReady() const noexcept
+	{
+		return m_ready.load(std::memory_order_acquire);
+	}
+
+	bool GL4Texture::isDynamic() const noexcept
+	{
+		return (m_type == TextureType::Dynamic);
+	}
+
+	bool GL4Texture::createFromUnpackBuffer()
+	{
+		if (m_texture)
+		{
+			return false;
+		}
+
+		// [メインテクスチャ] を作成
+		{
+			::glGenTextures(1, &m_texture);
+			::glBindTexture(GL_TEXTURE_2D, m_texture);
+
+			// データは GL_PIXEL_UNPACK_BUFFER の先頭から読まれる
+			::glTexImage2D(GL_TEXTURE_2D, 0, m_format.GLInternalFormat(), m_size.x, m_size.y, 0,
+				m_format.GLFormat(), m_format.GLType(), nullptr);
+
+			// ミップマップは転送の完了後に finishDeferredUpload() で生成する
+			::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+		}
+
+		return true;
+	}
+
+	bool GL4Texture::fillFromUnpackBuffer()
+	{
+		if (m_type != TextureType::Dynamic)
+		{
+			return false;
+		}
+
+		if ((m_format != TextureFormat::R8G8B8A8_Unorm)
+			&& (m_format != TextureFormat::R8G8B8A8_Unorm_SRGB))
+		{
+			LOG_FAIL(U"DynamicTexture image fill for {0} is not yet implemented"_fmt(m_format.name()));
+			return false;
+		}
+
+		::glBindTexture(GL_TEXTURE_2D, m_texture);
+
+		::glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_size.x, m_size.y, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+		return true;
+	}
+
+	void GL4Texture::finishDeferredUpload()
+	{
+		if (m_hasMipMap && m_texture)
+		{
+			const size_t mipmapCount = ImageProcessing::CalculateMipCount(m_size.x, m_size.y);
+			::glBindTexture(GL_TEXTURE_2D, m_texture);
+			::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(mipmapCount - 1));
+			::glGenerateMipmap(GL_TEXTURE_2D);
+		}
+
+		m_ready.store(true, std::memory_order_release);
+	}
+
 	bool GL4Texture::fill(const ColorF& color, bool)
 	{
 		if (m_type != TextureType::Dynamic)
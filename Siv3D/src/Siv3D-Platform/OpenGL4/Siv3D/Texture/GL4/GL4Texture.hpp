@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <atomic>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Common/OpenGL.hpp>
 # include <Siv3D/TextureFormat.hpp>
@@ -25,6 +26,7 @@ namespace s3d
 		struct Dynamic {};
 		struct Render {};
 		struct MSRender {};
+		struct Deferred {};
 
 		SIV3D_NODISCARD_CXX20
 		GL4Texture(const Image& image, TextureDesc desc);
@@ -47,6 +49,9 @@ namespace s3d
 
 		GL4Texture(MSRender, const Size& size, const TextureFormat& format, TextureDesc desc, HasDepth hasDepth);
 
+		// OpenGL の命令を発行せずに作成する。テクスチャの実体は createFromUnpackBuffer() で作成される
+		GL4Texture(Deferred, const Size& size, TextureDesc desc);
+
 		~GL4Texture();
 
 		[[nodiscard]]
@@ -70,6 +75,22 @@ namespace s3d
 		[[nodiscard]]
 		bool hasDepth() const noexcept;
 
+		// 任意のスレッドから呼べる
+		[[nodiscard]]
+		bool isReady() const noexcept;
+
+		[[nodiscard]]
+		bool isDynamic() const noexcept;
+
+		// バインドされている GL_PIXEL_UNPACK_BUFFER の内容からテクスチャの実体を作成する
+		bool createFromUnpackBuffer();
+
+		// バインドされている GL_PIXEL_UNPACK_BUFFER の内容で動的テクスチャを更新する
+		bool fillFromUnpackBuffer();
+
+		// 転送の完了後に呼ぶ。ミップマップを生成し、テクスチャを使用可能にする
+		void finishDeferredUpload();
+
 		// 動的テクスチャを指定した色で塗りつぶす
 		bool fill(const ColorF& color, bool wait);
 
@@ -149,6 +170,8 @@ namespace s3d
 
 		bool m_initialized = false;
 
+		std::atomic<bool> m_ready{ true };
+
 		bool initDepthBuffer();
 	};
 }
@@ -455,6 +455,11 @@ namespace s3d
 		return m_hasDepth;
 	}
 
+	bool GLES3Texture::isDynamic() const noexcept
+	{
+		return (m_type == TextureType::Dynamic);
+	}
+
 	bool GLES3Texture::fill(const ColorF& color, bool)
 	{
 		if (m_type != TextureType::Dynamic)
@@ -70,6 +70,9 @@ namespace s3d
 		[[nodiscard]]
 		bool hasDepth() const noexcept;
 
+		[[nodiscard]]
+		bool isDynamic() const noexcept;
+
 		// 動的テクスチャを指定した色で塗りつぶす
 		bool fill(const ColorF& color, bool wait);
 
@@ -10,7 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/EngineOptions.hpp>
-# include <Siv3D/Renderer2D/Null/CRenderer2D_Null.hpp>
+# include <Siv3D/Renderer2D/Software/CRenderer2D_Software.hpp>
 # include <Siv3D/Renderer2D/GLES3/CRenderer2D_GLES3.hpp>
 # include <Siv3D/Renderer2D/WebGPU/CRenderer2D_WebGPU.hpp>
 
@@ -20,7 +20,7 @@ namespace s3d
 	{
 		if (g_engineOptions.renderer == EngineOption::Renderer::Headless)
 		{
-			return new CRenderer2D_Null;
+			return new CRenderer2D_Software;
 		}
 		else if (g_engineOptions.renderer == EngineOption::Renderer::WebGPU)
 		{
@@ -10,7 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/EngineOptions.hpp>
-# include <Siv3D/Texture/Null/CTexture_Null.hpp>
+# include <Siv3D/Texture/Software/CTexture_Software.hpp>
 # include <Siv3D/Texture/GLES3/CTexture_GLES3.hpp>
 
 namespace s3d
@@ -20,7 +20,7 @@ namespace s3d
 	{
 		if (g_engineOptions.renderer == EngineOption::Renderer::Headless)
 		{
-			return new CTexture_Null;
+			return new CTexture_Software;
 		}
 		else
 		{
@@ -164,6 +164,55 @@ namespace s3d
 		m_commandManager.pushDraw(startIndex, indexCount, phong, instanceCount);
 	}
 
+	void CRenderer3D_WebGPU::addMeshInstances(const uint32 startIndex, const uint32 indexCount, const Mesh& mesh, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, const size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		if (not m_currentCustomVS)
+		{
+			m_commandManager.pushStandardVS(m_standardVS->forwardID);
+		}
+
+		if (not m_currentCustomPS)
+		{
+			m_commandManager.pushStandardPS(m_standardPS->forwardID);
+		}
+
+		m_commandManager.pushInputLayout(WebGPUInputLayout3D::Mesh);
+		m_commandManager.pushMesh(mesh);
+		m_commandManager.pushUVTransform(Float4{ 1.0f, 1.0f, 0.0f, 0.0f });
+
+		pushInstances(startIndex, indexCount, material, transforms, colors, count);
+	}
+
+	void CRenderer3D_WebGPU::addTexturedMeshInstances(const uint32 startIndex, const uint32 indexCount, const Mesh& mesh, const Texture& texture, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, const size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		if (not m_currentCustomVS)
+		{
+			m_commandManager.pushStandardVS(m_standardVS->forwardID);
+		}
+
+		if (not m_currentCustomPS)
+		{
+			m_commandManager.pushStandardPS(m_standardPS->forwardID);
+		}
+
+		m_commandManager.pushInputLayout(WebGPUInputLayout3D::Mesh);
+		m_commandManager.pushMesh(mesh);
+		m_commandManager.pushUVTransform(Float4{ 1.0f, 1.0f, 0.0f, 0.0f });
+		m_commandManager.pushPSTexture(0, texture);
+
+		pushInstances(startIndex, indexCount, material, transforms, colors, count);
+	}
+
 	void CRenderer3D_WebGPU::addLine3D(const Float3& begin, const Float3& end, const Float4(&colors)[2])
 	{
 		constexpr VertexLine3D::IndexType vertexSize = 2, indexSize = 2;
@@ -895,4 +944,27 @@ namespace s3d
 
 		currentRenderingPass.End();
 	}
+
+	void CRenderer3D_WebGPU::pushInstances(const uint32 startIndex, const uint32 indexCount, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, const size_t count)
+	{
+		// シェーダやメッシュの設定は共有し、インスタンスごとに座標変換とマテリアルの色だけを変える
+		const Mat4x4 baseTransform = m_commandManager.getCurrentLocalTransform();
+
+		PhongMaterialInternal phong{ material };
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			m_commandManager.pushLocalTransform(transforms[i] * baseTransform);
+
+			if (colors)
+			{
+				phong.diffuseColor = colors[i].toFloat4();
+			}
+
+			const uint32 instanceCount = 1;
+			m_commandManager.pushDraw(startIndex, indexCount, phong, instanceCount);
+		}
+
+		m_commandManager.pushLocalTransform(baseTransform);
+	}
 }
@@ -56,15 +56,15 @@ namespace s3d
 		}
 	}
 
-	void CTexture_WebGPU::updateAsyncTextureLoad(const size_t maxUpdate)
+	size_t CTexture_WebGPU::updateAsyncTextureLoad(const size_t maxUploadBytes)
 	{
 		if (not isMainThread())
 		{
-			return;
+			return 0;
 		}
 
 		// 終了時は即座に全消去
-		if (maxUpdate == Largest<size_t>)
+		if (maxUploadBytes == Largest<size_t>)
 		{
 			std::lock_guard lock{ m_requestsMutex };
 
@@ -75,16 +75,26 @@ namespace s3d
 
 			m_requests.clear();
 
-			return;
+			{
+				std::lock_guard fillsLock{ m_fillsMutex };
+
+				m_pendingFills.clear();
+			}
+
+			return 0;
 		}
 
 		std::lock_guard lock{ m_requestsMutex };
 
-		const size_t loadCount = Min(maxUpdate, m_requests.size());
+		size_t loadCount = 0;
 
-		for (size_t i = 0; i < loadCount; ++i)
+		size_t uploadedBytes = 0;
+
+		// 大きなテクスチャが永久に待たされないよう、予算に関わらず少なくとも 1 つは作成する
+		while ((loadCount < m_requests.size())
+			&& ((loadCount == 0) || (uploadedBytes < maxUploadBytes)))
 		{
-			auto& request = m_requests[i];
+			auto& request = m_requests[loadCount];
 
 			if (*request.pMipmaps)
 			{
@@ -95,10 +105,23 @@ namespace s3d
 				request.idResult.get() = create(*request.pImage, *request.pDesc);
 			}
 
+			uploadedBytes += request.pImage->size_bytes();
+
+			for (const auto& mipmap : *request.pMipmaps)
+			{
+				uploadedBytes += mipmap.size_bytes();
+			}
+
 			request.waiting.get() = false;
+
+			++loadCount;
 		}
 
 		m_requests.pop_front_N(loadCount);
+
+		uploadedBytes += uploadPendingFills((uploadedBytes < maxUploadBytes) ? (maxUploadBytes - uploadedBytes) : 0);
+
+		return uploadedBytes;
 	}
 
 	size_t CTexture_WebGPU::getTextureCount() const
@@ -308,6 +331,17 @@ namespace s3d
 		return m_textures.add(std::move(texture), info);
 	}
 
+	Texture::IDType CTexture_WebGPU::createDeferred(Image&& image, const TextureDesc desc)
+	{
+		// メインスレッド以外からの場合は create() が updateAsyncTextureLoad() での作成を待つ
+		return create(image, desc);
+	}
+
+	bool CTexture_WebGPU::isReady(Texture::IDType)
+	{
+		return true;
+	}
+
 	void CTexture_WebGPU::release(const Texture::IDType handleID)
 	{
 		m_textures.erase(handleID);
@@ -353,6 +387,37 @@ namespace s3d
 		return m_textures[handleID]->fillRegion(m_device, src, stride, rect, wait);
 	}
 
+	bool CTexture_WebGPU::fillAsync(const Texture::IDType handleID, Image&& image)
+	{
+		if (isReleased(handleID))
+		{
+			return false;
+		}
+
+		if (const WebGPUTexture* texture = m_textures[handleID];
+			(not texture->isDynamic()) || (texture->getSize() != image.size()))
+		{
+			return false;
+		}
+
+		// 任意のスレッドから呼ばれるため、ここでは予約のみ行い、転送は updateAsyncTextureLoad() で行う
+		std::lock_guard lock{ m_fillsMutex };
+
+		// まだ転送していない更新があれば、新しい画像で置き換える
+		for (auto& pending : m_pendingFills)
+		{
+			if (pending.id == handleID)
+			{
+				pending.image = std::move(image);
+				return true;
+			}
+		}
+
+		m_pendingFills.push_back(PendingFill{ handleID, std::move(image) });
+
+		return true;
+	}
+
 	void CTexture_WebGPU::clearRT(const Texture::IDType handleID, const ColorF& color)
 	{
 		m_textures[handleID]->clearRT(m_device, color);
@@ -413,6 +478,45 @@ namespace s3d
 		return (std::this_thread::get_id() == m_mainThreadID);
 	}
 
+	bool CTexture_WebGPU::isReleased(const Texture::IDType handleID) const
+	{
+		// 解放済みの ID は Null テクスチャを指す
+		return (m_textures[handleID] == m_textures[Texture::IDType::NullAsset()]);
+	}
+
+	size_t CTexture_WebGPU::uploadPendingFills(const size_t maxUploadBytes)
+	{
+		std::lock_guard lock{ m_fillsMutex };
+
+		size_t fillCount = 0;
+
+		size_t uploadedBytes = 0;
+
+		// 大きなテクスチャが永久に待たされないよう、予算に関わらず少なくとも 1 つは転送する
+		while ((fillCount < m_pendingFills.size())
+			&& ((uploadedBytes == 0) || (uploadedBytes < maxUploadBytes)))
+		{
+			const PendingFill& pending = m_pendingFills[fillCount];
+
+			++fillCount;
+
+			// 転送前に解放された
+			if (isReleased(pending.id))
+			{
+				continue;
+			}
+
+			if (m_textures[pending.id]->fill(m_device, pending.image.data(), pending.image.stride(), true))
+			{
+				uploadedBytes += pending.image.size_bytes();
+			}
+		}
+
+		m_pendingFills.pop_front_N(fillCount);
+
+		return uploadedBytes;
+	}
+
 	Texture::IDType CTexture_WebGPU::pushRequest(const Image& image, const Array<Image>& mipmaps, const TextureDesc desc)
 	{
 		std::atomic<bool> waiting = true;
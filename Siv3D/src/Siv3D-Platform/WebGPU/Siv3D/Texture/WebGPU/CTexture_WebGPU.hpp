@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <thread>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Texture/ITexture.hpp>
 # include <Siv3D/AssetHandleManager/AssetHandleManager.hpp>
@@ -31,7 +32,7 @@ namespace s3d
 
 		void init();
 
-		void updateAsyncTextureLoad(size_t maxUpdate) override;
+		size_t updateAsyncTextureLoad(size_t maxUploadBytes) override;
 
 		size_t getTextureCount() const override;
 
@@ -55,6 +56,10 @@ namespace s3d
 
 		Texture::IDType createMSRT(const Size& size, const TextureFormat& format, HasDepth hasDepth, HasMipMap hasMipMap) override;
 
+		Texture::IDType createDeferred(Image&& image, TextureDesc desc) override;
+
+		bool isReady(Texture::IDType handleID) override;
+
 		void release(Texture::IDType handleID) override;
 
 		Size getSize(Texture::IDType handleID) override;
@@ -73,6 +78,8 @@ namespace s3d
 
 		bool fillRegion(Texture::IDType handleID, const void* src, uint32 stride, const Rect& rect, bool wait) override;
 
+		bool fillAsync(Texture::IDType handleID, Image&& image) override;
+
 		void clearRT(Texture::IDType handleID, const ColorF& color) override;
 
 		void generateMips(Texture::IDType handleID) override;
@@ -127,11 +134,34 @@ namespace s3d
 		//
 		/////////////////////////////////
 
+		/////////////////////////////////
+		//
+		// fillAsync() による動的テクスチャの更新
+		std::mutex m_fillsMutex;
+
+		struct PendingFill
+		{
+			Texture::IDType id;
+
+			Image image;
+		};
+
+		// 転送を待っている更新（m_fillsMutex で保護）
+		Array<PendingFill> m_pendingFills;
+		//
+		/////////////////////////////////
+
 		wgpu::Device* m_device;
 
 		[[nodiscard]]
 		bool isMainThread() const noexcept;
 
+		[[nodiscard]]
+		bool isReleased(Texture::IDType handleID) const;
+
+		// fillAsync() で予約された更新を、予算の範囲で転送する
+		size_t uploadPendingFills(size_t maxUploadBytes);
+
 		Texture::IDType pushRequest(const Image& image, const Array<Image>& mipmaps, TextureDesc desc);
 	};
 }
@@ -590,6 +590,11 @@ namespace s3d
 		return m_hasDepth;
 	}
 
+	bool WebGPUTexture::isDynamic() const noexcept
+	{
+		return (m_type == TextureType::Dynamic);
+	}
+
 	bool WebGPUTexture::fill(wgpu::Device* device, const ColorF& color, bool)
 	{
 		if (m_type != TextureType::Dynamic)
@@ -36,7 +36,7 @@ namespace s3d
 
 			if (HRSRC hrs = ::FindResourceW(hModule, &pathW[1], L"FILE")) [[likely]]
 			{
-				m_resource =
+				m_memory =
 				{
 					.pointer = static_cast<const Byte*>(::LockResource(::LoadResource(hModule, hrs)))
 				};
@@ -62,6 +62,13 @@ namespace s3d
 		}
 		else
 		{
+			const int64 fileSize = FileSystem::FileSize(path);
+
+			if (openMapped(path, fileSize))
+			{
+				return true;
+			}
+
 			// ファイルのオープン
 			{
 				m_file.file.open(path.toWstr(), std::ios_base::binary);
@@ -77,7 +84,7 @@ namespace s3d
 			m_info =
 			{
 				.isOpen		= true,
-				.size		= FileSystem::FileSize(path),
+				.size		= fileSize,
 				.fullPath	= FileSystem::FullPath(path)
 			};
 
@@ -95,9 +102,16 @@ namespace s3d
 			return;
 		}
 
-		if (isResource())
+		if (isMapped())
+		{
+			m_mappedFile.close();
+			m_memory = {};
+			LOG_INFO(U"📥 BinaryReader: File `{0}` closed"_fmt(
+				m_info.fullPath));
+		}
+		else if (isMemory())
 		{
-			m_resource = {};
+			m_memory = {};
 			LOG_INFO(U"📥 BinaryReader: Resource `{0}` closed"_fmt(
 				m_info.fullPath));
 		}
@@ -131,9 +145,9 @@ namespace s3d
 
 		assert(InRange<int64>(clampedPos, 0, size()));
 
-		if (isResource())
+		if (isMemory())
 		{
-			return (m_resource.pos = clampedPos);
+			return (m_memory.pos = clampedPos);
 		}
 		else
 		{
@@ -145,9 +159,9 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::getPos()
 	{
-		if (isResource())
+		if (isMemory())
 		{
-			return m_resource.pos;
+			return m_memory.pos;
 		}
 		else
 		{
@@ -157,11 +171,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::read(const NonNull<void*> dst, const int64 size)
 	{
-		if (isResource())
+		if (isMemory())
 		{
-			const int64 readBytes = Clamp(size, 0LL, (m_info.size - m_resource.pos));
-			std::memcpy(dst.pointer, (m_resource.pointer + m_resource.pos), static_cast<size_t>(readBytes));
-			m_resource.pos += readBytes;
+			const int64 readBytes = Clamp(size, 0LL, (m_info.size - m_memory.pos));
+			std::memcpy(dst.pointer, (m_memory.pointer + m_memory.pos), static_cast<size_t>(readBytes));
+			m_memory.pos += readBytes;
 			return readBytes;
 		}
 		else
@@ -191,11 +205,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::read(const NonNull<void*> dst, const int64 pos, const int64 size)
 	{
-		if (isResource())
+		if (isMemory())
 		{
 			const int64 readBytes = Clamp(size, 0LL, (m_info.size - pos));
-			std::memcpy(dst.pointer, (m_resource.pointer + pos), static_cast<size_t>(readBytes));
-			m_resource.pos = (pos + readBytes);
+			std::memcpy(dst.pointer, (m_memory.pointer + pos), static_cast<size_t>(readBytes));
+			m_memory.pos = (pos + readBytes);
 			return readBytes;
 		}
 		else
@@ -230,10 +244,10 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 size)
 	{
-		if (isResource())
+		if (isMemory())
 		{
-			const int64 readBytes = Clamp(size, 0LL, (m_info.size - m_resource.pos));
-			std::memcpy(dst.pointer, (m_resource.pointer + m_resource.pos), static_cast<size_t>(readBytes));
+			const int64 readBytes = Clamp(size, 0LL, (m_info.size - m_memory.pos));
+			std::memcpy(dst.pointer, (m_memory.pointer + m_memory.pos), static_cast<size_t>(readBytes));
 			return readBytes;
 		}
 		else
@@ -266,10 +280,10 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 pos, const int64 size)
 	{
-		if (isResource())
+		if (isMemory())
 		{
 			const int64 readBytes = Clamp(size, 0LL, (m_info.size - pos));
-			std::memcpy(dst.pointer, (m_resource.pointer + pos), static_cast<size_t>(readBytes));
+			std::memcpy(dst.pointer, (m_memory.pointer + pos), static_cast<size_t>(readBytes));
 			return readBytes;
 		}
 		else
@@ -310,8 +324,65 @@ namespace s3d
 		return m_info.fullPath;
 	}
 
-	bool BinaryReader::BinaryReaderDetail::isResource() const noexcept
+	bool BinaryReader::BinaryReaderDetail::supportsReadView() const noexcept
+	{
+		return isMemory();
+	}
+
+	std::span<const Byte> BinaryReader::BinaryReaderDetail::readView(const int64 size)
+	{
+		if (not isMemory())
+		{
+			return{};
+		}
+
+		const int64 readBytes = Clamp(size, 0LL, (m_info.size - m_memory.pos));
+		const std::span<const Byte> view{ (m_memory.pointer + m_memory.pos), static_cast<size_t>(readBytes) };
+		m_memory.pos += readBytes;
+		return view;
+	}
+
+	bool BinaryReader::BinaryReaderDetail::isMapped() const noexcept
 	{
-		return (m_resource.pointer != nullptr);
+		return m_mappedFile.isOpen();
+	}
+
+	bool BinaryReader::BinaryReaderDetail::isMemory() const noexcept
+	{
+		return (m_memory.pointer != nullptr);
+	}
+
+	bool BinaryReader::BinaryReaderDetail::openMapped(const FilePathView path, const int64 fileSize)
+	{
+		if (fileSize < BinaryReader::MemoryMapThreshold)
+		{
+			return false;
+		}
+
+		if ((not m_mappedFile.open(path, MapAll::Yes))
+			|| (not m_mappedFile.data())
+			|| (static_cast<int64>(m_mappedFile.mappedSize()) != fileSize)) [[unlikely]]
+		{
+			// メモリマップできない場合は通常の読み込みを使う
+			m_mappedFile.close();
+			return false;
+		}
+
+		m_memory =
+		{
+			.pointer = m_mappedFile.data()
+		};
+
+		m_info =
+		{
+			.isOpen		= true,
+			.size		= fileSize,
+			.fullPath	= m_mappedFile.path()
+		};
+
+		LOG_INFO(U"📤 BinaryReader: File `{0}` opened (size: {1}, memory-mapped)"_fmt(
+			m_info.fullPath, FormatDataSize(m_info.size)));
+
+		return true;
 	}
 }
@@ -16,6 +16,7 @@
 # include <Siv3D/String.hpp>
 # include <Siv3D/Byte.hpp>
 # include <Siv3D/NonNull.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
 
 namespace s3d
 {
@@ -29,11 +30,14 @@ namespace s3d
 			int64 pos = 0;
 		} m_file;
 
-		struct Resource
+		// リソース、または BinaryReader::MemoryMapThreshold 以上でメモリマップしたファイル
+		struct Memory
 		{
 			const Byte* pointer = nullptr;
 			int64 pos = 0;
-		} m_resource;
+		} m_memory;
+
+		MemoryMappedFileView m_mappedFile;
 
 		struct Info
 		{
@@ -42,7 +46,9 @@ namespace s3d
 			FilePath fullPath;
 		} m_info;
 
-		bool isResource() const noexcept;
+		bool isMemory() const noexcept;
+
+		bool openMapped(FilePathView path, int64 fileSize);
 
 	public:
 
@@ -70,6 +76,12 @@ namespace s3d
 
 		int64 lookahead(NonNull<void*> dst, int64 pos, int64 size);
 
+		bool supportsReadView() const noexcept;
+
+		std::span<const Byte> readView(int64 size);
+
+		bool isMapped() const noexcept;
+
 		const FilePath& path() const noexcept;
 	};
 }
@@ -10,7 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/EngineOptions.hpp>
-# include <Siv3D/Renderer2D/Null/CRenderer2D_Null.hpp>
+# include <Siv3D/Renderer2D/Software/CRenderer2D_Software.hpp>
 # include <Siv3D/Renderer2D/GL4/CRenderer2D_GL4.hpp>
 # include <Siv3D/Renderer2D/D3D11/CRenderer2D_D3D11.hpp>
 
@@ -20,7 +20,7 @@ namespace s3d
 	{
 		if (g_engineOptions.renderer == EngineOption::Renderer::Headless)
 		{
-			return new CRenderer2D_Null;
+			return new CRenderer2D_Software;
 		}
 		else if ((g_engineOptions.renderer == EngineOption::Renderer::PlatformDefault)
 			|| (g_engineOptions.renderer == EngineOption::Renderer::Direct3D11))
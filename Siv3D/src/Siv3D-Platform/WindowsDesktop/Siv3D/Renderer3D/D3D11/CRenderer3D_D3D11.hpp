@@ -83,6 +83,10 @@ namespace s3d
 
 		void addTexturedMesh(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const TextureRegion& textureRegion, const PhongMaterial& material) override;
 
+		void addMeshInstances(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, size_t count) override;
+
+		void addTexturedMeshInstances(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const Texture& texture, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, size_t count) override;
+
 		void addLine3D(const Float3& begin, const Float3& end, const Float4(&colors)[2]) override;
 
 
@@ -191,5 +195,7 @@ namespace s3d
 		Optional<PixelShader> m_currentCustomPS;
 
 		Renderer3DStat m_stat;
+
+		void pushInstances(uint32 startIndex, uint32 indexCount, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, size_t count);
 	};
 }
@@ -11,7 +11,9 @@
 
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/AsyncTask.hpp>
+# include <Siv3D/ProfileZone.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
+# include <Siv3D/Threading/IThreading.hpp>
 # include <Siv3D/Resource/IResource.hpp>
 # include <Siv3D/Profiler/IProfiler.hpp>
 # include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
@@ -79,6 +81,7 @@ namespace s3d
 		SystemLog::Initial();
 		SystemMisc::Init();
 
+		SIV3D_ENGINE(Threading)->init();
 		SIV3D_ENGINE(Resource)->init();
 		SIV3D_ENGINE(Profiler)->init();
 	}
@@ -149,6 +152,8 @@ namespace s3d
 
 	bool CSystem::update()
 	{
+		SIV3D_PROFILE_SCOPE(U"System::Update");
+
 		if (m_termination)
 		{
 			return false;
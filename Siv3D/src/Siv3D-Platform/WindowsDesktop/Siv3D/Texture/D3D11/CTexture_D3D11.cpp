@@ -101,9 +101,25 @@ namespace s3d
 		}
 	}
 
-	void CTexture_D3D11::updateAsyncTextureLoad(const size_t)
+	size_t CTexture_D3D11::updateAsyncTextureLoad(const size_t maxUploadBytes)
 	{
-		// do nothing
+		// テクスチャの作成は任意のスレッドから行えるが、デバイスコンテキストはメインスレッドでのみ使う
+		if (not isMainThread())
+		{
+			return 0;
+		}
+
+		// 終了時は即座に全消去
+		if (maxUploadBytes == Largest<size_t>)
+		{
+			std::lock_guard lock{ m_fillsMutex };
+
+			m_pendingFills.clear();
+
+			return 0;
+		}
+
+		return uploadPendingFills(maxUploadBytes);
 	}
 
 	size_t CTexture_D3D11::getTextureCount() const
@@ -326,6 +342,17 @@ namespace s3d
 		return m_textures.add(std::move(texture), info);
 	}
 
+	Texture::IDType CTexture_D3D11::createDeferred(Image&& image, const TextureDesc desc)
+	{
+		// 任意のスレッドでテクスチャを作成できるため、そのまま作成する
+		return create(image, desc);
+	}
+
+	bool CTexture_D3D11::isReady(Texture::IDType)
+	{
+		return true;
+	}
+
 	void CTexture_D3D11::release(const Texture::IDType handleID)
 	{
 		m_textures.erase(handleID);
@@ -371,6 +398,37 @@ namespace s3d
 		return m_textures[handleID]->fillRegion(m_context, src, stride, rect, wait);
 	}
 
+	bool CTexture_D3D11::fillAsync(const Texture::IDType handleID, Image&& image)
+	{
+		if (isReleased(handleID))
+		{
+			return false;
+		}
+
+		if (const D3D11Texture* texture = m_textures[handleID];
+			(not texture->isDynamic()) || (texture->getDesc().size != image.size()))
+		{
+			return false;
+		}
+
+		// イミディエイトコンテキストはスレッドセーフではないので、ここでは予約のみ行い、転送は updateAsyncTextureLoad() で行う
+		std::lock_guard lock{ m_fillsMutex };
+
+		// まだ転送していない更新があれば、新しい画像で置き換える
+		for (auto& pending : m_pendingFills)
+		{
+			if (pending.id == handleID)
+			{
+				pending.image = std::move(image);
+				return true;
+			}
+		}
+
+		m_pendingFills.push_back(PendingFill{ handleID, std::move(image) });
+
+		return true;
+	}
+
 	void CTexture_D3D11::clearRT(const Texture::IDType handleID, const ColorF& color)
 	{
 		m_textures[handleID]->clearRT(m_context, color);
@@ -425,4 +483,48 @@ namespace s3d
 	{
 		return m_textures[handleID]->getDSV();
 	}
+
+	bool CTexture_D3D11::isMainThread() const noexcept
+	{
+		return (std::this_thread::get_id() == m_mainThreadID);
+	}
+
+	bool CTexture_D3D11::isReleased(const Texture::IDType handleID) const
+	{
+		// 解放済みの ID は Null テクスチャを指す
+		return (m_textures[handleID] == m_textures[Texture::IDType::NullAsset()]);
+	}
+
+	size_t CTexture_D3D11::uploadPendingFills(const size_t maxUploadBytes)
+	{
+		std::lock_guard lock{ m_fillsMutex };
+
+		size_t fillCount = 0;
+
+		size_t uploadedBytes = 0;
+
+		// 大きなテクスチャが永久に待たされないよう、予算に関わらず少なくとも 1 つは転送する
+		while ((fillCount < m_pendingFills.size())
+			&& ((uploadedBytes == 0) || (uploadedBytes < maxUploadBytes)))
+		{
+			const PendingFill& pending = m_pendingFills[fillCount];
+
+			++fillCount;
+
+			// 転送前に解放された
+			if (isReleased(pending.id))
+			{
+				continue;
+			}
+
+			if (m_textures[pending.id]->fill(m_context, pending.image.data(), pending.image.stride(), true))
+			{
+				uploadedBytes += pending.image.size_bytes();
+			}
+		}
+
+		m_pendingFills.pop_front_N(fillCount);
+
+		return uploadedBytes;
+	}
 }
@@ -63,6 +63,9 @@ namespace s3d
 		[[nodiscard]]
 		bool hasDepth() const noexcept;
 
+		[[nodiscard]]
+		bool isDynamic() const noexcept;
+
 		[[nodiscard]]
 		ID3D11Texture2D* getTexture();
 
@@ -10,7 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/EngineOptions.hpp>
-# include <Siv3D/Texture/Null/CTexture_Null.hpp>
+# include <Siv3D/Texture/Software/CTexture_Software.hpp>
 # include <Siv3D/Texture/GL4/CTexture_GL4.hpp>
 # include <Siv3D/Texture/D3D11/CTexture_D3D11.hpp>
 
@@ -20,7 +20,7 @@ namespace s3d
 	{
 		if (g_engineOptions.renderer == EngineOption::Renderer::Headless)
 		{
-			return new CTexture_Null;
+			return new CTexture_Software;
 		}
 		else if (g_engineOptions.renderer == EngineOption::Renderer::PlatformDefault
 			|| g_engineOptions.renderer == EngineOption::Renderer::Direct3D11)
@@ -16,6 +16,7 @@
 # include <Siv3D/ScopeGuard.hpp>
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/ShaderCommon.hpp>
+# include <Siv3D/ProfileZone.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include <Siv3D/Renderer/Metal/CRenderer_Metal.hpp>
 # include <Siv3D/Shader/Metal/CShader_Metal.hpp>
@@ -248,6 +249,42 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_Metal::addRects(const RectF* rects, size_t count, const ColorF* colors, const Float4& color)
+	{
+		while (count)
+		{
+			size_t numBuilt = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildRects(m_bufferCreator, rects, count, colors, color, numBuilt))
+			{
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
+
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->shapeID);
+				}
+
+				m_commandManager.pushDraw(indexCount);
+			}
+
+			if (numBuilt == 0)
+			{
+				break;
+			}
+
+			rects += numBuilt;
+			count -= numBuilt;
+
+			if (colors)
+			{
+				colors += numBuilt;
+			}
+		}
+	}
+
 	void CRenderer2D_Metal::addRectFrame(const FloatRect& rect, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
 		if (const auto indexCount = Vertex2DBuilder::BuildRectFrame(m_bufferCreator, rect, thickness, innerColor, outerColor))
@@ -302,6 +339,44 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_Metal::addCircles(const Circle* circles, size_t count, const ColorF* colors, const Float4& color)
+	{
+		const float scale = getMaxScaling();
+
+		while (count)
+		{
+			size_t numBuilt = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildCircles(m_bufferCreator, circles, count, colors, color, scale, numBuilt))
+			{
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
+
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->shapeID);
+				}
+
+				m_commandManager.pushDraw(indexCount);
+			}
+
+			if (numBuilt == 0)
+			{
+				break;
+			}
+
+			circles += numBuilt;
+			count -= numBuilt;
+
+			if (colors)
+			{
+				colors += numBuilt;
+			}
+		}
+	}
+
 	void CRenderer2D_Metal::addCircleFrame(const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
 		if (const auto indexCount = Vertex2DBuilder::BuildCircleFrame(m_bufferCreator, center, rInner, thickness, innerColor, outerColor, getMaxScaling()))
@@ -681,9 +756,12 @@ namespace s3d
 
 	}
 
-	void CRenderer2D_Metal::addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
-		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
-		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
+	void CRenderer2D_Metal::addParticles(const Particle2DBuffer&, const ParticleSystem2DParameters::ColorOverLifeTimeFunc&)
+	{
+
+	}
+
+	void CRenderer2D_Metal::addTexturedParticles(const Texture&, const Particle2DBuffer&, const ParticleSystem2DParameters::ColorOverLifeTimeFunc&)
 	{
 
 	}
@@ -879,6 +957,8 @@ namespace s3d
 
 	void CRenderer2D_Metal::flush()
 	{
+		SIV3D_PROFILE_SCOPE(U"Renderer2D::flush");
+
 		// [Siv3D ToDo]
 	}
 
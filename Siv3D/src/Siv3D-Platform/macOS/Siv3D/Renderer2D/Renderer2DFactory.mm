@@ -10,7 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/EngineOptions.hpp>
-# include <Siv3D/Renderer2D/Null/CRenderer2D_Null.hpp>
+# include <Siv3D/Renderer2D/Software/CRenderer2D_Software.hpp>
 # include <Siv3D/Renderer2D/GL4/CRenderer2D_GL4.hpp>
 # include <Siv3D/Renderer2D/Metal/CRenderer2D_Metal.hpp>
 
@@ -29,7 +29,7 @@ namespace s3d
 		}
 		else
 		{
-			return new CRenderer2D_Null;
+			return new CRenderer2D_Software;
 		}
 	}
 }
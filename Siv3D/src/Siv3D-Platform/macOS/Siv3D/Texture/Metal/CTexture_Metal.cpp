@@ -30,9 +30,10 @@ namespace s3d
 		
 	}
 
-	void CTexture_Metal::updateAsyncTextureLoad(const size_t)
+	size_t CTexture_Metal::updateAsyncTextureLoad(const size_t)
 	{
 		// [Siv3D ToDo]
+		return 0;
 	}
 
 	size_t CTexture_Metal::getTextureCount() const
@@ -91,6 +92,16 @@ namespace s3d
 		return Texture::IDType::NullAsset();
 	}
 
+	Texture::IDType CTexture_Metal::createDeferred(Image&&, TextureDesc)
+	{
+		return Texture::IDType::NullAsset();
+	}
+
+	bool CTexture_Metal::isReady(Texture::IDType)
+	{
+		return true;
+	}
+
 	void CTexture_Metal::release(Texture::IDType handleID)
 	{
 
@@ -136,6 +147,11 @@ namespace s3d
 		return false;
 	}
 
+	bool CTexture_Metal::fillAsync(Texture::IDType, Image&&)
+	{
+		return false;
+	}
+
 
 
 	void CTexture_Metal::clearRT(Texture::IDType handleID, const ColorF& color)
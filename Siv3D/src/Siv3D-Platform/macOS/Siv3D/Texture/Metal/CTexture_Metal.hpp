@@ -27,7 +27,7 @@ namespace s3d
 		
 		void init();
 
-		void updateAsyncTextureLoad(size_t maxUpdate) override;
+		size_t updateAsyncTextureLoad(size_t maxUploadBytes) override;
 
 		size_t getTextureCount() const override;
 		
@@ -50,6 +50,10 @@ namespace s3d
 		Texture::IDType createRT(const Grid<Float4>& image, HasDepth hasDepth, HasMipMap hasMipMap) override;
 
 		Texture::IDType createMSRT(const Size& size, const TextureFormat& format, HasDepth hasDepth, HasMipMap hasMipMap) override;
+
+		Texture::IDType createDeferred(Image&& image, TextureDesc desc) override;
+
+		bool isReady(Texture::IDType handleID) override;
 		
 		void release(Texture::IDType handleID) override;
 
@@ -69,6 +73,8 @@ namespace s3d
 
 		bool fillRegion(Texture::IDType handleID, const void* src, uint32 stride, const Rect& rect, bool wait) override;
 
+		bool fillAsync(Texture::IDType handleID, Image&& image) override;
+
 
 		void clearRT(Texture::IDType handleID, const ColorF& color) override;
 
@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <cstring>
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/FormatUtility.hpp>
@@ -29,6 +30,13 @@ namespace s3d
 
 		close();
 
+		const int64 fileSize = FileSystem::FileSize(path);
+
+		if (openMapped(path, fileSize))
+		{
+			return true;
+		}
+
 		// ファイルのオープン
 		{
 			m_file.file.open(path.narrow(), std::ios_base::binary);
@@ -44,7 +52,7 @@ namespace s3d
 		m_info =
 		{
 			.isOpen		= true,
-			.size		= FileSystem::FileSize(path),
+			.size		= fileSize,
 			.fullPath	= FileSystem::FullPath(path)
 		};
 
@@ -61,8 +69,17 @@ namespace s3d
 			return;
 		}
 
-		m_file.file.close();
-		m_file.pos = 0;
+		if (isMapped())
+		{
+			m_mapped.view.close();
+			m_mapped = {};
+		}
+		else
+		{
+			m_file.file.close();
+			m_file.pos = 0;
+		}
+
 		LOG_INFO(U"📥 BinaryReader: File `{0}` closed"_fmt(
 			m_info.fullPath));
 
@@ -88,6 +105,11 @@ namespace s3d
 
 		assert(InRange<int64>(clampedPos, 0, size()));
 
+		if (isMapped())
+		{
+			return (m_mapped.pos = clampedPos);
+		}
+
 		m_file.file.seekg(clampedPos);
 		m_file.pos = clampedPos;
 		return m_file.pos;
@@ -95,11 +117,24 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::getPos()
 	{
+		if (isMapped())
+		{
+			return m_mapped.pos;
+		}
+
 		return m_file.pos;
 	}
 
 	int64 BinaryReader::BinaryReaderDetail::read(const NonNull<void*> dst, const int64 size)
 	{
+		if (isMapped())
+		{
+			const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - m_mapped.pos));
+			std::memcpy(dst.pointer, (m_mapped.pointer + m_mapped.pos), static_cast<size_t>(readBytes));
+			m_mapped.pos += readBytes;
+			return readBytes;
+		}
+
 		const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - m_file.pos));
 
 		if (readBytes)
@@ -124,6 +159,14 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::read(const NonNull<void*> dst, const int64 pos, const int64 size)
 	{
+		if (isMapped())
+		{
+			const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - pos));
+			std::memcpy(dst.pointer, (m_mapped.pointer + pos), static_cast<size_t>(readBytes));
+			m_mapped.pos = (pos + readBytes);
+			return readBytes;
+		}
+
 		if (pos != setPos(pos))
 		{
 			return 0;
@@ -153,6 +196,13 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 size)
 	{
+		if (isMapped())
+		{
+			const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - m_mapped.pos));
+			std::memcpy(dst.pointer, (m_mapped.pointer + m_mapped.pos), static_cast<size_t>(readBytes));
+			return readBytes;
+		}
+
 		const auto previousPos = getPos();
 
 		const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - m_file.pos));
@@ -180,6 +230,13 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 pos, const int64 size)
 	{
+		if (isMapped())
+		{
+			const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - pos));
+			std::memcpy(dst.pointer, (m_mapped.pointer + pos), static_cast<size_t>(readBytes));
+			return readBytes;
+		}
+
 		const auto previousPos = getPos();
 
 		if (pos != setPos(pos))
@@ -210,8 +267,74 @@ namespace s3d
 		return readBytes;
 	}
 
+	bool BinaryReader::BinaryReaderDetail::supportsReadView() const noexcept
+	{
+		return isMapped();
+	}
+
+	std::span<const Byte> BinaryReader::BinaryReaderDetail::readView(const int64 size)
+	{
+		if (not isMapped())
+		{
+			return{};
+		}
+
+		const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - m_mapped.pos));
+		const std::span<const Byte> view{ (m_mapped.pointer + m_mapped.pos), static_cast<size_t>(readBytes) };
+		m_mapped.pos += readBytes;
+		return view;
+	}
+
 	const FilePath& BinaryReader::BinaryReaderDetail::path() const noexcept
 	{
 		return m_info.fullPath;
 	}
+
+	bool BinaryReader::BinaryReaderDetail::isMapped() const noexcept
+	{
+		return (m_mapped.pointer != nullptr);
+	}
+
+	bool BinaryReader::BinaryReaderDetail::openMapped(const FilePathView path, const int64 fileSize)
+	{
+	# if SIV3D_PLATFORM(WEB)
+
+		// Emscripten のファイルシステムはメモリ上にあるため、メモリマップしても速くならない
+		(void)path;
+		(void)fileSize;
+		return false;
+
+	# else
+
+		if (fileSize < BinaryReader::MemoryMapThreshold)
+		{
+			return false;
+		}
+
+		if ((not m_mapped.view.open(path, MapAll::Yes))
+			|| (not m_mapped.view.data())
+			|| (static_cast<int64>(m_mapped.view.mappedSize()) != fileSize)) SIV3D_UNLIKELY
+		{
+			// メモリマップできない場合は通常の読み込みを使う
+			m_mapped.view.close();
+			return false;
+		}
+
+		m_mapped.pointer = m_mapped.view.data();
+		m_mapped.pos = 0;
+
+		m_info =
+		{
+			.isOpen		= true,
+			.size		= fileSize,
+			.fullPath	= m_mapped.view.path()
+		};
+
+		LOG_INFO(U"📤 BinaryReader: File `{0}` opened (size: {1}, memory-mapped)"_fmt(
+			m_info.fullPath, FormatDataSize(m_info.size)));
+
+		return true;
+
+	# endif
+	}
 }
@@ -14,6 +14,7 @@
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/NonNull.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
 
 namespace s3d
 {
@@ -26,6 +27,14 @@ namespace s3d
 			std::ifstream file;
 			int64 pos = 0;
 		} m_file;
+
+		// BinaryReader::MemoryMapThreshold 以上のファイルは、メモリマップして読み込む
+		struct Mapped
+		{
+			MemoryMappedFileView view;
+			const Byte* pointer = nullptr;
+			int64 pos = 0;
+		} m_mapped;
 		
 		struct Info
 		{
@@ -33,6 +42,8 @@ namespace s3d
 			int64 size = 0;
 			FilePath fullPath;
 		} m_info;
+
+		bool openMapped(FilePathView path, int64 fileSize);
 		
 	public:
 
@@ -60,6 +71,12 @@ namespace s3d
 
 		int64 lookahead(NonNull<void*> buffer, int64 pos, int64 size);
 
+		bool supportsReadView() const noexcept;
+
+		std::span<const Byte> readView(int64 size);
+
+		bool isMapped() const noexcept;
+
 		const FilePath& path() const noexcept;
 	};
 }
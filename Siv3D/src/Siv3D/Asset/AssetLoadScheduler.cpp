@@ -0,0 +1,379 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "AssetLoadScheduler.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		static uint64 RunRead(const AssetLoadJob& job) noexcept
+		{
+			try
+			{
+				return job.read();
+			}
+			catch (...)
+			{
+				LOG_FAIL(U"AssetLoadScheduler: an exception was thrown while reading an asset");
+				return 0;
+			}
+		}
+
+		static void RunDecode(const AssetLoadJob& job) noexcept
+		{
+			try
+			{
+				job.decode();
+			}
+			catch (...)
+			{
+				LOG_FAIL(U"AssetLoadScheduler: an exception was thrown while decoding an asset");
+			}
+		}
+	}
+
+	AssetLoadScheduler::~AssetLoadScheduler()
+	{
+		shutdown();
+	}
+
+	std::shared_ptr<AssetLoadJob> AssetLoadScheduler::submit(std::function<uint64()> read, std::function<void()> decode, const AssetLoadPriority priority)
+	{
+		auto job = std::make_shared<AssetLoadJob>();
+		job->read = std::move(read);
+		job->decode = std::move(decode);
+		job->priority = priority;
+		job->readFinished = (not job->read);
+
+		std::lock_guard lock{ m_mutex };
+
+		if (not m_decodeThreads)
+		{
+			startThreads();
+		}
+
+		job->sequence = m_sequence++;
+
+		if (job->readFinished)
+		{
+			pushDecode(job);
+		}
+		else
+		{
+			++m_stats.queuedRead;
+			m_readQueue.push(job);
+			m_readAvailable.notify_one();
+		}
+
+		return job;
+	}
+
+	bool AssetLoadScheduler::cancel(const std::shared_ptr<AssetLoadJob>& job)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		if (job->state != AssetLoadJob::State::Queued)
+		{
+			return false;
+		}
+
+		if (job->readFinished)
+		{
+			--m_stats.queuedDecode;
+		}
+		else
+		{
+			--m_stats.queuedRead;
+		}
+
+		job->state = AssetLoadJob::State::Canceled;
+		++m_stats.canceled;
+		m_jobFinished.notify_all();
+
+		return true;
+	}
+
+	size_t AssetLoadScheduler::cancelAll()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		size_t canceledCount = 0;
+
+		for (auto* queue : { &m_readQueue, &m_decodeQueue })
+		{
+			while (not queue->empty())
+			{
+				const auto job = queue->top();
+				queue->pop();
+
+				if (job->state == AssetLoadJob::State::Queued)
+				{
+					job->state = AssetLoadJob::State::Canceled;
+					++canceledCount;
+				}
+			}
+		}
+
+		m_stats.queuedRead = 0;
+		m_stats.queuedDecode = 0;
+		m_stats.canceled += canceledCount;
+		m_jobFinished.notify_all();
+
+		return canceledCount;
+	}
+
+	void AssetLoadScheduler::wait(const std::shared_ptr<AssetLoadJob>& job, const std::function<void()>& pump)
+	{
+		std::unique_lock lock{ m_mutex };
+
+		for (;;)
+		{
+			switch (job->state)
+			{
+			case AssetLoadJob::State::Done:
+			case AssetLoadJob::State::Canceled:
+				return;
+			case AssetLoadJob::State::Queued:
+				{
+					// ワーカーを待たずに、呼び出したスレッドで残りのステージを実行する
+					markRunning(*job);
+					const bool needsRead = (not job->readFinished);
+					lock.unlock();
+
+					const uint64 readBytes = (needsRead ? detail::RunRead(*job) : 0);
+					detail::RunDecode(*job);
+
+					lock.lock();
+					m_stats.readBytes += readBytes;
+					job->readFinished = true;
+					finish(*job);
+					return;
+				}
+			case AssetLoadJob::State::Running:
+				if (pump)
+				{
+					lock.unlock();
+					pump();
+					lock.lock();
+
+					if (job->state != AssetLoadJob::State::Running)
+					{
+						continue;
+					}
+				}
+
+				m_jobFinished.wait_for(lock, std::chrono::milliseconds{ 1 });
+				break;
+			}
+		}
+	}
+
+	void AssetLoadScheduler::setThreadCount(const size_t readThreads, const size_t decodeThreads)
+	{
+		bool running = false;
+		{
+			std::lock_guard lock{ m_mutex };
+			running = (not m_decodeThreads.isEmpty());
+		}
+
+		if (running)
+		{
+			stopThreads();
+		}
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_readThreadCount = Max<size_t>(readThreads, 1);
+			m_decodeThreadCount = Max<size_t>(decodeThreads, 1);
+
+			if (running)
+			{
+				startThreads();
+			}
+		}
+	}
+
+	AssetLoadStats AssetLoadScheduler::getStats() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_stats;
+	}
+
+	void AssetLoadScheduler::shutdown()
+	{
+		cancelAll();
+
+		stopThreads();
+	}
+
+	void AssetLoadScheduler::startThreads()
+	{
+		if (m_decodeThreadCount == 0)
+		{
+			// I/O 待ちのスレッドとメインスレッドの分を残す
+			m_decodeThreadCount = Clamp<size_t>((Threading::GetConcurrency() / 2), 1, 4);
+		}
+
+		m_stop = false;
+
+		for (size_t i = 0; i < m_readThreadCount; ++i)
+		{
+			m_readThreads.emplace_back([this]() { readLoop(); });
+		}
+
+		for (size_t i = 0; i < m_decodeThreadCount; ++i)
+		{
+			m_decodeThreads.emplace_back([this]() { decodeLoop(); });
+		}
+
+		LOG_TRACE(U"AssetLoadScheduler: started ({} read threads, {} decode threads)"_fmt(m_readThreadCount, m_decodeThreadCount));
+	}
+
+	void AssetLoadScheduler::stopThreads()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stop = true;
+		}
+
+		m_readAvailable.notify_all();
+		m_decodeAvailable.notify_all();
+
+		for (auto& thread : m_readThreads)
+		{
+			thread.join();
+		}
+
+		for (auto& thread : m_decodeThreads)
+		{
+			thread.join();
+		}
+
+		m_readThreads.clear();
+		m_decodeThreads.clear();
+	}
+
+	void AssetLoadScheduler::readLoop()
+	{
+		std::unique_lock lock{ m_mutex };
+
+		for (;;)
+		{
+			m_readAvailable.wait(lock, [this]() { return (m_stop || (not m_readQueue.empty())); });
+
+			if (m_stop)
+			{
+				return;
+			}
+
+			const auto job = popQueued(m_readQueue);
+
+			if (not job)
+			{
+				continue;
+			}
+
+			lock.unlock();
+			const uint64 readBytes = detail::RunRead(*job);
+			lock.lock();
+
+			m_stats.readBytes += readBytes;
+			job->readFinished = true;
+			job->state = AssetLoadJob::State::Queued;
+			--m_stats.running;
+			pushDecode(job);
+		}
+	}
+
+	void AssetLoadScheduler::decodeLoop()
+	{
+		std::unique_lock lock{ m_mutex };
+
+		for (;;)
+		{
+			m_decodeAvailable.wait(lock, [this]() { return (m_stop || (not m_decodeQueue.empty())); });
+
+			if (m_stop)
+			{
+				return;
+			}
+
+			const auto job = popQueued(m_decodeQueue);
+
+			if (not job)
+			{
+				continue;
+			}
+
+			lock.unlock();
+			detail::RunDecode(*job);
+			lock.lock();
+
+			finish(*job);
+		}
+	}
+
+	std::shared_ptr<AssetLoadJob> AssetLoadScheduler::popQueued(JobQueue& queue)
+	{
+		while (not queue.empty())
+		{
+			auto job = queue.top();
+			queue.pop();
+
+			if (job->state == AssetLoadJob::State::Queued)
+			{
+				markRunning(*job);
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void AssetLoadScheduler::markRunning(AssetLoadJob& job)
+	{
+		if (job.readFinished)
+		{
+			--m_stats.queuedDecode;
+		}
+		else
+		{
+			--m_stats.queuedRead;
+		}
+
+		++m_stats.running;
+		job.state = AssetLoadJob::State::Running;
+	}
+
+	void AssetLoadScheduler::pushDecode(const std::shared_ptr<AssetLoadJob>& job)
+	{
+		++m_stats.queuedDecode;
+		m_decodeQueue.push(job);
+		m_decodeAvailable.notify_one();
+
+		// I/O ステージの完了を待っている wait() を起こす
+		m_jobFinished.notify_all();
+	}
+
+	void AssetLoadScheduler::finish(AssetLoadJob& job)
+	{
+		job.state = AssetLoadJob::State::Done;
+		--m_stats.running;
+		++m_stats.completed;
+		m_jobFinished.notify_all();
+	}
+}
@@ -0,0 +1,159 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <condition_variable>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <queue>
+# include <thread>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/AssetLoadPriority.hpp>
+# include <Siv3D/AssetLoadStats.hpp>
+
+namespace s3d
+{
+	// 非同期ロード 1 件分のジョブ。状態はすべて AssetLoadScheduler のミューテックスで保護される
+	struct AssetLoadJob
+	{
+		enum class State : uint8
+		{
+			// いずれかのキューで待機中
+			Queued,
+
+			// いずれかのステージを実行中
+			Running,
+
+			Done,
+
+			Canceled,
+		};
+
+		// I/O ステージ。読み込んだバイト数を返す。空の場合はデコードステージから始める
+		std::function<uint64()> read;
+
+		// デコードステージ
+		std::function<void()> decode;
+
+		AssetLoadPriority priority = AssetLoadPriority::Normal;
+
+		// 同じ優先度のジョブを要求順に処理するための通し番号
+		uint64 sequence = 0;
+
+		State state = State::Queued;
+
+		bool readFinished = false;
+	};
+
+	// I/O とデコードを別々の、スレッド数が制限されたワーカーで処理するアセットのロードスケジューラ
+	class AssetLoadScheduler
+	{
+	public:
+
+		AssetLoadScheduler() = default;
+
+		~AssetLoadScheduler();
+
+		AssetLoadScheduler(const AssetLoadScheduler&) = delete;
+
+		AssetLoadScheduler& operator =(const AssetLoadScheduler&) = delete;
+
+		// ジョブを登録する。ワーカースレッドは最初の登録時に作成される
+		[[nodiscard]]
+		std::shared_ptr<AssetLoadJob> submit(std::function<uint64()> read, std::function<void()> decode, AssetLoadPriority priority);
+
+		// 開始していないジョブを取り消す。取り消した場合 true
+		bool cancel(const std::shared_ptr<AssetLoadJob>& job);
+
+		// 開始していないすべてのジョブを取り消し、取り消した数を返す
+		size_t cancelAll();
+
+		// ジョブの完了を待つ。キューで待機中の場合は呼び出したスレッドで残りのステージを実行する
+		// 実行中のジョブを待つ間は pump を繰り返し呼ぶ（メインスレッドでのテクスチャ作成の要求を処理するため）
+		void wait(const std::shared_ptr<AssetLoadJob>& job, const std::function<void()>& pump);
+
+		// スレッド数を変更する。実行中のジョブが終わるまで待ってからスレッドを作り直す
+		void setThreadCount(size_t readThreads, size_t decodeThreads);
+
+		// キューの状況と累計を返す（1 秒あたりの値は含まない）
+		[[nodiscard]]
+		AssetLoadStats getStats() const;
+
+		// すべてのスレッドを終了する。キューに残っているジョブは取り消される
+		void shutdown();
+
+	private:
+
+		struct Compare
+		{
+			[[nodiscard]]
+			bool operator ()(const std::shared_ptr<AssetLoadJob>& a, const std::shared_ptr<AssetLoadJob>& b) const noexcept
+			{
+				if (a->priority != b->priority)
+				{
+					return (a->priority < b->priority);
+				}
+
+				return (a->sequence > b->sequence);
+			}
+		};
+
+		// 取り消されたジョブや、wait() で実行されたジョブはキューに残り、取り出し時に捨てられる
+		using JobQueue = std::priority_queue<std::shared_ptr<AssetLoadJob>, std::vector<std::shared_ptr<AssetLoadJob>>, Compare>;
+
+		mutable std::mutex m_mutex;
+
+		std::condition_variable m_readAvailable;
+
+		std::condition_variable m_decodeAvailable;
+
+		std::condition_variable m_jobFinished;
+
+		JobQueue m_readQueue;
+
+		JobQueue m_decodeQueue;
+
+		Array<std::thread> m_readThreads;
+
+		Array<std::thread> m_decodeThreads;
+
+		size_t m_readThreadCount = 2;
+
+		size_t m_decodeThreadCount = 0;
+
+		bool m_stop = false;
+
+		uint64 m_sequence = 0;
+
+		AssetLoadStats m_stats;
+
+		void startThreads();
+
+		void stopThreads();
+
+		void readLoop();
+
+		void decodeLoop();
+
+		// キューから待機中のジョブを取り出して実行状態にする。無い場合は nullptr
+		[[nodiscard]]
+		std::shared_ptr<AssetLoadJob> popQueued(JobQueue& queue);
+
+		// 待機中のジョブを実行状態にする
+		void markRunning(AssetLoadJob& job);
+
+		void pushDecode(const std::shared_ptr<AssetLoadJob>& job);
+
+		void finish(AssetLoadJob& job);
+	};
+}
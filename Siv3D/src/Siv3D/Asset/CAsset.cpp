@@ -13,6 +13,7 @@
 # include <Siv3D/Texture/ITexture.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Time.hpp>
 
 namespace s3d
 {
@@ -45,6 +46,10 @@ namespace s3d
 	{
 		LOG_SCOPED_TRACE(U"CAsset::~CAsset()");
 
+		m_shuttingDown = true;
+
+		m_loadScheduler.cancelAll();
+
 		SIV3D_ENGINE(Texture)->updateAsyncTextureLoad(Largest<size_t>);
 
 		// wait for all
@@ -55,11 +60,15 @@ namespace s3d
 				asset.second->wait();
 			}
 		}
+
+		m_loadScheduler.shutdown();
 	}
 
 	void CAsset::update()
 	{
-		SIV3D_ENGINE(Texture)->updateAsyncTextureLoad(4);
+		m_uploadedBytes += SIV3D_ENGINE(Texture)->updateAsyncTextureLoad(m_uploadBudget);
+
+		updateThroughput();
 	}
 
 	bool CAsset::registerAsset(const AssetType assetType, const AssetNameView name, std::unique_ptr<IAsset>&& asset)
@@ -127,7 +136,7 @@ namespace s3d
 		return it->second->load(String{ hint });
 	}
 
-	void CAsset::loadAsync(const AssetType assetType, const AssetNameView name, const StringView hint)
+	void CAsset::loadAsync(const AssetType assetType, const AssetNameView name, const StringView hint, const AssetLoadPriority priority)
 	{
 		auto& assetList = m_assetLists[FromEnum(assetType)];
 		const auto it = assetList.find(name);
@@ -138,9 +147,31 @@ namespace s3d
 			return;
 		}
 
+		it->second->setLoadPriority(priority);
+
 		it->second->loadAsync(String{ hint });
 	}
 
+	bool CAsset::cancelLoadAsync(const AssetType assetType, const AssetNameView name)
+	{
+		auto& assetList = m_assetLists[FromEnum(assetType)];
+		const auto it = assetList.find(name);
+
+		if (it == assetList.end())
+		{
+			return false;
+		}
+
+		if (not it->second->cancelAsync())
+		{
+			return false;
+		}
+
+		LOG_TRACE(U"ℹ️ {}Asset: Async loading of `{}` canceled"_fmt(detail::GetAssetTypeName(assetType), name));
+
+		return true;
+	}
+
 	void CAsset::wait(const AssetType assetType, const AssetNameView name)
 	{
 		auto& assetList = m_assetLists[FromEnum(assetType)];
@@ -244,4 +275,108 @@ namespace s3d
 
 		return result;
 	}
+
+	std::shared_ptr<AssetLoadJob> CAsset::submitLoad(std::function<uint64()> read, std::function<void()> decode, const AssetLoadPriority priority)
+	{
+		return m_loadScheduler.submit(std::move(read), std::move(decode), priority);
+	}
+
+	void CAsset::waitLoad(const std::shared_ptr<AssetLoadJob>& job)
+	{
+		// OpenGL などでは、ワーカーがメインスレッドでのテクスチャ作成を待っていることがあるため、待機中も要求を処理する
+		m_loadScheduler.wait(job, [this]()
+			{
+				if (m_shuttingDown)
+				{
+					SIV3D_ENGINE(Texture)->updateAsyncTextureLoad(Largest<size_t>);
+				}
+				else
+				{
+					m_uploadedBytes += SIV3D_ENGINE(Texture)->updateAsyncTextureLoad(m_uploadBudget);
+				}
+			});
+	}
+
+	bool CAsset::cancelLoad(const std::shared_ptr<AssetLoadJob>& job)
+	{
+		return m_loadScheduler.cancel(job);
+	}
+
+	size_t CAsset::cancelAllLoads()
+	{
+		size_t canceledCount = 0;
+
+		for (auto& assetList : m_assetLists)
+		{
+			for (auto&& [name, asset] : assetList)
+			{
+				if (asset->cancelAsync())
+				{
+					++canceledCount;
+				}
+			}
+		}
+
+		if (canceledCount)
+		{
+			LOG_TRACE(U"ℹ️ Asset: {} async loads canceled"_fmt(canceledCount));
+		}
+
+		return canceledCount;
+	}
+
+	void CAsset::setLoaderThreadCount(const size_t readThreads, const size_t decodeThreads)
+	{
+		m_loadScheduler.setThreadCount(readThreads, decodeThreads);
+	}
+
+	void CAsset::setUploadBudget(const size_t bytes)
+	{
+		m_uploadBudget = bytes;
+	}
+
+	size_t CAsset::getUploadBudget() const
+	{
+		return m_uploadBudget;
+	}
+
+	AssetLoadStats CAsset::getLoadStats() const
+	{
+		AssetLoadStats stats = m_loadScheduler.getStats();
+		stats.uploadedBytes = m_uploadedBytes;
+		stats.completedPerSecond = m_throughput.completedPerSecond;
+		stats.readBytesPerSecond = m_throughput.readBytesPerSecond;
+		stats.uploadedBytesPerSecond = m_throughput.uploadedBytesPerSecond;
+		return stats;
+	}
+
+	void CAsset::updateThroughput()
+	{
+		const uint64 time = Time::GetMicrosec();
+
+		if (m_throughput.startTimeMicrosec == 0)
+		{
+			m_throughput.startTimeMicrosec = time;
+			return;
+		}
+
+		const uint64 elapsed = (time - m_throughput.startTimeMicrosec);
+
+		if (elapsed < 1'000'000)
+		{
+			return;
+		}
+
+		const AssetLoadStats stats = m_loadScheduler.getStats();
+		const uint64 uploadedBytes = m_uploadedBytes;
+		const double seconds = (elapsed / 1'000'000.0);
+
+		m_throughput.completedPerSecond = ((stats.completed - m_throughput.completed) / seconds);
+		m_throughput.readBytesPerSecond = ((stats.readBytes - m_throughput.readBytes) / seconds);
+		m_throughput.uploadedBytesPerSecond = ((uploadedBytes - m_throughput.uploadedBytes) / seconds);
+		m_throughput.startTimeMicrosec = time;
+		m_throughput.completed = stats.completed;
+		m_throughput.readBytes = stats.readBytes;
+		m_throughput.uploadedBytes = uploadedBytes;
+	}
 }
@@ -13,6 +13,7 @@
 # include <Siv3D/HashTable.hpp>
 # include <Siv3D/String.hpp>
 # include "IAsset.hpp"
+# include "AssetLoadScheduler.hpp"
 
 namespace s3d
 {
@@ -34,7 +35,9 @@ namespace s3d
 
 		bool load(AssetType assetType, AssetNameView name, StringView hint) override;
 
-		void loadAsync(AssetType assetType, AssetNameView name, StringView hint) override;
+		void loadAsync(AssetType assetType, AssetNameView name, StringView hint, AssetLoadPriority priority) override;
+
+		bool cancelLoadAsync(AssetType assetType, AssetNameView name) override;
 
 		void wait(AssetType assetType, AssetNameView name) override;
 
@@ -50,8 +53,58 @@ namespace s3d
 
 		HashTable<AssetName, AssetInfo> enumerate(AssetType assetType) override;
 
+		std::shared_ptr<AssetLoadJob> submitLoad(std::function<uint64()> read, std::function<void()> decode, AssetLoadPriority priority) override;
+
+		void waitLoad(const std::shared_ptr<AssetLoadJob>& job) override;
+
+		bool cancelLoad(const std::shared_ptr<AssetLoadJob>& job) override;
+
+		size_t cancelAllLoads() override;
+
+		void setLoaderThreadCount(size_t readThreads, size_t decodeThreads) override;
+
+		void setUploadBudget(size_t bytes) override;
+
+		size_t getUploadBudget() const override;
+
+		AssetLoadStats getLoadStats() const override;
+
 	private:
 
+		// 1 フレームあたりに GPU に転送するテクスチャデータの上限の初期値
+		static constexpr size_t DefaultUploadBudget = (32 * 1024 * 1024);
+
 		std::array<HashTable<String, std::unique_ptr<IAsset>>, 5> m_assetLists;
+
+		// アセットより先に破棄され、実行中のジョブが無いことを保証する
+		AssetLoadScheduler m_loadScheduler;
+
+		size_t m_uploadBudget = DefaultUploadBudget;
+
+		std::atomic<uint64> m_uploadedBytes = 0;
+
+		bool m_shuttingDown = false;
+
+		// スループットの計測
+		struct ThroughputWindow
+		{
+			uint64 startTimeMicrosec = 0;
+
+			uint64 completed = 0;
+
+			uint64 readBytes = 0;
+
+			uint64 uploadedBytes = 0;
+
+			double completedPerSecond = 0.0;
+
+			double readBytesPerSecond = 0.0;
+
+			double uploadedBytesPerSecond = 0.0;
+		};
+
+		ThroughputWindow m_throughput;
+
+		void updateThroughput();
 	};
 }
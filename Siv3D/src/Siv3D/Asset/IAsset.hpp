@@ -16,6 +16,8 @@
 
 namespace s3d
 {
+	struct AssetLoadJob;
+
 	enum class AssetType
 	{
 		Audio,
@@ -47,7 +49,9 @@ namespace s3d
 
 		virtual bool load(AssetType assetType, AssetNameView name, StringView hint) = 0;
 
-		virtual void loadAsync(AssetType assetType, AssetNameView name, StringView hint) = 0;
+		virtual void loadAsync(AssetType assetType, AssetNameView name, StringView hint, AssetLoadPriority priority) = 0;
+
+		virtual bool cancelLoadAsync(AssetType assetType, AssetNameView name) = 0;
 
 		virtual void wait(AssetType assetType, AssetNameView name) = 0;
 
@@ -62,5 +66,21 @@ namespace s3d
 		virtual void unregisterAll(AssetType assetType) = 0;
 
 		virtual HashTable<AssetName, AssetInfo> enumerate(AssetType assetType) = 0;
+
+		virtual std::shared_ptr<AssetLoadJob> submitLoad(std::function<uint64()> read, std::function<void()> decode, AssetLoadPriority priority) = 0;
+
+		virtual void waitLoad(const std::shared_ptr<AssetLoadJob>& job) = 0;
+
+		virtual bool cancelLoad(const std::shared_ptr<AssetLoadJob>& job) = 0;
+
+		virtual size_t cancelAllLoads() = 0;
+
+		virtual void setLoaderThreadCount(size_t readThreads, size_t decodeThreads) = 0;
+
+		virtual void setUploadBudget(size_t bytes) = 0;
+
+		virtual size_t getUploadBudget() const = 0;
+
+		virtual AssetLoadStats getLoadStats() const = 0;
 	};
 }
@@ -34,4 +34,24 @@ namespace s3d
 	{
 		return m_tags;
 	}
+
+	AssetLoadPriority IAsset::IAssetDetail::getLoadPriority() const
+	{
+		return m_loadPriority;
+	}
+
+	void IAsset::IAssetDetail::setLoadPriority(const AssetLoadPriority priority)
+	{
+		m_loadPriority = priority;
+	}
+
+	const std::shared_ptr<AssetLoadJob>& IAsset::IAssetDetail::getLoadJob() const
+	{
+		return m_loadJob;
+	}
+
+	void IAsset::IAssetDetail::setLoadJob(std::shared_ptr<AssetLoadJob> job)
+	{
+		m_loadJob = std::move(job);
+	}
 }
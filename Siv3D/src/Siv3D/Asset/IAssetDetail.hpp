@@ -11,6 +11,7 @@
 
 # pragma once
 # include <Siv3D/Asset.hpp>
+# include "AssetLoadScheduler.hpp"
 
 namespace s3d
 {
@@ -32,10 +33,24 @@ namespace s3d
 		[[nodiscard]]
 		const Array<AssetTag>& getTags() const;
 
+		[[nodiscard]]
+		AssetLoadPriority getLoadPriority() const;
+
+		void setLoadPriority(AssetLoadPriority priority);
+
+		[[nodiscard]]
+		const std::shared_ptr<AssetLoadJob>& getLoadJob() const;
+
+		void setLoadJob(std::shared_ptr<AssetLoadJob> job);
+
 	private:
 
 		Array<String> m_tags;
 
 		std::atomic<AssetState> m_state = AssetState::Uninitialized;
+
+		AssetLoadPriority m_loadPriority = AssetLoadPriority::Normal;
+
+		std::shared_ptr<AssetLoadJob> m_loadJob;
 	};
 }
@@ -10,7 +10,10 @@
 //-----------------------------------------------
 
 # include <Siv3D/Asset.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
 # include "IAssetDetail.hpp"
+# include "IAsset.hpp"
 
 namespace s3d
 {
@@ -59,4 +62,100 @@ namespace s3d
 	{
 		pImpl->setState(state);
 	}
+
+	void IAsset::setLoadPriority(const AssetLoadPriority priority)
+	{
+		pImpl->setLoadPriority(priority);
+	}
+
+	AssetLoadPriority IAsset::getLoadPriority() const
+	{
+		return pImpl->getLoadPriority();
+	}
+
+	bool IAsset::cancelAsync()
+	{
+		if (not isAsyncLoading())
+		{
+			return false;
+		}
+
+		const auto job = pImpl->getLoadJob();
+
+		if ((not job) || (not SIV3D_ENGINE(Asset)->cancelLoad(job)))
+		{
+			return false;
+		}
+
+		pImpl->setLoadJob(nullptr);
+
+		setState(AssetState::Uninitialized);
+
+		return true;
+	}
+
+	void IAsset::requestAsyncLoad(std::function<uint64()> read, std::function<bool()> decode)
+	{
+		setState(AssetState::AsyncLoading);
+
+		auto job = SIV3D_ENGINE(Asset)->submitLoad(std::move(read),
+			[this, decode = std::move(decode)]()
+			{
+				bool result = false;
+
+				try
+				{
+					result = decode();
+				}
+				catch (...)
+				{
+					LOG_FAIL(U"IAsset: an exception was thrown while loading an asset");
+				}
+
+				setState(result ? AssetState::Loaded : AssetState::Failed);
+			}, pImpl->getLoadPriority());
+
+		pImpl->setLoadJob(std::move(job));
+	}
+
+	void IAsset::waitAsyncLoad()
+	{
+		if (const auto job = pImpl->getLoadJob())
+		{
+			SIV3D_ENGINE(Asset)->waitLoad(job);
+		}
+	}
+
+	namespace Asset
+	{
+		void SetLoaderThreadCount(const size_t readThreads, const size_t decodeThreads)
+		{
+			SIV3D_ENGINE(Asset)->setLoaderThreadCount(readThreads, decodeThreads);
+		}
+
+		void SetUploadBudget(const size_t bytes)
+		{
+			SIV3D_ENGINE(Asset)->setUploadBudget(bytes);
+		}
+
+		size_t GetUploadBudget()
+		{
+			return SIV3D_ENGINE(Asset)->getUploadBudget();
+		}
+
+		size_t GetLoadQueueDepth()
+		{
+			return SIV3D_ENGINE(Asset)->getLoadStats().queueDepth();
+		}
+
+		AssetLoadStats GetLoadStats()
+		{
+			return SIV3D_ENGINE(Asset)->getLoadStats();
+		}
+
+		size_t CancelAllLoads()
+		{
+			return SIV3D_ENGINE(Asset)->cancelAllLoads();
+		}
+	}
 }
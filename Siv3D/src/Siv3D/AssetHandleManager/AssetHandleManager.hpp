@@ -10,10 +10,14 @@
 //-----------------------------------------------
 
 # pragma once
+# include <array>
+# include <atomic>
+# include <iterator>
 # include <memory>
 # include <mutex>
+# include <utility>
 # include <Siv3D/Common.hpp>
-# include <Siv3D/HashTable.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
@@ -21,88 +25,294 @@
 
 namespace s3d
 {
+	/// @brief アセットのデータを管理するクラス
+	/// @remark アセット ID の下位ビットはスロット番号、上位ビットは世代を表します。
+	/// @remark `operator []` はロックを取らずに参照でき、追加と削除のみ mutex で保護されます。
 	template <class IDType, class Data>
 	class AssetHandleManager
 	{
 	private:
 
-		using MapType = HashTable<IDType, std::unique_ptr<Data>>;
+		static constexpr size_t PageSizeBits = 12;
 
-		MapType m_data;
+		static constexpr size_t PageSize = (size_t{ 1 } << PageSizeBits);
 
-		String m_assetTypeName;
+		static constexpr size_t MaxPages = 4096;
+
+		static constexpr uint32 MaxSlots = static_cast<uint32>(PageSize * MaxPages);
+
+		using ValueType = typename IDType::value_type;
+
+		// 64-bit: スロット番号 32 ビット + 世代 32 ビット, 32-bit: スロット番号 24 ビット + 世代 8 ビット
+		static constexpr uint32 IndexBits = ((sizeof(ValueType) == 4) ? 24 : 32);
+
+		static constexpr ValueType IndexMask = ((ValueType{ 1 } << IndexBits) - 1);
+
+		static constexpr uint32 GenerationMask = static_cast<uint32>(Largest<ValueType> >> IndexBits);
+
+		using EntryType = std::pair<IDType, std::unique_ptr<Data>>;
+
+		struct Slot
+		{
+			/// @brief 現在のスロットの世代。削除のたびに進み、古い ID からの参照を無効にする
+			std::atomic<uint32> generation = 0;
+
+			/// @brief 参照用のデータのポインタ
+			std::atomic<Data*> pData = nullptr;
+
+			/// @brief 所有権と ID（追加・削除・列挙時のみ使用）
+			EntryType entry;
+		};
+
+		using Page = std::array<Slot, PageSize>;
 
-		typename IDType::value_type m_idCount = 0;
+		std::array<std::atomic<Page*>, MaxPages> m_pages{};
 
-		bool m_idFilled = false;
+		/// @brief これまでに使われたスロット数
+		uint32 m_slotCount = 0;
+
+		/// @brief 再利用できるスロット番号
+		Array<uint32> m_freeSlots;
+
+		size_t m_size = 0;
+
+		String m_assetTypeName;
 
 		std::mutex m_mutex;
 
-	public:
+		[[nodiscard]]
+		static constexpr uint32 GetIndex(const IDType id) noexcept
+		{
+			return static_cast<uint32>(id.value() & IndexMask);
+		}
 
-		using iterator = typename MapType::iterator;
-		using const_iterator = typename MapType::const_iterator;
+		[[nodiscard]]
+		static constexpr uint32 GetGeneration(const IDType id) noexcept
+		{
+			return static_cast<uint32>(id.value() >> IndexBits);
+		}
 
-		explicit AssetHandleManager(const String& name)
-			: m_assetTypeName{ name } {}
+		[[nodiscard]]
+		static constexpr IDType MakeID(const uint32 index, const uint32 generation) noexcept
+		{
+			return IDType{ ((static_cast<ValueType>(generation) << IndexBits) | index) };
+		}
 
-		void setNullData(std::unique_ptr<Data>&& data)
+		[[nodiscard]]
+		static constexpr uint32 NextGeneration(const uint32 index, const uint32 generation) noexcept
 		{
-			m_data.emplace(IDType::NullAsset(), std::move(data));
+			const uint32 nextGeneration = ((generation + 1) & GenerationMask);
 
-			LOG_TRACE(U"💠 Created {0}[0(null)]"_fmt(m_assetTypeName));
+			// Invalid ID と重なる組み合わせは使わない
+			return MakeID(index, nextGeneration).isInvalid() ? 0 : nextGeneration;
 		}
 
 		[[nodiscard]]
-		Data* operator [](const IDType id)
+		Slot* getSlot(const uint32 index) const noexcept
 		{
-			std::lock_guard lock{ m_mutex };
+			const size_t pageIndex = (index >> PageSizeBits);
 
-			return m_data[id].get();
+			if (MaxPages <= pageIndex)
+			{
+				return nullptr;
+			}
+
+			if (Page* page = m_pages[pageIndex].load(std::memory_order_acquire))
+			{
+				return &(*page)[index & (PageSize - 1)];
+			}
+
+			return nullptr;
 		}
 
+		/// @brief 新しいスロットを確保します。m_mutex をロックした状態で呼ぶ必要があります。
 		[[nodiscard]]
-		IDType add(std::unique_ptr<Data>&& data, [[maybe_unused]] const String& info = U"")
+		Slot* allocateSlot(uint32& index)
 		{
-			std::lock_guard lock{ m_mutex };
+			if (m_freeSlots)
+			{
+				index = m_freeSlots.back();
+				m_freeSlots.pop_back();
+				return getSlot(index);
+			}
+
+			if (m_slotCount == MaxSlots)
+			{
+				return nullptr;
+			}
+
+			index = m_slotCount++;
 
-			if (++m_idCount == IDType::InvalidID)
+			const size_t pageIndex = (index >> PageSizeBits);
+
+			if (m_pages[pageIndex].load(std::memory_order_relaxed) == nullptr)
 			{
-				m_idFilled = true;
-				m_idCount = 0;
+				m_pages[pageIndex].store(new Page, std::memory_order_release);
 			}
 
-			if (not m_idFilled)
+			return getSlot(index);
+		}
+
+		template <class EntryT, class ManagerPointer>
+		class IteratorBase
+		{
+		public:
+
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= EntryType;
+			using difference_type	= std::ptrdiff_t;
+			using pointer			= EntryT*;
+			using reference			= EntryT&;
+
+			IteratorBase() = default;
+
+			IteratorBase(ManagerPointer manager, const uint32 index)
+				: m_manager{ manager }
+				, m_index{ index }
 			{
-				m_data.emplace(m_idCount, std::move(data));
+				skipEmpty();
+			}
 
-				LOG_TRACE(U"💠 Created {0}[{1}] {2}"_fmt(m_assetTypeName, m_idCount, info));
+			[[nodiscard]]
+			reference operator *() const
+			{
+				return m_manager->getSlot(m_index)->entry;
+			}
 
-				return IDType(m_idCount);
+			[[nodiscard]]
+			pointer operator ->() const
+			{
+				return &m_manager->getSlot(m_index)->entry;
 			}
-			else
+
+			IteratorBase& operator ++()
 			{
-				if (m_data.size() == (IDType::InvalidID - 1))
-				{
-					LOG_FAIL(U"❌ No more {0}s can be created"_fmt(m_assetTypeName));
+				++m_index;
+				skipEmpty();
+				return *this;
+			}
 
-					return IDType::NullAsset();
-				}
+			IteratorBase operator ++(int)
+			{
+				IteratorBase tmp = *this;
+				++(*this);
+				return tmp;
+			}
 
-				while (++m_idCount < IDType::InvalidID)
+			[[nodiscard]]
+			bool operator ==(const IteratorBase& other) const noexcept
+			{
+				return (m_index == other.m_index);
+			}
+
+			[[nodiscard]]
+			bool operator !=(const IteratorBase& other) const noexcept
+			{
+				return (m_index != other.m_index);
+			}
+
+		private:
+
+			ManagerPointer m_manager = nullptr;
+
+			uint32 m_index = 0;
+
+			void skipEmpty()
+			{
+				while ((m_index < m_manager->m_slotCount)
+					&& (not m_manager->getSlot(m_index)->entry.second))
 				{
-					if (m_data.find(IDType(++m_idCount)) == m_data.end())
-					{
-						m_data.emplace(m_idCount, std::move(data));
+					++m_index;
+				}
+			}
+		};
+
+	public:
+
+		using iterator = IteratorBase<EntryType, AssetHandleManager*>;
+		using const_iterator = IteratorBase<const EntryType, const AssetHandleManager*>;
+
+		explicit AssetHandleManager(const String& name)
+			: m_assetTypeName{ name } {}
+
+		~AssetHandleManager()
+		{
+			for (auto& page : m_pages)
+			{
+				delete page.exchange(nullptr);
+			}
+		}
+
+		AssetHandleManager(const AssetHandleManager&) = delete;
 
-						LOG_TRACE(U"💠 Created {0}[{1}] {2}"_fmt(m_assetTypeName, m_idCount, info));
+		AssetHandleManager& operator =(const AssetHandleManager&) = delete;
 
-						return IDType(m_idCount);
+		void setNullData(std::unique_ptr<Data>&& data)
+		{
+			std::lock_guard lock{ m_mutex };
+
+			uint32 index = 0;
+			Slot* slot = allocateSlot(index);
+			assert(index == 0);
+
+			slot->pData.store(data.get(), std::memory_order_release);
+			slot->entry = EntryType{ IDType::NullAsset(), std::move(data) };
+			++m_size;
+
+			LOG_TRACE(U"💠 Created {0}[0(null)]"_fmt(m_assetTypeName));
+		}
+
+		/// @brief ID に対応するデータを返します。
+		/// @param id アセット ID
+		/// @return ID に対応するデータ。ID が既に削除されている場合は Null アセットのデータ
+		/// @remark ロックを取りません。任意のスレッドから呼べます。
+		[[nodiscard]]
+		Data* operator [](const IDType id) const noexcept
+		{
+			if (const Slot* slot = getSlot(GetIndex(id)))
+			{
+				if (slot->generation.load(std::memory_order_acquire) == GetGeneration(id))
+				{
+					if (Data* pData = slot->pData.load(std::memory_order_acquire))
+					{
+						return pData;
 					}
 				}
+			}
+
+			// 削除済み、または不正な ID の場合は Null アセットを返す
+			if (const Slot* nullSlot = getSlot(0))
+			{
+				return nullSlot->pData.load(std::memory_order_acquire);
+			}
+
+			return nullptr;
+		}
+
+		[[nodiscard]]
+		IDType add(std::unique_ptr<Data>&& data, [[maybe_unused]] const String& info = U"")
+		{
+			std::lock_guard lock{ m_mutex };
+
+			uint32 index = 0;
+			Slot* slot = allocateSlot(index);
+
+			if (not slot)
+			{
+				LOG_FAIL(U"❌ No more {0}s can be created"_fmt(m_assetTypeName));
 
 				return IDType::NullAsset();
 			}
+
+			const IDType id = MakeID(index, slot->generation.load(std::memory_order_relaxed));
+
+			slot->pData.store(data.get(), std::memory_order_release);
+			slot->entry = EntryType{ id, std::move(data) };
+			++m_size;
+
+			LOG_TRACE(U"💠 Created {0}[{1}] {2}"_fmt(m_assetTypeName, id.value(), info));
+
+			return id;
 		}
 
 		void erase(const IDType id)
@@ -114,13 +324,20 @@ namespace s3d
 
 			std::lock_guard lock{ m_mutex };
 
-			const auto it = m_data.find(id);
+			const uint32 index = GetIndex(id);
+			Slot* slot = getSlot(index);
 
-			assert(it != m_data.end());
+			assert(slot && (slot->generation.load(std::memory_order_relaxed) == GetGeneration(id)) && slot->entry.second);
 
 			LOG_TRACE(U"♻️ Released {0}[{1}]"_fmt(m_assetTypeName, id.value()));
 
-			m_data.erase(it);
+			// 先に世代を進めて、以降の参照を無効にする
+			slot->generation.store(NextGeneration(index, slot->generation.load(std::memory_order_relaxed)), std::memory_order_release);
+			slot->pData.store(nullptr, std::memory_order_release);
+			slot->entry = EntryType{};
+			--m_size;
+
+			m_freeSlots.push_back(index);
 
 			SIV3D_ENGINE(AssetMonitor)->released();
 		}
@@ -129,9 +346,16 @@ namespace s3d
 		{
 			std::lock_guard lock{ m_mutex };
 
-			for (const auto& data : m_data)
+			for (uint32 index = 0; index < m_slotCount; ++index)
 			{
-				if (const auto id = data.first; !id.isNull())
+				Slot* slot = getSlot(index);
+
+				if (not slot->entry.second)
+				{
+					continue;
+				}
+
+				if (const auto id = slot->entry.first; !id.isNull())
 				{
 					LOG_TRACE(U"♻️ Released {0}[{1}]"_fmt(m_assetTypeName, id.value()));
 				}
@@ -139,40 +363,45 @@ namespace s3d
 				{
 					LOG_TRACE(U"♻️ Released {0}[0(null)]"_fmt(m_assetTypeName));
 				}
+
+				slot->generation.store(NextGeneration(index, slot->generation.load(std::memory_order_relaxed)), std::memory_order_release);
+				slot->pData.store(nullptr, std::memory_order_release);
+				slot->entry = EntryType{};
 			}
 
-			m_data.clear();
+			m_slotCount = 0;
+			m_freeSlots.clear();
+			m_size = 0;
 		}
 
 		[[nodiscard]]
 		iterator begin()
 		{
-			return m_data.begin();
+			return iterator{ this, 0 };
 		}
 
 		[[nodiscard]]
 		iterator end()
 		{
-			return m_data.end();
+			return iterator{ this, m_slotCount };
 		}
 
 		[[nodiscard]]
 		const_iterator begin() const
 		{
-			return m_data.cbegin();
+			return const_iterator{ this, 0 };
 		}
 
 		[[nodiscard]]
 		const_iterator end() const
 		{
-			return m_data.cend();
+			return const_iterator{ this, m_slotCount };
 		}
 
 		[[nodiscard]]
 		size_t size() const noexcept
 		{
-			return m_data.size();
+			return m_size;
 		}
 	};
 }
-
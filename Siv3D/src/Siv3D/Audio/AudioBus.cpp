@@ -217,6 +217,8 @@ namespace s3d
 	{
 		m_bus.setVisualizationEnable(true);
 
+		m_bus.mTap = &m_tap;
+
 		m_handle = pSoloud->play(m_bus);
 	}
 
@@ -225,6 +227,11 @@ namespace s3d
 		return m_bus;
 	}
 
+	const AudioSampleTap& AudioBus::getTap() const noexcept
+	{
+		return m_tap;
+	}
+
 	void AudioBus::annexSoundHandle(const SoLoud::handle handle)
 	{
 		m_bus.annexSound(handle);
@@ -15,6 +15,7 @@
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Duration.hpp>
 # include <ThirdParty/soloud/include/soloud.h>
+# include "AudioSampleTap.hpp"
 
 namespace s3d
 {
@@ -28,6 +29,10 @@ namespace s3d
 		[[nodiscard]]
 		SoLoud::Bus& getBus() noexcept;
 
+		// フィルタを適用する前の、バスの出力
+		[[nodiscard]]
+		const AudioSampleTap& getTap() const noexcept;
+
 		void annexSoundHandle(SoLoud::handle handle);
 
 		double getVolume();
@@ -50,6 +55,9 @@ namespace s3d
 
 	private:
 
+		// m_bus より後に破棄する
+		AudioSampleTap m_tap;
+
 		SoLoud::Bus m_bus;
 
 		SoLoud::Soloud* m_pSoloud = nullptr;
@@ -21,60 +21,80 @@
 # include <ThirdParty/soloud/include/soloud_wavstream.h>
 # include <ThirdParty/soloud/include/soloud_speech.h>
 # include "DynamicAudioSource.hpp"
+# include "BufferedStreamSource.hpp"
+# include "SharedWav.hpp"
 
 namespace s3d
 {
-	AudioData::AudioData(Null, SoLoud::Soloud* pSoloud)
-		: m_pSoloud{ pSoloud }
+	namespace detail
 	{
-		// m_wave 準備
+		[[nodiscard]]
+		static std::shared_ptr<const Wave> MakeNullWave()
 		{
-			m_wave = Wave::Generate(SecondsF{ 0.5 }, [](double t) {
+			Wave wave = Wave::Generate(SecondsF{ 0.5 }, [](double t) {
 				return 0.5 * std::sin(t * Math::TwoPi) * std::sin(t * Math::TwoPi * 220.0 * (t * 4.0 + 1.0)); });
-		
-			m_wave.deinterleave();
-		}
 
-		std::unique_ptr<SoLoud::Wav> source = std::make_unique<SoLoud::Wav>();
+			wave.deinterleave();
 
-		if (SoLoud::SO_NO_ERROR != source->loadRawWave(&m_wave[0].left,
-			static_cast<uint32>(m_wave.size() * 2), static_cast<float>(m_wave.sampleRate()),
-			2, false, false))
+			return std::make_shared<const Wave>(std::move(wave));
+		}
+
+		[[nodiscard]]
+		static std::shared_ptr<const Wave> MakeDeinterleaved(Wave&& wave, const Optional<AudioLoopTiming>& loop)
 		{
-			return;
+			if (loop && loop->endPos && (loop->endPos < wave.size()))
+			{
+				wave.resize(loop->endPos);
+				wave.shrink_to_fit();
+			}
+
+			wave.deinterleave();
+
+			return std::make_shared<const Wave>(std::move(wave));
 		}
 
-		m_sampleRate	= static_cast<uint32>(source->mBaseSamplerate);
-		m_lengthSample	= source->mSampleCount;
-		m_audioSource	= std::move(source);
-		m_initialized	= true;
+		// deinterleave() 済みの波形の先頭 length サンプルを取り出す
+		[[nodiscard]]
+		static std::shared_ptr<const Wave> TruncateDeinterleaved(const Wave& wave, const size_t length)
+		{
+			std::shared_ptr<Wave> result = std::make_shared<Wave>(length, Arg::sampleRate = wave.sampleRate());
+
+			const float* pSrc = &wave[0].left;
+			float* pDst = &(*result)[0].left;
+
+			std::memcpy(pDst, pSrc, (sizeof(float) * length));
+			std::memcpy((pDst + length), (pSrc + wave.size()), (sizeof(float) * length));
+
+			return result;
+		}
 	}
 
+	AudioData::AudioData(Null, SoLoud::Soloud* pSoloud)
+		: AudioData{ pSoloud, detail::MakeNullWave(), none } {}
+
 	AudioData::AudioData(SoLoud::Soloud* pSoloud, Wave&& wave, const Optional<AudioLoopTiming>& loop)
+		: AudioData{ pSoloud, detail::MakeDeinterleaved(std::move(wave), loop), loop } {}
+
+	AudioData::AudioData(SoLoud::Soloud* pSoloud, const std::shared_ptr<const Wave>& wave, const Optional<AudioLoopTiming>& loop)
 		: m_pSoloud{ pSoloud }
 		, m_loop{ loop.has_value() }
 	{
-		// m_wave 準備
+		if ((not wave) || wave->isEmpty())
 		{
-			m_wave = std::move(wave);
-
-			if (loop && loop->endPos && (loop->endPos < m_wave.size()))
-			{
-				m_wave.resize(loop->endPos);
-				m_wave.shrink_to_fit();
-			}
-
-			m_wave.deinterleave();
+			return;
 		}
 
-		std::unique_ptr<SoLoud::Wav> source = std::make_unique<SoLoud::Wav>();
-
-		if (SoLoud::SO_NO_ERROR != source->loadRawWave(&m_wave[0].left,
-			static_cast<uint32>(m_wave.size() * 2), static_cast<float>(m_wave.sampleRate()),
-			2, false, false))
+		// m_wave 準備
+		if (loop && loop->endPos && (loop->endPos < wave->size()))
 		{
-			return;
+			m_wave = detail::TruncateDeinterleaved(*wave, static_cast<size_t>(loop->endPos));
 		}
+		else
+		{
+			m_wave = wave;
+		}
+
+		std::unique_ptr<SoLoud::Wav> source = std::make_unique<SharedWav>(m_wave);
 
 		m_sampleRate	= static_cast<uint32>(source->mBaseSamplerate);
 		m_lengthSample	= source->mSampleCount;
@@ -90,7 +110,7 @@ namespace s3d
 		m_initialized	= true;
 	}
 
-	AudioData::AudioData(SoLoud::Soloud* pSoloud, const FilePathView path)
+	AudioData::AudioData(SoLoud::Soloud* pSoloud, const FilePathView path, StreamDecodePool& decodePool)
 		: m_pSoloud{ pSoloud }
 		, m_isStreaming{ true }
 	{
@@ -128,11 +148,11 @@ namespace s3d
 
 		m_sampleRate	= static_cast<uint32>(source->mBaseSamplerate);
 		m_lengthSample	= source->mSampleCount;
-		m_audioSource	= std::move(source);
+		m_audioSource	= std::make_unique<BufferedStreamSource>(std::move(source), decodePool);
 		m_initialized	= true;
 	}
 
-	AudioData::AudioData(SoLoud::Soloud* pSoloud, const FilePathView path, const uint64 loopBegin)
+	AudioData::AudioData(SoLoud::Soloud* pSoloud, const FilePathView path, const uint64 loopBegin, StreamDecodePool& decodePool)
 		: m_pSoloud{ pSoloud }
 		, m_isStreaming{ true }
 		, m_loop{ true }
@@ -171,7 +191,7 @@ namespace s3d
 
 		m_sampleRate	= static_cast<uint32>(source->mBaseSamplerate);
 		m_lengthSample	= source->mSampleCount;
-		m_audioSource	= std::move(source);
+		m_audioSource	= std::make_unique<BufferedStreamSource>(std::move(source), decodePool);
 
 		m_loopTiming	= { loopBegin, 0 };
 		m_audioSource->setLooping(true);
@@ -624,6 +644,11 @@ namespace s3d
 		m_pSoloud->fadeRelativePlaySpeed(m_handle, static_cast<float>(speed), time.count());
 	}
 
+	std::shared_ptr<const Wave> AudioData::getSharedWave() const noexcept
+	{
+		return m_wave;
+	}
+
 	const float* AudioData::getSamples(const size_t channel) const
 	{
 		if (m_isStreaming)
@@ -631,7 +656,7 @@ namespace s3d
 			return nullptr;
 		}
 
-		const float* pSrc = &m_wave[0].left;
+		const float* pSrc = &(*m_wave)[0].left;
 
 		if (channel == 0)
 		{
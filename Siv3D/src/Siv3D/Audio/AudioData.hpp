@@ -16,6 +16,7 @@
 # include <Siv3D/Audio.hpp>
 # include <Siv3D/KlattTTSParameters.hpp>
 # include "AudioResourceHolder.hpp"
+# include "StreamDecodePool.hpp"
 # include <ThirdParty/soloud/include/soloud.h>
 
 namespace s3d
@@ -36,9 +37,12 @@ namespace s3d
 
 		AudioData(SoLoud::Soloud* pSoloud, Wave&& wave, const Optional<AudioLoopTiming>& loop);
 
-		AudioData(SoLoud::Soloud* pSoloud, FilePathView path);
+		// wave は deinterleave() 済みの波形。他の AudioData と共有し、コピーせずに再生する
+		AudioData(SoLoud::Soloud* pSoloud, const std::shared_ptr<const Wave>& wave, const Optional<AudioLoopTiming>& loop);
 
-		AudioData(SoLoud::Soloud* pSoloud, FilePathView path, uint64 loopBegin);
+		AudioData(SoLoud::Soloud* pSoloud, FilePathView path, StreamDecodePool& decodePool);
+
+		AudioData(SoLoud::Soloud* pSoloud, FilePathView path, uint64 loopBegin, StreamDecodePool& decodePool);
 
 		AudioData(Dynamic, SoLoud::Soloud* pSoloud, const std::shared_ptr<IAudioStream>& pAudioStream, Arg::sampleRate_<uint32> sampleRate);
 
@@ -140,6 +144,10 @@ namespace s3d
 		[[nodiscard]]
 		const float* getSamples(size_t channel) const;
 
+		// deinterleave() 済みの波形。ストリーミングなど、波形を持たない場合は nullptr
+		[[nodiscard]]
+		std::shared_ptr<const Wave> getSharedWave() const noexcept;
+
 	private:
 
 	# if SIV3D_PLATFORM(WINDOWS)
@@ -152,7 +160,7 @@ namespace s3d
 
 		SoLoud::Soloud* m_pSoloud = nullptr;
 
-		Wave m_wave;
+		std::shared_ptr<const Wave> m_wave;
 
 		uint32 m_sampleRate = 0;
 
@@ -0,0 +1,100 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Utility.hpp>
+# include "AudioSampleTap.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 上書きが続いた場合に、読み出しをやり直す最大の回数
+		constexpr int32 MaxTapReadRetries = 4;
+	}
+
+	AudioSampleTap::AudioSampleTap()
+		: m_samples{ std::make_unique<std::atomic<float>[]>(CapacitySamples) }
+	{
+		for (uint32 i = 0; i < CapacitySamples; ++i)
+		{
+			m_samples[i].store(0.0f, std::memory_order_relaxed);
+		}
+	}
+
+	void AudioSampleTap::write(const float* aBuffer, const unsigned int aSamples, const unsigned int aBufferSize, const unsigned int aChannels)
+	{
+		const uint64 writePos = m_writePos.load(std::memory_order_relaxed);
+
+		// サンプルを書き換える前に、書き換える範囲を公開する
+		m_reservedPos.store((writePos + aSamples), std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_release);
+
+		for (uint32 i = 0; i < aSamples; ++i)
+		{
+			float sample = 0.0f;
+
+			for (uint32 ch = 0; ch < aChannels; ++ch)
+			{
+				sample += aBuffer[(ch * aBufferSize) + i];
+			}
+
+			m_samples[(writePos + i) & (CapacitySamples - 1)].store(sample, std::memory_order_relaxed);
+		}
+
+		m_writePos.store((writePos + aSamples), std::memory_order_release);
+	}
+
+	void AudioSampleTap::read(float* dst, size_t length) const
+	{
+		if (MaxReadSamples < length)
+		{
+			const size_t excess = (length - MaxReadSamples);
+			std::fill(dst, (dst + excess), 0.0f);
+			dst += excess;
+			length = MaxReadSamples;
+		}
+
+		for (int32 retry = 0; ; ++retry)
+		{
+			const uint64 end = m_writePos.load(std::memory_order_acquire);
+			const size_t available = static_cast<size_t>(Min<uint64>(end, length));
+			const size_t missing = (length - available);
+			const uint64 begin = (end - available);
+
+			std::fill(dst, (dst + missing), 0.0f);
+
+			for (size_t i = 0; i < available; ++i)
+			{
+				dst[missing + i] = m_samples[(begin + i) & (CapacitySamples - 1)].load(std::memory_order_relaxed);
+			}
+
+			// コピー中に書き換えられたサンプルを読んでいれば、その書き込みが公開した m_reservedPos が見える
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			const uint64 reservedPos = m_reservedPos.load(std::memory_order_relaxed);
+
+			// コピーした範囲が、書き込み中のものも含めて上書きされていなければ完了
+			if ((reservedPos - begin) <= CapacitySamples)
+			{
+				return;
+			}
+
+			if (retry == detail::MaxTapReadRetries)
+			{
+				// 上書きされた可能性のある古い側のサンプルは 0 にする
+				const size_t overwritten = static_cast<size_t>(Min<uint64>((reservedPos - CapacitySamples - begin), available));
+				std::fill((dst + missing), (dst + missing + overwritten), 0.0f);
+				return;
+			}
+		}
+	}
+}
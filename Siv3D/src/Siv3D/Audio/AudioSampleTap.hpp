@@ -0,0 +1,56 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <memory>
+# include <Siv3D/Common.hpp>
+# include <ThirdParty/soloud/include/soloud.h>
+
+namespace s3d
+{
+	// ミキサーの出力を、チャンネルを合計したモノラルのサンプルとして保持するリングバッファ
+	//
+	// ミキサーのスレッドが書き込み（生産者）、読み出し側は直近のサンプルをコピーする（消費者）。
+	// どちらもロックせず、書き込みはメモリを確保しない。
+	// 書き込みはサンプルを書き換える前に m_reservedPos を、書き換えた後に m_writePos を進める（seqlock）。
+	// 読み出し側はコピーした後に m_reservedPos を確認し、書き込み中のものも含めて上書きされていた場合は読み出しをやり直す。
+	class AudioSampleTap : public SoLoud::AudioTap
+	{
+	public:
+
+		// 保持するサンプル数（2 の累乗）
+		static constexpr uint32 CapacitySamples = (1 << 15);
+
+		// 一度に読み出せる最大のサンプル数。FFTSampleLength::SL16K の FFT に足りる数
+		//
+		// リングバッファを読み出しの 2 倍の大きさにして、コピー中にミキサーが書き込んでも読み出す範囲に届きにくくする
+		static constexpr uint32 MaxReadSamples = (1 << 14);
+
+		AudioSampleTap();
+
+		// (ミキサー)
+		void write(const float* aBuffer, unsigned int aSamples, unsigned int aBufferSize, unsigned int aChannels) override;
+
+		// 直近の length サンプルを古い順に dst へコピーする。まだ書き込まれていない部分と、MaxReadSamples を超える部分は 0
+		void read(float* dst, size_t length) const;
+
+	private:
+
+		std::unique_ptr<std::atomic<float>[]> m_samples;
+
+		// 書き込みを始めたサンプルの累計。この位置までのスロットは書き換え中の可能性がある
+		std::atomic<uint64> m_reservedPos{ 0 };
+
+		// 書き込みを終えたサンプルの累計
+		std::atomic<uint64> m_writePos{ 0 };
+	};
+}
@@ -0,0 +1,425 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ProfileZone.hpp>
+# include "BufferedStreamSource.hpp"
+# include "StreamDecodePool.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 再生開始時に無音にならないよう、ボイスの作成時に呼び出し元のスレッドでデコードしておくチャンク数
+		constexpr uint32 PrefillChunks = 4;
+
+		// ワーカーが 1 つのストリームを続けてデコードする最大のチャンク数
+		constexpr uint32 MaxChunksPerFill = 8;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	BufferedStream
+	//
+	////////////////////////////////////////////////////////////////
+
+	BufferedStream::BufferedStream(SoLoud::WavStream& source, const bool looping, const uint64 loopBeginFrame, BufferedStreamLiveCount& liveCount)
+		: m_decoder{ source.createInstance() }
+		, m_liveCount{ liveCount }
+		, m_channels{ Max(source.mChannels, 1u) }
+		, m_sampleRate{ source.mBaseSamplerate }
+		, m_lengthFrames{ source.mSampleCount }
+		, m_loopBeginFrame{ loopBeginFrame }
+		, m_looping{ looping && (loopBeginFrame < source.mSampleCount) }
+		, m_ring(CapacityFrames * m_channels)
+	{
+		{
+			std::lock_guard lock{ m_liveCount.mutex };
+
+			++m_liveCount.count;
+		}
+
+		m_decoder->init(source, 0);
+
+		Array<float> scratch;
+
+		fill(scratch, detail::PrefillChunks);
+	}
+
+	BufferedStream::~BufferedStream()
+	{
+		m_decoder.reset();
+
+		std::lock_guard lock{ m_liveCount.mutex };
+
+		--m_liveCount.count;
+
+		m_liveCount.released.notify_all();
+	}
+
+	uint32 BufferedStream::channels() const noexcept
+	{
+		return m_channels;
+	}
+
+	uint64 BufferedStream::lengthFrames() const noexcept
+	{
+		return m_lengthFrames;
+	}
+
+	uint64 BufferedStream::loopBeginFrame() const noexcept
+	{
+		return m_loopBeginFrame;
+	}
+
+	bool BufferedStream::isLooping() const noexcept
+	{
+		return m_looping;
+	}
+
+	bool BufferedStream::tryFill(Array<float>& scratch)
+	{
+		if (m_closed.load(std::memory_order_acquire)
+			|| m_busy.test_and_set(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		const bool decoded = fill(scratch, detail::MaxChunksPerFill);
+
+		m_busy.clear(std::memory_order_release);
+
+		return decoded;
+	}
+
+	uint32 BufferedStream::read(float* buffer, const uint32 frames, const uint32 bufferSize)
+	{
+		const uint64 readPos = m_readPos.load(std::memory_order_relaxed);
+		const uint32 count = static_cast<uint32>(Min<uint64>(frames, (m_writePos.load(std::memory_order_acquire) - readPos)));
+
+		for (uint32 i = 0; i < count; ++i)
+		{
+			const float* pSrc = &m_ring[((readPos + i) & (CapacityFrames - 1)) * m_channels];
+
+			for (uint32 ch = 0; ch < m_channels; ++ch)
+			{
+				buffer[(ch * bufferSize) + i] = pSrc[ch];
+			}
+		}
+
+		m_readPos.store((readPos + count), std::memory_order_release);
+
+		return count;
+	}
+
+	void BufferedStream::requestSeek(const uint64 frame)
+	{
+		m_seekFrame.store(Min(frame, m_lengthFrames), std::memory_order_relaxed);
+
+		m_seekPending = (m_seekRequest.load(std::memory_order_relaxed) + 1);
+
+		m_seekRequest.store(m_seekPending, std::memory_order_release);
+	}
+
+	bool BufferedStream::isReady() const noexcept
+	{
+		return (m_seekAck.load(std::memory_order_acquire) == m_seekPending);
+	}
+
+	bool BufferedStream::hasEnded() const noexcept
+	{
+		return (m_decodeEnded.load(std::memory_order_acquire)
+			&& (m_readPos.load(std::memory_order_relaxed) == m_writePos.load(std::memory_order_acquire)));
+	}
+
+	void BufferedStream::close() noexcept
+	{
+		m_closed.store(true, std::memory_order_release);
+	}
+
+	bool BufferedStream::isClosed() const noexcept
+	{
+		return m_closed.load(std::memory_order_acquire);
+	}
+
+	bool BufferedStream::fill(Array<float>& scratch, const uint32 maxChunks)
+	{
+		SIV3D_PROFILE_SCOPE(U"BufferedStream::fill");
+
+		// 前半をデコード先、後半をシークで読み捨てるサンプルの置き場として使う
+		if (const size_t scratchSize = (ChunkFrames * m_channels * 2);
+			scratch.size() < scratchSize)
+		{
+			scratch.resize(scratchSize);
+		}
+
+		bool progressed = false;
+
+		// シークの要求に応じる。ミキサーは応じるまでリングバッファを読まないので、読み出し位置を書き換えてよい
+		if (const uint64 request = m_seekRequest.load(std::memory_order_acquire);
+			request != m_seekAck.load(std::memory_order_relaxed))
+		{
+			seekDecoder(m_seekFrame.load(std::memory_order_relaxed), scratch);
+
+			m_readPos.store(m_writePos.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+			m_decodeEnded.store(false, std::memory_order_relaxed);
+
+			m_seekAck.store(request, std::memory_order_release);
+
+			progressed = true;
+		}
+
+		for (uint32 i = 0; i < maxChunks; ++i)
+		{
+			if (m_decodeEnded.load(std::memory_order_relaxed))
+			{
+				break;
+			}
+
+			const uint64 writePos = m_writePos.load(std::memory_order_relaxed);
+
+			if ((CapacityFrames - (writePos - m_readPos.load(std::memory_order_acquire))) < ChunkFrames)
+			{
+				break;
+			}
+
+			bool decodeEnded = false;
+			const uint32 frames = decodeChunk(scratch, decodeEnded);
+
+			for (uint32 k = 0; k < frames; ++k)
+			{
+				float* pDst = &m_ring[((writePos + k) & (CapacityFrames - 1)) * m_channels];
+
+				for (uint32 ch = 0; ch < m_channels; ++ch)
+				{
+					pDst[ch] = scratch[(ch * ChunkFrames) + k];
+				}
+			}
+
+			m_writePos.store((writePos + frames), std::memory_order_release);
+
+			if (decodeEnded)
+			{
+				m_decodeEnded.store(true, std::memory_order_release);
+			}
+
+			progressed = true;
+		}
+
+		return progressed;
+	}
+
+	void BufferedStream::seekDecoder(const uint64 frame, Array<float>& scratch)
+	{
+		// WavStream のシークは、デコーダの mStreamPosition を現在位置として読み捨てるサンプル数を決める
+		m_decoder->mStreamPosition = (m_decodedFrames / m_sampleRate);
+
+		m_decoder->seek((frame / m_sampleRate), (scratch.data() + (ChunkFrames * m_channels)), (ChunkFrames * m_channels));
+
+		m_decodedFrames = frame;
+	}
+
+	uint32 BufferedStream::decodeChunk(Array<float>& scratch, bool& decodeEnded)
+	{
+		uint32 frames = 0;
+
+		// ループの始点に戻った直後に 1 フレームもデコードできなければ、末尾に達したとみなす
+		bool rewound = false;
+
+		while (frames < ChunkFrames)
+		{
+			const uint32 n = m_decoder->getAudio((scratch.data() + frames), (ChunkFrames - frames), ChunkFrames);
+
+			frames += n;
+			m_decodedFrames += n;
+
+			if (n != 0)
+			{
+				rewound = false;
+			}
+
+			if (frames == ChunkFrames)
+			{
+				break;
+			}
+
+			if ((n != 0) && (not m_decoder->hasEnded()))
+			{
+				continue;
+			}
+
+			if ((not m_looping) || rewound)
+			{
+				decodeEnded = true;
+				break;
+			}
+
+			seekDecoder(m_loopBeginFrame, scratch);
+
+			rewound = true;
+		}
+
+		return frames;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	BufferedStreamInstance
+	//
+	////////////////////////////////////////////////////////////////
+
+	class BufferedStreamInstance : public SoLoud::AudioSourceInstance
+	{
+	public:
+
+		explicit BufferedStreamInstance(BufferedStreamSource* aParent)
+			: mParent{ aParent }
+			, m_stream{ std::make_shared<BufferedStream>(*aParent->m_stream,
+				((aParent->mFlags & SoLoud::AudioSource::SHOULD_LOOP) != 0),
+				static_cast<uint64>(aParent->mLoopPoint * aParent->mBaseSamplerate),
+				aParent->m_liveCount) }
+		{
+			mChannels = m_stream->channels();
+
+			mParent->m_pool->add(m_stream);
+		}
+
+		~BufferedStreamInstance() override
+		{
+			m_stream->close();
+
+			mParent->m_pool->notify();
+		}
+
+		unsigned int getAudio(float* aBuffer, unsigned int aSamplesToRead, unsigned int aBufferSize) override
+		{
+			// シークの要求にワーカーが応じるまでは無音
+			if (not m_stream->isReady())
+			{
+				clear(aBuffer, 0, aSamplesToRead, aBufferSize);
+				return aSamplesToRead;
+			}
+
+			const uint32 frames = m_stream->read(aBuffer, aSamplesToRead, aBufferSize);
+
+			advance(frames);
+
+			if ((frames < aSamplesToRead)
+				&& (not m_stream->hasEnded()))
+			{
+				// デコードが間に合わなかった分は無音にする
+				clear(aBuffer, frames, aSamplesToRead, aBufferSize);
+				return aSamplesToRead;
+			}
+
+			return frames;
+		}
+
+		bool hasEnded() override
+		{
+			return (m_stream->isReady() && m_stream->hasEnded());
+		}
+
+		SoLoud::result seek(SoLoud::time aSeconds, float*, unsigned int) override
+		{
+			const uint64 frame = Min(static_cast<uint64>(Max(aSeconds, 0.0) * mBaseSamplerate), m_stream->lengthFrames());
+
+			m_stream->requestSeek(frame);
+
+			m_position = frame;
+
+			mStreamPosition = aSeconds;
+
+			mParent->m_pool->notify();
+
+			return SoLoud::SO_NO_ERROR;
+		}
+
+		SoLoud::result rewind() override
+		{
+			return seek(0.0, nullptr, 0);
+		}
+
+	private:
+
+		BufferedStreamSource* mParent;
+
+		std::shared_ptr<BufferedStream> m_stream;
+
+		// ミキサーに渡したフレームの、ファイル上の位置
+		uint64 m_position = 0;
+
+		void clear(float* aBuffer, const uint32 begin, const uint32 end, const uint32 aBufferSize) const
+		{
+			for (uint32 ch = 0; ch < mChannels; ++ch)
+			{
+				std::fill((aBuffer + (ch * aBufferSize) + begin), (aBuffer + (ch * aBufferSize) + end), 0.0f);
+			}
+		}
+
+		// ワーカーがループの始点に戻ったぶん、再生位置とループ回数を更新する
+		void advance(const uint32 frames)
+		{
+			m_position += frames;
+
+			if (not m_stream->isLooping())
+			{
+				return;
+			}
+
+			const uint64 lengthFrames = m_stream->lengthFrames();
+			const uint64 loopFrames = (lengthFrames - m_stream->loopBeginFrame());
+
+			while (lengthFrames <= m_position)
+			{
+				m_position -= loopFrames;
+
+				mStreamPosition -= (loopFrames / static_cast<double>(mBaseSamplerate));
+
+				++mLoopCount;
+			}
+		}
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	BufferedStreamSource
+	//
+	////////////////////////////////////////////////////////////////
+
+	BufferedStreamSource::BufferedStreamSource(std::unique_ptr<SoLoud::WavStream>&& stream, StreamDecodePool& pool)
+		: m_stream{ std::move(stream) }
+		, m_pool{ &pool }
+	{
+		mChannels = m_stream->mChannels;
+		mBaseSamplerate = m_stream->mBaseSamplerate;
+	}
+
+	BufferedStreamSource::~BufferedStreamSource()
+	{
+		stop();
+
+		// ワーカーがデコーダを手放すまで待つ
+		std::unique_lock lock{ m_liveCount.mutex };
+
+		m_liveCount.released.wait(lock, [this]() { return (m_liveCount.count == 0); });
+	}
+
+	SoLoud::AudioSourceInstance* BufferedStreamSource::createInstance()
+	{
+		return new BufferedStreamInstance(this);
+	}
+
+	uint32 BufferedStreamSource::samples() const noexcept
+	{
+		return m_stream->mSampleCount;
+	}
+}
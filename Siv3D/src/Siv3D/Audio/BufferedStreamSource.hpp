@@ -0,0 +1,171 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <condition_variable>
+# include <memory>
+# include <mutex>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <ThirdParty/soloud/include/soloud.h>
+# include <ThirdParty/soloud/include/soloud_wavstream.h>
+
+namespace s3d
+{
+	class StreamDecodePool;
+
+	// BufferedStreamSource のデコーダを持つ BufferedStream の数。ソースの破棄は、これが 0 になるまで待つ
+	struct BufferedStreamLiveCount
+	{
+		std::mutex mutex;
+
+		std::condition_variable released;
+
+		uint32 count = 0;
+	};
+
+	// 1 つのボイスのための、デコーダとリングバッファ
+	//
+	// デコーダ（WavStream のインスタンス）は StreamDecodePool のワーカーだけが操作し、リングバッファに書き込む（生産者）。
+	// ミキサーのスレッドはリングバッファから読み出すだけ（消費者）。
+	// ループ再生では、ワーカーがループの始点に戻ってデコードを続けるため、ミキサーはループの継ぎ目で待たされない。
+	class BufferedStream
+	{
+	public:
+
+		// リングバッファのフレーム数（2 の累乗）
+		static constexpr uint32 CapacityFrames = (1 << 15);
+
+		// 1 回のデコードのフレーム数
+		static constexpr uint32 ChunkFrames = 1024;
+
+		BufferedStream(SoLoud::WavStream& source, bool looping, uint64 loopBeginFrame, BufferedStreamLiveCount& liveCount);
+
+		~BufferedStream();
+
+		BufferedStream(const BufferedStream&) = delete;
+
+		BufferedStream& operator =(const BufferedStream&) = delete;
+
+		[[nodiscard]]
+		uint32 channels() const noexcept;
+
+		[[nodiscard]]
+		uint64 lengthFrames() const noexcept;
+
+		[[nodiscard]]
+		uint64 loopBeginFrame() const noexcept;
+
+		[[nodiscard]]
+		bool isLooping() const noexcept;
+
+		// (ワーカー) 他のワーカーが埋めていなければ、リングバッファを埋める。デコードした場合 true
+		bool tryFill(Array<float>& scratch);
+
+		// (ミキサー) 最大 frames フレームを、チャンネルごとに bufferSize 間隔で読み出す。読み出したフレーム数を返す
+		[[nodiscard]]
+		uint32 read(float* buffer, uint32 frames, uint32 bufferSize);
+
+		// (ミキサー) 指定した位置からのデコードをワーカーに要求する。ワーカーが応じるまで isReady() は false
+		void requestSeek(uint64 frame);
+
+		// (ミキサー) シークの要求にワーカーが応じているか
+		[[nodiscard]]
+		bool isReady() const noexcept;
+
+		// (ミキサー) 末尾までデコードし、すべて読み出したか
+		[[nodiscard]]
+		bool hasEnded() const noexcept;
+
+		void close() noexcept;
+
+		[[nodiscard]]
+		bool isClosed() const noexcept;
+
+	private:
+
+		std::unique_ptr<SoLoud::AudioSourceInstance> m_decoder;
+
+		BufferedStreamLiveCount& m_liveCount;
+
+		uint32 m_channels = 0;
+
+		double m_sampleRate = 0.0;
+
+		uint64 m_lengthFrames = 0;
+
+		uint64 m_loopBeginFrame = 0;
+
+		bool m_looping = false;
+
+		// CapacityFrames * m_channels 個のサンプルをインタリーブして格納する
+		Array<float> m_ring;
+
+		// 書き込み・読み出したフレームの累計
+		std::atomic<uint64> m_writePos{ 0 };
+
+		std::atomic<uint64> m_readPos{ 0 };
+
+		// ミキサーが要求したシークの通し番号と、ワーカーが応じた通し番号
+		std::atomic<uint64> m_seekRequest{ 0 };
+
+		std::atomic<uint64> m_seekAck{ 0 };
+
+		std::atomic<uint64> m_seekFrame{ 0 };
+
+		// ミキサーが最後に要求したシークの通し番号
+		uint64 m_seekPending = 0;
+
+		std::atomic<bool> m_decodeEnded{ false };
+
+		std::atomic<bool> m_closed{ false };
+
+		std::atomic_flag m_busy;
+
+		// (ワーカー) デコーダの位置
+		uint64 m_decodedFrames = 0;
+
+		// シークの要求に応じ、最大 maxChunks チャンクをデコードする。何かした場合 true
+		bool fill(Array<float>& scratch, uint32 maxChunks);
+
+		void seekDecoder(uint64 frame, Array<float>& scratch);
+
+		// デコーダから最大 ChunkFrames フレームを scratch の前半にデコードする。末尾に達した場合は decodeEnded を true にする
+		[[nodiscard]]
+		uint32 decodeChunk(Array<float>& scratch, bool& decodeEnded);
+	};
+
+	// WavStream のデコードを StreamDecodePool のワーカーで先行して行う AudioSource
+	class BufferedStreamSource : public SoLoud::AudioSource
+	{
+	public:
+
+		BufferedStreamSource(std::unique_ptr<SoLoud::WavStream>&& stream, StreamDecodePool& pool);
+
+		virtual ~BufferedStreamSource();
+
+		virtual SoLoud::AudioSourceInstance* createInstance();
+
+		[[nodiscard]]
+		uint32 samples() const noexcept;
+
+	private:
+
+		friend class BufferedStreamInstance;
+
+		std::unique_ptr<SoLoud::WavStream> m_stream;
+
+		StreamDecodePool* m_pool = nullptr;
+
+		BufferedStreamLiveCount m_liveCount;
+	};
+}
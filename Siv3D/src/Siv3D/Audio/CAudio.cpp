@@ -18,7 +18,10 @@
 # include <Siv3D/AudioDecoder.hpp>
 # include <Siv3D/KlattTTSParameters.hpp>
 # include <Siv3D/DLL.hpp>
+# include <Siv3D/FFT/IFFT.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
 # include "CAudio.hpp"
+# include <ThirdParty/soloud/include/soloud_fft.h>
 
 namespace s3d
 {
@@ -35,6 +38,49 @@ namespace s3d
 				(static_cast<double>(samples) / sampleRate),
 				audio->loopTiming().beginPos, audio->loopTiming().endPos, audio->isStreaming());
 		}
+
+		// SoLoud::Soloud::calcFFT() と同じ計算を、タップから読み出した直近 256 サンプルで行う
+		static void CalcVisualizationFFT(const AudioSampleTap& tap, const uint32 sampleRate, FFTResult& result)
+		{
+			float samples[256];
+			tap.read(samples, 256);
+
+			float temp[1024];
+
+			for (size_t i = 0; i < 256; ++i)
+			{
+				temp[i * 2] = samples[i];
+				temp[i * 2 + 1] = 0.0f;
+				temp[i + 512] = 0.0f;
+				temp[i + 768] = 0.0f;
+			}
+
+			SoLoud::FFT::fft1024(temp);
+
+			result.buffer.resize(256);
+
+			for (size_t i = 0; i < 256; ++i)
+			{
+				const float real = temp[i * 2];
+				const float imag = temp[i * 2 + 1];
+				result.buffer[i] = (std::sqrt(real * real + imag * imag) * 0.25f);
+			}
+
+			result.resolution = static_cast<double>(sampleRate) / (256 << static_cast<int32>(FFTSampleLength::SL512));
+			result.sampleRate = sampleRate;
+		}
+
+		// タップから読み出した直近のサンプルで FFT を実行する。複数のスレッドから同時に呼んでよい
+		static void CalcFFT(const AudioSampleTap& tap, const uint32 sampleRate, const FFTSampleLength sampleLength, FFTResult& result)
+		{
+			thread_local Array<float> samples;
+
+			samples.resize(256 << static_cast<int32>(sampleLength));
+
+			tap.read(samples.data(), samples.size());
+
+			SIV3D_ENGINE(FFT)->fft(result, samples.data(), samples.size(), sampleRate, sampleLength);
+		}
 	}
 
 	CAudio::CAudio() {}
@@ -47,6 +93,9 @@ namespace s3d
 
 		m_audios.destroy();
 
+		// ストリーミングの Audio がすべて破棄されてからワーカーを終了する
+		m_streamDecodePool.shutdown();
+
 		for (auto& bus : m_buses)
 		{
 			bus.reset();
@@ -79,6 +128,9 @@ namespace s3d
 		{
 			m_soloud = std::make_unique<SoLoud::Soloud>();
 
+			// ミキサーが動き出す前に設定する
+			m_soloud->mTap = &m_globalTap;
+
 		# if SIV3D_PLATFORM(WEB)
 			if (SoLoud::SO_NO_ERROR != m_soloud->init(SoLoud::Soloud::CLIP_ROUNDOFF, SoLoud::Soloud::AUTO, SoLoud::Soloud::AUTO, 4096))
 			{
@@ -231,6 +283,56 @@ namespace s3d
 		return create(std::move(wave), AudioLoopTiming{ loopBeginSample, loopEndSample });
 	}
 
+	Audio::IDType CAudio::createFromFile(const FilePathView path, const Optional<AudioLoopTiming>& loop)
+	{
+		// 同じファイルから作成した Audio とデコード結果を共有する
+		const std::shared_ptr<const Wave> wave = m_decodedWaveCache.load(path);
+
+		if (not wave)
+		{
+			return Audio::IDType::NullAsset();
+		}
+
+		// Audio を作成
+		auto audio = std::make_unique<AudioData>(m_soloud.get(), wave, loop);
+
+		if (not audio->isInitialized()) // もし作成に失敗していたら
+		{
+			return Audio::IDType::NullAsset();
+		}
+
+		const String info = detail::ToInfo(audio);
+
+		// Audio を管理に登録
+		return m_audios.add(std::move(audio), info);
+	}
+
+	Audio::IDType CAudio::createFromFile(const FilePathView path, const Duration& loopBegin, const Duration& loopEnd)
+	{
+		const std::shared_ptr<const Wave> wave = m_decodedWaveCache.load(path);
+
+		if (not wave)
+		{
+			return Audio::IDType::NullAsset();
+		}
+
+		const uint64 loopBeginSample = static_cast<uint64>(loopBegin.count() * wave->sampleRate());
+		const uint64 loopEndSample = static_cast<uint64>(loopEnd.count() * wave->sampleRate());
+
+		// Audio を作成
+		auto audio = std::make_unique<AudioData>(m_soloud.get(), wave, AudioLoopTiming{ loopBeginSample, loopEndSample });
+
+		if (not audio->isInitialized()) // もし作成に失敗していたら
+		{
+			return Audio::IDType::NullAsset();
+		}
+
+		const String info = detail::ToInfo(audio);
+
+		// Audio を管理に登録
+		return m_audios.add(std::move(audio), info);
+	}
+
 	Audio::IDType CAudio::createStreamingNonLoop(const FilePathView path)
 	{
 		// ストリーミングに対応しない形式の場合のフォールバック
@@ -240,11 +342,11 @@ namespace s3d
 			&& (format != AudioFormat::OggVorbis)
 			&& (format != AudioFormat::FLAC))
 		{
-			return create(Wave{ path }, none);
+			return createFromFile(path, none);
 		}
 
 		// Audio を作成
-		auto audio = std::make_unique<AudioData>(m_soloud.get(), path);
+		auto audio = std::make_unique<AudioData>(m_soloud.get(), path, m_streamDecodePool);
 
 		if (not audio->isInitialized()) // もし作成に失敗していたら
 		{
@@ -266,11 +368,11 @@ namespace s3d
 			&& (format != AudioFormat::OggVorbis)
 			&& (format != AudioFormat::FLAC))
 		{
-			return create(Wave{ path }, AudioLoopTiming{ loopBegin, 0 });
+			return createFromFile(path, AudioLoopTiming{ loopBegin, 0 });
 		}
 
 		// Audio を作成
-		auto audio = std::make_unique<AudioData>(m_soloud.get(), path, loopBegin);
+		auto audio = std::make_unique<AudioData>(m_soloud.get(), path, loopBegin, m_streamDecodePool);
 
 		if (not audio->isInitialized()) // もし作成に失敗していたら
 		{
@@ -510,6 +612,11 @@ namespace s3d
 		return m_audios[handleID]->getSamples(channel);
 	}
 
+	std::shared_ptr<const Wave> CAudio::getSharedWave(const Audio::IDType handleID)
+	{
+		return m_audios[handleID]->getSharedWave();
+	}
+
 
 	size_t CAudio::getActiveVoiceCount()
 	{
@@ -541,39 +648,24 @@ namespace s3d
 		m_soloud->fadeGlobalVolume(static_cast<float>(volume), time.count());
 	}
 
-	void CAudio::getGlobalSamples(Array<float>& samples)
+	void CAudio::getGlobalSamples(Array<float>& samples, const size_t length)
 	{
-		if (const float* p = m_soloud->getWave())
-		{
-			samples.assign(p, p + 256);
-		}
-		else
-		{
-			samples.clear();
-		}
+		samples.resize(length);
+
+		m_globalTap.read(samples.data(), length);
 	}
 
 	void CAudio::getGlobalFFT(FFTResult& result)
 	{
-		result.buffer.clear();
-		result.resolution = 0.0;
-		result.sampleRate = 0;
-
-		if (const float* p = m_soloud->calcFFT())
-		{
-			const uint32 sampleRate = m_soloud->mSamplerate;
-			result.buffer.assign(p, p + 256);
-			result.resolution = static_cast<double>(sampleRate) / (256 << static_cast<int32>(FFTSampleLength::SL512));
-			result.sampleRate = sampleRate;
+		detail::CalcVisualizationFFT(m_globalTap, m_soloud->mSamplerate, result);
+	}
 
-			for (auto& x : result.buffer)
-			{
-				x *= 0.25f;
-			}
-		}
+	void CAudio::getGlobalFFT(FFTResult& result, const FFTSampleLength sampleLength)
+	{
+		detail::CalcFFT(m_globalTap, m_soloud->mSamplerate, sampleLength, result);
 	}
 
-	void CAudio::getBusSamples(const size_t busIndex, Array<float>& samples)
+	void CAudio::getBusSamples(const size_t busIndex, Array<float>& samples, const size_t length)
 	{
 		samples.clear();
 
@@ -587,10 +679,9 @@ namespace s3d
 			return;
 		}
 
-		if (const float* p = m_buses[busIndex]->getBus().getWave())
-		{
-			samples.assign(p, p + 256);
-		}
+		samples.resize(length);
+
+		m_buses[busIndex]->getTap().read(samples.data(), length);
 	}
 
 	void CAudio::getBusFFT(const size_t busIndex, FFTResult& result)
@@ -609,18 +700,26 @@ namespace s3d
 			return;
 		}
 
-		if (const float* p = m_buses[busIndex]->getBus().calcFFT())
+		detail::CalcVisualizationFFT(m_buses[busIndex]->getTap(), static_cast<uint32>(m_buses[busIndex]->getBus().mBaseSamplerate), result);
+	}
+
+	void CAudio::getBusFFT(const size_t busIndex, FFTResult& result, const FFTSampleLength sampleLength)
+	{
+		result.buffer.clear();
+		result.resolution = 0.0;
+		result.sampleRate = 0;
+
+		if (Audio::MaxBusCount <= busIndex)
 		{
-			const uint32 sampleRate = static_cast<uint32>(m_buses[busIndex]->getBus().mBaseSamplerate);
-			result.buffer.assign(p, p + 256);
-			result.resolution = static_cast<double>(sampleRate) / (256 << static_cast<int32>(FFTSampleLength::SL512));
-			result.sampleRate = sampleRate;
+			return;
+		}
 
-			for (auto& x : result.buffer)
-			{
-				x *= 0.25f;
-			}
+		if (not m_buses[busIndex])
+		{
+			return;
 		}
+
+		detail::CalcFFT(m_buses[busIndex]->getTap(), static_cast<uint32>(m_buses[busIndex]->getBus().mBaseSamplerate), sampleLength, result);
 	}
 
 	double CAudio::getBusVolume(const size_t busIndex)
@@ -710,6 +809,21 @@ namespace s3d
 		return m_soundTouchAvailable;
 	}
 
+	void CAudio::setDecodedWaveCacheCapacity(const size_t capacityBytes)
+	{
+		m_decodedWaveCache.setCapacity(capacityBytes);
+	}
+
+	DecodedWaveCacheStats CAudio::getDecodedWaveCacheStats() const
+	{
+		return m_decodedWaveCache.getStats();
+	}
+
+	void CAudio::clearDecodedWaveCache()
+	{
+		m_decodedWaveCache.clear();
+	}
+
 
 	void CAudio::speakKlatt(const StringView text, const KlattTTSParameters& param)
 	{
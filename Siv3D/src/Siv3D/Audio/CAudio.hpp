@@ -14,7 +14,10 @@
 # include "IAudio.hpp"
 # include "AudioData.hpp"
 # include "AudioBus.hpp"
+# include "AudioSampleTap.hpp"
 # include "SoundTouchFunctions.hpp"
+# include "DecodedWaveCache.hpp"
+# include "StreamDecodePool.hpp"
 # include <Siv3D/DLL.hpp>
 
 namespace s3d
@@ -35,6 +38,10 @@ namespace s3d
 
 		Audio::IDType create(Wave&& wave, const Duration& loopBegin, const Duration& loopEnd) override;
 
+		Audio::IDType createFromFile(FilePathView path, const Optional<AudioLoopTiming>& loop) override;
+
+		Audio::IDType createFromFile(FilePathView path, const Duration& loopBegin, const Duration& loopEnd) override;
+
 		Audio::IDType createStreamingNonLoop(FilePathView path) override;
 
 		Audio::IDType createStreamingLoop(FilePathView path, uint64 loopBegin) override;
@@ -122,6 +129,8 @@ namespace s3d
 
 		const float* getSamples(Audio::IDType handleID, size_t channel) override;
 
+		std::shared_ptr<const Wave> getSharedWave(Audio::IDType handleID) override;
+
 
 		size_t getActiveVoiceCount() override;
 
@@ -135,14 +144,18 @@ namespace s3d
 
 		void fadeGlobalVolume(double volume, const Duration& time) override;
 
-		void getGlobalSamples(Array<float>& samples) override;
+		void getGlobalSamples(Array<float>& samples, size_t length) override;
 
 		void getGlobalFFT(FFTResult& result) override;
 
-		void getBusSamples(size_t busIndex, Array<float>& samples) override;
+		void getGlobalFFT(FFTResult& result, FFTSampleLength sampleLength) override;
+
+		void getBusSamples(size_t busIndex, Array<float>& samples, size_t length) override;
 
 		void getBusFFT(size_t busIndex, FFTResult& result) override;
 
+		void getBusFFT(size_t busIndex, FFTResult& result, FFTSampleLength sampleLength) override;
+
 		double getBusVolume(size_t busIndex) override;
 
 		void setBusVolume(size_t busIndex, double volume) override;
@@ -169,6 +182,12 @@ namespace s3d
 
 		bool supportsPitchShift() const noexcept override;
 
+		void setDecodedWaveCacheCapacity(size_t capacityBytes) override;
+
+		DecodedWaveCacheStats getDecodedWaveCacheStats() const override;
+
+		void clearDecodedWaveCache() override;
+
 
 		void speakKlatt(StringView text, const KlattTTSParameters& param) override;
 
@@ -184,12 +203,19 @@ namespace s3d
 
 		static constexpr uint32 MaxActiveVoiceCount = 72; // hard limit: 1024
 
+		// m_soloud より後に破棄する
+		AudioSampleTap m_globalTap;
+
 		std::unique_ptr<SoLoud::Soloud> m_soloud;
 		
 		std::array<std::unique_ptr<AudioBus>, Audio::MaxBusCount> m_buses;
 
 		AssetHandleManager<Audio::IDType, AudioData> m_audios{ U"Audio" };
 
+		DecodedWaveCache m_decodedWaveCache;
+
+		StreamDecodePool m_streamDecodePool;
+
 		LibraryHandle m_soundTouch = nullptr;
 
 		bool m_soundTouchAvailable = false;
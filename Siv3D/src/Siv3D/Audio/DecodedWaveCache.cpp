@@ -0,0 +1,161 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/FileSystem.hpp>
+# include "DecodedWaveCache.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// エントリごとに、リストとハッシュテーブルのノードが使うおおよそのメモリ
+		constexpr size_t EntryOverheadBytes = 64;
+
+		[[nodiscard]]
+		static FilePath CacheKey(const FilePathView path)
+		{
+			if (FileSystem::IsResourcePath(path))
+			{
+				return FilePath{ path };
+			}
+
+			return FileSystem::FullPath(path);
+		}
+	}
+
+	std::shared_ptr<const Wave> DecodedWaveCache::load(const FilePathView path)
+	{
+		const FilePath key = detail::CacheKey(path);
+		const int64 fileSize = FileSystem::FileSize(path);
+		const Optional<DateTime> writeTime = FileSystem::WriteTime(path);
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			if (const auto it = m_table.find(key);
+				it != m_table.end())
+			{
+				const EntryList::iterator entry = it->second;
+
+				if ((entry->fileSize == fileSize)
+					&& (entry->writeTime == writeTime))
+				{
+					// 最近使われたエントリとして先頭に移す
+					m_entries.splice(m_entries.begin(), m_entries, entry);
+
+					++m_stats.hits;
+
+					return entry->wave;
+				}
+
+				// ファイルが更新されている
+				erase(entry);
+			}
+
+			++m_stats.misses;
+		}
+
+		// デコードはロックの外で行う
+		std::shared_ptr<Wave> wave = std::make_shared<Wave>(path);
+
+		if (wave->isEmpty())
+		{
+			return nullptr;
+		}
+
+		wave->deinterleave();
+
+		Entry entry;
+		entry.path		= key;
+		entry.fileSize	= fileSize;
+		entry.writeTime	= writeTime;
+		entry.wave		= wave;
+		entry.bytes		= (sizeof(Entry) + detail::EntryOverheadBytes + wave->size_bytes());
+
+		std::lock_guard lock{ m_mutex };
+
+		if (m_capacityBytes < entry.bytes)
+		{
+			return wave;
+		}
+
+		// 別のスレッドが先に追加していた場合はそちらを共有する
+		if (const auto it = m_table.find(key);
+			it != m_table.end())
+		{
+			if ((it->second->fileSize == fileSize)
+				&& (it->second->writeTime == writeTime))
+			{
+				return it->second->wave;
+			}
+
+			erase(it->second);
+		}
+
+		m_entries.push_front(std::move(entry));
+		m_table.emplace(key, m_entries.begin());
+
+		++m_stats.entries;
+		m_stats.usedBytes += m_entries.front().bytes;
+
+		shrink();
+
+		return wave;
+	}
+
+	void DecodedWaveCache::clear()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_table.clear();
+		m_entries.clear();
+		m_stats.entries = 0;
+		m_stats.usedBytes = 0;
+	}
+
+	void DecodedWaveCache::setCapacity(const size_t capacityBytes)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_capacityBytes = capacityBytes;
+
+		shrink();
+	}
+
+	DecodedWaveCacheStats DecodedWaveCache::getStats() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		DecodedWaveCacheStats stats = m_stats;
+		stats.capacityBytes = m_capacityBytes;
+		return stats;
+	}
+
+	void DecodedWaveCache::erase(const EntryList::iterator it)
+	{
+		m_table.erase(it->path);
+
+		--m_stats.entries;
+		m_stats.usedBytes -= it->bytes;
+
+		m_entries.erase(it);
+	}
+
+	void DecodedWaveCache::shrink()
+	{
+		while (m_capacityBytes < m_stats.usedBytes)
+		{
+			erase(std::prev(m_entries.end()));
+
+			++m_stats.evictions;
+		}
+	}
+}
@@ -0,0 +1,80 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <list>
+# include <memory>
+# include <mutex>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/DateTime.hpp>
+# include <Siv3D/Wave.hpp>
+# include <Siv3D/DecodedWaveCacheStats.hpp>
+
+namespace s3d
+{
+	// ファイルから作成する Audio で共有する、デコード済みの波形のキャッシュ
+	//
+	// 波形は deinterleave() した状態で保持し、AudioData は SharedWav を通してコピーせずに参照する。
+	// 容量の上限を超えると最近使われていない波形をキャッシュから取り除くが、それを参照している AudioData が残っている間は解放されない。
+	class DecodedWaveCache
+	{
+	public:
+
+		static constexpr size_t DefaultCapacityBytes = (64 << 20);
+
+		// キャッシュにあればそれを返し、無ければデコードして追加する。デコードに失敗した場合は nullptr
+		[[nodiscard]]
+		std::shared_ptr<const Wave> load(FilePathView path);
+
+		void clear();
+
+		void setCapacity(size_t capacityBytes);
+
+		[[nodiscard]]
+		DecodedWaveCacheStats getStats() const;
+
+	private:
+
+		struct Entry
+		{
+			FilePath path;
+
+			// ファイルが更新されていないかを確かめるための情報
+			int64 fileSize = 0;
+
+			Optional<DateTime> writeTime;
+
+			std::shared_ptr<const Wave> wave;
+
+			size_t bytes = 0;
+		};
+
+		using EntryList = std::list<Entry>;
+
+		mutable std::mutex m_mutex;
+
+		// 先頭ほど最近使われたエントリ
+		EntryList m_entries;
+
+		HashTable<FilePath, EntryList::iterator> m_table;
+
+		size_t m_capacityBytes = DefaultCapacityBytes;
+
+		DecodedWaveCacheStats m_stats;
+
+		void erase(EntryList::iterator it);
+
+		void shrink();
+	};
+}
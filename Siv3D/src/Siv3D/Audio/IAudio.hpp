@@ -12,6 +12,8 @@
 # pragma once
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Audio.hpp>
+# include <Siv3D/DecodedWaveCacheStats.hpp>
+# include <Siv3D/FFTSampleLength.hpp>
 
 namespace SoLoud
 {
@@ -41,6 +43,10 @@ namespace s3d
 
 		virtual Audio::IDType create(Wave&& wave, const Duration& loopBegin, const Duration& loopEnd) = 0;
 
+		virtual Audio::IDType createFromFile(FilePathView path, const Optional<AudioLoopTiming>& loop) = 0;
+
+		virtual Audio::IDType createFromFile(FilePathView path, const Duration& loopBegin, const Duration& loopEnd) = 0;
+
 		virtual Audio::IDType createStreamingNonLoop(FilePathView path) = 0;
 
 		virtual Audio::IDType createStreamingLoop(FilePathView path, uint64 loopBegin) = 0;
@@ -128,6 +134,8 @@ namespace s3d
 
 		virtual const float* getSamples(Audio::IDType handleID, size_t channel) = 0;
 
+		virtual std::shared_ptr<const Wave> getSharedWave(Audio::IDType handleID) = 0;
+
 
 		virtual size_t getActiveVoiceCount() = 0;
 
@@ -141,14 +149,18 @@ namespace s3d
 
 		virtual void fadeGlobalVolume(double volume, const Duration& time) = 0;
 
-		virtual void getGlobalSamples(Array<float>& samples) = 0;
+		virtual void getGlobalSamples(Array<float>& samples, size_t length) = 0;
 
 		virtual void getGlobalFFT(FFTResult& result) = 0;
 
-		virtual void getBusSamples(size_t busIndex, Array<float>& samples) = 0;
+		virtual void getGlobalFFT(FFTResult& result, FFTSampleLength sampleLength) = 0;
+
+		virtual void getBusSamples(size_t busIndex, Array<float>& samples, size_t length) = 0;
 
 		virtual void getBusFFT(size_t busIndex, FFTResult& result) = 0;
 
+		virtual void getBusFFT(size_t busIndex, FFTResult& result, FFTSampleLength sampleLength) = 0;
+
 		virtual double getBusVolume(size_t busIndex) = 0;
 
 		virtual void setBusVolume(size_t busIndex, double volume) = 0;
@@ -175,6 +187,12 @@ namespace s3d
 
 		virtual bool supportsPitchShift() const noexcept = 0;
 
+		virtual void setDecodedWaveCacheCapacity(size_t capacityBytes) = 0;
+
+		virtual DecodedWaveCacheStats getDecodedWaveCacheStats() const = 0;
+
+		virtual void clearDecodedWaveCache() = 0;
+
 
 
 		virtual void speakKlatt(StringView text, const KlattTTSParameters& param) = 0;
@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Wave.hpp>
+# include <ThirdParty/soloud/include/soloud_wav.h>
+
+namespace s3d
+{
+	// deinterleave() 済みの Wave を、コピーせずに参照して再生する SoLoud::Wav
+	class SharedWav : public SoLoud::Wav
+	{
+	public:
+
+		explicit SharedWav(const std::shared_ptr<const Wave>& wave)
+			: m_wave{ wave }
+		{
+			// SoLoud::Wav は mData を書き換えない
+			mData			= const_cast<float*>(&(*m_wave)[0].left);
+			mSampleCount	= static_cast<uint32>(m_wave->size());
+			mChannels		= 2;
+			mBaseSamplerate	= static_cast<float>(m_wave->sampleRate());
+		}
+
+		~SharedWav() override
+		{
+			stop();
+
+			// 共有している波形を SoLoud::Wav のデストラクタで解放させない
+			mData = nullptr;
+		}
+
+	private:
+
+		std::shared_ptr<const Wave> m_wave;
+	};
+}
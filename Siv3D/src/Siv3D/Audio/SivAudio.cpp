@@ -107,7 +107,7 @@ namespace s3d
 		: Audio{ path, Loop::No } {}
 
 	Audio::Audio(const FilePathView path, const Loop loop)
-		: Audio{ (detail::CheckEngine(), Wave{ path }), loop } {}
+		: Audio{ path, (loop ? Optional<AudioLoopTiming>{{ 0, 0 }} : none) } {}
 
 	Audio::Audio(const FilePathView path, const Arg::loopBegin_<uint64> loopBegin)
 		: Audio{ path, AudioLoopTiming{ *loopBegin, 0 } } {}
@@ -119,10 +119,16 @@ namespace s3d
 		: Audio{ path, loopBegin, Arg::loopEnd = Duration{ 0 } } {}
 
 	Audio::Audio(const FilePathView path, const Arg::loopBegin_<Duration> loopBegin, const Arg::loopEnd_<Duration> loopEnd)
-		: Audio{ (detail::CheckEngine(), Wave{ path }), loopBegin, loopEnd } {}
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Audio)->createFromFile(path, *loopBegin, *loopEnd))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
 
 	Audio::Audio(const FilePathView path, const Optional<AudioLoopTiming>& loop)
-		: Audio{ (detail::CheckEngine(), Wave{ path }), loop } {}
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Audio)->createFromFile(path, loop))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
 
 	Audio::Audio(FileStreaming, const FilePathView path)
 		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Audio)->createStreamingNonLoop(path))) }
@@ -0,0 +1,147 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "StreamDecodePool.hpp"
+# include "BufferedStreamSource.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// ストリームが登録されているが埋めるべきリングバッファが無いときに、ワーカーが次に確認するまでの最大の待ち時間
+		constexpr std::chrono::milliseconds StreamDecodeIdleWait{ 2 };
+	}
+
+	StreamDecodePool::StreamDecodePool(const size_t threadCount)
+		: m_threadCount{ threadCount } {}
+
+	StreamDecodePool::~StreamDecodePool()
+	{
+		shutdown();
+	}
+
+	void StreamDecodePool::add(const std::shared_ptr<BufferedStream>& stream)
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_streams << stream;
+
+			if (m_threads.isEmpty() && (not m_stop))
+			{
+				for (size_t i = 0; i < m_threadCount; ++i)
+				{
+					m_threads.emplace_back([this]() { run(); });
+				}
+			}
+
+			m_notified = true;
+		}
+
+		m_wakeUp.notify_all();
+	}
+
+	void StreamDecodePool::notify()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_notified = true;
+		}
+
+		m_wakeUp.notify_all();
+	}
+
+	void StreamDecodePool::shutdown()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_stop = true;
+		}
+
+		m_wakeUp.notify_all();
+
+		for (auto& thread : m_threads)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
+
+		m_threads.clear();
+
+		// ストリームの破棄で BufferedStreamSource の待機が解除されるので、ロックの外で行う
+		Array<std::shared_ptr<BufferedStream>> streams;
+		{
+			std::lock_guard lock{ m_mutex };
+
+			streams.swap(m_streams);
+		}
+	}
+
+	bool StreamDecodePool::fill(Array<float>& scratch)
+	{
+		Array<std::shared_ptr<BufferedStream>> streams;
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_streams.remove_if([](const std::shared_ptr<BufferedStream>& stream) { return stream->isClosed(); });
+
+			streams.assign(m_streams.begin(), m_streams.end());
+		}
+
+		bool decoded = false;
+
+		for (const auto& stream : streams)
+		{
+			decoded |= stream->tryFill(scratch);
+		}
+
+		// 閉じられたストリームの最後の参照は、ロックの外のここで手放される場合がある
+		return decoded;
+	}
+
+	void StreamDecodePool::run()
+	{
+		Array<float> scratch;
+
+		for (;;)
+		{
+			{
+				std::lock_guard lock{ m_mutex };
+
+				if (m_stop)
+				{
+					break;
+				}
+			}
+
+			if (not fill(scratch))
+			{
+				std::unique_lock lock{ m_mutex };
+
+				if (m_streams.isEmpty())
+				{
+					// ストリームが無い間は、add() / notify() / shutdown() まで待つ
+					m_wakeUp.wait(lock, [this]() { return (m_stop || m_notified || (not m_streams.isEmpty())); });
+				}
+				else
+				{
+					m_wakeUp.wait_for(lock, detail::StreamDecodeIdleWait, [this]() { return (m_stop || m_notified); });
+				}
+
+				m_notified = false;
+			}
+		}
+	}
+}
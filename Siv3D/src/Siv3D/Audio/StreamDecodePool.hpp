@@ -0,0 +1,73 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <condition_variable>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+
+namespace s3d
+{
+	class BufferedStream;
+
+	// ストリーミング再生中のボイスのリングバッファを、ミキサーに先行してデコードで埋めるワーカースレッド
+	//
+	// 各ワーカーは登録されたストリームを順に見て、空きのあるリングバッファを埋める。
+	// 1 つのストリームを同時に埋めるワーカーは 1 つだけ。閉じられたストリームはワーカーが手放す。
+	class StreamDecodePool
+	{
+	public:
+
+		static constexpr size_t DefaultThreadCount = 2;
+
+		// threadCount が 0 の場合はワーカースレッドを作成しない。ストリームは fill() で埋める
+		explicit StreamDecodePool(size_t threadCount = DefaultThreadCount);
+
+		~StreamDecodePool();
+
+		StreamDecodePool(const StreamDecodePool&) = delete;
+
+		StreamDecodePool& operator =(const StreamDecodePool&) = delete;
+
+		// ストリームを登録する。ワーカースレッドは最初の登録時に作成される
+		void add(const std::shared_ptr<BufferedStream>& stream);
+
+		// シークの要求やストリームが閉じられたことを、待機中のワーカーに知らせる
+		void notify();
+
+		// すべてのスレッドを終了し、登録されているストリームを手放す
+		void shutdown();
+
+		// 登録されているストリームを、呼び出し元のスレッドでそれぞれ 1 回埋める。デコードした場合 true
+		bool fill(Array<float>& scratch);
+
+	private:
+
+		std::mutex m_mutex;
+
+		std::condition_variable m_wakeUp;
+
+		Array<std::shared_ptr<BufferedStream>> m_streams;
+
+		Array<std::thread> m_threads;
+
+		size_t m_threadCount = DefaultThreadCount;
+
+		bool m_stop = false;
+
+		bool m_notified = false;
+
+		void run();
+	};
+}
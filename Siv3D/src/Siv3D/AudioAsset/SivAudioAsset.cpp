@@ -242,7 +242,17 @@ namespace s3d
 
 	void AudioAsset::LoadAsync(const AssetNameView name)
 	{
-		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Audio, name, {});
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Audio, name, {}, AssetLoadPriority::Normal);
+	}
+
+	void AudioAsset::LoadAsync(const AssetNameView name, const AssetLoadPriority priority)
+	{
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Audio, name, {}, priority);
+	}
+
+	bool AudioAsset::CancelLoadAsync(const AssetNameView name)
+	{
+		return SIV3D_ENGINE(Asset)->cancelLoadAsync(AssetType::Audio, name);
 	}
 
 	void AudioAsset::Wait(const AssetNameView name)
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/AudioAssetData.hpp>
+# include <Siv3D/ProfileZone.hpp>
 
 namespace s3d
 {
@@ -42,6 +43,8 @@ namespace s3d
 
 	bool AudioAssetData::load(const String& hint)
 	{
+		SIV3D_PROFILE_SCOPE(U"AudioAsset::load");
+
 		if (isUninitialized())
 		{
 			if (onLoad(*this, hint))
@@ -68,21 +71,13 @@ namespace s3d
 	{
 		if (isUninitialized())
 		{
-			setState(AssetState::AsyncLoading);
-
-			m_task = Async([this, hint = hint]()
-				{
-					setState(onLoad(*this, hint) ? AssetState::Loaded : AssetState::Failed);
-				});
+			requestAsyncLoad({}, [this, hint = hint]() { return onLoad(*this, hint); });
 		}
 	}
 
 	void AudioAssetData::wait()
 	{
-		if (m_task.isValid())
-		{
-			m_task.get();
-		}
+		waitAsyncLoad();
 	}
 
 	void AudioAssetData::release()
@@ -94,6 +89,12 @@ namespace s3d
 
 		if (isAsyncLoading())
 		{
+			// 開始していないロードは取り消す
+			if (cancelAsync())
+			{
+				return;
+			}
+
 			wait();
 		}
 
@@ -12,6 +12,7 @@
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfileZone.hpp>
 # include "CAudioDecoder.hpp"
 # include <Siv3D/AudioFormat/WAVEDecoder.hpp>
 # include <Siv3D/AudioFormat/OggVorbisDecoder.hpp>
@@ -91,6 +92,8 @@ namespace s3d
 
 	Wave CAudioDecoder::decode(IReader& reader, const FilePathView pathHint, const AudioFormat imageFormat)
 	{
+		SIV3D_PROFILE_SCOPE(U"AudioDecoder::decode");
+
 		LOG_SCOPED_TRACE(U"CAudioDecoder::decode()");
 
 		auto it = findDecoder(imageFormat);
@@ -112,6 +115,8 @@ namespace s3d
 
 	Wave CAudioDecoder::decode(IReader& reader, const StringView decoderName)
 	{
+		SIV3D_PROFILE_SCOPE(U"AudioDecoder::decode");
+
 		LOG_SCOPED_TRACE(U"CAudioDecoder::decode({})"_fmt(decoderName));
 
 		const auto it = findDecoder(decoderName);
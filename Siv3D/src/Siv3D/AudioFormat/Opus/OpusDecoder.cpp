@@ -11,6 +11,7 @@
 
 # include <Siv3D/AudioFormat/OpusDecoder.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/IReader/ReaderBytes.hpp>
 
 # if SIV3D_PLATFORM(WINDOWS) | SIV3D_PLATFORM(MACOS) | SIV3D_PLATFORM(WEB)
 #	include <ThirdParty-prebuilt/ogg/ogg.h>
@@ -75,8 +76,8 @@ namespace s3d
 			return{};
 		}
 
-		Array<uint8> data(reader.size());
-		reader.read(data.data(), data.size());
+		// op_open_memory() はデータをコピーしないので、OggOpusFile を解放するまで data を保持する
+		const ReaderBytes data{ reader };
 
 		int err;
 		OggOpusFile* of = ::op_open_memory(data.data(), data.size(), &err);
@@ -110,6 +110,26 @@ namespace s3d
 		return pImpl->lookahead(NonNull{ dst }, pos, size);
 	}
 
+	bool BinaryReader::supportsReadView() const noexcept
+	{
+		return pImpl->supportsReadView();
+	}
+
+	std::span<const Byte> BinaryReader::readView(const int64 size)
+	{
+		if (size <= 0)
+		{
+			return{};
+		}
+
+		return pImpl->readView(size);
+	}
+
+	bool BinaryReader::isMemoryMapped() const noexcept
+	{
+		return pImpl->isMapped();
+	}
+
 	const FilePath& BinaryReader::path() const noexcept
 	{
 		return pImpl->path();
@@ -213,21 +213,28 @@ namespace s3d
 
 		const boost::escaped_list_separator<char32> separator{ detail::ToU32String(escapes), detail::ToU32String(separators), detail::ToU32String(quotes) };
 
-		String str;
+		String buffer;
+
+		Array<StringView> lines;
 
 		m_data.clear();
 
-		while (reader.readLine(str))
+		// 行ごとに String を作成せず、まとめて読み込んだバッファの中の各行をトークンに分割する
+		reader.readLineViews(buffer, lines);
+
+		m_data.reserve(lines.size());
+
+		for (const auto& line : lines)
 		{
 			try
 			{
-				const boost::tokenizer<boost::escaped_list_separator<char32>, String::const_iterator, String> tokens{ str, separator };
+				const boost::tokenizer<boost::escaped_list_separator<char32>, StringView::const_iterator, String> tokens{ line.begin(), line.end(), separator };
 
 				m_data.emplace_back(tokens.begin(), tokens.end());
 			}
 			catch (boost::exception&)
 			{
-				str.replace(U"\\", U"\\\\");
+				const String str = String{ line }.replace(U"\\", U"\\\\");
 
 				const boost::tokenizer<boost::escaped_list_separator<char32>, String::const_iterator, String> tokens{ str, separator };
 
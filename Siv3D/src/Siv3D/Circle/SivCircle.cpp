@@ -279,6 +279,18 @@ namespace s3d
 		return *this;
 	}
 
+	void Circle::DrawBatch(const Array<Circle>& circles, const ColorF& color)
+	{
+		SIV3D_ENGINE(Renderer2D)->addCircles(circles.data(), circles.size(), nullptr, color.toFloat4());
+	}
+
+	void Circle::DrawBatch(const Array<Circle>& circles, const Array<ColorF>& colors)
+	{
+		assert(circles.size() == colors.size());
+
+		SIV3D_ENGINE(Renderer2D)->addCircles(circles.data(), Min(circles.size(), colors.size()), colors.data(), Float4{ 1.0f, 1.0f, 1.0f, 1.0f });
+	}
+
 	const Circle& Circle::drawFrame(const double thickness, const ColorF& color) const
 	{
 		return drawFrame(thickness * 0.5, thickness * 0.5, color);
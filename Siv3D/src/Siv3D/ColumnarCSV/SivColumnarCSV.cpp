@@ -0,0 +1,505 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <charconv>
+# include <cstring>
+# include <Siv3D/ColumnarCSV.hpp>
+# include <Siv3D/TextReader.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Error.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <ThirdParty/fast_float/fast_float.h>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// この大きさより小さいデータは分割せずにパースする
+		constexpr size_t MinChunkSize = (256 * 1024);
+
+		[[nodiscard]]
+		static std::string_view RemoveUTF8BOM(const std::string_view s) noexcept
+		{
+			if (s.starts_with("\xEF\xBB\xBF"))
+			{
+				return s.substr(3);
+			}
+
+			return s;
+		}
+
+		[[nodiscard]]
+		static const char* FindChar(const char* first, const char* last, const char ch) noexcept
+		{
+			if (const void* p = std::memchr(first, ch, (last - first)))
+			{
+				return static_cast<const char*>(p);
+			}
+
+			return last;
+		}
+
+		// [first, last) の各行（末尾の \r を除く）について f(line) を呼ぶ。空の行は飛ばす
+		template <class Fty>
+		static void ForEachLine(const char* first, const char* const last, Fty f)
+		{
+			while (first < last)
+			{
+				const char* lineEnd = FindChar(first, last, '\n');
+				const char* next = ((lineEnd == last) ? last : (lineEnd + 1));
+
+				if ((first < lineEnd) && (lineEnd[-1] == '\r'))
+				{
+					--lineEnd;
+				}
+
+				if (first < lineEnd)
+				{
+					f(std::string_view(first, (lineEnd - first)));
+				}
+
+				first = next;
+			}
+		}
+
+		// 行の各セルについて f(column, cell, hasEscapedQuote) を呼ぶ。引用符は取り除く
+		template <class Fty>
+		static void ForEachCell(const std::string_view line, const char separator, Fty f)
+		{
+			const char* it = line.data();
+			const char* const last = (line.data() + line.size());
+
+			for (size_t column = 0;; ++column)
+			{
+				std::string_view cell;
+				bool hasEscapedQuote = false;
+
+				if ((it < last) && (*it == '"'))
+				{
+					const char* const cellBegin = ++it;
+
+					while (it < last)
+					{
+						if (*it == '"')
+						{
+							if (((it + 1) < last) && (it[1] == '"'))
+							{
+								hasEscapedQuote = true;
+								it += 2;
+								continue;
+							}
+
+							break;
+						}
+
+						++it;
+					}
+
+					cell = std::string_view(cellBegin, (it - cellBegin));
+					it = FindChar(it, last, separator);
+				}
+				else
+				{
+					const char* const cellEnd = FindChar(it, last, separator);
+					cell = std::string_view(it, (cellEnd - it));
+					it = cellEnd;
+				}
+
+				if (not f(column, cell, hasEscapedQuote))
+				{
+					return;
+				}
+
+				if (it == last)
+				{
+					return;
+				}
+
+				++it;
+			}
+		}
+
+		[[nodiscard]]
+		static std::string_view TrimNumber(std::string_view s) noexcept
+		{
+			while ((not s.empty()) && ((s.front() == ' ') || (s.front() == '\t')))
+			{
+				s.remove_prefix(1);
+			}
+
+			while ((not s.empty()) && ((s.back() == ' ') || (s.back() == '\t')))
+			{
+				s.remove_suffix(1);
+			}
+
+			if (s.starts_with('+'))
+			{
+				s.remove_prefix(1);
+			}
+
+			return s;
+		}
+
+		[[nodiscard]]
+		static bool ParseCell(std::string_view cell, int64& result) noexcept
+		{
+			cell = TrimNumber(cell);
+
+			const auto [p, ec] = std::from_chars(cell.data(), (cell.data() + cell.size()), result);
+
+			return ((ec == std::errc{}) && (p == (cell.data() + cell.size())) && (not cell.empty()));
+		}
+
+		[[nodiscard]]
+		static bool ParseCell(std::string_view cell, double& result) noexcept
+		{
+			cell = TrimNumber(cell);
+
+			const auto [p, ec] = fast_float::from_chars(cell.data(), (cell.data() + cell.size()), result);
+
+			return ((ec == std::errc{}) && (p == (cell.data() + cell.size())) && (not cell.empty()));
+		}
+
+		[[nodiscard]]
+		static String ToString(const std::string_view cell, const bool hasEscapedQuote)
+		{
+			if (not hasEscapedQuote)
+			{
+				return Unicode::FromUTF8(cell);
+			}
+
+			std::string unescaped;
+			unescaped.reserve(cell.size());
+
+			for (size_t i = 0; i < cell.size(); ++i)
+			{
+				unescaped.push_back(cell[i]);
+
+				if ((cell[i] == '"') && ((i + 1) < cell.size()) && (cell[i + 1] == '"'))
+				{
+					++i;
+				}
+			}
+
+			return Unicode::FromUTF8(unescaped);
+		}
+
+		// データを、行の途中で切れないように分割する
+		[[nodiscard]]
+		static Array<const char*> SplitIntoChunks(const std::string_view data)
+		{
+			const char* const first = data.data();
+			const char* const last = (data.data() + data.size());
+
+			const size_t maxChunks = Max<size_t>(1, (data.size() / MinChunkSize));
+			const size_t chunkCount = Min<size_t>(maxChunks, (Threading::GetConcurrency() * 4));
+
+			Array<const char*> boundaries;
+			boundaries.reserve(chunkCount + 1);
+			boundaries << first;
+
+			for (size_t i = 1; i < chunkCount; ++i)
+			{
+				const char* p = Max((first + (data.size() * i / chunkCount)), boundaries.back());
+
+				if (p != last)
+				{
+					p = FindChar(p, last, '\n');
+					p = ((p == last) ? last : (p + 1));
+				}
+
+				boundaries << p;
+			}
+
+			boundaries << last;
+
+			return boundaries;
+		}
+	}
+
+	ColumnarCSV::ColumnarCSV(const FilePathView path, const Array<CSVColumnType>& columnTypes, const HasHeader hasHeader, const char32 separator)
+	{
+		load(path, columnTypes, hasHeader, separator);
+	}
+
+	bool ColumnarCSV::load(const FilePathView path, const Array<CSVColumnType>& columnTypes, const HasHeader hasHeader, const char32 separator)
+	{
+		clear();
+
+		if (0x80 <= separator)
+		{
+			LOG_FAIL(U"ColumnarCSV::load(): The separator must be an ASCII character");
+			return false;
+		}
+
+		// 通常のファイルは、コピーせずにメモリマップしたデータをパースする
+		if (not FileSystem::IsResourcePath(path))
+		{
+			const MemoryMappedFileView view{ path };
+
+			if (view && (view.mappedSize() != 0))
+			{
+				const std::string_view data{ reinterpret_cast<const char*>(view.data()), view.mappedSize() };
+
+				if ((not data.starts_with("\xFF\xFE")) && (not data.starts_with("\xFE\xFF")))
+				{
+					return loadFromUTF8(data, columnTypes, hasHeader, static_cast<char>(separator));
+				}
+			}
+		}
+
+		TextReader reader{ path };
+
+		if (not reader)
+		{
+			return false;
+		}
+
+		return loadFromUTF8(Unicode::ToUTF8(reader.readAll()), columnTypes, hasHeader, static_cast<char>(separator));
+	}
+
+	void ColumnarCSV::clear() noexcept
+	{
+		m_columns.clear();
+
+		m_header.clear();
+
+		m_rows = 0;
+
+		m_invalidCellCount = 0;
+	}
+
+	bool ColumnarCSV::isEmpty() const noexcept
+	{
+		return (m_rows == 0);
+	}
+
+	ColumnarCSV::operator bool() const noexcept
+	{
+		return (not isEmpty());
+	}
+
+	size_t ColumnarCSV::rows() const noexcept
+	{
+		return m_rows;
+	}
+
+	size_t ColumnarCSV::columns() const noexcept
+	{
+		return m_columns.size();
+	}
+
+	const Array<String>& ColumnarCSV::header() const noexcept
+	{
+		return m_header;
+	}
+
+	Optional<size_t> ColumnarCSV::columnIndex(const StringView name) const
+	{
+		for (size_t i = 0; i < m_header.size(); ++i)
+		{
+			if (m_header[i] == name)
+			{
+				return i;
+			}
+		}
+
+		return none;
+	}
+
+	CSVColumnType ColumnarCSV::columnType(const size_t column) const
+	{
+		if (m_columns.size() <= column)
+		{
+			throw Error{ U"ColumnarCSV::columnType(): Invalid column index ({})"_fmt(column) };
+		}
+
+		return m_columns[column].type;
+	}
+
+	const Array<int64>& ColumnarCSV::getInt64Column(const size_t column) const
+	{
+		return getColumn(column, CSVColumnType::Int64).int64s;
+	}
+
+	const Array<double>& ColumnarCSV::getDoubleColumn(const size_t column) const
+	{
+		return getColumn(column, CSVColumnType::Double).doubles;
+	}
+
+	const Array<String>& ColumnarCSV::getStringColumn(const size_t column) const
+	{
+		return getColumn(column, CSVColumnType::String).strings;
+	}
+
+	size_t ColumnarCSV::invalidCellCount() const noexcept
+	{
+		return m_invalidCellCount;
+	}
+
+	const ColumnarCSV::Column& ColumnarCSV::getColumn(const size_t column, const CSVColumnType type) const
+	{
+		if (m_columns.size() <= column)
+		{
+			throw Error{ U"ColumnarCSV: Invalid column index ({})"_fmt(column) };
+		}
+
+		if (m_columns[column].type != type)
+		{
+			throw Error{ U"ColumnarCSV: The type of column {} does not match"_fmt(column) };
+		}
+
+		return m_columns[column];
+	}
+
+	bool ColumnarCSV::loadFromUTF8(std::string_view data, const Array<CSVColumnType>& columnTypes, const HasHeader hasHeader, const char separator)
+	{
+		data = detail::RemoveUTF8BOM(data);
+
+		const size_t columnCount = columnTypes.size();
+
+		if (hasHeader)
+		{
+			// 最初の空でない行を見出しとする
+			const char* const last = (data.data() + data.size());
+			const char* headerEnd = data.data();
+
+			while (headerEnd != last)
+			{
+				const char* lineEnd = detail::FindChar(headerEnd, last, '\n');
+				const char* const next = ((lineEnd == last) ? last : (lineEnd + 1));
+
+				detail::ForEachLine(headerEnd, lineEnd, [&](const std::string_view line)
+				{
+					detail::ForEachCell(line, separator, [&](const size_t, const std::string_view cell, const bool hasEscapedQuote)
+					{
+						m_header << detail::ToString(cell, hasEscapedQuote);
+						return true;
+					});
+				});
+
+				headerEnd = next;
+
+				if (m_header)
+				{
+					break;
+				}
+			}
+
+			data.remove_prefix(headerEnd - data.data());
+		}
+
+		const Array<const char*> boundaries = detail::SplitIntoChunks(data);
+		const size_t chunkCount = (boundaries.size() - 1);
+
+		// 1 回目: チャンクごとの行数を数える
+		Array<size_t> rowOffsets(chunkCount + 1, 0);
+
+		Threading::ParallelFor(0, chunkCount, [&](const size_t chunk)
+		{
+			size_t rows = 0;
+
+			detail::ForEachLine(boundaries[chunk], boundaries[chunk + 1], [&](std::string_view) { ++rows; });
+
+			rowOffsets[chunk + 1] = rows;
+		}, 1);
+
+		for (size_t i = 0; i < chunkCount; ++i)
+		{
+			rowOffsets[i + 1] += rowOffsets[i];
+		}
+
+		m_rows = rowOffsets.back();
+
+		m_columns.resize(columnCount);
+
+		for (size_t i = 0; i < columnCount; ++i)
+		{
+			Column& column = m_columns[i];
+			column.type = columnTypes[i];
+
+			switch (column.type)
+			{
+			case CSVColumnType::Int64:
+				column.int64s.resize(m_rows, 0);
+				break;
+			case CSVColumnType::Double:
+				column.doubles.resize(m_rows, 0.0);
+				break;
+			default:
+				column.strings.resize(m_rows);
+				break;
+			}
+		}
+
+		// 2 回目: 各チャンクの行を、それぞれの行の位置にパースする
+		Array<size_t> invalidCounts(chunkCount, 0);
+
+		Threading::ParallelFor(0, chunkCount, [&](const size_t chunk)
+		{
+			size_t row = rowOffsets[chunk];
+			size_t invalidCount = 0;
+
+			detail::ForEachLine(boundaries[chunk], boundaries[chunk + 1], [&](const std::string_view line)
+			{
+				detail::ForEachCell(line, separator, [&](const size_t index, const std::string_view cell, const bool hasEscapedQuote)
+				{
+					if (columnCount <= index)
+					{
+						return false;
+					}
+
+					Column& column = m_columns[index];
+
+					switch (column.type)
+					{
+					case CSVColumnType::Int64:
+						if (not detail::ParseCell(cell, column.int64s[row]))
+						{
+							column.int64s[row] = 0;
+							++invalidCount;
+						}
+						break;
+					case CSVColumnType::Double:
+						if (not detail::ParseCell(cell, column.doubles[row]))
+						{
+							column.doubles[row] = 0.0;
+							++invalidCount;
+						}
+						break;
+					default:
+						column.strings[row] = detail::ToString(cell, hasEscapedQuote);
+						break;
+					}
+
+					return true;
+				});
+
+				++row;
+			});
+
+			invalidCounts[chunk] = invalidCount;
+		}, 1);
+
+		m_invalidCellCount = invalidCounts.sum();
+
+		if (m_header && (columnCount < m_header.size()))
+		{
+			m_header.resize(columnCount);
+		}
+
+		return true;
+	}
+}
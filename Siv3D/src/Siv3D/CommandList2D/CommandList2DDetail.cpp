@@ -0,0 +1,199 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "CommandList2DDetail.hpp"
+# include <Siv3D/LineStyle.hpp>
+# include <Siv3D/Renderer2D/IRenderer2D.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+
+namespace s3d
+{
+	static_assert(sizeof(TriangleIndex) == (sizeof(Vertex2D::IndexType) * 3));
+
+	namespace detail
+	{
+		template <class Type>
+		static void GrowArray(Array<Type>& array, const size_t target)
+		{
+			if (target <= array.size())
+			{
+				return;
+			}
+
+			size_t newSize = Max<size_t>(array.size() * 2, 256);
+
+			while (newSize < target)
+			{
+				newSize *= 2;
+			}
+
+			array.resize(newSize);
+		}
+	}
+
+	CommandList2D::CommandList2DDetail::CommandList2DDetail()
+		: m_bufferCreator{ [this](const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize) { return requestBuffer(vertexSize, indexSize); } } {}
+
+	CommandList2D::CommandList2DDetail::CommandList2DDetail(const float maxScaling)
+		: CommandList2DDetail{}
+	{
+		m_maxScaling = maxScaling;
+	}
+
+	CommandList2D::CommandList2DDetail::CommandList2DDetail(const CommandList2DDetail& other)
+		: CommandList2DDetail{}
+	{
+		*this = other;
+	}
+
+	CommandList2D::CommandList2DDetail& CommandList2D::CommandList2DDetail::operator =(const CommandList2DDetail& other)
+	{
+		// m_bufferCreator は自身の this を指しているのでコピーしない
+		m_vertices.assign(other.m_vertices.begin(), (other.m_vertices.begin() + other.m_vertexCount));
+		m_indices.assign(other.m_indices.begin(), (other.m_indices.begin() + other.m_triangleCount));
+		m_vertexCount	= other.m_vertexCount;
+		m_triangleCount	= other.m_triangleCount;
+		m_segments		= other.m_segments;
+		m_maxScaling	= other.m_maxScaling;
+
+		return *this;
+	}
+
+	void CommandList2D::CommandList2DDetail::addLine(const Float2& begin, const Float2& end, const float thickness, const Float4(&colors)[2])
+	{
+		(void)Vertex2DBuilder::BuildLine(LineStyle::Default, m_bufferCreator, begin, end, thickness, colors, m_maxScaling);
+	}
+
+	void CommandList2D::CommandList2DDetail::addTriangle(const Float2(&points)[3], const Float4& color)
+	{
+		(void)Vertex2DBuilder::BuildTriangle(m_bufferCreator, points, color);
+	}
+
+	void CommandList2D::CommandList2DDetail::addRect(const FloatRect& rect, const Float4& color)
+	{
+		(void)Vertex2DBuilder::BuildRect(m_bufferCreator, rect, color);
+	}
+
+	void CommandList2D::CommandList2DDetail::addRectFrame(const FloatRect& rect, const float thickness, const Float4& color)
+	{
+		(void)Vertex2DBuilder::BuildRectFrame(m_bufferCreator, rect, thickness, color, color);
+	}
+
+	void CommandList2D::CommandList2DDetail::addCircle(const Float2& center, const float r, const Float4& innerColor, const Float4& outerColor)
+	{
+		(void)Vertex2DBuilder::BuildCircle(m_bufferCreator, center, r, innerColor, outerColor, m_maxScaling);
+	}
+
+	void CommandList2D::CommandList2DDetail::addCircleFrame(const Float2& center, const float rInner, const float thickness, const Float4& color)
+	{
+		(void)Vertex2DBuilder::BuildCircleFrame(m_bufferCreator, center, rInner, thickness, color, color, m_maxScaling);
+	}
+
+	void CommandList2D::CommandList2DDetail::addEllipse(const Float2& center, const float a, const float b, const Float4& color)
+	{
+		(void)Vertex2DBuilder::BuildEllipse(m_bufferCreator, center, a, b, color, color, m_maxScaling);
+	}
+
+	void CommandList2D::CommandList2DDetail::addQuad(const FloatQuad& quad, const Float4& color)
+	{
+		(void)Vertex2DBuilder::BuildQuad(m_bufferCreator, quad, color);
+	}
+
+	void CommandList2D::CommandList2DDetail::addLineString(const Vec2* points, const size_t size, const float thickness, const Float4& color, const CloseRing closeRing)
+	{
+		(void)Vertex2DBuilder::BuildLineString(m_bufferCreator, m_buffer, LineStyle::Default, points, size, none, thickness, false, color, closeRing, m_maxScaling);
+	}
+
+	void CommandList2D::CommandList2DDetail::addPolygon(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Float4& color)
+	{
+		(void)Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, indices, none, color);
+	}
+
+	void CommandList2D::CommandList2DDetail::addVertices(const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
+	{
+		(void)Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, indices, num_triangles);
+	}
+
+	void CommandList2D::CommandList2DDetail::clear() noexcept
+	{
+		m_vertexCount = 0;
+		m_triangleCount = 0;
+		m_segments.clear();
+	}
+
+	void CommandList2D::CommandList2DDetail::reserve(const size_t vertexSize, const size_t num_triangles)
+	{
+		detail::GrowArray(m_vertices, vertexSize);
+		detail::GrowArray(m_indices, num_triangles);
+	}
+
+	size_t CommandList2D::CommandList2DDetail::num_vertices() const noexcept
+	{
+		return m_vertexCount;
+	}
+
+	size_t CommandList2D::CommandList2DDetail::num_triangles() const noexcept
+	{
+		return m_triangleCount;
+	}
+
+	const Array<CommandList2D::Segment>& CommandList2D::CommandList2DDetail::segments() const noexcept
+	{
+		return m_segments;
+	}
+
+	void CommandList2D::CommandList2DDetail::draw() const
+	{
+		auto pRenderer2D = SIV3D_ENGINE(Renderer2D);
+
+		for (const auto& segment : m_segments)
+		{
+			pRenderer2D->addPolygon((m_vertices.data() + segment.vertexOffset), segment.vertexCount,
+				(m_indices.data() + segment.triangleOffset), segment.triangleCount);
+		}
+	}
+
+	Vertex2DBufferPointer CommandList2D::CommandList2DDetail::requestBuffer(const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize)
+	{
+		assert((indexSize % 3) == 0);
+
+		if ((MaxSegmentVertexCount < vertexSize)
+			|| (MaxSegmentIndexCount < indexSize)) SIV3D_UNLIKELY
+		{
+			return{ nullptr, nullptr, 0 };
+		}
+
+		// 現在のセグメントに収まらない場合は新しいセグメントを始める
+		if ((not m_segments)
+			|| (MaxSegmentVertexCount < (m_segments.back().vertexCount + vertexSize))
+			|| (MaxSegmentIndexCount < ((m_segments.back().triangleCount * 3) + indexSize)))
+		{
+			m_segments.push_back({ static_cast<uint32>(m_vertexCount), 0, static_cast<uint32>(m_triangleCount), 0 });
+		}
+
+		const uint32 triangleSize = (indexSize / 3);
+
+		detail::GrowArray(m_vertices, (m_vertexCount + vertexSize));
+		detail::GrowArray(m_indices, (m_triangleCount + triangleSize));
+
+		auto& segment = m_segments.back();
+		Vertex2D* const pVertex = (m_vertices.data() + m_vertexCount);
+		Vertex2D::IndexType* const pIndex = reinterpret_cast<Vertex2D::IndexType*>(m_indices.data() + m_triangleCount);
+		const auto indexOffset = static_cast<Vertex2D::IndexType>(segment.vertexCount);
+
+		m_vertexCount += vertexSize;
+		m_triangleCount += triangleSize;
+		segment.vertexCount += vertexSize;
+		segment.triangleCount += triangleSize;
+
+		return{ pVertex, pIndex, indexOffset };
+	}
+}
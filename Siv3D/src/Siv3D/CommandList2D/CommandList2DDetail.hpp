@@ -0,0 +1,98 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/CommandList2D.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+
+namespace s3d
+{
+	class CommandList2D::CommandList2DDetail
+	{
+	public:
+
+		CommandList2DDetail();
+
+		explicit CommandList2DDetail(float maxScaling);
+
+		CommandList2DDetail(const CommandList2DDetail& other);
+
+		CommandList2DDetail& operator =(const CommandList2DDetail& other);
+
+		void addLine(const Float2& begin, const Float2& end, float thickness, const Float4(&colors)[2]);
+
+		void addTriangle(const Float2(&points)[3], const Float4& color);
+
+		void addRect(const FloatRect& rect, const Float4& color);
+
+		void addRectFrame(const FloatRect& rect, float thickness, const Float4& color);
+
+		void addCircle(const Float2& center, float r, const Float4& innerColor, const Float4& outerColor);
+
+		void addCircleFrame(const Float2& center, float rInner, float thickness, const Float4& color);
+
+		void addEllipse(const Float2& center, float a, float b, const Float4& color);
+
+		void addQuad(const FloatQuad& quad, const Float4& color);
+
+		void addLineString(const Vec2* points, size_t size, float thickness, const Float4& color, CloseRing closeRing);
+
+		void addPolygon(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Float4& color);
+
+		void addVertices(const Vertex2D* vertices, size_t vertexCount, const TriangleIndex* indices, size_t num_triangles);
+
+		void clear() noexcept;
+
+		void reserve(size_t vertexSize, size_t num_triangles);
+
+		[[nodiscard]]
+		size_t num_vertices() const noexcept;
+
+		[[nodiscard]]
+		size_t num_triangles() const noexcept;
+
+		[[nodiscard]]
+		const Array<Segment>& segments() const noexcept;
+
+		void draw() const;
+
+	private:
+
+		// 1 つのセグメントの頂点数の上限（Vertex2D::IndexType で表せる範囲）
+		static constexpr uint32 MaxSegmentVertexCount = 65535;
+
+		// 1 つのセグメントのインデックス数の上限（3 の倍数）
+		static constexpr uint32 MaxSegmentIndexCount = 65535;
+
+		Array<Vertex2D> m_vertices;
+
+		Array<TriangleIndex> m_indices;
+
+		// 使用中の頂点数。m_vertices のサイズは容量として扱う
+		size_t m_vertexCount = 0;
+
+		// 使用中の三角形の個数。m_indices のサイズは容量として扱う
+		size_t m_triangleCount = 0;
+
+		Array<Segment> m_segments;
+
+		// Vertex2DBuilder でのメモリアロケーションを避けるためのバッファ
+		Array<Float2> m_buffer;
+
+		BufferCreatorFunc m_bufferCreator;
+
+		float m_maxScaling = 1.0f;
+
+		[[nodiscard]]
+		Vertex2DBufferPointer requestBuffer(Vertex2D::IndexType vertexSize, Vertex2D::IndexType indexSize);
+	};
+}
@@ -0,0 +1,200 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/CommandList2D.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/LineString.hpp>
+# include <Siv3D/Polygon.hpp>
+# include "CommandList2DDetail.hpp"
+
+namespace s3d
+{
+	CommandList2D::CommandList2D()
+		: pImpl{ std::make_unique<CommandList2DDetail>() } {}
+
+	CommandList2D::CommandList2D(const CommandList2D& other)
+		: pImpl{ std::make_unique<CommandList2DDetail>(*other.pImpl) } {}
+
+	CommandList2D::CommandList2D(CommandList2D&& other) noexcept
+		: pImpl{ std::move(other.pImpl) }
+	{
+		other.pImpl = std::make_unique<CommandList2DDetail>();
+	}
+
+	CommandList2D::CommandList2D(const double maxScaling)
+		: pImpl{ std::make_unique<CommandList2DDetail>(static_cast<float>(maxScaling)) } {}
+
+	CommandList2D::~CommandList2D() {}
+
+	CommandList2D& CommandList2D::operator =(const CommandList2D& other)
+	{
+		*pImpl = *other.pImpl;
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::operator =(CommandList2D&& other) noexcept
+	{
+		// 移動元も使える状態のまま残すため、ポインタを交換する
+		pImpl.swap(other.pImpl);
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addLine(const Line& line, const double thickness, const ColorF& color)
+	{
+		const Float4 colorF = color.toFloat4();
+
+		pImpl->addLine(line.begin, line.end, static_cast<float>(thickness), { colorF, colorF });
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addLine(const Line& line, const double thickness, const ColorF& colorBegin, const ColorF& colorEnd)
+	{
+		pImpl->addLine(line.begin, line.end, static_cast<float>(thickness), { colorBegin.toFloat4(), colorEnd.toFloat4() });
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addTriangle(const Triangle& triangle, const ColorF& color)
+	{
+		pImpl->addTriangle({ triangle.p0, triangle.p1, triangle.p2 }, color.toFloat4());
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addRect(const RectF& rect, const ColorF& color)
+	{
+		pImpl->addRect(FloatRect{ rect.x, rect.y, (rect.x + rect.w), (rect.y + rect.h) }, color.toFloat4());
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addRectFrame(const RectF& rect, const double thickness, const ColorF& color)
+	{
+		const double innerThickness = (thickness * 0.5);
+
+		if ((rect.w <= 0.0) || (rect.h <= 0.0) || (thickness <= 0.0))
+		{
+			return *this;
+		}
+
+		if (((rect.w * 0.5) <= innerThickness) || ((rect.h * 0.5) <= innerThickness))
+		{
+			return addRect(rect.stretched(innerThickness), color);
+		}
+
+		pImpl->addRectFrame(
+			FloatRect{ (rect.x + innerThickness), (rect.y + innerThickness), (rect.x + rect.w - innerThickness), (rect.y + rect.h - innerThickness) },
+			static_cast<float>(thickness), color.toFloat4());
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addCircle(const Circle& circle, const ColorF& color)
+	{
+		const Float4 colorF = color.toFloat4();
+
+		pImpl->addCircle(circle.center, static_cast<float>(circle.r), colorF, colorF);
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addCircle(const Circle& circle, const ColorF& innerColor, const ColorF& outerColor)
+	{
+		pImpl->addCircle(circle.center, static_cast<float>(circle.r), innerColor.toFloat4(), outerColor.toFloat4());
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addCircleFrame(const Circle& circle, const double thickness, const ColorF& color)
+	{
+		pImpl->addCircleFrame(circle.center, static_cast<float>(circle.r - (thickness * 0.5)), static_cast<float>(thickness), color.toFloat4());
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addEllipse(const Ellipse& ellipse, const ColorF& color)
+	{
+		pImpl->addEllipse(ellipse.center, static_cast<float>(ellipse.a), static_cast<float>(ellipse.b), color.toFloat4());
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addQuad(const Quad& quad, const ColorF& color)
+	{
+		pImpl->addQuad(FloatQuad{ quad.p0, quad.p1, quad.p2, quad.p3 }, color.toFloat4());
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addLineString(const LineString& lineString, const double thickness, const ColorF& color, const CloseRing closeRing)
+	{
+		pImpl->addLineString(lineString.data(), lineString.size(), static_cast<float>(thickness), color.toFloat4(), closeRing);
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addPolygon(const Polygon& polygon, const ColorF& color)
+	{
+		pImpl->addPolygon(polygon.vertices(), polygon.indices(), color.toFloat4());
+
+		return *this;
+	}
+
+	CommandList2D& CommandList2D::addVertices(const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
+	{
+		pImpl->addVertices(vertices, vertexCount, indices, num_triangles);
+
+		return *this;
+	}
+
+	void CommandList2D::clear() noexcept
+	{
+		pImpl->clear();
+	}
+
+	void CommandList2D::reserve(const size_t vertexSize, const size_t num_triangles)
+	{
+		pImpl->reserve(vertexSize, num_triangles);
+	}
+
+	bool CommandList2D::isEmpty() const noexcept
+	{
+		return (pImpl->num_triangles() == 0);
+	}
+
+	CommandList2D::operator bool() const noexcept
+	{
+		return (not isEmpty());
+	}
+
+	size_t CommandList2D::num_vertices() const noexcept
+	{
+		return pImpl->num_vertices();
+	}
+
+	size_t CommandList2D::num_triangles() const noexcept
+	{
+		return pImpl->num_triangles();
+	}
+
+	const Array<CommandList2D::Segment>& CommandList2D::segments() const noexcept
+	{
+		return pImpl->segments();
+	}
+
+	void CommandList2D::draw() const
+	{
+		pImpl->draw();
+	}
+}
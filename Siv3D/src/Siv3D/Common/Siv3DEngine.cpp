@@ -13,6 +13,7 @@
 # include <Siv3D/Empty/IEmpty.hpp>
 # include <Siv3D/LicenseManager/ILicenseManager.hpp>
 # include <Siv3D/Logger/ILogger.hpp>
+# include <Siv3D/Threading/IThreading.hpp>
 # include <Siv3D/System/ISystem.hpp>
 # include <Siv3D/Resource/IResource.hpp>
 # include <Siv3D/Profiler/IProfiler.hpp>
@@ -18,6 +18,7 @@ namespace s3d
 	class ISiv3DEmpty;
 	class ISiv3DLicenseManager;
 	class ISiv3DLogger;
+	class ISiv3DThreading;
 	class ISiv3DSystem;
 	class ISiv3DResource;
 	class ISiv3DProfiler;
@@ -74,6 +75,7 @@ namespace s3d
 			Siv3DComponent<ISiv3DEmpty>,
 			Siv3DComponent<ISiv3DLicenseManager>,
 			Siv3DComponent<ISiv3DLogger>,
+			Siv3DComponent<ISiv3DThreading>,
 			Siv3DComponent<ISiv3DSystem>,
 			Siv3DComponent<ISiv3DResource>,
 			Siv3DComponent<ISiv3DProfiler>,
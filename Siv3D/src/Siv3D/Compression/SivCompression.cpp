@@ -10,14 +10,211 @@
 //-----------------------------------------------
 
 # include <Siv3D/Compression.hpp>
+# include <Siv3D/CompressionDictionary.hpp>
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/MemoryViewReader.hpp>
+# include <Siv3D/MemoryWriter.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/Threading.hpp>
 # include <ThirdParty/zstd/zstd.h>
+# include <Siv3D/CompressionDictionary/CompressionDictionaryDetail.hpp>
 
 # include <Siv3D/EngineLog.hpp>
 
 namespace s3d
 {
+	namespace detail
+	{
+		struct ZstdCCtxDeleter
+		{
+			void operator ()(ZSTD_CCtx* cctx) const noexcept
+			{
+				ZSTD_freeCCtx(cctx);
+			}
+		};
+
+		struct ZstdDCtxDeleter
+		{
+			void operator ()(ZSTD_DCtx* dctx) const noexcept
+			{
+				ZSTD_freeDCtx(dctx);
+			}
+		};
+
+		using ZstdCCtx = std::unique_ptr<ZSTD_CCtx, ZstdCCtxDeleter>;
+
+		using ZstdDCtx = std::unique_ptr<ZSTD_DCtx, ZstdDCtxDeleter>;
+
+		// 辞書を使う小さなデータの圧縮・展開ではコンテキストの作成が支配的になるので、スレッドごとに使い回す
+		[[nodiscard]]
+		static ZSTD_CCtx* GetThreadCCtx()
+		{
+			thread_local ZstdCCtx cctx{ ZSTD_createCCtx() };
+			return cctx.get();
+		}
+
+		[[nodiscard]]
+		static ZSTD_DCtx* GetThreadDCtx()
+		{
+			thread_local ZstdDCtx dctx{ ZSTD_createDCtx() };
+			return dctx.get();
+		}
+
+		// IReader から次の入力を取り出す。readView() に対応していればコピーしない
+		class StreamInput
+		{
+		public:
+
+			StreamInput(IReader& reader, const size_t chunkSize)
+				: m_reader{ reader }
+				, m_chunkSize{ chunkSize }
+				, m_useView{ reader.supportsReadView() }
+			{
+				if (not m_useView)
+				{
+					m_buffer.resize(chunkSize);
+				}
+			}
+
+			[[nodiscard]]
+			ZSTD_inBuffer next()
+			{
+				if (m_useView)
+				{
+					const std::span<const Byte> view = m_reader.readView(static_cast<int64>(m_chunkSize));
+					return{ view.data(), view.size(), 0 };
+				}
+
+				const int64 readBytes = m_reader.read(m_buffer.data(), static_cast<int64>(m_chunkSize));
+				return{ m_buffer.data(), static_cast<size_t>(Max<int64>(readBytes, 0)), 0 };
+			}
+
+		private:
+
+			IReader& m_reader;
+
+			size_t m_chunkSize;
+
+			bool m_useView;
+
+			Array<Byte> m_buffer;
+		};
+
+		[[nodiscard]]
+		static bool WriteOutput(IWriter& writer, const ZSTD_outBuffer& output)
+		{
+			return (writer.write(output.dst, static_cast<int64>(output.pos)) == static_cast<int64>(output.pos));
+		}
+
+		[[nodiscard]]
+		static bool CompressStream(ZSTD_CCtx* cctx, IReader& reader, IWriter& writer)
+		{
+			// 入力のサイズが分かっていればフレームに記録し、展開時にバッファを一度で確保できるようにする
+			if (const int64 remaining = (reader.size() - reader.getPos());
+				0 <= remaining)
+			{
+				ZSTD_CCtx_setPledgedSrcSize(cctx, static_cast<unsigned long long>(remaining));
+			}
+
+			StreamInput inputStream{ reader, ZSTD_CStreamInSize() };
+
+			const size_t outputBufferSize = ZSTD_CStreamOutSize();
+			const auto pOutputBuffer = std::make_unique<Byte[]>(outputBufferSize);
+
+			for (;;)
+			{
+				ZSTD_inBuffer input = inputStream.next();
+
+				const ZSTD_EndDirective mode = ((input.size == 0) ? ZSTD_e_end : ZSTD_e_continue);
+
+				for (;;)
+				{
+					ZSTD_outBuffer output = { pOutputBuffer.get(), outputBufferSize, 0 };
+
+					const size_t remaining = ZSTD_compressStream2(cctx, &output, &input, mode);
+
+					if (ZSTD_isError(remaining))
+					{
+						LOG_FAIL(U"Compression::Compress(): {}"_fmt(Unicode::Widen(ZSTD_getErrorName(remaining))));
+						return false;
+					}
+
+					if (not WriteOutput(writer, output))
+					{
+						return false;
+					}
+
+					if ((mode == ZSTD_e_end) ? (remaining == 0) : (input.pos == input.size))
+					{
+						break;
+					}
+				}
+
+				if (mode == ZSTD_e_end)
+				{
+					return true;
+				}
+			}
+		}
+
+		[[nodiscard]]
+		static bool DecompressStream(ZSTD_DCtx* dctx, IReader& reader, IWriter& writer)
+		{
+			StreamInput inputStream{ reader, ZSTD_DStreamInSize() };
+
+			const size_t outputBufferSize = ZSTD_DStreamOutSize();
+			const auto pOutputBuffer = std::make_unique<Byte[]>(outputBufferSize);
+
+			// 0 以外のまま入力が終わった場合は、フレームが途中で切れている
+			size_t lastResult = 0;
+
+			for (;;)
+			{
+				ZSTD_inBuffer input = inputStream.next();
+
+				if (input.size == 0)
+				{
+					break;
+				}
+
+				while (input.pos < input.size)
+				{
+					ZSTD_outBuffer output = { pOutputBuffer.get(), outputBufferSize, 0 };
+
+					lastResult = ZSTD_decompressStream(dctx, &output, &input);
+
+					if (ZSTD_isError(lastResult))
+					{
+						LOG_FAIL(U"Compression::Decompress(): {}"_fmt(Unicode::Widen(ZSTD_getErrorName(lastResult))));
+						return false;
+					}
+
+					if (not WriteOutput(writer, output))
+					{
+						return false;
+					}
+				}
+			}
+
+			return (lastResult == 0);
+		}
+
+		[[nodiscard]]
+		static const CompressionDictionary::CompressionDictionaryDetail* GetDictionaryDetail(const CompressionDictionary& dictionary)
+		{
+			const auto* pDetail = dictionary._detail();
+
+			if ((not pDetail) || pDetail->isEmpty())
+			{
+				LOG_FAIL(U"Compression: The dictionary is empty");
+				return nullptr;
+			}
+
+			return pDetail;
+		}
+	}
+
 	namespace Compression
 	{
 		Blob Compress(const void* data, const size_t size, const int32 compressionLevel)
@@ -239,7 +436,7 @@ namespace s3d
 			return CompressToFile(blob.data(), blob.size(), outputPath, compressionLevel);
 		}
 
-		bool CompressFileToFile(const FilePathView inputPath, const FilePathView outputPath, const int32 compressionLevel)
+		bool CompressFileToFile(const FilePathView inputPath, const FilePathView outputPath, const int32 compressionLevel, const int32 numWorkers)
 		{
 			BinaryReader reader{ inputPath };
 
@@ -248,79 +445,20 @@ namespace s3d
 				return false;
 			}
 
-			const size_t inputBufferSize = ZSTD_CStreamInSize();
-			const auto pInputBuffer = std::make_unique<Byte[]>(inputBufferSize);
-
-			const size_t outputBufferSize = ZSTD_CStreamOutSize();
-			const auto pOutputBuffer = std::make_unique<Byte[]>(outputBufferSize);
-
-			ZSTD_CStream* const cStream = ZSTD_createCStream();
-
-			if (not cStream)
-			{
-				return false;
-			}
-
-			if (const size_t ret = ZSTD_initCStream(cStream, compressionLevel); 
-				ZSTD_isError(ret))
-			{
-				ZSTD_freeCStream(cStream);
-				return false;
-			}
-
-			size_t toRead = inputBufferSize;
-
 			BinaryWriter writer{ outputPath };
 
 			if (not writer)
 			{
-				ZSTD_freeCStream(cStream);
 				return false;
 			}
 
-			while (const size_t read = static_cast<size_t>(reader.read(pInputBuffer.get(), toRead)))
-			{
-				ZSTD_inBuffer input = { pInputBuffer.get(), read, 0 };
-
-				while (input.pos < input.size)
-				{
-					ZSTD_outBuffer output = { pOutputBuffer.get(), outputBufferSize, 0 };
-
-					toRead = ZSTD_compressStream(cStream, &output, &input);
-
-					if (ZSTD_isError(toRead))
-					{
-						writer.clear();
-
-						ZSTD_freeCStream(cStream);
-
-						return false;
-					}
-
-					if (toRead > inputBufferSize)
-					{
-						toRead = inputBufferSize;
-					}
-
-					writer.write(pOutputBuffer.get(), output.pos);
-				}
-			}
-
-			ZSTD_outBuffer output = { pOutputBuffer.get(), outputBufferSize, 0 };
-
-			const size_t remainingToFlush = ZSTD_endStream(cStream, &output);
-
-			ZSTD_freeCStream(cStream);
-
-			if (remainingToFlush)
+			if (not Compress(reader, writer, compressionLevel, numWorkers))
 			{
 				writer.clear();
 
 				return false;
 			}
 
-			writer.write(pOutputBuffer.get(), output.pos);
-
 			return true;
 		}
 
@@ -553,59 +691,242 @@ namespace s3d
 				return false;
 			}
 
-			const size_t inputBufferSize = ZSTD_DStreamInSize();
-			const auto pInputBuffer = std::make_unique<Byte[]>(inputBufferSize);
-
-			const size_t outputBufferSize = ZSTD_DStreamOutSize();
-			const auto pOutputBuffer = std::make_unique<Byte[]>(outputBufferSize);
+			BinaryWriter writer{ outputPath };
 
-			ZSTD_DStream* const dStream = ZSTD_createDStream();
+			if (not writer)
+			{
+				return false;
+			}
 
-			if (not dStream)
+			if (not Decompress(reader, writer))
 			{
+				writer.clear();
+
 				return false;
 			}
 
-			if (const size_t ret = ZSTD_initDStream(dStream);
-				ZSTD_isError(ret))
+			return true;
+		}
+
+		bool Compress(IReader& reader, IWriter& writer, const int32 compressionLevel, const int32 numWorkers)
+		{
+			if ((not reader.isOpen()) || (not writer.isOpen()))
 			{
-				ZSTD_freeDStream(dStream);
 				return false;
 			}
 
-			BinaryWriter writer{ outputPath };
+			const detail::ZstdCCtx cctx{ ZSTD_createCCtx() };
 
-			if (not writer)
+			if (not cctx)
 			{
-				ZSTD_freeDStream(dStream);
 				return false;
 			}
 
-			while (const size_t read = static_cast<size_t>(reader.read(pInputBuffer.get(), inputBufferSize)))
+			if (ZSTD_isError(ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_compressionLevel, compressionLevel)))
 			{
-				ZSTD_inBuffer input = { pInputBuffer.get(), read, 0 };
+				return false;
+			}
 
-				while (input.pos < input.size)
+			if (numWorkers != NoWorkers)
+			{
+				const int32 workers = ((numWorkers == AutoWorkers) ? static_cast<int32>(Threading::GetConcurrency()) : numWorkers);
+
+				// ワーカースレッドが使えない環境では、呼び出したスレッドで圧縮する
+				if (ZSTD_isError(ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_nbWorkers, workers)))
 				{
-					ZSTD_outBuffer output = { pOutputBuffer.get(), outputBufferSize, 0 };
+					LOG_INFO(U"Compression::Compress(): Worker threads are not available on this platform");
+				}
+			}
 
-					if (const size_t ret = ZSTD_decompressStream(dStream, &output, &input); 
-						ZSTD_isError(ret))
-					{
-						writer.clear();
+			return detail::CompressStream(cctx.get(), reader, writer);
+		}
 
-						ZSTD_freeDStream(dStream);
+		bool Compress(IReader& reader, IWriter& writer, const CompressionDictionary& dictionary)
+		{
+			if ((not reader.isOpen()) || (not writer.isOpen()))
+			{
+				return false;
+			}
 
-						return false;
-					}
+			const auto* pDictionary = detail::GetDictionaryDetail(dictionary);
 
-					writer.write(pOutputBuffer.get(), output.pos);
+			if (not pDictionary)
+			{
+				return false;
+			}
+
+			const detail::ZstdCCtx cctx{ ZSTD_createCCtx() };
+
+			if ((not cctx)
+				|| ZSTD_isError(ZSTD_CCtx_refCDict(cctx.get(), pDictionary->getCDict())))
+			{
+				return false;
+			}
+
+			return detail::CompressStream(cctx.get(), reader, writer);
+		}
+
+		Blob Compress(const void* data, const size_t size, const CompressionDictionary& dictionary)
+		{
+			Blob blob;
+
+			if (not Compress(data, size, blob, dictionary))
+			{
+				return{};
+			}
+
+			return blob;
+		}
+
+		bool Compress(const void* data, const size_t size, Blob& dst, const CompressionDictionary& dictionary)
+		{
+			dst.clear();
+
+			const auto* pDictionary = detail::GetDictionaryDetail(dictionary);
+
+			ZSTD_CCtx* const cctx = detail::GetThreadCCtx();
+
+			if ((not pDictionary) || (not cctx))
+			{
+				return false;
+			}
+
+			dst.resize(ZSTD_compressBound(size));
+
+			const size_t result = ZSTD_compress_usingCDict(cctx, dst.data(), dst.size(), data, size, pDictionary->getCDict());
+
+			if (ZSTD_isError(result))
+			{
+				dst.clear();
+				return false;
+			}
+
+			dst.resize(result);
+
+			return true;
+		}
+
+		Blob Compress(const Blob& blob, const CompressionDictionary& dictionary)
+		{
+			return Compress(blob.data(), blob.size(), dictionary);
+		}
+
+		bool Compress(const Blob& blob, Blob& dst, const CompressionDictionary& dictionary)
+		{
+			return Compress(blob.data(), blob.size(), dst, dictionary);
+		}
+
+		bool Decompress(IReader& reader, IWriter& writer)
+		{
+			if ((not reader.isOpen()) || (not writer.isOpen()))
+			{
+				return false;
+			}
+
+			const detail::ZstdDCtx dctx{ ZSTD_createDCtx() };
+
+			if (not dctx)
+			{
+				return false;
+			}
+
+			return detail::DecompressStream(dctx.get(), reader, writer);
+		}
+
+		bool Decompress(IReader& reader, IWriter& writer, const CompressionDictionary& dictionary)
+		{
+			if ((not reader.isOpen()) || (not writer.isOpen()))
+			{
+				return false;
+			}
+
+			const auto* pDictionary = detail::GetDictionaryDetail(dictionary);
+
+			if (not pDictionary)
+			{
+				return false;
+			}
+
+			const detail::ZstdDCtx dctx{ ZSTD_createDCtx() };
+
+			if ((not dctx)
+				|| ZSTD_isError(ZSTD_DCtx_refDDict(dctx.get(), pDictionary->getDDict())))
+			{
+				return false;
+			}
+
+			return detail::DecompressStream(dctx.get(), reader, writer);
+		}
+
+		Blob Decompress(const void* data, const size_t size, const CompressionDictionary& dictionary)
+		{
+			Blob blob;
+
+			if (not Decompress(data, size, blob, dictionary))
+			{
+				return{};
+			}
+
+			return blob;
+		}
+
+		bool Decompress(const void* data, const size_t size, Blob& dst, const CompressionDictionary& dictionary)
+		{
+			dst.clear();
+
+			const auto* pDictionary = detail::GetDictionaryDetail(dictionary);
+
+			ZSTD_DCtx* const dctx = detail::GetThreadDCtx();
+
+			if ((not pDictionary) || (not dctx))
+			{
+				return false;
+			}
+
+			const unsigned long long contentSize = ZSTD_getFrameContentSize(data, size);
+
+			if (contentSize == ZSTD_CONTENTSIZE_ERROR)
+			{
+				return false;
+			}
+
+			if (contentSize == ZSTD_CONTENTSIZE_UNKNOWN)
+			{
+				// 展開後のサイズが記録されていない場合はストリームとして展開する
+				MemoryViewReader reader{ data, size };
+				MemoryWriter writer;
+
+				if (not Decompress(reader, writer, dictionary))
+				{
+					return false;
 				}
+
+				dst = writer.retrieve();
+
+				return true;
 			}
 
-			ZSTD_freeDStream(dStream);
+			dst.resize(static_cast<size_t>(contentSize));
+
+			const size_t result = ZSTD_decompress_usingDDict(dctx, dst.data(), dst.size(), data, size, pDictionary->getDDict());
+
+			if (ZSTD_isError(result) || (result != dst.size()))
+			{
+				dst.clear();
+				return false;
+			}
 
 			return true;
 		}
+
+		Blob Decompress(const Blob& blob, const CompressionDictionary& dictionary)
+		{
+			return Decompress(blob.data(), blob.size(), dictionary);
+		}
+
+		bool Decompress(const Blob& blob, Blob& dst, const CompressionDictionary& dictionary)
+		{
+			return Decompress(blob.data(), blob.size(), dst, dictionary);
+		}
 	}
 }
@@ -0,0 +1,80 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/EngineLog.hpp>
+# include "CompressionDictionaryDetail.hpp"
+
+namespace s3d
+{
+	CompressionDictionary::CompressionDictionaryDetail::CompressionDictionaryDetail(Blob&& dictionary, const int32 compressionLevel)
+		: m_blob{ std::move(dictionary) }
+		, m_compressionLevel{ compressionLevel }
+	{
+		if (m_blob.isEmpty())
+		{
+			return;
+		}
+
+		m_cDict = ZSTD_createCDict(m_blob.data(), m_blob.size(), m_compressionLevel);
+		m_dDict = ZSTD_createDDict(m_blob.data(), m_blob.size());
+
+		if ((not m_cDict) || (not m_dDict))
+		{
+			LOG_FAIL(U"CompressionDictionary: Failed to load the dictionary ({} bytes)"_fmt(m_blob.size()));
+
+			ZSTD_freeCDict(m_cDict);
+			ZSTD_freeDDict(m_dDict);
+			m_cDict = nullptr;
+			m_dDict = nullptr;
+			m_blob.clear();
+			return;
+		}
+
+		m_id = ZSTD_getDictID_fromDDict(m_dDict);
+	}
+
+	CompressionDictionary::CompressionDictionaryDetail::~CompressionDictionaryDetail()
+	{
+		ZSTD_freeCDict(m_cDict);
+
+		ZSTD_freeDDict(m_dDict);
+	}
+
+	bool CompressionDictionary::CompressionDictionaryDetail::isEmpty() const noexcept
+	{
+		return (m_cDict == nullptr);
+	}
+
+	uint32 CompressionDictionary::CompressionDictionaryDetail::id() const noexcept
+	{
+		return m_id;
+	}
+
+	int32 CompressionDictionary::CompressionDictionaryDetail::compressionLevel() const noexcept
+	{
+		return m_compressionLevel;
+	}
+
+	const Blob& CompressionDictionary::CompressionDictionaryDetail::getBlob() const noexcept
+	{
+		return m_blob;
+	}
+
+	const ZSTD_CDict* CompressionDictionary::CompressionDictionaryDetail::getCDict() const noexcept
+	{
+		return m_cDict;
+	}
+
+	const ZSTD_DDict* CompressionDictionary::CompressionDictionaryDetail::getDDict() const noexcept
+	{
+		return m_dDict;
+	}
+}
@@ -0,0 +1,65 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/CompressionDictionary.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class CompressionDictionary::CompressionDictionaryDetail
+	{
+	public:
+
+		CompressionDictionaryDetail() = default;
+
+		CompressionDictionaryDetail(Blob&& dictionary, int32 compressionLevel);
+
+		~CompressionDictionaryDetail();
+
+		CompressionDictionaryDetail(const CompressionDictionaryDetail&) = delete;
+
+		CompressionDictionaryDetail& operator =(const CompressionDictionaryDetail&) = delete;
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		[[nodiscard]]
+		uint32 id() const noexcept;
+
+		[[nodiscard]]
+		int32 compressionLevel() const noexcept;
+
+		[[nodiscard]]
+		const Blob& getBlob() const noexcept;
+
+		// 圧縮用に解析済みの辞書。辞書が空の場合は nullptr
+		[[nodiscard]]
+		const ZSTD_CDict* getCDict() const noexcept;
+
+		// 展開用に解析済みの辞書。辞書が空の場合は nullptr
+		[[nodiscard]]
+		const ZSTD_DDict* getDDict() const noexcept;
+
+	private:
+
+		Blob m_blob;
+
+		int32 m_compressionLevel = Compression::DefaultLevel;
+
+		uint32 m_id = 0;
+
+		// 辞書の解析は圧縮や展開よりも重いので、作成時に一度だけ行う
+		ZSTD_CDict* m_cDict = nullptr;
+
+		ZSTD_DDict* m_dDict = nullptr;
+	};
+}
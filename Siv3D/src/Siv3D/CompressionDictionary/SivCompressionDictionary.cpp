@@ -0,0 +1,113 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/CompressionDictionary.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <ThirdParty/zstd/zdict.h>
+# include "CompressionDictionaryDetail.hpp"
+
+namespace s3d
+{
+	CompressionDictionary::CompressionDictionary()
+		: pImpl{ std::make_shared<CompressionDictionaryDetail>() } {}
+
+	CompressionDictionary::CompressionDictionary(const Blob& dictionary, const int32 compressionLevel)
+		: CompressionDictionary{ Blob{ dictionary }, compressionLevel } {}
+
+	CompressionDictionary::CompressionDictionary(Blob&& dictionary, const int32 compressionLevel)
+		: pImpl{ std::make_shared<CompressionDictionaryDetail>(std::move(dictionary), compressionLevel) } {}
+
+	CompressionDictionary::CompressionDictionary(const FilePathView path, const int32 compressionLevel)
+		: CompressionDictionary{ Blob{ path }, compressionLevel } {}
+
+	bool CompressionDictionary::isEmpty() const noexcept
+	{
+		return pImpl->isEmpty();
+	}
+
+	CompressionDictionary::operator bool() const noexcept
+	{
+		return (not isEmpty());
+	}
+
+	uint32 CompressionDictionary::id() const noexcept
+	{
+		return pImpl->id();
+	}
+
+	int32 CompressionDictionary::compressionLevel() const noexcept
+	{
+		return pImpl->compressionLevel();
+	}
+
+	const Blob& CompressionDictionary::getBlob() const noexcept
+	{
+		return pImpl->getBlob();
+	}
+
+	bool CompressionDictionary::save(const FilePathView path) const
+	{
+		if (isEmpty())
+		{
+			return false;
+		}
+
+		return getBlob().save(path);
+	}
+
+	CompressionDictionary CompressionDictionary::Train(const Array<Blob>& samples, const size_t capacity, const int32 compressionLevel)
+	{
+		LOG_SCOPED_TRACE(U"CompressionDictionary::Train()");
+
+		if (samples.isEmpty() || (capacity == 0))
+		{
+			return{};
+		}
+
+		size_t totalSize = 0;
+
+		for (const auto& sample : samples)
+		{
+			totalSize += sample.size();
+		}
+
+		// ZDICT_trainFromBuffer() はサンプルを連結したバッファと、各サンプルのサイズを受け取る
+		Blob samplesBuffer{ Arg::reserve = totalSize };
+		Array<size_t> sampleSizes(Arg::reserve = samples.size());
+
+		for (const auto& sample : samples)
+		{
+			samplesBuffer.append(sample.data(), sample.size());
+			sampleSizes << sample.size();
+		}
+
+		Blob dictionary(capacity);
+
+		const size_t result = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+			samplesBuffer.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+
+		if (ZDICT_isError(result))
+		{
+			LOG_FAIL(U"CompressionDictionary::Train(): {}"_fmt(Unicode::Widen(ZDICT_getErrorName(result))));
+			return{};
+		}
+
+		dictionary.resize(result);
+
+		return CompressionDictionary{ std::move(dictionary), compressionLevel };
+	}
+
+	const CompressionDictionary::CompressionDictionaryDetail* CompressionDictionary::_detail() const noexcept
+	{
+		return pImpl.get();
+	}
+}
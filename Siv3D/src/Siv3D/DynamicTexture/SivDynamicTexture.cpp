@@ -117,6 +117,25 @@ namespace s3d
 		return SIV3D_ENGINE(Texture)->fillRegion(m_handle->id(), image.data(), image.stride(), rect, false);
 	}
 
+	bool DynamicTexture::fillAsync(const Image& image)
+	{
+		return fillAsync(Image{ image });
+	}
+
+	bool DynamicTexture::fillAsync(Image&& image)
+	{
+		if (isEmpty())
+		{
+			return false;
+		}
+		else if (image.size() != size())
+		{
+			return false;
+		}
+
+		return SIV3D_ENGINE(Texture)->fillAsync(m_handle->id(), std::move(image));
+	}
+
 	void DynamicTexture::generateMips()
 	{
 		if (isEmpty())
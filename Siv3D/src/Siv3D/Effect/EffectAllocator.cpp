@@ -0,0 +1,120 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+# include <mutex>
+# include <new>
+# include "EffectAllocator.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		class SizeClassPool
+		{
+		public:
+
+			void* allocate(const size_t blockSize)
+			{
+				std::lock_guard lock{ m_mutex };
+
+				if (m_freeList)
+				{
+					FreeBlock* block = m_freeList;
+					m_freeList = block->next;
+					return block;
+				}
+
+				if ((m_current + blockSize) > m_end)
+				{
+					// ページはプールと同じく解放しない
+					void* page = ::operator new(EffectAllocator::PageSize, std::align_val_t{ EffectAllocator::Alignment });
+					m_current = static_cast<uint8*>(page);
+					m_end = (m_current + EffectAllocator::PageSize);
+				}
+
+				void* p = m_current;
+				m_current += blockSize;
+				return p;
+			}
+
+			void deallocate(void* p) noexcept
+			{
+				std::lock_guard lock{ m_mutex };
+
+				FreeBlock* block = static_cast<FreeBlock*>(p);
+				block->next = m_freeList;
+				m_freeList = block;
+			}
+
+		private:
+
+			std::mutex m_mutex;
+
+			FreeBlock* m_freeList = nullptr;
+
+			// 最後に確保したページの未使用部分
+			uint8* m_current = nullptr;
+
+			uint8* m_end = nullptr;
+		};
+
+		constexpr size_t NumSizeClasses = (EffectAllocator::MaxBlockSize / EffectAllocator::Alignment);
+
+		[[nodiscard]]
+		constexpr size_t ToSizeClass(const size_t size) noexcept
+		{
+			return ((size + (EffectAllocator::Alignment - 1)) / EffectAllocator::Alignment - 1);
+		}
+
+		[[nodiscard]]
+		SizeClassPool* GetPools()
+		{
+			// エフェクトは静的オブジェクトの破棄の後に破棄されることがあるため、プールは破棄しない
+			static SizeClassPool* const pools = new SizeClassPool[NumSizeClasses];
+			return pools;
+		}
+	}
+
+	namespace EffectAllocator
+	{
+		void* Allocate(const size_t size)
+		{
+			if ((size == 0) || (MaxBlockSize < size))
+			{
+				return ::operator new(size);
+			}
+
+			const size_t sizeClass = ToSizeClass(size);
+
+			return GetPools()[sizeClass].allocate((sizeClass + 1) * Alignment);
+		}
+
+		void Deallocate(void* p, const size_t size) noexcept
+		{
+			if (not p)
+			{
+				return;
+			}
+
+			if ((size == 0) || (MaxBlockSize < size))
+			{
+				::operator delete(p);
+				return;
+			}
+
+			GetPools()[ToSizeClass(size)].deallocate(p);
+		}
+	}
+}
@@ -0,0 +1,34 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+# pragma once
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	// IEffect の派生クラスのオブジェクト用のメモリプール
+	//
+	// 16 バイト単位のサイズクラスごとに 64 KiB のページからブロックを切り出し、
+	// 解放されたブロックはサイズクラスごとのフリーリストで再利用する。
+	// MaxBlockSize を超えるサイズや、Alignment を超えるアライメントはグローバルの operator new で確保する
+	namespace EffectAllocator
+	{
+		inline constexpr size_t Alignment = 16;
+
+		inline constexpr size_t MaxBlockSize = 256;
+
+		inline constexpr size_t PageSize = (64 * 1024);
+
+		[[nodiscard]]
+		void* Allocate(size_t size);
+
+		void Deallocate(void* p, size_t size) noexcept;
+	}
+}
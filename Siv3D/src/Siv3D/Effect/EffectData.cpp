@@ -29,7 +29,7 @@ namespace s3d
 			return;
 		}
 
-		m_effects.emplace_back(std::move(effect), 0);
+		m_effects.push_back(Entry{ std::move(effect), 0.0 });
 	}
 
 	size_t EffectData::num_effects() const noexcept
@@ -81,46 +81,74 @@ namespace s3d
 
 	void EffectData::update()
 	{
-		for (auto& effect : m_effects)
-		{
-			effect.second += m_lastDeltaSec;
-		}
-
+		const double deltaSec = m_lastDeltaSec;
 		m_lastDeltaSec = 0.0;
 
-		for (auto it = m_effects.begin(); it != m_effects.end();)
-		{
-			const double timeSec = it->second;
+		// update() の中で追加されたエフェクトは末尾に並び、経過時間 0 のまま同じフレームで更新される
+		const size_t previousCount = m_effects.size();
+
+		m_updating = true;
+		m_clearedInUpdate = false;
+
+		// 継続するエフェクトを先頭から詰めていく。
+		// IEffect::update() の中で m_effects が再確保されることがあるため、要素への参照は保持しない
+		size_t writeIndex = 0;
 
-			if (timeSec < 0.0)
+		for (size_t readIndex = 0; readIndex < m_effects.size(); ++readIndex)
+		{
+			if (readIndex < previousCount)
 			{
-				++it;
-				continue;
+				m_effects[readIndex].timeSec += deltaSec;
 			}
 
+			const double timeSec = m_effects[readIndex].timeSec;
+
+			bool alive = true;
+
 			if (m_maxLifeTimeSec < timeSec)
 			{
-				it = m_effects.erase(it);
-				continue;
+				alive = false;
+			}
+			else if (0.0 <= timeSec)
+			{
+				alive = m_effects[readIndex].effect->update(timeSec);
+
+				if (m_clearedInUpdate) // effect is cleared.
+				{
+					m_updating = false;
+					m_discarded.clear();
+					return;
+				}
 			}
-		
-			if (it->first->update(timeSec) == false)
+
+			if (alive)
 			{
-				if (m_effects.empty()) // effect is cleared.
+				if (writeIndex != readIndex)
 				{
-					break;
+					m_effects[writeIndex] = std::move(m_effects[readIndex]);
 				}
 
-				it = m_effects.erase(it);
-				continue;
+				++writeIndex;
+			}
+			else
+			{
+				m_effects[readIndex].effect.reset();
 			}
-			
-			++it;
 		}
+
+		m_effects.resize(writeIndex);
+
+		m_updating = false;
 	}
 
 	void EffectData::clear()
 	{
+		if (m_updating)
+		{
+			m_discarded.insert(m_discarded.end(), std::make_move_iterator(m_effects.begin()), std::make_move_iterator(m_effects.end()));
+			m_clearedInUpdate = true;
+		}
+
 		m_effects.clear();
 	}
 }
@@ -11,8 +11,8 @@
 
 # pragma once
 # include <memory>
-# include <list>
 # include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/IEffect.hpp>
 
 namespace s3d
@@ -56,7 +56,19 @@ namespace s3d
 
 	private:
 
-		std::list<std::pair<std::unique_ptr<IEffect>, double>> m_effects;
+		struct Entry
+		{
+			std::unique_ptr<IEffect> effect;
+
+			// エフェクトの発生からの時間（秒）
+			double timeSec = 0.0;
+		};
+
+		// 追加された順に並ぶ。終了したエフェクトは update() で詰めて取り除く
+		Array<Entry> m_effects;
+
+		// update() の実行中に clear() で取り除かれたエフェクト。実行中の IEffect::update() が終わってから破棄する
+		Array<Entry> m_discarded;
 
 		double m_maxLifeTimeSec = 10.0;
 
@@ -67,5 +79,11 @@ namespace s3d
 		bool m_paused = false;
 
 		bool m_initialized = false;
+
+		// update() の実行中である
+		bool m_updating = false;
+
+		// update() の実行中に clear() が呼ばれた
+		bool m_clearedInUpdate = false;
 	};
 }
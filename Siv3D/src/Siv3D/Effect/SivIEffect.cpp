@@ -0,0 +1,46 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+# include <Siv3D/IEffect.hpp>
+# include "EffectAllocator.hpp"
+
+namespace s3d
+{
+	void* IEffect::operator new(const size_t size)
+	{
+		return EffectAllocator::Allocate(size);
+	}
+
+	void* IEffect::operator new(const size_t size, const std::align_val_t alignment)
+	{
+		if (static_cast<size_t>(alignment) <= EffectAllocator::Alignment)
+		{
+			return EffectAllocator::Allocate(size);
+		}
+
+		return ::operator new(size, alignment);
+	}
+
+	void IEffect::operator delete(void* p, const size_t size) noexcept
+	{
+		EffectAllocator::Deallocate(p, size);
+	}
+
+	void IEffect::operator delete(void* p, const size_t size, const std::align_val_t alignment) noexcept
+	{
+		if (static_cast<size_t>(alignment) <= EffectAllocator::Alignment)
+		{
+			EffectAllocator::Deallocate(p, size);
+			return;
+		}
+
+		::operator delete(p, alignment);
+	}
+}
@@ -17,6 +17,39 @@
 
 namespace s3d
 {
+	namespace detail
+	{
+		// FFTSampleLength::SL16K のサンプル数
+		constexpr size_t MaxFFTSamples = 16384;
+
+		// スレッドごとの、FFT の入出力と pffft の作業領域
+		struct FFTWorkspace
+		{
+			float* inoutBuffer = AlignedMalloc<float, 16>(MaxFFTSamples);
+
+			float* workBuffer = AlignedMalloc<float, 16>(MaxFFTSamples);
+
+			FFTWorkspace() = default;
+
+			FFTWorkspace(const FFTWorkspace&) = delete;
+
+			FFTWorkspace& operator =(const FFTWorkspace&) = delete;
+
+			~FFTWorkspace()
+			{
+				AlignedFree(workBuffer);
+				AlignedFree(inoutBuffer);
+			}
+		};
+
+		[[nodiscard]]
+		static FFTWorkspace& GetFFTWorkspace()
+		{
+			thread_local FFTWorkspace workspace;
+			return workspace;
+		}
+	}
+
 	CFFT::CFFT()
 	{
 		m_setups.fill(nullptr);
@@ -26,10 +59,6 @@ namespace s3d
 	{
 		LOG_SCOPED_TRACE(U"CFFT::~CFFT()");
 
-		AlignedFree(m_workBuffer);
-
-		AlignedFree(m_inoutBuffer);
-
 		for (auto& setup : m_setups)
 		{
 			if (setup)
@@ -51,10 +80,6 @@ namespace s3d
 		{
 			setup = ::pffft_new_setup(256 << i++, PFFFT_REAL);
 		}
-
-		m_inoutBuffer = AlignedMalloc<float, 16>(16384);
-
-		m_workBuffer = AlignedMalloc<float, 16>(16384);
 	}
 
 	void CFFT::fft(FFTResult& result, const Wave& wave, const uint32 pos, const FFTSampleLength sampleLength)
@@ -64,7 +89,8 @@ namespace s3d
 		const int32 end = std::min(begin + samples, static_cast<int32>(wave.samples()));
 		const int32 fillCount = end - begin;
 
-		float* pDst = m_inoutBuffer;
+		float* const inoutBuffer = detail::GetFFTWorkspace().inoutBuffer;
+		float* pDst = inoutBuffer;
 
 		if (fillCount)
 		{
@@ -83,14 +109,15 @@ namespace s3d
 			*pDst++ = 0.0f;
 		}
 
-		doFFT(result, wave.sampleRate(), sampleLength);
+		doFFT(result, inoutBuffer, wave.sampleRate(), sampleLength);
 	}
 
 	void CFFT::fft(FFTResult& result, const Array<WaveSampleS16>& wave, uint32 pos, const uint32 sampleRate, const FFTSampleLength sampleLength)
 	{
 		const int32 samples = 256 << static_cast<int32>(sampleLength);
 
-		float* pDst = m_inoutBuffer;
+		float* const inoutBuffer = detail::GetFFTWorkspace().inoutBuffer;
+		float* pDst = inoutBuffer;
 
 		for (size_t samplesLeft = samples; samplesLeft; --samplesLeft)
 		{
@@ -104,24 +131,31 @@ namespace s3d
 			*pDst++ = (static_cast<int32>(sample.left) + static_cast<int32>(sample.right)) / (32768.0f * 2);
 		}
 
-		doFFT(result, sampleRate, sampleLength);
+		doFFT(result, inoutBuffer, sampleRate, sampleLength);
 	}
 
 	void CFFT::fft(FFTResult& result, const float* input, size_t size, const uint32 sampleRate, const FFTSampleLength sampleLength)
 	{
-		std::memcpy(m_inoutBuffer, input, sizeof(float) * size);
+		const size_t samples = (256 << static_cast<int32>(sampleLength));
+		const size_t fillCount = Min(size, samples);
+
+		float* const inoutBuffer = detail::GetFFTWorkspace().inoutBuffer;
+
+		std::memcpy(inoutBuffer, input, sizeof(float) * fillCount);
+
+		std::fill((inoutBuffer + fillCount), (inoutBuffer + samples), 0.0f);
 
-		doFFT(result, sampleRate, sampleLength);
+		doFFT(result, inoutBuffer, sampleRate, sampleLength);
 	}
 
-	void CFFT::doFFT(FFTResult& result, const uint32 sampleRate, const FFTSampleLength sampleLength)
+	void CFFT::doFFT(FFTResult& result, float* inoutBuffer, const uint32 sampleRate, const FFTSampleLength sampleLength)
 	{
 		result.buffer.resize(128 << static_cast<int32>(sampleLength));
 
-		::pffft_transform_ordered(m_setups[static_cast<size_t>(sampleLength)], m_inoutBuffer, m_inoutBuffer, m_workBuffer, PFFFT_FORWARD);
+		::pffft_transform_ordered(m_setups[static_cast<size_t>(sampleLength)], inoutBuffer, inoutBuffer, detail::GetFFTWorkspace().workBuffer, PFFFT_FORWARD);
 
 		const float m = 1.0f / result.buffer.size();
-		const float* pSrc = m_inoutBuffer;
+		const float* pSrc = inoutBuffer;
 		float* pDst = result.buffer.data();
 
 		for (size_t i = 0; i < result.buffer.size(); ++i)
@@ -34,12 +34,10 @@ namespace s3d
 
 	private:
 
+		// FFTSampleLength ごとに事前に作成したセットアップ。読み取り専用なので、複数のスレッドで共有できる
 		std::array<PFFFT_Setup*, 7> m_setups;
 
-		float* m_inoutBuffer = nullptr;
-
-		float* m_workBuffer = nullptr;
-
-		void doFFT(FFTResult& result, uint32 samplingRate, FFTSampleLength sampleLength);
+		// 作業領域はスレッドごとに持つので、fft() は複数のスレッドから同時に呼んでよい
+		void doFFT(FFTResult& result, float* inoutBuffer, uint32 samplingRate, FFTSampleLength sampleLength);
 	};
 }
@@ -12,6 +12,8 @@
 # include <Siv3D/Common.hpp>
 # include <Siv3D/FFT.hpp>
 # include <Siv3D/Audio.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Audio/IAudio.hpp>
 # include <Siv3D/FFT/IFFT.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 
@@ -36,7 +38,9 @@ namespace s3d
 			const int32 begin = Max(static_cast<int32>(pos) - 1 - samples, 0);
 			const int32 end = Min(begin + samples, static_cast<int32>(audio.samples()));
 
-			Array<float> inputs(samples);
+			// 呼び出しのたびにメモリを確保しないよう、スレッドごとに使い回す
+			thread_local Array<float> inputs;
+			inputs.assign(samples, 0.0f);
 
 			size_t ii = 0;
 
@@ -63,5 +67,25 @@ namespace s3d
 		{
 			SIV3D_ENGINE(FFT)->fft(result, input, static_cast<uint32>(length), sampleRate, sampleLength);
 		}
+
+		void AnalyzeMany(Array<FFTResult>& results, const Array<Array<float>>& inputs, const uint32 sampleRate, const FFTSampleLength sampleLength)
+		{
+			results.resize(inputs.size());
+
+			Threading::ParallelFor(0, inputs.size(), [&](const size_t i)
+				{
+					SIV3D_ENGINE(FFT)->fft(results[i], inputs[i].data(), static_cast<uint32>(inputs[i].size()), sampleRate, sampleLength);
+				}, 1);
+		}
+
+		void AnalyzeMany(Array<FFTResult>& results, const Array<MixBus>& buses, const FFTSampleLength sampleLength)
+		{
+			results.resize(buses.size());
+
+			Threading::ParallelFor(0, buses.size(), [&](const size_t i)
+				{
+					SIV3D_ENGINE(Audio)->getBusFFT(FromEnum(buses[i]), results[i], sampleLength);
+				}, 1);
+		}
 	}
 }
@@ -55,6 +55,13 @@ namespace s3d
 			throw EngineError{ U"FT_Init_FreeType() failed" };
 		}
 
+		// グリフアトラスを作成
+		{
+			m_glyphAtlases[FromEnum(FontMethod::Bitmap)]	= std::make_unique<GlyphAtlas>(Color{ 255, 0 });
+			m_glyphAtlases[FromEnum(FontMethod::SDF)]		= std::make_unique<GlyphAtlas>(Color{ 255, 0 });
+			m_glyphAtlases[FromEnum(FontMethod::MSDF)]		= std::make_unique<GlyphAtlas>(Color{ 0, 0 });
+		}
+
 		// null Font を管理に登録
 		{
 			// null Font を作成
@@ -216,16 +223,23 @@ namespace s3d
 	void CFont::release(const Font::IDType handleID)
 	{
 		m_fonts.erase(handleID);
+
+		// 破棄したフォントをフォールバックフォントとして参照する整形結果が残らないようにする
+		m_shapedTextCache.clear();
 	}
 
 	bool CFont::addFallbackFont(const Font::IDType handleID, const std::weak_ptr<AssetHandle<Font>::AssetIDWrapperType>& font)
 	{
+		m_shapedTextCache.clear();
+
 		return m_fonts[handleID]->addFallbackFont(font);
 	}
 
 	void CFont::setIndentSize(const Font::IDType handleID, const int32 indentSize)
 	{
 		m_fonts[handleID]->setIndentSize(indentSize);
+
+		m_shapedTextCache.clear();
 	}
 
 	const FontFaceProperty& CFont::getProperty(const Font::IDType handleID)
@@ -260,7 +274,16 @@ namespace s3d
 
 	Array<GlyphCluster> CFont::getGlyphClusters(const Font::IDType handleID, const StringView s, const bool recursive, const Ligature ligature)
 	{
-		return m_fonts[handleID]->getGlyphClusters(s, recursive, ligature);
+		if (auto clusters = m_shapedTextCache.findGlyphClusters(handleID.value(), s, recursive, ligature))
+		{
+			return std::move(*clusters);
+		}
+
+		Array<GlyphCluster> clusters = m_fonts[handleID]->getGlyphClusters(s, recursive, ligature);
+
+		m_shapedTextCache.addGlyphClusters(handleID.value(), s, recursive, ligature, clusters);
+
+		return clusters;
 	}
 
 	GlyphInfo CFont::getGlyphInfo(const Font::IDType handleID, const StringView ch)
@@ -352,6 +375,20 @@ namespace s3d
 		return font->getGlyphCache().preload(*font, chars);
 	}
 
+	bool CFont::bakeAtlas(const Font::IDType handleID, const StringView chars, const FilePathView path)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return font->getGlyphCache().bakeAtlas(*font, chars, path);
+	}
+
+	bool CFont::loadBakedAtlas(const Font::IDType handleID, const FilePathView path)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return font->getGlyphCache().loadBakedAtlas(*font, path);
+	}
+
 	const Texture& CFont::getTexture(const Font::IDType handleID)
 	{
 		return m_fonts[handleID]->getGlyphCache().getTexture();
@@ -410,18 +447,42 @@ namespace s3d
 
 	RectF CFont::region(const Font::IDType handleID, const StringView s, const Array<GlyphCluster>& clusters, const Vec2& pos, const double fontSize, const double lineHeightScale)
 	{
+		if (const auto size = m_shapedTextCache.findRegionSize(handleID.value(), s, clusters, fontSize, lineHeightScale))
+		{
+			return{ pos, *size };
+		}
+
 		const auto& font = m_fonts[handleID];
+		const RectF rect = font->getGlyphCache().region(*font, s, clusters, false, pos, fontSize, lineHeightScale);
+
+		// グリフをキャッシュできずに失敗した結果は保存しない
+		if (rect != RectF::Empty())
 		{
-			return m_fonts[handleID]->getGlyphCache().region(*font, s, clusters, false, pos, fontSize, lineHeightScale);
+			m_shapedTextCache.addRegionSize(handleID.value(), s, clusters, fontSize, lineHeightScale, rect.size);
 		}
+
+		return rect;
 	}
 
 	RectF CFont::regionBase(const Font::IDType handleID, const StringView s, const Array<GlyphCluster>& clusters, const Vec2& pos, const double fontSize, const double lineHeightScale)
 	{
 		const auto& font = m_fonts[handleID];
+
+		if (const auto size = m_shapedTextCache.findRegionSize(handleID.value(), s, clusters, fontSize, lineHeightScale))
 		{
-			return m_fonts[handleID]->getGlyphCache().region(*font, s, clusters, true, pos, fontSize, lineHeightScale);
+			const double scale = (fontSize / font->getProperty().fontPixelSize);
+			return{ pos.movedBy(0, -font->getProperty().ascender * scale), *size };
 		}
+
+		const RectF rect = font->getGlyphCache().region(*font, s, clusters, true, pos, fontSize, lineHeightScale);
+
+		// グリフをキャッシュできずに失敗した結果は保存しない
+		if (rect != RectF::Empty())
+		{
+			m_shapedTextCache.addRegionSize(handleID.value(), s, clusters, fontSize, lineHeightScale, rect.size);
+		}
+
+		return rect;
 	}
 
 	RectF CFont::draw(const Font::IDType handleID, const StringView s, const Array<GlyphCluster>& clusters, const Vec2& pos, const double fontSize, const TextStyle& textStyle, const ColorF& color, const double lineHeightScale)
@@ -646,4 +707,24 @@ namespace s3d
 	{
 		return detail::IsAvailable(typeface);
 	}
+
+	GlyphAtlas& CFont::getGlyphAtlas(const FontMethod method)
+	{
+		return *m_glyphAtlases[FromEnum(method)];
+	}
+
+	GlyphAtlasStats CFont::getGlyphAtlasStats(const FontMethod method) const
+	{
+		return m_glyphAtlases[FromEnum(method)]->getStats();
+	}
+
+	void CFont::setShapedTextCacheCapacity(const size_t capacityBytes)
+	{
+		m_shapedTextCache.setCapacity(capacityBytes);
+	}
+
+	ShapedTextCacheStats CFont::getShapedTextCacheStats() const
+	{
+		return m_shapedTextCache.getStats();
+	}
 }
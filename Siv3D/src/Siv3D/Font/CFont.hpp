@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <array>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Font.hpp>
 # include <Siv3D/PixelShader.hpp>
@@ -18,6 +19,8 @@
 # include "FontData.hpp"
 # include "EmojiData.hpp"
 # include "IconData.hpp"
+# include "GlyphCache/GlyphAtlas.hpp"
+# include "ShapedTextCache.hpp"
 
 namespace s3d
 {
@@ -107,6 +110,10 @@ namespace s3d
 	
 		bool preload(Font::IDType handleID, StringView chars) override;
 
+		bool bakeAtlas(Font::IDType handleID, StringView chars, FilePathView path) override;
+
+		bool loadBakedAtlas(Font::IDType handleID, FilePathView path) override;
+
 		const Texture& getTexture(Font::IDType handleID) override;
 
 		Glyph getGlyph(Font::IDType handleID, StringView ch) override;
@@ -162,10 +169,23 @@ namespace s3d
 
 		bool isAvailable(Typeface typeface) const override;
 
+		GlyphAtlas& getGlyphAtlas(FontMethod method) override;
+
+		GlyphAtlasStats getGlyphAtlasStats(FontMethod method) const override;
+
+		void setShapedTextCacheCapacity(size_t capacityBytes) override;
+
+		ShapedTextCacheStats getShapedTextCacheStats() const override;
+
 	private:
 
 		FT_Library m_freeType = nullptr;
 
+		// 描画方式ごとに、すべてのフォントで共有するグリフアトラス。フォントより後に破棄する
+		std::array<std::unique_ptr<GlyphAtlas>, 3> m_glyphAtlases;
+
+		ShapedTextCache m_shapedTextCache;
+
 		AssetHandleManager<Font::IDType, FontData> m_fonts{ U"Font" };
 
 		std::unique_ptr<FontShader> m_shader;
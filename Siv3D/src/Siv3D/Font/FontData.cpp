@@ -28,7 +28,7 @@ namespace s3d
 {
 	FontData::FontData(Null)
 	{
-		m_glyphCache = std::make_unique<BitmapGlyphCache>();
+		m_glyphCache = std::make_unique<BitmapGlyphCache>(SIV3D_ENGINE(Font)->getGlyphAtlas(FontMethod::Bitmap));
 
 		m_initialized = true;
 	}
@@ -73,13 +73,13 @@ namespace s3d
 		switch (fontMethod)
 		{
 		case FontMethod::Bitmap:
-			m_glyphCache = std::make_unique<BitmapGlyphCache>();
+			m_glyphCache = std::make_unique<BitmapGlyphCache>(SIV3D_ENGINE(Font)->getGlyphAtlas(FontMethod::Bitmap));
 			break;
 		case FontMethod::SDF:
-			m_glyphCache = std::make_unique<SDFGlyphCache>();
+			m_glyphCache = std::make_unique<SDFGlyphCache>(SIV3D_ENGINE(Font)->getGlyphAtlas(FontMethod::SDF));
 			break;
 		case FontMethod::MSDF:
-			m_glyphCache = std::make_unique<MSDFGlyphCache>();
+			m_glyphCache = std::make_unique<MSDFGlyphCache>(SIV3D_ENGINE(Font)->getGlyphAtlas(FontMethod::MSDF));
 			break;
 		}
 
@@ -325,6 +325,16 @@ namespace s3d
 		return RenderMSDFGlyph(m_fontFace.getFT_Face(), glyphIndex, buffer, m_fontFace.getProperty());
 	}
 
+	Array<SDFGlyph> FontData::renderSDFByGlyphIndices(const Array<GlyphIndex>& glyphIndices, const int32 buffer) const
+	{
+		return RenderSDFGlyphs(m_fontFace.getFT_Face(), glyphIndices, buffer, m_fontFace.getProperty());
+	}
+
+	Array<MSDFGlyph> FontData::renderMSDFByGlyphIndices(const Array<GlyphIndex>& glyphIndices, const int32 buffer) const
+	{
+		return RenderMSDFGlyphs(m_fontFace.getFT_Face(), glyphIndices, buffer, m_fontFace.getProperty());
+	}
+
 	IGlyphCache& FontData::getGlyphCache() const
 	{
 		return *m_glyphCache;
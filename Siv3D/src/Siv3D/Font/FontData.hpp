@@ -78,6 +78,14 @@ namespace s3d
 		[[nodiscard]]
 		MSDFGlyph renderMSDFByGlyphIndex(GlyphIndex glyphIndex, int32 buffer) const;
 
+		// 距離場の生成を並列に行う
+		[[nodiscard]]
+		Array<SDFGlyph> renderSDFByGlyphIndices(const Array<GlyphIndex>& glyphIndices, int32 buffer) const;
+
+		// 距離場の生成を並列に行う
+		[[nodiscard]]
+		Array<MSDFGlyph> renderMSDFByGlyphIndices(const Array<GlyphIndex>& glyphIndices, int32 buffer) const;
+
 		[[nodiscard]]
 		IGlyphCache& getGlyphCache() const;
 
@@ -0,0 +1,246 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/Hash.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "BakedGlyphs.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		constexpr char BakedGlyphsMagic[8] = { 'S', '3', 'D', 'G', 'L', 'Y', 'P', 'H' };
+
+		// フォーマットを変更したら増やす
+		constexpr uint32 BakedGlyphsVersion = 1;
+
+		struct BakedGlyphsHeader
+		{
+			char magic[8];
+
+			uint32 version;
+
+			uint32 method;
+
+			int32 fontPixelSize;
+
+			uint32 glyphCount;
+
+			uint64 fontHash;
+		};
+		static_assert(sizeof(BakedGlyphsHeader) == 32);
+
+		static_assert(std::is_trivially_copyable_v<BakedGlyphs::Entry> && (sizeof(BakedGlyphs::Entry) == 48));
+
+		// 同じフォントファイルの同じフェイスであるかを確かめるためのハッシュ
+		[[nodiscard]]
+		static uint64 FontHash(const FontFaceProperty& prop)
+		{
+			const std::string s = (prop.familiyName + U'\n' + prop.styleName).toUTF8();
+
+			const uint64 hashes[3] = {
+				Hash::XXHash3(s.data(), s.size()),
+				prop.numGlyphs,
+				FromEnum(prop.style),
+			};
+
+			return Hash::XXHash3(hashes, sizeof(hashes));
+		}
+	}
+
+	bool BakedGlyphs::Save(const FilePathView path, const FontFaceProperty& prop, const FontMethod method, const Array<GlyphInfo>& infos, const Array<Image>& images)
+	{
+		assert(infos.size() == images.size());
+
+		detail::BakedGlyphsHeader header{};
+		std::memcpy(header.magic, detail::BakedGlyphsMagic, sizeof(header.magic));
+		header.version			= detail::BakedGlyphsVersion;
+		header.method			= FromEnum(method);
+		header.fontPixelSize	= prop.fontPixelSize;
+		header.glyphCount		= static_cast<uint32>(infos.size());
+		header.fontHash			= detail::FontHash(prop);
+
+		Array<Entry> entries(Arg::reserve = infos.size());
+		uint64 offset = (sizeof(header) + (sizeof(Entry) * infos.size()));
+
+		for (size_t i = 0; i < infos.size(); ++i)
+		{
+			const GlyphInfo& info = infos[i];
+			const Image& image = images[i];
+
+			entries << Entry{
+				.glyphIndex		= info.glyphIndex,
+				.buffer			= info.buffer,
+				.left			= info.left,
+				.top			= info.top,
+				.width			= info.width,
+				.height			= info.height,
+				.xAdvance		= info.xAdvance,
+				.yAdvance		= info.yAdvance,
+				.imageWidth		= image.width(),
+				.imageHeight	= image.height(),
+				.offset			= offset,
+			};
+
+			offset += image.size_bytes();
+		}
+
+		BinaryWriter writer{ path };
+
+		if (not writer)
+		{
+			LOG_FAIL(U"BakedGlyphs::Save(): Failed to open `{}`"_fmt(path));
+			return false;
+		}
+
+		if ((not writer.write(header))
+			|| (writer.write(entries.data(), static_cast<int64>(entries.size_bytes())) != static_cast<int64>(entries.size_bytes())))
+		{
+			return false;
+		}
+
+		for (const auto& image : images)
+		{
+			if (writer.write(image.data(), static_cast<int64>(image.size_bytes())) != static_cast<int64>(image.size_bytes()))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool BakedGlyphs::load(const FilePathView path, const FontFaceProperty& prop, const FontMethod method)
+	{
+		m_file.close();
+		m_data.clear();
+		m_pData = nullptr;
+		m_entries.clear();
+
+		size_t size = 0;
+
+		if ((not FileSystem::IsResourcePath(path))
+			&& m_file.open(path))
+		{
+			m_pData = m_file.data();
+			size = m_file.mappedSize();
+		}
+		else
+		{
+			BinaryReader reader{ path };
+
+			if (not reader)
+			{
+				LOG_FAIL(U"BakedGlyphs: Failed to open `{}`"_fmt(path));
+				return false;
+			}
+
+			m_data.resize(static_cast<size_t>(reader.size()));
+
+			if (reader.read(m_data.data(), static_cast<int64>(m_data.size())) != static_cast<int64>(m_data.size()))
+			{
+				return false;
+			}
+
+			m_pData = m_data.data();
+			size = m_data.size();
+		}
+
+		detail::BakedGlyphsHeader header;
+
+		if ((size < sizeof(header))
+			|| (std::memcpy(&header, m_pData, sizeof(header)), false)
+			|| (std::memcmp(header.magic, detail::BakedGlyphsMagic, sizeof(header.magic)) != 0)
+			|| (header.version != detail::BakedGlyphsVersion))
+		{
+			LOG_FAIL(U"BakedGlyphs: `{}` is not a baked glyph file or was created with a different format"_fmt(path));
+			return false;
+		}
+
+		if ((header.method != FromEnum(method))
+			|| (header.fontPixelSize != prop.fontPixelSize)
+			|| (header.fontHash != detail::FontHash(prop)))
+		{
+			LOG_FAIL(U"BakedGlyphs: `{}` was created with a different font, size or rendering method"_fmt(path));
+			return false;
+		}
+
+		if (((size - sizeof(header)) / sizeof(Entry)) < header.glyphCount)
+		{
+			LOG_FAIL(U"BakedGlyphs: `{}` is broken"_fmt(path));
+			return false;
+		}
+
+		m_entries.reserve(header.glyphCount);
+
+		for (uint32 i = 0; i < header.glyphCount; ++i)
+		{
+			Entry entry;
+			std::memcpy(&entry, (m_pData + sizeof(header) + (sizeof(Entry) * i)), sizeof(Entry));
+
+			const uint64 imageSize = (static_cast<uint64>(Max(entry.imageWidth, 0)) * Max(entry.imageHeight, 0) * sizeof(Color));
+
+			if ((entry.imageWidth < 0) || (entry.imageHeight < 0)
+				|| (size < entry.offset) || ((size - entry.offset) < imageSize)
+				|| ((entry.offset % alignof(Color)) != 0))
+			{
+				LOG_FAIL(U"BakedGlyphs: `{}` is broken"_fmt(path));
+				m_entries.clear();
+				return false;
+			}
+
+			m_entries.emplace(entry.glyphIndex, entry);
+		}
+
+		return true;
+	}
+
+	BakedGlyphs::operator bool() const noexcept
+	{
+		return (not m_entries.empty());
+	}
+
+	const BakedGlyphs::Entry* BakedGlyphs::find(const GlyphIndex glyphIndex) const
+	{
+		if (const auto it = m_entries.find(glyphIndex);
+			it != m_entries.end())
+		{
+			return &it->second;
+		}
+
+		return nullptr;
+	}
+
+	GlyphInfo BakedGlyphs::getInfo(const Entry& entry, const FontFaceProperty& prop) const noexcept
+	{
+		GlyphInfo info;
+		info.glyphIndex	= entry.glyphIndex;
+		info.buffer		= entry.buffer;
+		info.left		= entry.left;
+		info.top		= entry.top;
+		info.width		= entry.width;
+		info.height		= entry.height;
+		info.ascender	= prop.ascender;
+		info.descender	= prop.descender;
+		info.xAdvance	= entry.xAdvance;
+		info.yAdvance	= entry.yAdvance;
+		return info;
+	}
+
+	const Color* BakedGlyphs::getPixels(const Entry& entry) const noexcept
+	{
+		return reinterpret_cast<const Color*>(m_pData + entry.offset);
+	}
+}
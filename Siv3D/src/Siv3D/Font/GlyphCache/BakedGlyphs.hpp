@@ -0,0 +1,94 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/GlyphInfo.hpp>
+# include <Siv3D/FontMethod.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include "../FontFaceProperty.hpp"
+
+namespace s3d
+{
+	// Font::bakeAtlas() で作成する、事前にレンダリングしたグリフのファイル
+	//
+	// [ヘッダ]
+	//	magic "S3DGLYPH", version, method, fontPixelSize, フォントを識別するハッシュ, グリフの数
+	// [目次]
+	//	グリフごとの GlyphInfo（ascender, descender を除く）と画像の位置
+	// [画像]
+	//	目次の順に Color 配列を並べる
+	//
+	// 読み込んだファイルはメモリマップしたまま保持し、グリフが必要になったときに画像をアトラスへコピーする
+	class BakedGlyphs
+	{
+	public:
+
+		struct Entry
+		{
+			GlyphIndex glyphIndex;
+
+			int32 buffer;
+
+			int16 left;
+
+			int16 top;
+
+			int16 width;
+
+			int16 height;
+
+			double xAdvance;
+
+			double yAdvance;
+
+			int32 imageWidth;
+
+			int32 imageHeight;
+
+			uint64 offset;
+		};
+
+		// グリフを書き出す。infos と images は同じ順に並べる
+		[[nodiscard]]
+		static bool Save(FilePathView path, const FontFaceProperty& prop, FontMethod method, const Array<GlyphInfo>& infos, const Array<Image>& images);
+
+		// ファイルを開く。フォントや描画方式が一致しない場合は false
+		[[nodiscard]]
+		bool load(FilePathView path, const FontFaceProperty& prop, FontMethod method);
+
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		[[nodiscard]]
+		const Entry* find(GlyphIndex glyphIndex) const;
+
+		[[nodiscard]]
+		GlyphInfo getInfo(const Entry& entry, const FontFaceProperty& prop) const noexcept;
+
+		[[nodiscard]]
+		const Color* getPixels(const Entry& entry) const noexcept;
+
+	private:
+
+		MemoryMappedFileView m_file;
+
+		// メモリマップできないリソースファイルの場合に、ファイルの内容を保持する
+		Array<Byte> m_data;
+
+		const Byte* m_pData = nullptr;
+
+		HashTable<GlyphIndex, Entry> m_entries;
+	};
+}
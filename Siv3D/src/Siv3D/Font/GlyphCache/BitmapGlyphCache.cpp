@@ -13,12 +13,21 @@
 # include <Siv3D/BitmapGlyph.hpp>
 # include <Siv3D/Math.hpp>
 # include <Siv3D/System.hpp>
+# include <Siv3D/ProfileZone.hpp>
 # include <Siv3D/Font/IFont.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include "BitmapGlyphCache.hpp"
 
 namespace s3d
 {
+	BitmapGlyphCache::BitmapGlyphCache(GlyphAtlas& atlas)
+		: m_atlas{ atlas } {}
+
+	BitmapGlyphCache::~BitmapGlyphCache()
+	{
+		ReleaseGlyphs(m_atlas, m_glyphTable);
+	}
+
 	RectF BitmapGlyphCache::draw(const FontData& font, const StringView s, const Array<GlyphCluster>& clusters, const bool usebasePos, const Vec2& pos, const double size, const TextStyle& textStyle, const ColorF& color, const double lineHeightScale)
 	{
 		if (not prerender(font, clusters, true))
@@ -66,7 +75,7 @@ namespace s3d
 
 			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 			{
-				const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+				const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 				const Vec2 posOffset = usebasePos ? cache.info.getBase(scale) : cache.info.getOffset(scale);
 				const Vec2 drawPos = (penPos + posOffset);
 
@@ -370,7 +379,7 @@ namespace s3d
 			{
 				const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 				{
-					const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+					const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 					const Vec2 posOffset = cache.info.getOffset(scale);
 					const Vec2 drawPos = (newPenPositions[i] + posOffset);
 
@@ -411,7 +420,7 @@ namespace s3d
 		{
 			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 			{
-				const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+				const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 				const Vec2 posOffset = usebasePos ? cache.info.getBase(scale) : cache.info.getOffset(scale);
 				const Vec2 drawPos = (penPos + posOffset);
 
@@ -598,11 +607,36 @@ namespace s3d
 		return prerender(font, font.getGlyphClusters(s, false, Ligature::Yes), true);
 	}
 
+	bool BitmapGlyphCache::bakeAtlas(const FontData& font, const StringView chars, const FilePathView path)
+	{
+		// ビットマップのレンダリングは FreeType のフェイスを使うため、並列化せずに順にレンダリングする
+		Array<BitmapGlyph> glyphs;
+
+		for (const auto& glyphIndex : GetGlyphIndicesToBake(font, chars))
+		{
+			glyphs << font.renderBitmapByGlyphIndex(glyphIndex);
+		}
+
+		return SaveBakedGlyphs(path, font, glyphs);
+	}
+
+	bool BitmapGlyphCache::loadBakedAtlas(const FontData& font, const FilePathView path)
+	{
+		return m_bakedGlyphs.load(path, font.getProperty(), FontMethod::Bitmap);
+	}
+
 	const Texture& BitmapGlyphCache::getTexture() noexcept
 	{
 		updateTexture();
 
-		return m_texture;
+		// アトラスが複数のページを持つ場合は、最初にキャッシュしたグリフ（グリフ番号 0）のあるページを返す
+		if (const auto it = m_glyphTable.find(0);
+			it != m_glyphTable.end())
+		{
+			return m_atlas.getTexture(it->second.atlasPage);
+		}
+
+		return m_atlas.getTexture(0);
 	}
 
 	TextureRegion BitmapGlyphCache::getTextureRegion(const FontData& font, const GlyphIndex glyphIndex)
@@ -614,7 +648,7 @@ namespace s3d
 		updateTexture();
 
 		const auto& cache = m_glyphTable.find(glyphIndex)->second;
-		return m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+		return m_atlas.getTextureRegion(cache);
 	}
 
 	int32 BitmapGlyphCache::getBufferThickness(const GlyphIndex)
@@ -624,16 +658,17 @@ namespace s3d
 
 	bool BitmapGlyphCache::prerender(const FontData& font, const Array<GlyphCluster>& clusters, const bool isMainFont)
 	{
-		if (m_glyphTable.empty())
+		SIV3D_PROFILE_SCOPE(U"Font::prerender");
+
+		if (m_glyphTable.empty()
+			&& (not CacheBakedGlyph(m_atlas, m_bakedGlyphs, font.getProperty(), 0, m_glyphTable)))
 		{
 			const BitmapGlyph glyph = font.renderBitmapByGlyphIndex(0);
 
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+			if (not CacheGlyph(m_atlas, glyph.image, glyph, m_glyphTable))
 			{
 				return false;
 			}
-
-			m_hasDirty = true;
 		}
 
 		for (const auto& cluster : clusters)
@@ -643,24 +678,27 @@ namespace s3d
 				continue;
 			}
 
-			if (m_glyphTable.contains(cluster.glyphIndex))
+			if (IsGlyphCached(m_atlas, m_glyphTable, cluster.glyphIndex))
+			{
+				continue;
+			}
+
+			if (CacheBakedGlyph(m_atlas, m_bakedGlyphs, font.getProperty(), cluster.glyphIndex, m_glyphTable))
 			{
 				continue;
 			}
 
 			const BitmapGlyph glyph = font.renderBitmapByGlyphIndex(cluster.glyphIndex);
 
-			if (m_glyphTable.contains(glyph.glyphIndex))
+			if (IsGlyphCached(m_atlas, m_glyphTable, glyph.glyphIndex))
 			{
 				continue;
 			}
 
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+			if (not CacheGlyph(m_atlas, glyph.image, glyph, m_glyphTable))
 			{
 				return false;
 			}
-
-			m_hasDirty = true;
 		}
 
 		// texture content can be updated in a different thread
@@ -674,20 +712,6 @@ namespace s3d
 
 	void BitmapGlyphCache::updateTexture()
 	{
-		if (not m_hasDirty)
-		{
-			return;
-		}
-
-		if (m_texture.size() == m_buffer.image.size())
-		{
-			m_texture.fill(m_buffer.image);
-		}
-		else
-		{
-			m_texture = DynamicTexture{ m_buffer.image };
-		}
-
-		m_hasDirty = false;
+		m_atlas.update();
 	}
 }
@@ -12,7 +12,6 @@
 # pragma once
 # include <Siv3D/Font.hpp>
 # include <Siv3D/HashTable.hpp>
-# include <Siv3D/DynamicTexture.hpp>
 # include "IGlyphCache.hpp"
 # include "GlyphCacheCommon.hpp"
 
@@ -22,7 +21,9 @@ namespace s3d
 	{
 	public:
 
-		BitmapGlyphCache() = default;
+		explicit BitmapGlyphCache(GlyphAtlas& atlas);
+
+		~BitmapGlyphCache() override;
 
 		RectF draw(const FontData & font, StringView s, const Array<GlyphCluster>&clusters, bool usebasePos, const Vec2 & pos, double size, const TextStyle & textStyle, const ColorF & color, double lineHeightScale) override;
 
@@ -52,6 +53,10 @@ namespace s3d
 
 		bool preload(const FontData & font, StringView s) override;
 
+		bool bakeAtlas(const FontData& font, StringView chars, FilePathView path) override;
+
+		bool loadBakedAtlas(const FontData& font, FilePathView path) override;
+
 		[[nodiscard]]
 		const Texture& getTexture() noexcept override;
 
@@ -63,13 +68,12 @@ namespace s3d
 
 	private:
 
-		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
-
-		DynamicTexture m_texture;
+		GlyphAtlas& m_atlas;
 
-		bool m_hasDirty = false;
+		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
 
-		BufferImage m_buffer = {};
+		// loadBakedAtlas() で読み込んだ、事前にレンダリングされたグリフ
+		BakedGlyphs m_bakedGlyphs;
 
 		[[nodiscard]]
 		bool prerender(const FontData& font, const Array<GlyphCluster>& clusters, bool isMainFont);
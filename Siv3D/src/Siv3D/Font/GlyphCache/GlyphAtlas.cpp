@@ -0,0 +1,396 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Scene.hpp>
+# include "GlyphAtlas.hpp"
+# include "GlyphCacheCommon.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 新しいシェルフの高さ。近い高さのグリフが同じシェルフに入るように丸める
+		[[nodiscard]]
+		constexpr int32 ShelfHeight(const int32 glyphHeight) noexcept
+		{
+			return ((glyphHeight + 3) / 4 * 4);
+		}
+
+		// 既存のシェルフに入れてよいか。高すぎるシェルフに低いグリフを入れると無駄が大きい
+		[[nodiscard]]
+		constexpr bool FitsShelf(const int32 shelfHeight, const int32 glyphHeight) noexcept
+		{
+			return (glyphHeight <= shelfHeight)
+				&& (shelfHeight <= (ShelfHeight(glyphHeight) + (glyphHeight / 4)));
+		}
+	}
+
+	GlyphAtlas::GlyphAtlas(const Color& backgroundColor)
+		: m_backgroundColor{ backgroundColor } {}
+
+	bool GlyphAtlas::add(const Image& image, GlyphCache& cache)
+	{
+		return add(image.data(), image.size(), cache);
+	}
+
+	bool GlyphAtlas::add(const Color* pixels, const Size& size, GlyphCache& cache)
+	{
+		const int32 width	= size.x;
+		const int32 height	= size.y;
+
+		if (((PageWidth - Padding * 2) < width)
+			|| ((MaxPageHeight - Padding * 2) < height))
+		{
+			return false;
+		}
+
+		std::lock_guard lock{ m_mutex };
+
+		++m_stats.misses;
+
+		size_t pageIndex = 0, shelfIndex = 0;
+
+		if (not findSpace(width, height, pageIndex, shelfIndex))
+		{
+			return false;
+		}
+
+		Page& page = *m_pages[pageIndex];
+		Shelf& shelf = page.shelves[shelfIndex];
+		const Point pos{ shelf.penX, shelf.y };
+
+		for (int32 y = 0; y < height; ++y)
+		{
+			std::memcpy(page.image[pos.y + y] + pos.x, (pixels + static_cast<size_t>(width) * y), (sizeof(Color) * width));
+		}
+
+		MarkDirty(page, Rect{ pos, width, height });
+
+		uint32 slotIndex;
+
+		if (m_freeSlots)
+		{
+			slotIndex = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		else
+		{
+			slotIndex = static_cast<uint32>(m_slots.size());
+			m_slots.emplace_back();
+		}
+
+		Slot& slot = m_slots[slotIndex];
+		slot.pageIndex	= static_cast<uint16>(pageIndex);
+		slot.shelfIndex	= static_cast<uint16>(shelfIndex);
+		slot.area		= (width * height);
+		slot.used		= true;
+
+		shelf.slots << slotIndex;
+		shelf.penX += (width + Padding);
+		shelf.lastUsedFrame = Scene::FrameCount();
+
+		cache.textureRegionLeft		= static_cast<int16>(pos.x);
+		cache.textureRegionTop		= static_cast<int16>(pos.y);
+		cache.textureRegionWidth	= static_cast<int16>(width);
+		cache.textureRegionHeight	= static_cast<int16>(height);
+		cache.atlasPage				= static_cast<uint16>(pageIndex);
+		cache.atlasSlot				= slotIndex;
+		cache.atlasGeneration		= slot.generation;
+
+		++m_stats.glyphs;
+		m_stats.usedPixels += slot.area;
+
+		return true;
+	}
+
+	bool GlyphAtlas::touch(const GlyphCache& cache)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		if (m_slots.size() <= cache.atlasSlot)
+		{
+			return false;
+		}
+
+		const Slot& slot = m_slots[cache.atlasSlot];
+
+		if ((not slot.used) || (slot.generation != cache.atlasGeneration))
+		{
+			return false;
+		}
+
+		m_pages[slot.pageIndex]->shelves[slot.shelfIndex].lastUsedFrame = Scene::FrameCount();
+
+		++m_stats.hits;
+
+		return true;
+	}
+
+	void GlyphAtlas::release(const GlyphCache& cache)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		if (m_slots.size() <= cache.atlasSlot)
+		{
+			return;
+		}
+
+		const Slot& slot = m_slots[cache.atlasSlot];
+
+		if ((not slot.used) || (slot.generation != cache.atlasGeneration))
+		{
+			return;
+		}
+
+		m_pages[slot.pageIndex]->shelves[slot.shelfIndex].slots.remove(cache.atlasSlot);
+
+		freeSlot(cache.atlasSlot);
+	}
+
+	void GlyphAtlas::update()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		for (auto& page : m_pages)
+		{
+			if (not page->hasDirty)
+			{
+				continue;
+			}
+
+			if (page->texture.size() == page->image.size())
+			{
+				page->texture.fillRegion(page->image, page->dirty);
+				m_stats.uploadedBytes += (page->dirty.area() * sizeof(Color));
+			}
+			else
+			{
+				page->texture = DynamicTexture{ page->image };
+				m_stats.uploadedBytes += page->image.size_bytes();
+			}
+
+			page->hasDirty = false;
+		}
+	}
+
+	const Texture& GlyphAtlas::getTexture(const size_t pageIndex) const noexcept
+	{
+		if (m_pages.size() <= pageIndex)
+		{
+			return m_emptyTexture;
+		}
+
+		return m_pages[pageIndex]->texture;
+	}
+
+	TextureRegion GlyphAtlas::getTextureRegion(const GlyphCache& cache) const
+	{
+		return getTexture(cache.atlasPage)(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+	}
+
+	GlyphAtlasStats GlyphAtlas::getStats() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		GlyphAtlasStats stats = m_stats;
+		stats.pages = m_pages.size();
+		stats.capacityPixels = 0;
+
+		for (const auto& page : m_pages)
+		{
+			stats.capacityPixels += page->image.num_pixels();
+		}
+
+		return stats;
+	}
+
+	bool GlyphAtlas::findSpace(const int32 width, const int32 height, size_t& pageIndex, size_t& shelfIndex)
+	{
+		// 1. 高さが近く、右側に空きがあるシェルフのうち最も低いもの
+		{
+			int32 bestHeight = INT32_MAX;
+
+			for (size_t p = 0; p < m_pages.size(); ++p)
+			{
+				const auto& shelves = m_pages[p]->shelves;
+
+				for (size_t s = 0; s < shelves.size(); ++s)
+				{
+					const Shelf& shelf = shelves[s];
+
+					if (detail::FitsShelf(shelf.height, height)
+						&& ((shelf.penX + width + Padding) <= PageWidth)
+						&& (shelf.height < bestHeight))
+					{
+						pageIndex = p;
+						shelfIndex = s;
+						bestHeight = shelf.height;
+					}
+				}
+			}
+
+			if (bestHeight != INT32_MAX)
+			{
+				return true;
+			}
+		}
+
+		const int32 shelfHeight = Min(detail::ShelfHeight(height), (MaxPageHeight - Padding * 2));
+
+		// 2. 既存のページの下側に新しいシェルフを追加する
+		for (size_t p = 0; p < m_pages.size(); ++p)
+		{
+			if (addShelf(*m_pages[p], shelfHeight, shelfIndex))
+			{
+				pageIndex = p;
+				return true;
+			}
+		}
+
+		// 3. 新しいページを追加する
+		if (m_pages.size() < MaxPages)
+		{
+			auto page = std::make_unique<Page>();
+			page->image.resize(PageWidth, PageHeightStep, m_backgroundColor);
+
+			if (not addShelf(*page, shelfHeight, shelfIndex))
+			{
+				return false;
+			}
+
+			pageIndex = m_pages.size();
+			m_pages << std::move(page);
+			return true;
+		}
+
+		// 4. 現在のフレームで使われていない、グリフが入る高さのシェルフのうち、最も長く使われていないものを空ける
+		// （解放されて空になったシェルフを優先する）
+		{
+			const int32 currentFrame = Scene::FrameCount();
+			int64 oldestFrame = INT64_MAX;
+			int32 bestHeight = INT32_MAX;
+
+			for (size_t p = 0; p < m_pages.size(); ++p)
+			{
+				const auto& shelves = m_pages[p]->shelves;
+
+				for (size_t s = 0; s < shelves.size(); ++s)
+				{
+					const Shelf& shelf = shelves[s];
+
+					if ((shelf.height < height)
+						|| (shelf.lastUsedFrame == currentFrame))
+					{
+						continue;
+					}
+
+					const int64 frame = (shelf.slots ? shelf.lastUsedFrame : INT64_MIN);
+
+					if ((frame < oldestFrame)
+						|| ((frame == oldestFrame) && (shelf.height < bestHeight)))
+					{
+						pageIndex = p;
+						shelfIndex = s;
+						oldestFrame = frame;
+						bestHeight = shelf.height;
+					}
+				}
+			}
+
+			if (bestHeight == INT32_MAX)
+			{
+				return false;
+			}
+
+			evictShelf(*m_pages[pageIndex], shelfIndex);
+			return true;
+		}
+	}
+
+	bool GlyphAtlas::addShelf(Page& page, const int32 height, size_t& shelfIndex)
+	{
+		const int32 bottom = (page.nextShelfY + height + Padding);
+
+		if (MaxPageHeight < bottom)
+		{
+			return false;
+		}
+
+		if (page.image.height() < bottom)
+		{
+			const int32 newHeight = Min(((bottom + PageHeightStep - 1) / PageHeightStep * PageHeightStep), MaxPageHeight);
+			page.image.resizeRows(newHeight, m_backgroundColor);
+			MarkDirty(page, Rect{ 0, 0, page.image.size() });
+		}
+
+		Shelf shelf;
+		shelf.y = page.nextShelfY;
+		shelf.height = height;
+
+		shelfIndex = page.shelves.size();
+		page.shelves << std::move(shelf);
+		page.nextShelfY = bottom;
+
+		return true;
+	}
+
+	void GlyphAtlas::evictShelf(Page& page, const size_t shelfIndex)
+	{
+		Shelf& shelf = page.shelves[shelfIndex];
+
+		m_stats.evictions += shelf.slots.size();
+
+		for (const uint32 slotIndex : shelf.slots)
+		{
+			freeSlot(slotIndex);
+		}
+
+		shelf.slots.clear();
+		shelf.penX = Padding;
+
+		// 縮小して描画されるときに古いグリフがにじまないよう、シェルフ全体を背景色で埋める
+		for (int32 y = shelf.y; y < (shelf.y + shelf.height); ++y)
+		{
+			std::fill_n(page.image[y], PageWidth, m_backgroundColor);
+		}
+
+		MarkDirty(page, Rect{ 0, shelf.y, PageWidth, shelf.height });
+	}
+
+	void GlyphAtlas::freeSlot(const uint32 slotIndex)
+	{
+		Slot& slot = m_slots[slotIndex];
+
+		--m_stats.glyphs;
+		m_stats.usedPixels -= slot.area;
+
+		slot.used = false;
+		++slot.generation;
+		m_freeSlots << slotIndex;
+	}
+
+	void GlyphAtlas::MarkDirty(Page& page, const Rect& rect)
+	{
+		if (page.hasDirty)
+		{
+			const int32 left	= Min(page.dirty.x, rect.x);
+			const int32 top		= Min(page.dirty.y, rect.y);
+			const int32 right	= Max(page.dirty.rightX(), rect.rightX());
+			const int32 bottom	= Max(page.dirty.bottomY(), rect.bottomY());
+			page.dirty.set(left, top, (right - left), (bottom - top));
+		}
+		else
+		{
+			page.dirty = rect;
+			page.hasDirty = true;
+		}
+	}
+}
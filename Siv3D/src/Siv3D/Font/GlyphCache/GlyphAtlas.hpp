@@ -0,0 +1,148 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <mutex>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/DynamicTexture.hpp>
+# include <Siv3D/TextureRegion.hpp>
+# include <Siv3D/GlyphAtlasStats.hpp>
+
+namespace s3d
+{
+	struct GlyphCache;
+
+	// 同じ描画方式のすべてのフォントで共有する、複数ページのグリフアトラス
+	//
+	// 各ページは高さの揃ったシェルフ（行）にグリフを詰める。
+	// ページを増やせなくなると、現在のフレームで使われていないシェルフのうち最も長く使われていないものを空けて再利用する。
+	// 画像の変更範囲はページごとに記録し、update() でその範囲だけを GPU に転送する。
+	class GlyphAtlas
+	{
+	public:
+
+		static constexpr int32 PageWidth = 2048;
+
+		static constexpr int32 MaxPageHeight = 2048;
+
+		// ページの画像は必要になるまでこの単位で高さを伸ばす
+		static constexpr int32 PageHeightStep = 256;
+
+		static constexpr size_t MaxPages = 4;
+
+		static constexpr int32 Padding = 1;
+
+		explicit GlyphAtlas(const Color& backgroundColor);
+
+		// グリフの画像をアトラスに追加し、cache の領域を設定する。空きを確保できない場合は false
+		[[nodiscard]]
+		bool add(const Image& image, GlyphCache& cache);
+
+		// 幅 size.x の行を size.y 行並べた画像をアトラスに追加する
+		[[nodiscard]]
+		bool add(const Color* pixels, const Size& size, GlyphCache& cache);
+
+		// cache の領域が有効であれば、現在のフレームで使用したことを記録して true を返す。取り除かれていた場合は false
+		[[nodiscard]]
+		bool touch(const GlyphCache& cache);
+
+		// cache の領域を解放する。解放した領域は取り除く対象として優先される
+		void release(const GlyphCache& cache);
+
+		// 変更された範囲をテクスチャに転送する
+		void update();
+
+		[[nodiscard]]
+		const Texture& getTexture(size_t pageIndex) const noexcept;
+
+		// 有効な領域を持つ cache のテクスチャ領域を返す
+		[[nodiscard]]
+		TextureRegion getTextureRegion(const GlyphCache& cache) const;
+
+		[[nodiscard]]
+		GlyphAtlasStats getStats() const;
+
+	private:
+
+		static constexpr uint32 InvalidSlot = UINT32_MAX;
+
+		struct Slot
+		{
+			uint32 generation = 0;
+
+			uint16 pageIndex = 0;
+
+			uint16 shelfIndex = 0;
+
+			int32 area = 0;
+
+			bool used = false;
+		};
+
+		struct Shelf
+		{
+			int32 y = 0;
+
+			int32 height = 0;
+
+			int32 penX = Padding;
+
+			int32 lastUsedFrame = -1;
+
+			Array<uint32> slots;
+		};
+
+		struct Page
+		{
+			Image image;
+
+			DynamicTexture texture;
+
+			Array<Shelf> shelves;
+
+			int32 nextShelfY = Padding;
+
+			Rect dirty{ 0, 0, 0, 0 };
+
+			bool hasDirty = false;
+		};
+
+		mutable std::mutex m_mutex;
+
+		Color m_backgroundColor;
+
+		Array<std::unique_ptr<Page>> m_pages;
+
+		Array<Slot> m_slots;
+
+		Array<uint32> m_freeSlots;
+
+		Texture m_emptyTexture;
+
+		GlyphAtlasStats m_stats;
+
+		[[nodiscard]]
+		bool findSpace(int32 width, int32 height, size_t& pageIndex, size_t& shelfIndex);
+
+		[[nodiscard]]
+		bool addShelf(Page& page, int32 height, size_t& shelfIndex);
+
+		void evictShelf(Page& page, size_t shelfIndex);
+
+		void freeSlot(uint32 slotIndex);
+
+		static void MarkDirty(Page& page, const Rect& rect);
+	};
+}
@@ -53,59 +53,70 @@ namespace s3d
 		return true;
 	}
 
-	bool CacheGlyph(const FontData& font, const Image& image, const GlyphInfo& glyphInfo,
-		BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	bool IsGlyphCached(GlyphAtlas& atlas, const HashTable<GlyphIndex, GlyphCache>& glyphTable, const GlyphIndex glyphIndex)
 	{
-		if (not buffer.image)
+		const auto it = glyphTable.find(glyphIndex);
+
+		return ((it != glyphTable.end()) && atlas.touch(it->second));
+	}
+
+	bool CacheGlyph(GlyphAtlas& atlas, const Image& image, const GlyphInfo& glyphInfo, HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		GlyphCache cache;
+		cache.info = glyphInfo;
+
+		if (not atlas.add(image, cache))
 		{
-			const int32 fontSize = font.getProperty().fontPixelSize;
-			const int32 baseWidth =
-				fontSize <= 16 ? 512 :
-				fontSize <= 32 ? 768 :
-				fontSize <= 48 ? 1024 :
-				fontSize <= 64 ? 1536 :
-				fontSize <= 256 ? 2048 : 4096;
-			const int32 baseHeight = (fontSize <= 256 ? 256 : 512);
-			buffer.image.resize(baseWidth, baseHeight, buffer.backgroundColor);
+			return false;
 		}
 
-		buffer.penPos.x += buffer.padding;
+		glyphTable.insert_or_assign(glyphInfo.glyphIndex, cache);
+
+		return true;
+	}
 
-		const int32 bitmapWidth		= image.width();
-		const int32 bitmapHeight	= image.height();
+	bool CacheBakedGlyph(GlyphAtlas& atlas, const BakedGlyphs& bakedGlyphs, const FontFaceProperty& prop, const GlyphIndex glyphIndex, HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		const BakedGlyphs::Entry* entry = bakedGlyphs.find(glyphIndex);
 
-		if (buffer.image.width() < (buffer.penPos.x + (bitmapWidth + buffer.padding)))
+		if (not entry)
 		{
-			buffer.penPos.x = buffer.padding;
-			buffer.penPos.y += (buffer.currentMaxHeight + (buffer.padding * 2));
-			buffer.currentMaxHeight = 0;
+			return false;
 		}
 
-		if (buffer.image.height() < (buffer.penPos.y + (bitmapHeight + buffer.padding)))
+		GlyphCache cache;
+		cache.info = bakedGlyphs.getInfo(*entry, prop);
+
+		if (not atlas.add(bakedGlyphs.getPixels(*entry), Size{ entry->imageWidth, entry->imageHeight }, cache))
 		{
-			const int32 newHeight = ((buffer.penPos.y + (bitmapHeight + buffer.padding)) + 255) / 256 * 256;
+			return false;
+		}
 
-			if (BufferImage::MaxImageHeight < newHeight)
-			{
-				return false;
-			}
+		glyphTable.insert_or_assign(glyphIndex, cache);
 
-			buffer.image.resizeRows(newHeight, buffer.backgroundColor);
-		}
+		return true;
+	}
 
-		image.overwrite(buffer.image, buffer.penPos);
+	Array<GlyphIndex> GetGlyphIndicesToBake(const FontData& font, const StringView chars)
+	{
+		Array<GlyphIndex> glyphIndices = { 0 };
 
-		GlyphCache cache;
-		cache.info					= glyphInfo;
-		cache.textureRegionLeft		= static_cast<int16>(buffer.penPos.x);
-		cache.textureRegionTop		= static_cast<int16>(buffer.penPos.y);
-		cache.textureRegionWidth	= static_cast<int16>(bitmapWidth);
-		cache.textureRegionHeight	= static_cast<int16>(bitmapHeight);
-		glyphTable.emplace(glyphInfo.glyphIndex, cache);
+		for (const auto& cluster : font.getGlyphClusters(chars, false, Ligature::Yes))
+		{
+			if (cluster.fontIndex == 0)
+			{
+				glyphIndices << cluster.glyphIndex;
+			}
+		}
 
-		buffer.currentMaxHeight = Max(buffer.currentMaxHeight, bitmapHeight);
-		buffer.penPos.x += (bitmapWidth + buffer.padding);
+		return glyphIndices.sort_and_unique();
+	}
 
-		return true;
+	void ReleaseGlyphs(GlyphAtlas& atlas, const HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		for (const auto& glyph : glyphTable)
+		{
+			atlas.release(glyph.second);
+		}
 	}
 }
@@ -16,6 +16,8 @@
 # include <Siv3D/HashTable.hpp>
 # include <Siv3D/Char.hpp>
 # include "../FontData.hpp"
+# include "GlyphAtlas.hpp"
+# include "BakedGlyphs.hpp"
 
 namespace s3d
 {
@@ -30,32 +32,55 @@ namespace s3d
 		int16 textureRegionWidth = 0;
 
 		int16 textureRegionHeight = 0;
-	};
 
-	struct BufferImage
-	{
-		static constexpr int32 MaxImageHeight = 4096;
+		// グリフアトラスのページ
+		uint16 atlasPage = 0;
 
-		Image image;
+		// グリフアトラスでの領域の番号。取り除かれた後に再利用された領域は atlasGeneration で区別する
+		uint32 atlasSlot = UINT32_MAX;
 
-		Color backgroundColor{ 255, 0 };
+		uint32 atlasGeneration = 0;
+	};
 
-		int32 bufferWidth = 2;
+	[[nodiscard]]
+	double GetTabAdvance(double spaceWidth, double scale, double baseX, double currentX, int32 indentSize);
 
-		int32 padding = 1;
+	[[nodiscard]]
+	bool ProcessControlCharacter(char32 ch, Vec2& penPos, int32& line, const Vec2& basePos, double scale, double lineHeightScale, const FontFaceProperty& prop);
 
-		Point penPos = { 0, padding };
+	// グリフがキャッシュされていて、アトラスから取り除かれていなければ true
+	[[nodiscard]]
+	bool IsGlyphCached(GlyphAtlas& atlas, const HashTable<GlyphIndex, GlyphCache>& glyphTable, GlyphIndex glyphIndex);
 
-		int32 currentMaxHeight = 0;
-	};
+	// グリフの画像をアトラスに追加して glyphTable に登録する
+	[[nodiscard]]
+	bool CacheGlyph(GlyphAtlas& atlas, const Image& image, const GlyphInfo& glyphInfo, HashTable<GlyphIndex, GlyphCache>& glyphTable);
 
+	// 事前にレンダリングされたグリフがあれば、その画像をアトラスに追加して glyphTable に登録する
 	[[nodiscard]]
-	double GetTabAdvance(double spaceWidth, double scale, double baseX, double currentX, int32 indentSize);
+	bool CacheBakedGlyph(GlyphAtlas& atlas, const BakedGlyphs& bakedGlyphs, const FontFaceProperty& prop, GlyphIndex glyphIndex, HashTable<GlyphIndex, GlyphCache>& glyphTable);
 
+	// Font::bakeAtlas() で書き出すグリフ番号の一覧（グリフ番号 0 と、メインのフォントで描く文字）
 	[[nodiscard]]
-	bool ProcessControlCharacter(char32 ch, Vec2& penPos, int32& line, const Vec2& basePos, double scale, double lineHeightScale, const FontFaceProperty& prop);
+	Array<GlyphIndex> GetGlyphIndicesToBake(const FontData& font, StringView chars);
 
+	// レンダリングしたグリフをファイルに書き出す
+	template <class Glyph>
 	[[nodiscard]]
-	bool CacheGlyph(const FontData& font, const Image& image, const GlyphInfo& glyphInfo,
-		BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable);
+	inline bool SaveBakedGlyphs(const FilePathView path, const FontData& font, const Array<Glyph>& glyphs)
+	{
+		Array<GlyphInfo> infos(Arg::reserve = glyphs.size());
+		Array<Image> images(Arg::reserve = glyphs.size());
+
+		for (const auto& glyph : glyphs)
+		{
+			infos << glyph;
+			images << glyph.image;
+		}
+
+		return BakedGlyphs::Save(path, font.getProperty(), font.getMethod(), infos, images);
+	}
+
+	// glyphTable のすべてのグリフの領域をアトラスから解放する
+	void ReleaseGlyphs(GlyphAtlas& atlas, const HashTable<GlyphIndex, GlyphCache>& glyphTable);
 }
@@ -50,6 +50,10 @@ namespace s3d
 
 		virtual bool preload(const FontData& font, StringView s) = 0;
 
+		virtual bool bakeAtlas(const FontData& font, StringView chars, FilePathView path) = 0;
+
+		virtual bool loadBakedAtlas(const FontData& font, FilePathView path) = 0;
+
 		[[nodiscard]]
 		virtual const Texture& getTexture() noexcept = 0;
 
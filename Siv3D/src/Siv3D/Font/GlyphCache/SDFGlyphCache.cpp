@@ -12,12 +12,21 @@
 # include <Siv3D/TextureRegion.hpp>
 # include <Siv3D/SDFGlyph.hpp>
 # include <Siv3D/System.hpp>
+# include <Siv3D/ProfileZone.hpp>
 # include <Siv3D/Font/IFont.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include "SDFGlyphCache.hpp"
 
 namespace s3d
 {
+	SDFGlyphCache::SDFGlyphCache(GlyphAtlas& atlas)
+		: m_atlas{ atlas } {}
+
+	SDFGlyphCache::~SDFGlyphCache()
+	{
+		ReleaseGlyphs(m_atlas, m_glyphTable);
+	}
+
 	RectF SDFGlyphCache::draw(const FontData& font, const StringView s, const Array<GlyphCluster>& clusters, const bool usebasePos, const Vec2& pos, const double size, const TextStyle& textStyle, const ColorF& color, const double lineHeightScale)
 	{
 		if (not prerender(font, clusters, true))
@@ -65,7 +74,7 @@ namespace s3d
 
 			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 			{
-				const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+				const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 				const Vec2 posOffset = usebasePos ? cache.info.getBase(scale) : cache.info.getOffset(scale);
 				const Vec2 drawPos = (penPos + posOffset);
 
@@ -369,7 +378,7 @@ namespace s3d
 			{
 				const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 				{
-					const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+					const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 					const Vec2 posOffset = cache.info.getOffset(scale);
 					const Vec2 drawPos = (newPenPositions[i] + posOffset);
 
@@ -410,7 +419,7 @@ namespace s3d
 		{
 			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 			{
-				const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+				const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 				const Vec2 posOffset = usebasePos ? cache.info.getBase(scale) : cache.info.getOffset(scale);
 				const Vec2 drawPos = (penPos + posOffset);
 				RectF rect;
@@ -585,12 +594,12 @@ namespace s3d
 
 	void SDFGlyphCache::setBufferWidth(const int32 width)
 	{
-		m_buffer.bufferWidth = Max(width, 0);
+		m_bufferWidth = Max(width, 0);
 	}
 
 	int32 SDFGlyphCache::getBufferWidth() const noexcept
 	{
-		return m_buffer.bufferWidth;
+		return m_bufferWidth;
 	}
 
 	bool SDFGlyphCache::preload(const FontData& font, const StringView s)
@@ -598,11 +607,28 @@ namespace s3d
 		return prerender(font, font.getGlyphClusters(s, false, Ligature::Yes), true);
 	}
 
+	bool SDFGlyphCache::bakeAtlas(const FontData& font, const StringView chars, const FilePathView path)
+	{
+		return SaveBakedGlyphs(path, font, font.renderSDFByGlyphIndices(GetGlyphIndicesToBake(font, chars), m_bufferWidth));
+	}
+
+	bool SDFGlyphCache::loadBakedAtlas(const FontData& font, const FilePathView path)
+	{
+		return m_bakedGlyphs.load(path, font.getProperty(), FontMethod::SDF);
+	}
+
 	const Texture& SDFGlyphCache::getTexture() noexcept
 	{
 		updateTexture();
 
-		return m_texture;
+		// アトラスが複数のページを持つ場合は、最初にキャッシュしたグリフ（グリフ番号 0）のあるページを返す
+		if (const auto it = m_glyphTable.find(0);
+			it != m_glyphTable.end())
+		{
+			return m_atlas.getTexture(it->second.atlasPage);
+		}
+
+		return m_atlas.getTexture(0);
 	}
 
 	TextureRegion SDFGlyphCache::getTextureRegion(const FontData& font, const GlyphIndex glyphIndex)
@@ -614,7 +640,7 @@ namespace s3d
 		updateTexture();
 
 		const auto& cache = m_glyphTable.find(glyphIndex)->second;
-		return m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+		return m_atlas.getTextureRegion(cache);
 	}
 
 	int32 SDFGlyphCache::getBufferThickness(const GlyphIndex glyphIndex)
@@ -625,21 +651,18 @@ namespace s3d
 			return it->second.info.buffer;
 		}
 
-		return m_buffer.bufferWidth;
+		return m_bufferWidth;
 	}
 
 	bool SDFGlyphCache::prerender(const FontData& font, const Array<GlyphCluster>& clusters, const bool isMainFont)
 	{
-		if (m_glyphTable.empty())
-		{
-			const SDFGlyph glyph = font.renderSDFByGlyphIndex(0, m_buffer.bufferWidth);
+		SIV3D_PROFILE_SCOPE(U"Font::prerender");
 
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
-			{
-				return false;
-			}
+		Array<GlyphIndex> missingGlyphIndices;
 
-			m_hasDirty = true;
+		if (m_glyphTable.empty())
+		{
+			missingGlyphIndices << 0;
 		}
 
 		for (const auto& cluster : clusters)
@@ -649,24 +672,46 @@ namespace s3d
 				continue;
 			}
 
-			if (m_glyphTable.contains(cluster.glyphIndex))
+			if (IsGlyphCached(m_atlas, m_glyphTable, cluster.glyphIndex))
 			{
 				continue;
 			}
 
-			const SDFGlyph glyph = font.renderSDFByGlyphIndex(cluster.glyphIndex, m_buffer.bufferWidth);
+			missingGlyphIndices << cluster.glyphIndex;
+		}
 
-			if (m_glyphTable.contains(glyph.glyphIndex))
-			{
-				continue;
-			}
+		if (not missingGlyphIndices)
+		{
+			return true;
+		}
+
+		missingGlyphIndices.sort_and_unique();
+
+		// 事前にレンダリングされたグリフがあれば、それを使う
+		if (m_bakedGlyphs)
+		{
+			missingGlyphIndices.remove_if([&](const GlyphIndex glyphIndex)
+				{
+					return CacheBakedGlyph(m_atlas, m_bakedGlyphs, font.getProperty(), glyphIndex, m_glyphTable);
+				});
+		}
 
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+		// 足りないグリフをまとめて並列にレンダリングする
+		if (missingGlyphIndices)
+		{
+			for (const auto& glyph : font.renderSDFByGlyphIndices(missingGlyphIndices, m_bufferWidth))
 			{
-				return false;
-			}
+				// キャッシュ済みのグリフ（特に .notdef）を上書きしない
+				if (IsGlyphCached(m_atlas, m_glyphTable, glyph.glyphIndex))
+				{
+					continue;
+				}
 
-			m_hasDirty = true;
+				if (not CacheGlyph(m_atlas, glyph.image, glyph, m_glyphTable))
+				{
+					return false;
+				}
+			}
 		}
 
 		// texture content can be updated in a different thread
@@ -680,20 +725,6 @@ namespace s3d
 
 	void SDFGlyphCache::updateTexture()
 	{
-		if (not m_hasDirty)
-		{
-			return;
-		}
-
-		if (m_texture.size() == m_buffer.image.size())
-		{
-			m_texture.fill(m_buffer.image);
-		}
-		else
-		{
-			m_texture = DynamicTexture{ m_buffer.image };
-		}
-
-		m_hasDirty = false;
+		m_atlas.update();
 	}
 }
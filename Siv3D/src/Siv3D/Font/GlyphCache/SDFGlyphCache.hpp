@@ -11,7 +11,6 @@
 
 # pragma once
 # include <Siv3D/Font.hpp>
-# include <Siv3D/DynamicTexture.hpp>
 # include <Siv3D/HashTable.hpp>
 # include "IGlyphCache.hpp"
 # include "GlyphCacheCommon.hpp"
@@ -22,7 +21,9 @@ namespace s3d
 	{
 	public:
 
-		SDFGlyphCache() = default;
+		explicit SDFGlyphCache(GlyphAtlas& atlas);
+
+		~SDFGlyphCache() override;
 
 		RectF draw(const FontData& font, StringView s, const Array<GlyphCluster>& clusters, bool usebasePos, const Vec2& pos, double size, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) override;
 
@@ -52,6 +53,10 @@ namespace s3d
 
 		bool preload(const FontData& font, StringView s) override;
 
+		bool bakeAtlas(const FontData& font, StringView chars, FilePathView path) override;
+
+		bool loadBakedAtlas(const FontData& font, FilePathView path) override;
+
 		[[nodiscard]]
 		const Texture& getTexture() noexcept override;
 
@@ -63,13 +68,16 @@ namespace s3d
 
 	private:
 
-		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
+		static constexpr int32 DefaultBuffer = 2;
+
+		GlyphAtlas& m_atlas;
 
-		DynamicTexture m_texture;
+		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
 
-		bool m_hasDirty = false;
+		// loadBakedAtlas() で読み込んだ、事前にレンダリングされたグリフ
+		BakedGlyphs m_bakedGlyphs;
 
-		BufferImage m_buffer = {};
+		int32 m_bufferWidth = DefaultBuffer;
 	
 		[[nodiscard]]
 		bool prerender(const FontData& font, const Array<GlyphCluster>& clusters, bool isMainFont);
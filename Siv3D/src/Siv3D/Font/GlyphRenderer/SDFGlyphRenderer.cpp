@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/Threading.hpp>
 # include "GlyphRenderer.hpp"
 # include "SDFGlyphRenderer.hpp"
 # include "../FreeType.hpp"
@@ -136,66 +137,113 @@ namespace s3d
 
 			return image;
 		}
-	}
 
-	SDFGlyph RenderSDFGlyph(FT_Face face, const GlyphIndex glyphIndex, int32 buffer, const FontFaceProperty& prop)
-	{
-		if (not LoadOutlineGlyph(face, glyphIndex, prop.style))
+		// FreeType から取り出した、距離場を生成する前のグリフ
+		struct SDFGlyphSource
 		{
-			return{};
-		}
+			SDFGlyph glyph;
 
-		buffer = Max(buffer, 0);
+			msdfgen::Shape shape;
 
-		msdfgen::Shape shape;	
-		if (not detail::GetShape(face, shape))
-		{
-			return{};
-		}
+			Vec2 offset{ 0, 0 };
 
-		const GlyphBBox bbox = detail::GetBound(shape);
+			bool hasShape = false;
+		};
 
-		if (std::isinf(bbox.xMin) || std::isinf(bbox.xMax) || std::isinf(bbox.yMin) || std::isinf(bbox.yMax))
+		// FT_Face は複数のスレッドから同時に使えないため、この関数は呼び出し元のスレッドで順に呼ぶ
+		[[nodiscard]]
+		static SDFGlyphSource LoadSDFGlyphSource(FT_Face face, const GlyphIndex glyphIndex, int32 buffer, const FontFaceProperty& prop)
 		{
-			SDFGlyph result;
-			result.glyphIndex	= glyphIndex;
-			result.buffer		= buffer;
-			result.left			= 0;
-			result.top			= 0;
-			result.width		= 0;
-			result.height		= 0;
-			result.xAdvance		= (face->glyph->metrics.horiAdvance / 64.0);
-			result.yAdvance		= (face->glyph->metrics.vertAdvance / 64.0);
-			result.ascender		= prop.ascender;
-			result.descender	= prop.descender;
-			result.image		= {};
-			return result;
+			SDFGlyphSource source;
+
+			// 読み込みに失敗したグリフも、.notdef (0) ではなく要求されたインデックスで返す
+			source.glyph.glyphIndex = glyphIndex;
+
+			if (not LoadOutlineGlyph(face, glyphIndex, prop.style))
+			{
+				return source;
+			}
+
+			buffer = Max(buffer, 0);
+
+			if (not GetShape(face, source.shape))
+			{
+				return source;
+			}
+
+			const GlyphBBox bbox = GetBound(source.shape);
+
+			source.glyph.buffer		= buffer;
+			source.glyph.xAdvance	= (face->glyph->metrics.horiAdvance / 64.0);
+			source.glyph.yAdvance	= (face->glyph->metrics.vertAdvance / 64.0);
+			source.glyph.ascender	= prop.ascender;
+			source.glyph.descender	= prop.descender;
+
+			if (std::isinf(bbox.xMin) || std::isinf(bbox.xMax) || std::isinf(bbox.yMin) || std::isinf(bbox.yMax))
+			{
+				return source;
+			}
+
+			source.glyph.left	= static_cast<int16>(bbox.xMin);
+			source.glyph.top	= static_cast<int16>(bbox.yMax);
+			source.glyph.width	= static_cast<int16>(bbox.xMax - bbox.xMin);
+			source.glyph.height	= static_cast<int16>(bbox.yMax - bbox.yMin);
+			source.offset.set((-bbox.xMin + buffer), (-bbox.yMin + buffer));
+			source.hasShape = true;
+
+			return source;
 		}
-		else
+
+		// FreeType を使わないため、異なるグリフについて複数のスレッドから同時に呼べる
+		static void GenerateSDF(SDFGlyphSource& source)
 		{
-			const int32 width		= static_cast<int32>(bbox.xMax - bbox.xMin);
-			const int32 height		= static_cast<int32>(bbox.yMax - bbox.yMin);
-			const Vec2 offset{ (-bbox.xMin+ buffer), (-bbox.yMin + buffer) };
-			const msdfgen::Projection projection{ 1.0, msdfgen::Vector2{ offset.x, offset.y } };
+			if (not source.hasShape)
+			{
+				return;
+			}
+
+			const msdfgen::Projection projection{ 1.0, msdfgen::Vector2{ source.offset.x, source.offset.y } };
 			msdfgen::GeneratorConfig generatorConfig;
 			generatorConfig.overlapSupport = false;
 
-			msdfgen::Bitmap<float, 1> bitmap{ (width + (2 * buffer)), (height + (2 * buffer)) };
-			msdfgen::generateSDF(bitmap, shape, projection, 8.0, generatorConfig);
-
-			SDFGlyph result;
-			result.glyphIndex	= glyphIndex;
-			result.buffer		= buffer;
-			result.left			= static_cast<int16>(bbox.xMin);
-			result.top			= static_cast<int16>(bbox.yMax);
-			result.width		= static_cast<int16>(width);
-			result.height		= static_cast<int16>(height);
-			result.xAdvance		= (face->glyph->metrics.horiAdvance / 64.0);
-			result.yAdvance		= (face->glyph->metrics.vertAdvance / 64.0);
-			result.ascender		= prop.ascender;
-			result.descender	= prop.descender;
-			result.image		= detail::RenderMSDF(bitmap);
-			return result;
+			msdfgen::Bitmap<float, 1> bitmap{ (source.glyph.width + (2 * source.glyph.buffer)), (source.glyph.height + (2 * source.glyph.buffer)) };
+			msdfgen::generateSDF(bitmap, source.shape, projection, 8.0, generatorConfig);
+
+			source.glyph.image = RenderMSDF(bitmap);
+		}
+	}
+
+	SDFGlyph RenderSDFGlyph(FT_Face face, const GlyphIndex glyphIndex, const int32 buffer, const FontFaceProperty& prop)
+	{
+		detail::SDFGlyphSource source = detail::LoadSDFGlyphSource(face, glyphIndex, buffer, prop);
+
+		detail::GenerateSDF(source);
+
+		return std::move(source.glyph);
+	}
+
+	Array<SDFGlyph> RenderSDFGlyphs(FT_Face face, const Array<GlyphIndex>& glyphIndices, const int32 buffer, const FontFaceProperty& prop)
+	{
+		Array<detail::SDFGlyphSource> sources(Arg::reserve = glyphIndices.size());
+
+		for (const auto& glyphIndex : glyphIndices)
+		{
+			sources << detail::LoadSDFGlyphSource(face, glyphIndex, buffer, prop);
 		}
+
+		// 距離場の生成はグリフごとに独立しているため、ワーカースレッドで並列に行う
+		Threading::ParallelFor(0, sources.size(), [&](const size_t i)
+		{
+			detail::GenerateSDF(sources[i]);
+		}, 1);
+
+		Array<SDFGlyph> glyphs(Arg::reserve = sources.size());
+
+		for (auto& source : sources)
+		{
+			glyphs << std::move(source.glyph);
+		}
+
+		return glyphs;
 	}
 }
@@ -18,6 +18,8 @@
 
 namespace s3d
 {
+	class GlyphAtlas;
+
 	class SIV3D_NOVTABLE ISiv3DFont
 	{
 	public:
@@ -84,6 +86,10 @@ namespace s3d
 
 		virtual bool preload(Font::IDType handleID, StringView chars) = 0;
 
+		virtual bool bakeAtlas(Font::IDType handleID, StringView chars, FilePathView path) = 0;
+
+		virtual bool loadBakedAtlas(Font::IDType handleID, FilePathView path) = 0;
+
 		virtual const Texture& getTexture(Font::IDType handleID) = 0;
 
 		virtual Glyph getGlyph(Font::IDType handleID, StringView ch) = 0;
@@ -137,5 +143,13 @@ namespace s3d
 		virtual const PixelShader& getFontShader(FontMethod method, TextStyle::Type type, HasColor hasColor) const = 0;
 	
 		virtual bool isAvailable(Typeface typeface) const = 0;
+
+		virtual GlyphAtlas& getGlyphAtlas(FontMethod method) = 0;
+
+		virtual GlyphAtlasStats getGlyphAtlasStats(FontMethod method) const = 0;
+
+		virtual void setShapedTextCacheCapacity(size_t capacityBytes) = 0;
+
+		virtual ShapedTextCacheStats getShapedTextCacheStats() const = 0;
 	};
 }
@@ -0,0 +1,194 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <bit>
+# include <Siv3D/Hash.hpp>
+# include "ShapedTextCache.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		constexpr uint64 RegionParamFlag = (uint64{ 1 } << 63);
+
+		// エントリごとに、リストとハッシュテーブルのノードが使うおおよそのメモリ
+		constexpr size_t EntryOverheadBytes = 64;
+
+		[[nodiscard]]
+		static constexpr uint64 ClustersParam(const bool recursive, const Ligature ligature) noexcept
+		{
+			return ((recursive ? 1 : 0) | (ligature.getBool() ? 2 : 0));
+		}
+
+		[[nodiscard]]
+		static uint64 RegionParam(const Array<GlyphCluster>& clusters, const double fontSize, const double lineHeightScale) noexcept
+		{
+			const uint64 values[3] = {
+				Hash::XXHash3(clusters.data(), clusters.size_bytes()),
+				std::bit_cast<uint64>(fontSize),
+				std::bit_cast<uint64>(lineHeightScale),
+			};
+
+			return (Hash::XXHash3(values, sizeof(values)) | RegionParamFlag);
+		}
+	}
+
+	size_t ShapedTextCache::KeyHash::operator ()(const Key& key) const noexcept
+	{
+		const uint64 values[3] = {
+			key.fontID,
+			Hash::XXHash3(key.text.data(), key.text.size_bytes()),
+			key.param,
+		};
+
+		return static_cast<size_t>(Hash::XXHash3(values, sizeof(values)));
+	}
+
+	Optional<Array<GlyphCluster>> ShapedTextCache::findGlyphClusters(const uint64 fontID, const StringView s, const bool recursive, const Ligature ligature)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		if (const Entry* entry = find(Key{ fontID, s, detail::ClustersParam(recursive, ligature) }))
+		{
+			return entry->clusters;
+		}
+
+		return none;
+	}
+
+	void ShapedTextCache::addGlyphClusters(const uint64 fontID, const StringView s, const bool recursive, const Ligature ligature, const Array<GlyphCluster>& clusters)
+	{
+		Entry entry;
+		entry.fontID	= fontID;
+		entry.text		= s;
+		entry.param		= detail::ClustersParam(recursive, ligature);
+		entry.clusters	= clusters;
+		entry.bytes		= (sizeof(Entry) + detail::EntryOverheadBytes + entry.text.size_bytes() + entry.clusters.size_bytes());
+
+		std::lock_guard lock{ m_mutex };
+
+		add(std::move(entry));
+	}
+
+	Optional<SizeF> ShapedTextCache::findRegionSize(const uint64 fontID, const StringView s, const Array<GlyphCluster>& clusters, const double fontSize, const double lineHeightScale)
+	{
+		const uint64 param = detail::RegionParam(clusters, fontSize, lineHeightScale);
+
+		std::lock_guard lock{ m_mutex };
+
+		if (const Entry* entry = find(Key{ fontID, s, param }))
+		{
+			return entry->regionSize;
+		}
+
+		return none;
+	}
+
+	void ShapedTextCache::addRegionSize(const uint64 fontID, const StringView s, const Array<GlyphCluster>& clusters, const double fontSize, const double lineHeightScale, const SizeF& size)
+	{
+		Entry entry;
+		entry.fontID		= fontID;
+		entry.text			= s;
+		entry.param			= detail::RegionParam(clusters, fontSize, lineHeightScale);
+		entry.regionSize	= size;
+		entry.bytes			= (sizeof(Entry) + detail::EntryOverheadBytes + entry.text.size_bytes());
+
+		std::lock_guard lock{ m_mutex };
+
+		add(std::move(entry));
+	}
+
+	void ShapedTextCache::clear()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_table.clear();
+		m_entries.clear();
+		m_stats.entries = 0;
+		m_stats.usedBytes = 0;
+	}
+
+	void ShapedTextCache::setCapacity(const size_t capacityBytes)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_capacityBytes = capacityBytes;
+
+		shrink();
+	}
+
+	ShapedTextCacheStats ShapedTextCache::getStats() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		ShapedTextCacheStats stats = m_stats;
+		stats.capacityBytes = m_capacityBytes;
+		return stats;
+	}
+
+	const ShapedTextCache::Entry* ShapedTextCache::find(const Key& key)
+	{
+		const auto it = m_table.find(key);
+
+		if (it == m_table.end())
+		{
+			++m_stats.misses;
+			return nullptr;
+		}
+
+		// 最近使われたエントリとして先頭に移す
+		m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+		++m_stats.hits;
+
+		return &(*it->second);
+	}
+
+	void ShapedTextCache::add(Entry&& entry)
+	{
+		if (m_capacityBytes < entry.bytes)
+		{
+			return;
+		}
+
+		// 別のスレッドが先に追加していた場合
+		if (m_table.contains(Key{ entry.fontID, entry.text, entry.param }))
+		{
+			return;
+		}
+
+		m_entries.push_front(std::move(entry));
+
+		const Entry& added = m_entries.front();
+		m_table.emplace(Key{ added.fontID, added.text, added.param }, m_entries.begin());
+
+		++m_stats.entries;
+		m_stats.usedBytes += added.bytes;
+
+		shrink();
+	}
+
+	void ShapedTextCache::shrink()
+	{
+		while (m_capacityBytes < m_stats.usedBytes)
+		{
+			const Entry& oldest = m_entries.back();
+
+			m_table.erase(Key{ oldest.fontID, oldest.text, oldest.param });
+
+			--m_stats.entries;
+			m_stats.usedBytes -= oldest.bytes;
+			++m_stats.evictions;
+
+			m_entries.pop_back();
+		}
+	}
+}
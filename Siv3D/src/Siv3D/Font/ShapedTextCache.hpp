@@ -0,0 +1,117 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <list>
+# include <mutex>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/GlyphCluster.hpp>
+# include <Siv3D/PredefinedYesNo.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/ShapedTextCacheStats.hpp>
+
+namespace s3d
+{
+	// すべてのフォントで共有する、テキストの整形結果のキャッシュ
+	//
+	// 整形したグリフクラスタと、大きさごとのテキストの領域の大きさを、最近使われた順に容量の上限まで保持する。
+	// フォントの作成・破棄やフォールバックフォントの追加で整形結果が変わりうるため、そのときは clear() する。
+	class ShapedTextCache
+	{
+	public:
+
+		static constexpr size_t DefaultCapacityBytes = (4 << 20);
+
+		[[nodiscard]]
+		Optional<Array<GlyphCluster>> findGlyphClusters(uint64 fontID, StringView s, bool recursive, Ligature ligature);
+
+		void addGlyphClusters(uint64 fontID, StringView s, bool recursive, Ligature ligature, const Array<GlyphCluster>& clusters);
+
+		// clusters は s を整形した結果。fontSize と lineHeightScale で描いたときの領域の大きさを返す
+		[[nodiscard]]
+		Optional<SizeF> findRegionSize(uint64 fontID, StringView s, const Array<GlyphCluster>& clusters, double fontSize, double lineHeightScale);
+
+		void addRegionSize(uint64 fontID, StringView s, const Array<GlyphCluster>& clusters, double fontSize, double lineHeightScale, const SizeF& size);
+
+		void clear();
+
+		void setCapacity(size_t capacityBytes);
+
+		[[nodiscard]]
+		ShapedTextCacheStats getStats() const;
+
+	private:
+
+		struct Key
+		{
+			uint64 fontID = 0;
+
+			// エントリが持つ文字列を参照する
+			StringView text;
+
+			// グリフクラスタの場合は整形のオプション、領域の場合は大きさとグリフクラスタのハッシュ（最上位ビットが 1）
+			uint64 param = 0;
+
+			[[nodiscard]]
+			friend bool operator ==(const Key& lhs, const Key& rhs) noexcept
+			{
+				return (lhs.fontID == rhs.fontID)
+					&& (lhs.param == rhs.param)
+					&& (lhs.text == rhs.text);
+			}
+		};
+
+		struct KeyHash
+		{
+			[[nodiscard]]
+			size_t operator ()(const Key& key) const noexcept;
+		};
+
+		struct Entry
+		{
+			uint64 fontID = 0;
+
+			String text;
+
+			uint64 param = 0;
+
+			Array<GlyphCluster> clusters;
+
+			SizeF regionSize{ 0, 0 };
+
+			size_t bytes = 0;
+		};
+
+		using EntryList = std::list<Entry>;
+
+		mutable std::mutex m_mutex;
+
+		// 先頭ほど最近使われたエントリ
+		EntryList m_entries;
+
+		HashTable<Key, EntryList::iterator, KeyHash> m_table;
+
+		size_t m_capacityBytes = DefaultCapacityBytes;
+
+		ShapedTextCacheStats m_stats;
+
+		[[nodiscard]]
+		const Entry* find(const Key& key);
+
+		void add(Entry&& entry);
+
+		void shrink();
+	};
+}
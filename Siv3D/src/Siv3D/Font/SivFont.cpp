@@ -398,6 +398,16 @@ namespace s3d
 		return SIV3D_ENGINE(Font)->preload(m_handle->id(), chars);
 	}
 
+	bool Font::bakeAtlas(const StringView chars, const FilePathView path) const
+	{
+		return SIV3D_ENGINE(Font)->bakeAtlas(m_handle->id(), chars, path);
+	}
+
+	bool Font::loadBakedAtlas(const FilePathView path) const
+	{
+		return SIV3D_ENGINE(Font)->loadBakedAtlas(m_handle->id(), path);
+	}
+
 	const Texture& Font::getTexture() const
 	{
 		return SIV3D_ENGINE(Font)->getTexture(m_handle->id());
@@ -447,4 +457,19 @@ namespace s3d
 	{
 		return SIV3D_ENGINE(Font)->isAvailable(typeface);
 	}
+
+	GlyphAtlasStats Font::GetGlyphAtlasStats(const FontMethod method)
+	{
+		return SIV3D_ENGINE(Font)->getGlyphAtlasStats(method);
+	}
+
+	void Font::SetShapedTextCacheCapacity(const size_t capacityBytes)
+	{
+		SIV3D_ENGINE(Font)->setShapedTextCacheCapacity(capacityBytes);
+	}
+
+	ShapedTextCacheStats Font::GetShapedTextCacheStats()
+	{
+		return SIV3D_ENGINE(Font)->getShapedTextCacheStats();
+	}
 }
@@ -141,7 +141,17 @@ namespace s3d
 
 	void FontAsset::LoadAsync(const AssetNameView name, const StringView preloadText)
 	{
-		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Font, name, preloadText);
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Font, name, preloadText, AssetLoadPriority::Normal);
+	}
+
+	void FontAsset::LoadAsync(const AssetNameView name, const AssetLoadPriority priority, const StringView preloadText)
+	{
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Font, name, preloadText, priority);
+	}
+
+	bool FontAsset::CancelLoadAsync(const AssetNameView name)
+	{
+		return SIV3D_ENGINE(Asset)->cancelLoadAsync(AssetType::Font, name);
 	}
 
 	void FontAsset::Wait(const AssetNameView name)
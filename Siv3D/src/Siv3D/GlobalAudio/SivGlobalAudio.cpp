@@ -59,7 +59,12 @@ namespace s3d
 
 		void GetSamples(Array<float>& samples)
 		{
-			SIV3D_ENGINE(Audio)->getGlobalSamples(samples);
+			SIV3D_ENGINE(Audio)->getGlobalSamples(samples, 256);
+		}
+
+		void GetSamples(Array<float>& samples, const size_t length)
+		{
+			SIV3D_ENGINE(Audio)->getGlobalSamples(samples, length);
 		}
 
 		FFTResult GetFFT()
@@ -76,6 +81,11 @@ namespace s3d
 			SIV3D_ENGINE(Audio)->getGlobalFFT(result);
 		}
 
+		void GetFFT(FFTResult& result, const FFTSampleLength sampleLength)
+		{
+			SIV3D_ENGINE(Audio)->getGlobalFFT(result, sampleLength);
+		}
+
 		Array<float> BusGetSamples(const MixBus busIndex)
 		{
 			Array<float> result;
@@ -87,7 +97,12 @@ namespace s3d
 
 		void BusGetSamples(const MixBus busIndex, Array<float>& samples)
 		{
-			SIV3D_ENGINE(Audio)->getBusSamples(FromEnum(busIndex), samples);
+			SIV3D_ENGINE(Audio)->getBusSamples(FromEnum(busIndex), samples, 256);
+		}
+
+		void BusGetSamples(const MixBus busIndex, Array<float>& samples, const size_t length)
+		{
+			SIV3D_ENGINE(Audio)->getBusSamples(FromEnum(busIndex), samples, length);
 		}
 
 		FFTResult BusGetFFT(MixBus busIndex)
@@ -104,6 +119,11 @@ namespace s3d
 			SIV3D_ENGINE(Audio)->getBusFFT(FromEnum(busIndex), result);
 		}
 
+		void BusGetFFT(const MixBus busIndex, FFTResult& result, const FFTSampleLength sampleLength)
+		{
+			SIV3D_ENGINE(Audio)->getBusFFT(FromEnum(busIndex), result, sampleLength);
+		}
+
 		double BusGetVolume(const MixBus busIndex)
 		{
 			return SIV3D_ENGINE(Audio)->getBusVolume(FromEnum(busIndex));
@@ -183,5 +203,20 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(Audio)->supportsPitchShift();
 		}
+
+		void SetDecodedWaveCacheCapacity(const size_t capacityBytes)
+		{
+			SIV3D_ENGINE(Audio)->setDecodedWaveCacheCapacity(capacityBytes);
+		}
+
+		DecodedWaveCacheStats GetDecodedWaveCacheStats()
+		{
+			return SIV3D_ENGINE(Audio)->getDecodedWaveCacheStats();
+		}
+
+		void ClearDecodedWaveCache()
+		{
+			SIV3D_ENGINE(Audio)->clearDecodedWaveCache();
+		}
 	}
 }
@@ -0,0 +1,66 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/IReader.hpp>
+# include <Siv3D/Array.hpp>
+
+namespace s3d
+{
+	// IReader の現在位置から末尾までのデータ
+	//
+	// IReader が readView() に対応していればコピーせずに参照し、そうでなければバッファに読み込む。
+	// 参照している間は IReader を閉じたり、読み込み位置を変更したりしてはならない。
+	class ReaderBytes
+	{
+	public:
+
+		explicit ReaderBytes(IReader& reader)
+		{
+			const int64 size = Max<int64>((reader.size() - reader.getPos()), 0);
+
+			if (reader.supportsReadView())
+			{
+				m_view = reader.readView(size);
+				return;
+			}
+
+			m_buffer.resize(static_cast<size_t>(size));
+			m_buffer.resize(static_cast<size_t>(reader.read(m_buffer.data(), size)));
+			m_view = m_buffer;
+		}
+
+		[[nodiscard]]
+		const uint8* data() const noexcept
+		{
+			return static_cast<const uint8*>(static_cast<const void*>(m_view.data()));
+		}
+
+		[[nodiscard]]
+		size_t size() const noexcept
+		{
+			return m_view.size();
+		}
+
+		[[nodiscard]]
+		std::string_view asStringView() const noexcept
+		{
+			return{ static_cast<const char*>(static_cast<const void*>(m_view.data())), m_view.size() };
+		}
+
+	private:
+
+		Array<Byte> m_buffer;
+
+		std::span<const Byte> m_view;
+	};
+}
@@ -0,0 +1,509 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+// x86-64 では SSE4.1 と AVX2 のカーネルを用意し、実行時に CPU の対応命令セットで選ぶ
+# if (defined(_M_X64) || defined(__x86_64__)) && (not defined(__EMSCRIPTEN__))
+#	include <immintrin.h> // simde のエイリアスと衝突しないよう、SIMD.hpp より先にインクルードする
+#	define SIV3D_IMAGE_X86_KERNELS() 1
+#	if defined(__GNUC__)
+#		define SIV3D_TARGET_AVX2 __attribute__((target("avx2")))
+#	else
+#		define SIV3D_TARGET_AVX2
+#	endif
+# else
+#	define SIV3D_IMAGE_X86_KERNELS() 0
+# endif
+
+# include <Siv3D/CPUInfo.hpp>
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/Threading.hpp>
+# include "ImagePointOperations.hpp"
+
+namespace s3d
+{
+	namespace ImagePointOperations
+	{
+		namespace
+		{
+			// この画素数以上の画像は並列に処理する
+			constexpr size_t ParallelThreshold = (512 * 512);
+
+			// 1 回のタスクで処理する画素数の目安
+			constexpr size_t PixelsPerTask = (128 * 1024);
+
+			// 参照実装と同じ係数。Color::grayscale0_255() と同じ順序で計算し、結果を一致させる
+			constexpr double GrayR = 0.299, GrayG = 0.587, GrayB = 0.114;
+
+			constexpr double SepiaRR = 0.393, SepiaRG = 0.769, SepiaRB = 0.189;
+			constexpr double SepiaGR = 0.349, SepiaGG = 0.686, SepiaGB = 0.168;
+			constexpr double SepiaBR = 0.272, SepiaBG = 0.534, SepiaBB = 0.131;
+
+			template <class Kernel>
+			void ForEachBand(Image& image, Kernel kernel)
+			{
+				Color* const pixels = image.data();
+				const size_t width = image.width();
+				const size_t height = image.height();
+
+				if ((width * height) < ParallelThreshold)
+				{
+					kernel(pixels, (width * height));
+					return;
+				}
+
+				const size_t rowsPerTask = Max<size_t>((PixelsPerTask / width), 1);
+
+				Threading::ParallelFor(0, height, [=](const size_t beginY, const size_t endY)
+				{
+					kernel((pixels + beginY * width), ((endY - beginY) * width));
+				}, rowsPerTask);
+			}
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	Reference
+			//
+			////////////////////////////////////////////////////////////////
+
+			void Negate_Reference(Color* p, const size_t count) noexcept
+			{
+				for (Color* const pEnd = (p + count); p != pEnd; ++p)
+				{
+					*p = ~*p;
+				}
+			}
+
+			void Grayscale_Reference(Color* p, const size_t count) noexcept
+			{
+				for (Color* const pEnd = (p + count); p != pEnd; ++p)
+				{
+					const uint8 gray = p->grayscale0_255();
+					p->r = gray;
+					p->g = gray;
+					p->b = gray;
+				}
+			}
+
+			void Sepia_Reference(Color* p, const size_t count) noexcept
+			{
+				for (Color* const pEnd = (p + count); p != pEnd; ++p)
+				{
+					const double tr = Min(((SepiaRR * p->r) + (SepiaRG * p->g) + (SepiaRB * p->b)), 255.0);
+					const double tg = Min(((SepiaGR * p->r) + (SepiaGG * p->g) + (SepiaGB * p->b)), 255.0);
+					const double tb = Min(((SepiaBR * p->r) + (SepiaBG * p->g) + (SepiaBB * p->b)), 255.0);
+
+					p->r = static_cast<uint8>(tr);
+					p->g = static_cast<uint8>(tg);
+					p->b = static_cast<uint8>(tb);
+				}
+			}
+
+			void Brighten_Reference(Color* p, const size_t count, const int32 level) noexcept
+			{
+				for (Color* const pEnd = (p + count); p != pEnd; ++p)
+				{
+					p->r = static_cast<uint8>(Clamp((static_cast<int32>(p->r) + level), 0, 255));
+					p->g = static_cast<uint8>(Clamp((static_cast<int32>(p->g) + level), 0, 255));
+					p->b = static_cast<uint8>(Clamp((static_cast<int32>(p->b) + level), 0, 255));
+				}
+			}
+
+			void ApplyTable_Reference(Color* p, const size_t count, const uint8(&table)[256]) noexcept
+			{
+				for (Color* const pEnd = (p + count); p != pEnd; ++p)
+				{
+					p->r = table[p->r];
+					p->g = table[p->g];
+					p->b = table[p->b];
+				}
+			}
+
+			void SwapRB_Reference(Color* p, const size_t count) noexcept
+			{
+				for (Color* const pEnd = (p + count); p != pEnd; ++p)
+				{
+					const uint8 t = p->r;
+					p->r = p->b;
+					p->b = t;
+				}
+			}
+
+		# if SIV3D_IMAGE_X86_KERNELS()
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	SSE4.1
+			//
+			////////////////////////////////////////////////////////////////
+
+			[[nodiscard]]
+			inline __m128i* AsM128Ptr(Color* p) noexcept
+			{
+				return static_cast<__m128i*>(static_cast<void*>(p));
+			}
+
+			// (wr * r + wg * g) + wb * b
+			[[nodiscard]]
+			inline __m128d WeightedSum(const __m128d r, const __m128d g, const __m128d b, const double wr, const double wg, const double wb) noexcept
+			{
+				const __m128d t = ::_mm_add_pd(::_mm_mul_pd(::_mm_set1_pd(wr), r), ::_mm_mul_pd(::_mm_set1_pd(wg), g));
+				return ::_mm_add_pd(t, ::_mm_mul_pd(::_mm_set1_pd(wb), b));
+			}
+
+			// 4 画素の R, G, B を、それぞれ下位 2 画素と上位 2 画素の double に変換する
+			struct ChannelsPD
+			{
+				__m128d r[2], g[2], b[2];
+
+				explicit ChannelsPD(const __m128i v) noexcept
+				{
+					const __m128i mask = ::_mm_set1_epi32(0xFF);
+					const __m128i ri = ::_mm_and_si128(v, mask);
+					const __m128i gi = ::_mm_and_si128(::_mm_srli_epi32(v, 8), mask);
+					const __m128i bi = ::_mm_and_si128(::_mm_srli_epi32(v, 16), mask);
+
+					r[0] = ::_mm_cvtepi32_pd(ri);
+					g[0] = ::_mm_cvtepi32_pd(gi);
+					b[0] = ::_mm_cvtepi32_pd(bi);
+					r[1] = ::_mm_cvtepi32_pd(_mm_shuffle_epi32(ri, _MM_SHUFFLE(3, 2, 3, 2)));
+					g[1] = ::_mm_cvtepi32_pd(_mm_shuffle_epi32(gi, _MM_SHUFFLE(3, 2, 3, 2)));
+					b[1] = ::_mm_cvtepi32_pd(_mm_shuffle_epi32(bi, _MM_SHUFFLE(3, 2, 3, 2)));
+				}
+			};
+
+			[[nodiscard]]
+			inline __m128i ToEpi32(const __m128d lo, const __m128d hi) noexcept
+			{
+				return ::_mm_unpacklo_epi64(::_mm_cvttpd_epi32(lo), ::_mm_cvttpd_epi32(hi));
+			}
+
+			void Negate_SSE4_1(Color* p, const size_t count) noexcept
+			{
+				const __m128i rgbMask = ::_mm_set1_epi32(0x00FFFFFF);
+				const size_t simdCount = (count & ~size_t(3));
+
+				for (size_t i = 0; i < simdCount; i += 4)
+				{
+					__m128i* const pv = AsM128Ptr(p + i);
+					::_mm_storeu_si128(pv, ::_mm_xor_si128(::_mm_loadu_si128(pv), rgbMask));
+				}
+
+				Negate_Reference((p + simdCount), (count - simdCount));
+			}
+
+			void Grayscale_SSE4_1(Color* p, const size_t count) noexcept
+			{
+				const __m128i alphaMask = ::_mm_set1_epi32(static_cast<int32>(0xFF000000));
+				const size_t simdCount = (count & ~size_t(3));
+
+				for (size_t i = 0; i < simdCount; i += 4)
+				{
+					__m128i* const pv = AsM128Ptr(p + i);
+					const __m128i v = ::_mm_loadu_si128(pv);
+					const ChannelsPD c{ v };
+
+					const __m128i gray = ToEpi32(WeightedSum(c.r[0], c.g[0], c.b[0], GrayR, GrayG, GrayB),
+						WeightedSum(c.r[1], c.g[1], c.b[1], GrayR, GrayG, GrayB));
+
+					const __m128i rgb = ::_mm_or_si128(::_mm_or_si128(gray, ::_mm_slli_epi32(gray, 8)), ::_mm_slli_epi32(gray, 16));
+					::_mm_storeu_si128(pv, ::_mm_or_si128(rgb, ::_mm_and_si128(v, alphaMask)));
+				}
+
+				Grayscale_Reference((p + simdCount), (count - simdCount));
+			}
+
+			void Sepia_SSE4_1(Color* p, const size_t count) noexcept
+			{
+				const __m128i alphaMask = ::_mm_set1_epi32(static_cast<int32>(0xFF000000));
+				const __m128d maxValue = ::_mm_set1_pd(255.0);
+				const size_t simdCount = (count & ~size_t(3));
+
+				for (size_t i = 0; i < simdCount; i += 4)
+				{
+					__m128i* const pv = AsM128Ptr(p + i);
+					const __m128i v = ::_mm_loadu_si128(pv);
+					const ChannelsPD c{ v };
+
+					const __m128i r = ToEpi32(::_mm_min_pd(WeightedSum(c.r[0], c.g[0], c.b[0], SepiaRR, SepiaRG, SepiaRB), maxValue),
+						::_mm_min_pd(WeightedSum(c.r[1], c.g[1], c.b[1], SepiaRR, SepiaRG, SepiaRB), maxValue));
+					const __m128i g = ToEpi32(::_mm_min_pd(WeightedSum(c.r[0], c.g[0], c.b[0], SepiaGR, SepiaGG, SepiaGB), maxValue),
+						::_mm_min_pd(WeightedSum(c.r[1], c.g[1], c.b[1], SepiaGR, SepiaGG, SepiaGB), maxValue));
+					const __m128i b = ToEpi32(::_mm_min_pd(WeightedSum(c.r[0], c.g[0], c.b[0], SepiaBR, SepiaBG, SepiaBB), maxValue),
+						::_mm_min_pd(WeightedSum(c.r[1], c.g[1], c.b[1], SepiaBR, SepiaBG, SepiaBB), maxValue));
+
+					const __m128i rgb = ::_mm_or_si128(::_mm_or_si128(r, ::_mm_slli_epi32(g, 8)), ::_mm_slli_epi32(b, 16));
+					::_mm_storeu_si128(pv, ::_mm_or_si128(rgb, ::_mm_and_si128(v, alphaMask)));
+				}
+
+				Sepia_Reference((p + simdCount), (count - simdCount));
+			}
+
+			void Brighten_SSE4_1(Color* p, const size_t count, const int32 level) noexcept
+			{
+				const int32 amount = Min(Abs(level), 255);
+				const __m128i delta = ::_mm_set1_epi32(amount | (amount << 8) | (amount << 16));
+				const size_t simdCount = (count & ~size_t(3));
+
+				for (size_t i = 0; i < simdCount; i += 4)
+				{
+					__m128i* const pv = AsM128Ptr(p + i);
+					const __m128i v = ::_mm_loadu_si128(pv);
+					::_mm_storeu_si128(pv, ((0 < level) ? ::_mm_adds_epu8(v, delta) : ::_mm_subs_epu8(v, delta)));
+				}
+
+				Brighten_Reference((p + simdCount), (count - simdCount), level);
+			}
+
+			void SwapRB_SSE4_1(Color* p, const size_t count) noexcept
+			{
+				const __m128i shuffle = ::_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+				const size_t simdCount = (count & ~size_t(3));
+
+				for (size_t i = 0; i < simdCount; i += 4)
+				{
+					__m128i* const pv = AsM128Ptr(p + i);
+					::_mm_storeu_si128(pv, ::_mm_shuffle_epi8(::_mm_loadu_si128(pv), shuffle));
+				}
+
+				SwapRB_Reference((p + simdCount), (count - simdCount));
+			}
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	AVX2
+			//
+			////////////////////////////////////////////////////////////////
+
+			[[nodiscard]]
+			inline __m256i* AsM256Ptr(Color* p) noexcept
+			{
+				return static_cast<__m256i*>(static_cast<void*>(p));
+			}
+
+			SIV3D_TARGET_AVX2
+			void Negate_AVX2(Color* p, const size_t count) noexcept
+			{
+				const __m256i rgbMask = ::_mm256_set1_epi32(0x00FFFFFF);
+				const size_t simdCount = (count & ~size_t(7));
+
+				for (size_t i = 0; i < simdCount; i += 8)
+				{
+					__m256i* const pv = AsM256Ptr(p + i);
+					::_mm256_storeu_si256(pv, ::_mm256_xor_si256(::_mm256_loadu_si256(pv), rgbMask));
+				}
+
+				Negate_Reference((p + simdCount), (count - simdCount));
+			}
+
+			SIV3D_TARGET_AVX2
+			void Grayscale_AVX2(Color* p, const size_t count) noexcept
+			{
+				const __m128i mask = ::_mm_set1_epi32(0xFF);
+				const __m128i alphaMask = ::_mm_set1_epi32(static_cast<int32>(0xFF000000));
+				const __m256d wr = ::_mm256_set1_pd(GrayR), wg = ::_mm256_set1_pd(GrayG), wb = ::_mm256_set1_pd(GrayB);
+				const size_t simdCount = (count & ~size_t(3));
+
+				for (size_t i = 0; i < simdCount; i += 4)
+				{
+					__m128i* const pv = AsM128Ptr(p + i);
+					const __m128i v = ::_mm_loadu_si128(pv);
+					const __m256d r = ::_mm256_cvtepi32_pd(::_mm_and_si128(v, mask));
+					const __m256d g = ::_mm256_cvtepi32_pd(::_mm_and_si128(::_mm_srli_epi32(v, 8), mask));
+					const __m256d b = ::_mm256_cvtepi32_pd(::_mm_and_si128(::_mm_srli_epi32(v, 16), mask));
+
+					const __m256d sum = ::_mm256_add_pd(::_mm256_add_pd(::_mm256_mul_pd(wr, r), ::_mm256_mul_pd(wg, g)), ::_mm256_mul_pd(wb, b));
+					const __m128i gray = ::_mm256_cvttpd_epi32(sum);
+
+					const __m128i rgb = ::_mm_or_si128(::_mm_or_si128(gray, ::_mm_slli_epi32(gray, 8)), ::_mm_slli_epi32(gray, 16));
+					::_mm_storeu_si128(pv, ::_mm_or_si128(rgb, ::_mm_and_si128(v, alphaMask)));
+				}
+
+				Grayscale_Reference((p + simdCount), (count - simdCount));
+			}
+
+			SIV3D_TARGET_AVX2
+			void Sepia_AVX2(Color* p, const size_t count) noexcept
+			{
+				const __m128i mask = ::_mm_set1_epi32(0xFF);
+				const __m128i alphaMask = ::_mm_set1_epi32(static_cast<int32>(0xFF000000));
+				const __m256d maxValue = ::_mm256_set1_pd(255.0);
+				const size_t simdCount = (count & ~size_t(3));
+
+				for (size_t i = 0; i < simdCount; i += 4)
+				{
+					__m128i* const pv = AsM128Ptr(p + i);
+					const __m128i v = ::_mm_loadu_si128(pv);
+					const __m256d r = ::_mm256_cvtepi32_pd(::_mm_and_si128(v, mask));
+					const __m256d g = ::_mm256_cvtepi32_pd(::_mm_and_si128(::_mm_srli_epi32(v, 8), mask));
+					const __m256d b = ::_mm256_cvtepi32_pd(::_mm_and_si128(::_mm_srli_epi32(v, 16), mask));
+
+					const __m256d tr = ::_mm256_add_pd(::_mm256_add_pd(::_mm256_mul_pd(::_mm256_set1_pd(SepiaRR), r), ::_mm256_mul_pd(::_mm256_set1_pd(SepiaRG), g)), ::_mm256_mul_pd(::_mm256_set1_pd(SepiaRB), b));
+					const __m256d tg = ::_mm256_add_pd(::_mm256_add_pd(::_mm256_mul_pd(::_mm256_set1_pd(SepiaGR), r), ::_mm256_mul_pd(::_mm256_set1_pd(SepiaGG), g)), ::_mm256_mul_pd(::_mm256_set1_pd(SepiaGB), b));
+					const __m256d tb = ::_mm256_add_pd(::_mm256_add_pd(::_mm256_mul_pd(::_mm256_set1_pd(SepiaBR), r), ::_mm256_mul_pd(::_mm256_set1_pd(SepiaBG), g)), ::_mm256_mul_pd(::_mm256_set1_pd(SepiaBB), b));
+
+					const __m128i ri = ::_mm256_cvttpd_epi32(::_mm256_min_pd(tr, maxValue));
+					const __m128i gi = ::_mm256_cvttpd_epi32(::_mm256_min_pd(tg, maxValue));
+					const __m128i bi = ::_mm256_cvttpd_epi32(::_mm256_min_pd(tb, maxValue));
+
+					const __m128i rgb = ::_mm_or_si128(::_mm_or_si128(ri, ::_mm_slli_epi32(gi, 8)), ::_mm_slli_epi32(bi, 16));
+					::_mm_storeu_si128(pv, ::_mm_or_si128(rgb, ::_mm_and_si128(v, alphaMask)));
+				}
+
+				Sepia_Reference((p + simdCount), (count - simdCount));
+			}
+
+			SIV3D_TARGET_AVX2
+			void Brighten_AVX2(Color* p, const size_t count, const int32 level) noexcept
+			{
+				const int32 amount = Min(Abs(level), 255);
+				const __m256i delta = ::_mm256_set1_epi32(amount | (amount << 8) | (amount << 16));
+				const size_t simdCount = (count & ~size_t(7));
+
+				for (size_t i = 0; i < simdCount; i += 8)
+				{
+					__m256i* const pv = AsM256Ptr(p + i);
+					const __m256i v = ::_mm256_loadu_si256(pv);
+					::_mm256_storeu_si256(pv, ((0 < level) ? ::_mm256_adds_epu8(v, delta) : ::_mm256_subs_epu8(v, delta)));
+				}
+
+				Brighten_Reference((p + simdCount), (count - simdCount), level);
+			}
+
+			SIV3D_TARGET_AVX2
+			void SwapRB_AVX2(Color* p, const size_t count) noexcept
+			{
+				const __m256i shuffle = ::_mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+					2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+				const size_t simdCount = (count & ~size_t(7));
+
+				for (size_t i = 0; i < simdCount; i += 8)
+				{
+					__m256i* const pv = AsM256Ptr(p + i);
+					::_mm256_storeu_si256(pv, ::_mm256_shuffle_epi8(::_mm256_loadu_si256(pv), shuffle));
+				}
+
+				SwapRB_Reference((p + simdCount), (count - simdCount));
+			}
+
+		# endif
+
+			enum class InstructionSet : uint8
+			{
+				Reference,
+
+				SSE4_1,
+
+				AVX2,
+			};
+
+			[[nodiscard]]
+			InstructionSet GetInstructionSet() noexcept
+			{
+				static const InstructionSet instructionSet = []()
+				{
+				# if SIV3D_IMAGE_X86_KERNELS()
+
+					const CPUInfo& cpu = GetCPUInfo();
+
+					if (cpu.features.avx2)
+					{
+						return InstructionSet::AVX2;
+					}
+
+					if (cpu.features.sse4_1)
+					{
+						return InstructionSet::SSE4_1;
+					}
+
+				# endif
+
+					return InstructionSet::Reference;
+				}();
+
+				return instructionSet;
+			}
+
+			using KernelFunc = void(*)(Color*, size_t) noexcept;
+
+			[[nodiscard]]
+			KernelFunc SelectKernel([[maybe_unused]] const KernelFunc reference, [[maybe_unused]] const KernelFunc sse4_1, [[maybe_unused]] const KernelFunc avx2) noexcept
+			{
+				switch (GetInstructionSet())
+				{
+				case InstructionSet::AVX2:
+					return avx2;
+				case InstructionSet::SSE4_1:
+					return sse4_1;
+				default:
+					return reference;
+				}
+			}
+		}
+
+	# if SIV3D_IMAGE_X86_KERNELS()
+	#	define SIV3D_SELECT_KERNEL(name) SelectKernel(name##_Reference, name##_SSE4_1, name##_AVX2)
+	# else
+	#	define SIV3D_SELECT_KERNEL(name) SelectKernel(name##_Reference, name##_Reference, name##_Reference)
+	# endif
+
+		void Negate(Image& image)
+		{
+			ForEachBand(image, SIV3D_SELECT_KERNEL(Negate));
+		}
+
+		void Grayscale(Image& image)
+		{
+			ForEachBand(image, SIV3D_SELECT_KERNEL(Grayscale));
+		}
+
+		void Sepia(Image& image)
+		{
+			ForEachBand(image, SIV3D_SELECT_KERNEL(Sepia));
+		}
+
+		void Brighten(Image& image, const int32 level)
+		{
+			if (level == 0)
+			{
+				return;
+			}
+
+			void (*kernel)(Color*, size_t, int32) noexcept = Brighten_Reference;
+
+		# if SIV3D_IMAGE_X86_KERNELS()
+
+			if (GetInstructionSet() == InstructionSet::AVX2)
+			{
+				kernel = Brighten_AVX2;
+			}
+			else if (GetInstructionSet() == InstructionSet::SSE4_1)
+			{
+				kernel = Brighten_SSE4_1;
+			}
+
+		# endif
+
+			ForEachBand(image, [=](Color* p, const size_t count) { kernel(p, count, level); });
+		}
+
+		void ApplyTable(Image& image, const uint8(&table)[256])
+		{
+			// 表引きは SIMD 化による効果が小さいため、並列化のみを行う
+			ForEachBand(image, [&table](Color* p, const size_t count) { ApplyTable_Reference(p, count, table); });
+		}
+
+		void SwapRB(Image& image)
+		{
+			ForEachBand(image, SIV3D_SELECT_KERNEL(SwapRB));
+		}
+
+	# undef SIV3D_SELECT_KERNEL
+	}
+}
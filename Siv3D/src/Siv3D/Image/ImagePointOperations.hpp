@@ -0,0 +1,33 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+# pragma once
+# include <Siv3D/Image.hpp>
+
+namespace s3d
+{
+	// Image の画素ごとの処理。
+	// 命令セットに応じて AVX2 / SSE4.1 / 参照実装を選び、大きな画像は行のまとまりごとに並列に処理する
+	namespace ImagePointOperations
+	{
+		void Negate(Image& image);
+
+		void Grayscale(Image& image);
+
+		void Sepia(Image& image);
+
+		void Brighten(Image& image, int32 level);
+
+		// R, G, B をそれぞれ table で置き換える
+		void ApplyTable(Image& image, const uint8 (&table)[256]);
+
+		void SwapRB(Image& image);
+	}
+}
@@ -28,6 +28,7 @@
 # include <Siv3D/ImageFormat/WebPEncoder.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 # include "ImagePainting.hpp"
+# include "ImagePointOperations.hpp"
 
 namespace s3d
 {
@@ -812,16 +813,7 @@ namespace s3d
 
 	Image& Image::RGBAtoBGRA()
 	{
-		Color* p = m_data.data();
-		const Color* pEnd = (p + num_pixels());
-
-		while (p != pEnd)
-		{
-			const uint8 t = p->r;
-			p->r = p->b;
-			p->b = t;
-			++p;
-		}
+		ImagePointOperations::SwapRB(*this);
 
 		return *this;
 	}
@@ -946,10 +938,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = ~pixel;
-			}
+			ImagePointOperations::Negate(*this);
 		}
 
 		return *this;
@@ -969,10 +958,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				pixel = ~pixel;
-			}
+			ImagePointOperations::Negate(image);
 
 			return image;
 		}
@@ -995,13 +981,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				const uint8 gray = pixel.grayscale0_255();
-				pixel.r = gray;
-				pixel.g = gray;
-				pixel.b = gray;
-			}
+			ImagePointOperations::Grayscale(*this);
 		}
 
 		return *this;
@@ -1021,13 +1001,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				const uint8 gray = pixel.grayscale0_255();
-				pixel.r = gray;
-				pixel.g = gray;
-				pixel.b = gray;
-			}
+			ImagePointOperations::Grayscale(image);
 
 			return image;
 		}
@@ -1050,10 +1024,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = detail::MakeSepia(pixel);
-			}
+			ImagePointOperations::Sepia(*this);
 		}
 
 		return *this;
@@ -1073,10 +1044,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				pixel = detail::MakeSepia(pixel);
-			}
+			ImagePointOperations::Sepia(image);
 
 			return image;
 		}
@@ -1102,12 +1070,7 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitPosterizeTable(level, colorTable);
 
-			for (auto& pixel : m_data)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			ImagePointOperations::ApplyTable(*this, colorTable);
 		}
 
 		return *this;
@@ -1130,12 +1093,7 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitPosterizeTable(level, colorTable);
 
-			for (auto& pixel : image)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			ImagePointOperations::ApplyTable(image, colorTable);
 
 			return image;
 		}
@@ -1158,24 +1116,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			if (level < 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
-					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
-					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
-				}
-			}
-			else if (level > 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
-					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
-					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
-				}
-			}
+			ImagePointOperations::Brighten(*this, level);
 		}
 
 		return *this;
@@ -1195,24 +1136,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			if (level < 0)
-			{
-				for (auto& pixel : image)
-				{
-					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
-					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
-					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
-				}
-			}
-			else if (level > 0)
-			{
-				for (auto& pixel : image)
-				{
-					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
-					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
-					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
-				}
-			}
+			ImagePointOperations::Brighten(image, level);
 
 			return image;
 		}
@@ -1805,12 +1729,7 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitGammmaTable(gamma, colorTable);
 
-			for (auto& pixel : m_data)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			ImagePointOperations::ApplyTable(*this, colorTable);
 		}
 
 		return *this;
@@ -1833,12 +1752,7 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitGammmaTable(gamma, colorTable);
 
-			for (auto& pixel : image)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			ImagePointOperations::ApplyTable(image, colorTable);
 
 			return image;
 		}
@@ -12,6 +12,7 @@
 # include <Siv3D/FileSystem.hpp>
 # include "CImageDecoder.hpp"
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfileZone.hpp>
 # include <Siv3D/ImageFormat/BMPDecoder.hpp>
 # include <Siv3D/ImageFormat/PNGDecoder.hpp>
 # include <Siv3D/ImageFormat/JPEGDecoder.hpp>
@@ -70,6 +71,8 @@ namespace s3d
 
 	Image CImageDecoder::decode(IReader& reader, const FilePathView pathHint, const ImageFormat imageFormat)
 	{
+		SIV3D_PROFILE_SCOPE(U"ImageDecoder::decode");
+
 		LOG_SCOPED_TRACE(U"CImageDecoder::decode()");
 
 		auto it = findDecoder(imageFormat);
@@ -89,6 +92,52 @@ namespace s3d
 		return (*it)->decode(reader, pathHint);
 	}
 
+	bool CImageDecoder::decodeInto(IReader& reader, const FilePathView pathHint, Image& image, const ImageFormat imageFormat)
+	{
+		SIV3D_PROFILE_SCOPE(U"ImageDecoder::decodeInto");
+
+		LOG_SCOPED_TRACE(U"CImageDecoder::decodeInto()");
+
+		auto it = findDecoder(imageFormat);
+
+		if (it == m_decoders.end())
+		{
+			it = findDecoder(reader, pathHint);
+
+			if (it == m_decoders.end())
+			{
+				return false;
+			}
+		}
+
+		LOG_TRACE(U"Image decoder name: {}"_fmt((*it)->name()));
+
+		return (*it)->decodeInto(reader, pathHint, image);
+	}
+
+	Image CImageDecoder::decodeReduced(IReader& reader, const FilePathView pathHint, const Size& maxSize, const ImageFormat imageFormat)
+	{
+		SIV3D_PROFILE_SCOPE(U"ImageDecoder::decodeReduced");
+
+		LOG_SCOPED_TRACE(U"CImageDecoder::decodeReduced()");
+
+		auto it = findDecoder(imageFormat);
+
+		if (it == m_decoders.end())
+		{
+			it = findDecoder(reader, pathHint);
+
+			if (it == m_decoders.end())
+			{
+				return{};
+			}
+		}
+
+		LOG_TRACE(U"Image decoder name: {}"_fmt((*it)->name()));
+
+		return (*it)->decodeReduced(reader, pathHint, maxSize);
+	}
+
 	Grid<uint16> CImageDecoder::decodeGray16(IReader& reader, const FilePathView pathHint, const ImageFormat imageFormat)
 	{
 		LOG_SCOPED_TRACE(U"CImageDecoder::decodeGray16()");
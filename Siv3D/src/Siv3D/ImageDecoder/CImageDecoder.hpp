@@ -39,6 +39,10 @@ namespace s3d
 
 		Image decode(IReader& reader, FilePathView pathHint, ImageFormat imageFormat) override;
 
+		bool decodeInto(IReader& reader, FilePathView pathHint, Image& image, ImageFormat imageFormat) override;
+
+		Image decodeReduced(IReader& reader, FilePathView pathHint, const Size& maxSize, ImageFormat imageFormat) override;
+
 		Grid<uint16> decodeGray16(IReader& reader, FilePathView pathHint, ImageFormat imageFormat) override;
 
 		bool add(std::unique_ptr<IImageDecoder>&& decoder) override;
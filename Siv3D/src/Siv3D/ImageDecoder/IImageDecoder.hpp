@@ -33,6 +33,10 @@ namespace s3d
 
 		virtual Image decode(IReader& reader, FilePathView pathHint, ImageFormat imageFormat) = 0;
 
+		virtual bool decodeInto(IReader& reader, FilePathView pathHint, Image& image, ImageFormat imageFormat) = 0;
+
+		virtual Image decodeReduced(IReader& reader, FilePathView pathHint, const Size& maxSize, ImageFormat imageFormat) = 0;
+
 		virtual Grid<uint16> decodeGray16(IReader& reader, FilePathView pathHint, ImageFormat imageFormat) = 0;
 
 		virtual bool add(std::unique_ptr<IImageDecoder>&& decoder) = 0;
@@ -11,6 +11,7 @@
 
 # include <Siv3D/ImageDecoder.hpp>
 # include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/Threading.hpp>
 # include "IImageDecoder.hpp"
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include <Siv3D/Browser.hpp>
@@ -57,6 +58,86 @@ namespace s3d
 			return SIV3D_ENGINE(ImageDecoder)->decode(reader, {}, imageFormat);
 		}
 
+		bool DecodeInto(const FilePathView path, Image& image, const ImageFormat imageFormat)
+		{
+		# if SIV3D_PLATFORM(WEB)
+			Platform::Web::FetchFile(path);
+		# endif
+
+			BinaryReader reader(path);
+
+			if (not reader)
+			{
+				return false;
+			}
+
+			return SIV3D_ENGINE(ImageDecoder)->decodeInto(reader, path, image, imageFormat);
+		}
+
+		bool DecodeInto(IReader& reader, Image& image, const ImageFormat imageFormat)
+		{
+			return SIV3D_ENGINE(ImageDecoder)->decodeInto(reader, {}, image, imageFormat);
+		}
+
+		Array<Image> DecodeMany(const Array<FilePath>& paths, const ImageFormat imageFormat)
+		{
+			Array<Image> images(paths.size());
+
+		# if SIV3D_PLATFORM(WEB)
+
+			for (size_t i = 0; i < paths.size(); ++i)
+			{
+				images[i] = Decode(paths[i], imageFormat);
+			}
+
+		# else
+
+			// 1 枚ずつタスクにして、大きさの異なる画像が混ざっていても負荷が偏らないようにする
+			Threading::ParallelFor(0, paths.size(), [&](const size_t i)
+			{
+				images[i] = Decode(paths[i], imageFormat);
+			}, 1);
+
+		# endif
+
+			return images;
+		}
+
+		Image DecodeThumbnail(const FilePathView path, const Size& maxSize, const ImageFormat imageFormat)
+		{
+		# if SIV3D_PLATFORM(WEB)
+			Platform::Web::FetchFile(path);
+		# endif
+
+			BinaryReader reader(path);
+
+			if (not reader)
+			{
+				return{};
+			}
+
+			Image image = SIV3D_ENGINE(ImageDecoder)->decodeReduced(reader, path, maxSize, imageFormat);
+
+			if ((maxSize.x < image.width()) || (maxSize.y < image.height()))
+			{
+				return image.fitted(maxSize, AllowScaleUp::No);
+			}
+
+			return image;
+		}
+
+		Image DecodeThumbnail(IReader& reader, const Size& maxSize, const ImageFormat imageFormat)
+		{
+			Image image = SIV3D_ENGINE(ImageDecoder)->decodeReduced(reader, {}, maxSize, imageFormat);
+
+			if ((maxSize.x < image.width()) || (maxSize.y < image.height()))
+			{
+				return image.fitted(maxSize, AllowScaleUp::No);
+			}
+
+			return image;
+		}
+
 		Grid<uint16> DecodeGray16(FilePathView path, const ImageFormat imageFormat)
 		{
 			BinaryReader reader(path);
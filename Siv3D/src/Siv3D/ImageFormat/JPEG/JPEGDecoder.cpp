@@ -11,6 +11,8 @@
 
 # include <Siv3D/ImageFormat/JPEGDecoder.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ScopeGuard.hpp>
+# include <Siv3D/IReader/ReaderBytes.hpp>
 
 # if SIV3D_PLATFORM(WINDOWS) | SIV3D_PLATFORM(MACOS) | SIV3D_PLATFORM(WEB)
 #	include <ThirdParty-prebuilt/libjpeg-turbo/turbojpeg.h>
@@ -20,6 +22,106 @@
 
 namespace s3d
 {
+	namespace detail
+	{
+		// maxSize に収まるよう縮小した大きさを下回らない範囲で、最も小さくなる DCT スケーリングの係数を選ぶ
+		[[nodiscard]]
+		static Size GetReducedSize(const int32 width, const int32 height, const Size& maxSize)
+		{
+			if ((maxSize.x <= 0) || (maxSize.y <= 0))
+			{
+				return{ width, height };
+			}
+
+			const double scale = Min({ 1.0, (static_cast<double>(maxSize.x) / width), (static_cast<double>(maxSize.y) / height) });
+			const int32 minWidth = static_cast<int32>(std::ceil(width * scale));
+			const int32 minHeight = static_cast<int32>(std::ceil(height * scale));
+
+			int numScalingFactors = 0;
+			const tjscalingfactor* scalingFactors = ::tjGetScalingFactors(&numScalingFactors);
+
+			Size result{ width, height };
+
+			for (int i = 0; i < numScalingFactors; ++i)
+			{
+				const int32 scaledWidth = TJSCALED(width, scalingFactors[i]);
+				const int32 scaledHeight = TJSCALED(height, scalingFactors[i]);
+
+				if ((minWidth <= scaledWidth) && (minHeight <= scaledHeight)
+					&& ((static_cast<int64>(scaledWidth) * scaledHeight) < (static_cast<int64>(result.x) * result.y)))
+				{
+					result.set(scaledWidth, scaledHeight);
+				}
+			}
+
+			return result;
+		}
+
+		static bool DecodeJPEG(IReader& reader, Image& image, const Optional<Size>& maxSize)
+		{
+			const int64 size = (reader.size() - reader.getPos());
+
+			// メモリマップされたファイルやメモリ上のデータは、コピーせずにデコードする
+			const ReaderBytes buffer{ reader };
+
+			if (static_cast<int64>(buffer.size()) != size)
+			{
+				return false;
+			}
+
+			// turbojpeg の API は const でないポインタを受け取るが、入力を書き換えることはない
+			unsigned char* const pData = const_cast<unsigned char*>(buffer.data());
+
+			tjhandle tj = ::tjInitDecompress();
+
+			if (not tj)
+			{
+				return false;
+			}
+
+			ScopeGuard cleanup = [&]()
+			{
+				::tjDestroy(tj);
+			};
+
+			int width, height;
+
+			if (::tjDecompressHeader(tj, pData, static_cast<unsigned long>(size), &width, &height) != 0)
+			{
+				return false;
+			}
+
+			if ((Image::MaxWidth < width) || (Image::MaxHeight < height))
+			{
+				LOG_FAIL(U"JPEGDecoder: Image size {}x{} is not supported"_fmt(
+					width, height));
+				return false;
+			}
+
+			const Size decodedSize = (maxSize ? GetReducedSize(width, height, *maxSize) : Size{ width, height });
+
+			// 容量が足りる場合は、image のメモリを再確保せずに直接書き込む
+			image.resize(decodedSize);
+
+			// 破損したデータでも途中までの結果を返すため、戻り値は確認しない
+			::tjDecompress2(
+				tj,
+				pData,
+				static_cast<unsigned long>(size),
+				image.dataAsUint8(),
+				image.width(),
+				image.stride(),
+				image.height(),
+				TJPF_RGBX,
+				0);
+
+			LOG_VERBOSE(U"Image ({}x{}) decoded"_fmt(
+				image.width(), image.height()));
+
+			return true;
+		}
+	}
+
 	StringView JPEGDecoder::name() const
 	{
 		return U"JPEG"_sv;
@@ -123,37 +225,33 @@ namespace s3d
 	{
 		LOG_SCOPED_TRACE(U"JPEGDecoder::decode()");
 
-		const int64 size = reader.size();
-
-		uint8* buffer = static_cast<uint8*>(std::malloc(static_cast<size_t>(size)));
-
-		reader.read(buffer, size);
-
-		int width, height;
+		Image image;
 
-		tjhandle tj = ::tjInitDecompress();
+		if (not detail::DecodeJPEG(reader, image, none))
+		{
+			return{};
+		}
 
-		::tjDecompressHeader(tj, buffer, static_cast<unsigned long>(size), &width, &height);
+		return image;
+	}
 
-		Image image(width, height);
+	bool JPEGDecoder::decodeInto(IReader& reader, const FilePathView, Image& image) const
+	{
+		LOG_SCOPED_TRACE(U"JPEGDecoder::decodeInto()");
 
-		::tjDecompress(
-			tj,
-			buffer,
-			static_cast<unsigned long>(size),
-			image.dataAsUint8(),
-			image.width(),
-			image.stride(),
-			image.height(),
-			sizeof(Color),
-			0);
+		return detail::DecodeJPEG(reader, image, none);
+	}
 
-		::tjDestroy(tj);
+	Image JPEGDecoder::decodeReduced(IReader& reader, const FilePathView, const Size& maxSize) const
+	{
+		LOG_SCOPED_TRACE(U"JPEGDecoder::decodeReduced()");
 
-		std::free(buffer);
+		Image image;
 
-		LOG_VERBOSE(U"Image ({}x{}) decoded"_fmt(
-			width, height));
+		if (not detail::DecodeJPEG(reader, image, maxSize))
+		{
+			return{};
+		}
 
 		return image;
 	}
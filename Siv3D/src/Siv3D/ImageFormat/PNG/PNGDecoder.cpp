@@ -134,16 +134,28 @@ namespace s3d
 		return IImageDecoder::decode(path);
 	}
 
-	Image PNGDecoder::decode(IReader& reader, const FilePathView) const
+	Image PNGDecoder::decode(IReader& reader, const FilePathView pathHint) const
 	{
-		LOG_SCOPED_TRACE(U"PNGDecoder::decode()");
+		Image image;
+
+		if (not decodeInto(reader, pathHint, image))
+		{
+			return{};
+		}
+
+		return image;
+	}
+
+	bool PNGDecoder::decodeInto(IReader& reader, const FilePathView, Image& image) const
+	{
+		LOG_SCOPED_TRACE(U"PNGDecoder::decodeInto()");
 
 		// png_ptr
 		png_structp png_ptr = ::png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
 		{
 			if (!png_ptr)
 			{
-				return{};
+				return false;
 			}
 		}
 
@@ -157,7 +169,7 @@ namespace s3d
 		{
 			if (!info_ptr)
 			{
-				return{};
+				return false;
 			}
 		}
 
@@ -179,9 +191,9 @@ namespace s3d
 
 		if ((Image::MaxWidth < width) || (Image::MaxHeight < height))
 		{
-			LOG_FAIL(U"PNGDecoder::decode(): Image size {}x{} is not supported"_fmt(
+			LOG_FAIL(U"PNGDecoder::decodeInto(): Image size {}x{} is not supported"_fmt(
 				width, height));
-			return{};
+			return false;
 		}
 
 		if (iColorType == PNG_COLOR_TYPE_PALETTE)
@@ -237,7 +249,8 @@ namespace s3d
 
 		::png_get_IHDR(png_ptr, info_ptr, &width, &height, &iBitDepth, &iColorType, nullptr, nullptr, nullptr);
 
-		Image image(width, height);
+		// 容量が足りる場合は、image のメモリを再確保せずに直接書き込む
+		image.resize(width, height);
 
 		Array<uint8*> ppbRowPointers(height);
 		{
@@ -258,7 +271,7 @@ namespace s3d
 		LOG_VERBOSE(U"Image ({}x{}) decoded"_fmt(
 			width, height));
 
-		return image;
+		return true;
 	}
 
 	Grid<uint16> PNGDecoder::decodeGray16(const FilePathView path) const
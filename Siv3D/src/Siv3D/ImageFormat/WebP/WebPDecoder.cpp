@@ -11,6 +11,7 @@
 
 # include <Siv3D/ImageFormat/WebPDecoder.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/IReader/ReaderBytes.hpp>
 
 # if SIV3D_PLATFORM(WINDOWS) | SIV3D_PLATFORM(MACOS) | SIV3D_PLATFORM(WEB)
 #	include <ThirdParty-prebuilt/libwebp/decode.h>
@@ -85,9 +86,21 @@ namespace s3d
 		return IImageDecoder::decode(path);
 	}
 
-	Image WebPDecoder::decode(IReader& reader, const FilePathView) const
+	Image WebPDecoder::decode(IReader& reader, const FilePathView pathHint) const
 	{
-		LOG_SCOPED_TRACE(U"WebPDecoder::decode()");
+		Image image;
+
+		if (not decodeInto(reader, pathHint, image))
+		{
+			return{};
+		}
+
+		return image;
+	}
+
+	bool WebPDecoder::decodeInto(IReader& reader, const FilePathView, Image& image) const
+	{
+		LOG_SCOPED_TRACE(U"WebPDecoder::decodeInto()");
 
 		WebPDecoderConfig config;
 		WebPDecBuffer* const output_buffer = &config.output;
@@ -95,54 +108,53 @@ namespace s3d
 
 		if (not ::WebPInitDecoderConfig(&config))
 		{
-			return{};
+			return false;
 		}
 
 		config.options.use_threads = true;
-		config.output.colorspace = MODE_RGBA;
 
-		const int64 dataSize = reader.size();
-		Array<uint8> buffer(dataSize);
+		const int64 dataSize = (reader.size() - reader.getPos());
+		const ReaderBytes buffer{ reader };
 
-		if (dataSize != reader.read(buffer.data(), dataSize))
+		if (dataSize != static_cast<int64>(buffer.size()))
 		{
-			return{};
+			return false;
 		}
 
 		if (::WebPGetFeatures(static_cast<const uint8*>(buffer.data()), dataSize, bitstream) != VP8_STATUS_OK)
 		{
-			return{};
-		}
-
-		if (::WebPDecode(static_cast<const uint8*>(buffer.data()), dataSize, &config) != VP8_STATUS_OK)
-		{
-			return{};
+			return false;
 		}
 
-		const int32 width = output_buffer->width;
-		const int32 height = output_buffer->height;
+		const int32 width = bitstream->width;
+		const int32 height = bitstream->height;
 
 		if ((Image::MaxWidth < width) || (Image::MaxHeight < height))
 		{
-			return{};
+			return false;
 		}
 
-		const size_t size = output_buffer->u.RGBA.size;
-
-		Image image(width, height);
+		// libwebp の内部バッファを経由せず、image に直接デコードする
+		image.resize(width, height);
 
-		if (image.size_bytes() != size)
-		{
-			return image;
-		}
+		config.output.colorspace = MODE_RGBA;
+		config.output.is_external_memory = 1;
+		config.output.u.RGBA.rgba = image.dataAsUint8();
+		config.output.u.RGBA.stride = static_cast<int>(image.stride());
+		config.output.u.RGBA.size = image.size_bytes();
 
-		std::memcpy(image.data(), output_buffer->u.RGBA.rgba, size);
+		const VP8StatusCode result = ::WebPDecode(static_cast<const uint8*>(buffer.data()), dataSize, &config);
 
 		::WebPFreeDecBuffer(output_buffer);
 
+		if (result != VP8_STATUS_OK)
+		{
+			return false;
+		}
+
 		LOG_VERBOSE(U"Image ({}x{}) decoded"_fmt(
 			width, height));
 
-		return image;
+		return true;
 	}
 }
@@ -14,9 +14,13 @@
 # include <Siv3D/JSONValidator.hpp>
 # include <Siv3D/TextReader.hpp>
 # include <Siv3D/TextWriter.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
 # include <Siv3D/Unicode.hpp>
+# include <Siv3D/IReader/ReaderBytes.hpp>
 # include <ThirdParty/nlohmann/json.hpp>
 # include <ThirdParty/nlohmann/json-schema.hpp>
+# include <ThirdParty/miniutf/miniutf.hpp>
 
 namespace std
 {
@@ -1228,8 +1232,232 @@ namespace s3d
 		return JSON(Invalid_{});
 	}
 
+	namespace detail
+	{
+		[[nodiscard]]
+		static std::string_view ToStringView(const Byte* data, const size_t size) noexcept
+		{
+			return{ reinterpret_cast<const char*>(data), size };
+		}
+
+		[[nodiscard]]
+		static std::string_view RemoveUTF8BOM(std::string_view utf8) noexcept
+		{
+			if (utf8.starts_with("\xEF\xBB\xBF"))
+			{
+				utf8.remove_prefix(3);
+			}
+
+			return utf8;
+		}
+
+		// 最初の不正な UTF-8 のバイトの位置を返す。見つからなければ std::string_view::npos
+		[[nodiscard]]
+		static size_t FindInvalidUTF8(const std::string_view utf8) noexcept
+		{
+			const char8* const pSrc = utf8.data();
+			const size_t size = utf8.size();
+			size_t i = 0;
+
+			while (i < size)
+			{
+				if (static_cast<uint8>(pSrc[i]) < 0x80)
+				{
+					++i;
+					continue;
+				}
+
+				const offset_pt res = utf8_decode_check((pSrc + i), (size - i));
+
+				// サロゲートの符号位置は nlohmann::json が受け付けないので、不正なバイトとして扱う
+				if ((res.offset < 0)
+					|| ((0xD800 <= res.codePoint) && (res.codePoint < 0xE000)))
+				{
+					return i;
+				}
+
+				i += res.offset;
+			}
+
+			return std::string_view::npos;
+		}
+
+		// pos 以降の不正なバイトを、Unicode::FromUTF8 と同じく 1 バイトずつ置換文字 (U+FFFD) に置き換える
+		[[nodiscard]]
+		static std::string ReplaceInvalidUTF8(std::string_view utf8, size_t pos)
+		{
+			std::string result;
+			result.reserve(utf8.size() + 16);
+
+			while (pos != std::string_view::npos)
+			{
+				result.append(utf8.substr(0, pos));
+				result.append("\xEF\xBF\xBD");
+
+				utf8.remove_prefix(pos + 1);
+				pos = FindInvalidUTF8(utf8);
+			}
+
+			result.append(utf8);
+
+			return result;
+		}
+
+		[[nodiscard]]
+		static bool HasUTF16BOM(const std::string_view s) noexcept
+		{
+			return (s.starts_with("\xFF\xFE") || s.starts_with("\xFE\xFF"));
+		}
+
+		// ファイルをメモリマップし、UTF-8 であれば f(std::string_view) を呼ぶ。呼ばなかった場合は false を返す
+		template <class Fty>
+		[[nodiscard]]
+		static bool MapUTF8(const FilePathView path, Fty f)
+		{
+			// 埋め込みリソースはメモリマップできない
+			if (FileSystem::IsResourcePath(path))
+			{
+				return false;
+			}
+
+			const MemoryMappedFileView view{ path };
+
+			if ((not view) || (view.mappedSize() == 0))
+			{
+				return false;
+			}
+
+			const std::string_view data = ToStringView(view.data(), view.mappedSize());
+
+			if (HasUTF16BOM(data))
+			{
+				return false;
+			}
+
+			f(data);
+
+			return true;
+		}
+
+		// JSONVisitor を nlohmann::json の SAX インタフェースに合わせるクラス
+		class JSONVisitorAdapter
+		{
+		public:
+
+			using string_t = nlohmann::json::string_t;
+
+			explicit JSONVisitorAdapter(JSONVisitor& visitor)
+				: m_visitor{ visitor } {}
+
+			bool null()
+			{
+				return m_visitor.null();
+			}
+
+			bool boolean(const bool value)
+			{
+				return m_visitor.boolean(value);
+			}
+
+			bool number_integer(const nlohmann::json::number_integer_t value)
+			{
+				return m_visitor.signedInteger(value);
+			}
+
+			bool number_unsigned(const nlohmann::json::number_unsigned_t value)
+			{
+				return m_visitor.unsignedInteger(value);
+			}
+
+			bool number_float(const nlohmann::json::number_float_t value, const string_t&)
+			{
+				return m_visitor.floatingPoint(value);
+			}
+
+			bool string(string_t& value)
+			{
+				return m_visitor.string(widen(value));
+			}
+
+			bool binary(nlohmann::json::binary_t&)
+			{
+				return true;
+			}
+
+			bool start_object(std::size_t)
+			{
+				return m_visitor.startObject();
+			}
+
+			bool key(string_t& value)
+			{
+				return m_visitor.key(widen(value));
+			}
+
+			bool end_object()
+			{
+				return m_visitor.endObject();
+			}
+
+			bool start_array(std::size_t)
+			{
+				return m_visitor.startArray();
+			}
+
+			bool end_array()
+			{
+				return m_visitor.endArray();
+			}
+
+			bool parse_error(const std::size_t position, const std::string&, const nlohmann::detail::exception& e)
+			{
+				m_visitor.parseError(position, Unicode::Widen(e.what()));
+				return false;
+			}
+
+		private:
+
+			JSONVisitor& m_visitor;
+
+			// 文字列ごとのメモリアロケーションを避けるためのバッファ
+			String m_buffer;
+
+			[[nodiscard]]
+			StringView widen(const string_t& s)
+			{
+				const bool isASCII = std::all_of(s.begin(), s.end(), [](const char ch) { return (static_cast<unsigned char>(ch) < 0x80); });
+
+				if (isASCII)
+				{
+					m_buffer.resize(s.size());
+
+					for (size_t i = 0; i < s.size(); ++i)
+					{
+						m_buffer[i] = static_cast<char32>(s[i]);
+					}
+				}
+				else
+				{
+					m_buffer = Unicode::FromUTF8(s);
+				}
+
+				return m_buffer;
+			}
+		};
+	}
+
 	JSON JSON::Load(const FilePathView path, const AllowExceptions allowExceptions)
 	{
+		// UTF-8 のファイルは String を経由せずに直接パースする
+		{
+			JSON value{ Invalid_{} };
+
+			if (detail::MapUTF8(path, [&](const std::string_view utf8) { value = ParseUTF8(utf8, allowExceptions); }))
+			{
+				return value;
+			}
+		}
+
 		TextReader reader{ path };
 
 		if (not reader)
@@ -1247,6 +1475,20 @@ namespace s3d
 
 	JSON JSON::Load(std::unique_ptr<IReader>&& reader, const AllowExceptions allowExceptions)
 	{
+		if (reader && reader->isOpen())
+		{
+			const int64 startPos = reader->getPos();
+			const ReaderBytes buffer{ *reader };
+
+			if (not detail::HasUTF16BOM(buffer.asStringView()))
+			{
+				return ParseUTF8(buffer.asStringView(), allowExceptions);
+			}
+
+			// UTF-16 の場合は TextReader で読み直す
+			reader->setPos(startPos);
+		}
+
 		TextReader textReader{ std::move(reader) };
 
 		if (not textReader)
@@ -1284,6 +1526,72 @@ namespace s3d
 		return value;
 	}
 
+	JSON JSON::ParseUTF8(std::string_view utf8, const AllowExceptions allowExceptions)
+	{
+		utf8 = detail::RemoveUTF8BOM(utf8);
+
+		// 不正な UTF-8 を含む場合は、String を経由する読み込みと同じく置換文字 (U+FFFD) に置き換えてからパースする
+		if (const size_t invalidPos = detail::FindInvalidUTF8(utf8);
+			invalidPos != std::string_view::npos)
+		{
+			return ParseUTF8(detail::ReplaceInvalidUTF8(utf8, invalidPos), allowExceptions);
+		}
+
+		JSON value{ Invalid_{} };
+
+		try
+		{
+			value.m_detail = std::make_shared<detail::JSONDetail>(detail::JSONDetail::Value(), nlohmann::json::parse(utf8.begin(), utf8.end()));
+			value.m_isValid = true;
+		}
+		catch (const std::exception& e)
+		{
+			if (not allowExceptions)
+			{
+				return JSON::Invalid();
+			}
+
+			throw Error{ U"JSON::ParseUTF8(): " + Unicode::Widen(e.what()) };
+		}
+
+		return value;
+	}
+
+	bool JSON::Visit(const FilePathView path, JSONVisitor& visitor)
+	{
+		bool result = false;
+
+		if (detail::MapUTF8(path, [&](const std::string_view utf8) { result = VisitUTF8(utf8, visitor); }))
+		{
+			return result;
+		}
+
+		TextReader reader{ path };
+
+		if (not reader)
+		{
+			return false;
+		}
+
+		return VisitUTF8(Unicode::ToUTF8(reader.readAll()), visitor);
+	}
+
+	bool JSON::VisitUTF8(std::string_view utf8, JSONVisitor& visitor)
+	{
+		utf8 = detail::RemoveUTF8BOM(utf8);
+
+		// ParseUTF8() と同じく、不正な UTF-8 は置換文字 (U+FFFD) に置き換えてからパースする
+		if (const size_t invalidPos = detail::FindInvalidUTF8(utf8);
+			invalidPos != std::string_view::npos)
+		{
+			return VisitUTF8(detail::ReplaceInvalidUTF8(utf8, invalidPos), visitor);
+		}
+
+		detail::JSONVisitorAdapter adapter{ visitor };
+
+		return nlohmann::json::sax_parse(utf8.begin(), utf8.end(), &adapter);
+	}
+
 	JSON JSON::FromBSON(const Blob& bson, const AllowExceptions allowExceptions)
 	{
 		JSON value{ Invalid_{} };
@@ -130,4 +130,20 @@ namespace s3d
 
 		return readSize;
 	}
+
+	bool MemoryReader::supportsReadView() const noexcept
+	{
+		return true;
+	}
+
+	std::span<const Byte> MemoryReader::readView(const int64 size)
+	{
+		const int64 readSize = Clamp<int64>(size, 0, (m_blob.size() - m_pos));
+
+		const std::span<const Byte> view{ (m_blob.data() + m_pos), static_cast<size_t>(readSize) };
+
+		m_pos += readSize;
+
+		return view;
+	}
 }
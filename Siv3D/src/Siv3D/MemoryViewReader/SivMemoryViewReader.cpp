@@ -127,4 +127,20 @@ namespace s3d
 
 		return readSize;
 	}
+
+	bool MemoryViewReader::supportsReadView() const noexcept
+	{
+		return true;
+	}
+
+	std::span<const Byte> MemoryViewReader::readView(const int64 size)
+	{
+		const int64 readSize = Clamp<int64>(size, 0, (m_size - m_pos));
+
+		const std::span<const Byte> view{ (m_ptr + m_pos), static_cast<size_t>(readSize) };
+
+		m_pos += readSize;
+
+		return view;
+	}
 }
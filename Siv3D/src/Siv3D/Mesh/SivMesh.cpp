@@ -609,6 +609,59 @@ namespace s3d
 	}
 
 
+	void Mesh::drawInstanced(const Array<Mat4x4>& transforms, const ColorF& color) const
+	{
+		drawInstanced(transforms, PhongMaterial{ color });
+	}
+
+	void Mesh::drawInstanced(const Array<Mat4x4>& transforms, const Array<ColorF>& colors) const
+	{
+		drawInstanced(transforms, PhongMaterial{}, colors);
+	}
+
+	void Mesh::drawInstanced(const Array<Mat4x4>& transforms, const PhongMaterial& material) const
+	{
+		const uint32 indexCount = static_cast<uint32>(SIV3D_ENGINE(Mesh)->getIndexCount(m_handle->id()));
+
+		SIV3D_ENGINE(Renderer3D)->addMeshInstances(0, indexCount, *this, material, transforms.data(), nullptr, transforms.size());
+	}
+
+	void Mesh::drawInstanced(const Array<Mat4x4>& transforms, const PhongMaterial& material, const Array<ColorF>& colors) const
+	{
+		const uint32 indexCount = static_cast<uint32>(SIV3D_ENGINE(Mesh)->getIndexCount(m_handle->id()));
+
+		const size_t count = Min(transforms.size(), colors.size());
+
+		SIV3D_ENGINE(Renderer3D)->addMeshInstances(0, indexCount, *this, material, transforms.data(), colors.data(), count);
+	}
+
+	void Mesh::drawInstanced(const Array<Mat4x4>& transforms, const Texture& texture, const ColorF& color) const
+	{
+		drawInstanced(transforms, texture, PhongMaterial{ color, HasDiffuseTexture::Yes });
+	}
+
+	void Mesh::drawInstanced(const Array<Mat4x4>& transforms, const Texture& texture, const Array<ColorF>& colors) const
+	{
+		drawInstanced(transforms, texture, PhongMaterial{ Palette::White, HasDiffuseTexture::Yes }, colors);
+	}
+
+	void Mesh::drawInstanced(const Array<Mat4x4>& transforms, const Texture& texture, const PhongMaterial& material) const
+	{
+		const uint32 indexCount = static_cast<uint32>(SIV3D_ENGINE(Mesh)->getIndexCount(m_handle->id()));
+
+		SIV3D_ENGINE(Renderer3D)->addTexturedMeshInstances(0, indexCount, *this, texture, material, transforms.data(), nullptr, transforms.size());
+	}
+
+	void Mesh::drawInstanced(const Array<Mat4x4>& transforms, const Texture& texture, const PhongMaterial& material, const Array<ColorF>& colors) const
+	{
+		const uint32 indexCount = static_cast<uint32>(SIV3D_ENGINE(Mesh)->getIndexCount(m_handle->id()));
+
+		const size_t count = Min(transforms.size(), colors.size());
+
+		SIV3D_ENGINE(Renderer3D)->addTexturedMeshInstances(0, indexCount, *this, texture, material, transforms.data(), colors.data(), count);
+	}
+
+
 	void Mesh::swap(Mesh& other) noexcept
 	{
 		m_handle.swap(other.m_handle);
@@ -0,0 +1,266 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/MeshInstanceBatch.hpp>
+# include <Siv3D/Model.hpp>
+# include <Siv3D/TextureAsset.hpp>
+# include <Siv3D/ViewFrustum.hpp>
+# include <Siv3D/Graphics3D.hpp>
+# include <Siv3D/Threading.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// この数以上のインスタンスを持つまとまりは、視錐台カリングを並列に行う
+		constexpr size_t ParallelCullingThreshold = 4096;
+
+		[[nodiscard]]
+		static bool SameMaterial(const PhongMaterial& a, const PhongMaterial& b) noexcept
+		{
+			// diffuseColor はインスタンスごとの色で置き換えられるため比較しない
+			return (a.ambientColor == b.ambientColor)
+				&& (a.specularColor == b.specularColor)
+				&& (a.emissionColor == b.emissionColor)
+				&& (a.shininess == b.shininess)
+				&& (a.hasDiffuseTexture == b.hasDiffuseTexture);
+		}
+
+		[[nodiscard]]
+		static bool Intersects(const ViewFrustum& frustum, const Mat4x4& world, const Sphere& sphere) noexcept
+		{
+			const Float3 center{ sphere.center };
+			const float r = static_cast<float>(sphere.r);
+			const Float3 c = world.transformPoint(center);
+
+			// 拡大率が最大の軸に合わせて半径を拡大する
+			const float sx = (world.transformPoint(center + Float3{ r, 0, 0 }) - c).lengthSq();
+			const float sy = (world.transformPoint(center + Float3{ 0, r, 0 }) - c).lengthSq();
+			const float sz = (world.transformPoint(center + Float3{ 0, 0, r }) - c).lengthSq();
+
+			return frustum.intersects(Sphere{ c, std::sqrt(Max({ sx, sy, sz })) });
+		}
+	}
+
+	MeshInstanceBatch& MeshInstanceBatch::add(const Mesh& mesh, const Mat4x4& transform, const ColorF& color)
+	{
+		return add(mesh, transform, PhongMaterial{ color });
+	}
+
+	MeshInstanceBatch& MeshInstanceBatch::add(const Mesh& mesh, const Mat4x4& transform, const PhongMaterial& material)
+	{
+		Batch& batch = getBatch(mesh, nullptr, material);
+		batch.transforms << transform;
+		batch.colors << material.diffuseColor;
+		++m_instanceCount;
+		return *this;
+	}
+
+	MeshInstanceBatch& MeshInstanceBatch::add(const Mesh& mesh, const Texture& texture, const Mat4x4& transform, const ColorF& color)
+	{
+		return add(mesh, texture, transform, PhongMaterial{ color, HasDiffuseTexture::Yes });
+	}
+
+	MeshInstanceBatch& MeshInstanceBatch::add(const Mesh& mesh, const Texture& texture, const Mat4x4& transform, const PhongMaterial& material)
+	{
+		Batch& batch = getBatch(mesh, &texture, material);
+		batch.transforms << transform;
+		batch.colors << material.diffuseColor;
+		++m_instanceCount;
+		return *this;
+	}
+
+	MeshInstanceBatch& MeshInstanceBatch::add(const Model& model, const Mat4x4& transform)
+	{
+		const auto& materials = model.materials();
+
+		for (const auto& object : model.objects())
+		{
+			for (const auto& part : object.parts)
+			{
+				const Material material = (part.materialID ? materials[*part.materialID] : Material{});
+
+				if (material.diffuseTextureName)
+				{
+					add(part.mesh, TextureAsset(material.diffuseTextureName), transform, PhongMaterial{ material, HasDiffuseTexture::Yes });
+				}
+				else
+				{
+					add(part.mesh, transform, PhongMaterial{ material, HasDiffuseTexture::No });
+				}
+			}
+		}
+
+		return *this;
+	}
+
+	void MeshInstanceBatch::clear() noexcept
+	{
+		for (auto& batch : m_batches)
+		{
+			batch.transforms.clear();
+			batch.colors.clear();
+		}
+
+		m_instanceCount = 0;
+	}
+
+	void MeshInstanceBatch::release()
+	{
+		m_batches.release();
+		m_visibility.release();
+		m_visibleTransforms.release();
+		m_visibleColors.release();
+		m_lastBatchIndex = 0;
+		m_instanceCount = 0;
+	}
+
+	size_t MeshInstanceBatch::num_instances() const noexcept
+	{
+		return m_instanceCount;
+	}
+
+	size_t MeshInstanceBatch::num_batches() const noexcept
+	{
+		return m_batches.count_if([](const Batch& batch) { return (not batch.transforms.isEmpty()); });
+	}
+
+	void MeshInstanceBatch::draw() const
+	{
+		for (const auto& batch : m_batches)
+		{
+			if (batch.transforms.isEmpty())
+			{
+				continue;
+			}
+
+			if (batch.textured)
+			{
+				batch.mesh.drawInstanced(batch.transforms, batch.texture, batch.material, batch.colors);
+			}
+			else
+			{
+				batch.mesh.drawInstanced(batch.transforms, batch.material, batch.colors);
+			}
+		}
+	}
+
+	size_t MeshInstanceBatch::draw(const ViewFrustum& frustum) const
+	{
+		const Mat4x4 localTransform = Graphics3D::GetLocalTransform();
+
+		size_t drawCount = 0;
+
+		for (const auto& batch : m_batches)
+		{
+			const size_t count = batch.transforms.size();
+
+			if (count == 0)
+			{
+				continue;
+			}
+
+			m_visibility.resize(count);
+
+			const auto cull = [&](const size_t beginIndex, const size_t endIndex)
+			{
+				for (size_t i = beginIndex; i < endIndex; ++i)
+				{
+					m_visibility[i] = detail::Intersects(frustum, (batch.transforms[i] * localTransform), batch.boundingSphere);
+				}
+			};
+
+			if (count < detail::ParallelCullingThreshold)
+			{
+				cull(0, count);
+			}
+			else
+			{
+				Threading::ParallelFor(0, count, cull, detail::ParallelCullingThreshold);
+			}
+
+			m_visibleTransforms.clear();
+			m_visibleColors.clear();
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (m_visibility[i])
+				{
+					m_visibleTransforms << batch.transforms[i];
+					m_visibleColors << batch.colors[i];
+				}
+			}
+
+			if (m_visibleTransforms.isEmpty())
+			{
+				continue;
+			}
+
+			if (batch.textured)
+			{
+				batch.mesh.drawInstanced(m_visibleTransforms, batch.texture, batch.material, m_visibleColors);
+			}
+			else
+			{
+				batch.mesh.drawInstanced(m_visibleTransforms, batch.material, m_visibleColors);
+			}
+
+			drawCount += m_visibleTransforms.size();
+		}
+
+		return drawCount;
+	}
+
+	MeshInstanceBatch::Batch& MeshInstanceBatch::getBatch(const Mesh& mesh, const Texture* texture, const PhongMaterial& material)
+	{
+		const bool textured = (texture != nullptr);
+
+		const auto matches = [&](const Batch& batch)
+		{
+			return (batch.mesh.id() == mesh.id())
+				&& (batch.textured == textured)
+				&& ((not textured) || (batch.texture.id() == texture->id()))
+				&& detail::SameMaterial(batch.material, material);
+		};
+
+		// 同じ組み合わせが続けて追加されることが多いため、直前のまとまりから調べる
+		if ((m_lastBatchIndex < m_batches.size())
+			&& matches(m_batches[m_lastBatchIndex]))
+		{
+			return m_batches[m_lastBatchIndex];
+		}
+
+		for (size_t i = 0; i < m_batches.size(); ++i)
+		{
+			if (matches(m_batches[i]))
+			{
+				m_lastBatchIndex = i;
+				return m_batches[i];
+			}
+		}
+
+		Batch batch;
+		batch.mesh = mesh;
+		batch.textured = textured;
+
+		if (textured)
+		{
+			batch.texture = *texture;
+		}
+
+		batch.material = material;
+		batch.boundingSphere = mesh.boundingSphere();
+
+		m_lastBatchIndex = m_batches.size();
+		m_batches << std::move(batch);
+		return m_batches.back();
+	}
+}
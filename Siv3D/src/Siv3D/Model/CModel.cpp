@@ -10,8 +10,10 @@
 //-----------------------------------------------
 
 # include "CModel.hpp"
+# include "ModelCache.hpp"
 # include <Siv3D/Error.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/FormatLiteral.hpp>
 # include <Siv3D/Browser.hpp>
 
 namespace s3d
@@ -63,6 +65,42 @@ namespace s3d
 		return m_models.add(std::move(model), U"");
 	}
 
+	Model::IDType CModel::createCached(const FilePathView path, const FilePathView cachePath, const ColorOption colorOption)
+	{
+	# if SIV3D_PLATFORM(WEB)
+		Platform::Web::FetchFile(path);
+		Platform::Web::FetchFile(cachePath);
+	# endif
+
+		// 元のファイルが無い場合は、キャッシュをそのまま使う
+		const Optional<uint64> sourceHash = ModelCache::ComputeSourceHash(path);
+
+		if (const auto source = ModelCache::Load(cachePath, sourceHash, colorOption))
+		{
+			return m_models.add(std::make_unique<ModelData>(*source), U"(cached)");
+		}
+
+		if (not sourceHash)
+		{
+			LOG_FAIL(U"CModel::createCached(): Failed to load `{}`"_fmt(path));
+			return Model::IDType::NullAsset();
+		}
+
+		const auto source = ModelData::LoadOBJ(path, colorOption);
+
+		if (not source)
+		{
+			return Model::IDType::NullAsset();
+		}
+
+		if (not ModelCache::Save(cachePath, *source, *sourceHash, colorOption))
+		{
+			LOG_FAIL(U"CModel::createCached(): Failed to save `{}`"_fmt(cachePath));
+		}
+
+		return m_models.add(std::make_unique<ModelData>(*source), U"");
+	}
+
 	void CModel::release(const Model::IDType handleID)
 	{
 		m_models.erase(handleID);
@@ -29,6 +29,8 @@ namespace s3d
 
 		Model::IDType create(FilePathView path, ColorOption colorOption) override;
 
+		Model::IDType createCached(FilePathView path, FilePathView cachePath, ColorOption colorOption) override;
+
 		void release(Model::IDType handleID) override;
 
 		const Array<ModelObject>& getObjects(Model::IDType handleID) override;
@@ -27,6 +27,8 @@ namespace s3d
 
 		virtual Model::IDType create(FilePathView path, ColorOption colorOption) = 0;
 
+		virtual Model::IDType createCached(FilePathView path, FilePathView cachePath, ColorOption colorOption) = 0;
+
 		virtual void release(Model::IDType handleID) = 0;
 
 		virtual const Array<ModelObject>& getObjects(Model::IDType handleID) = 0;
@@ -0,0 +1,504 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/Hash.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "ModelCache.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		constexpr char ModelCacheMagic[8] = { 'S', '3', 'D', 'M', 'O', 'D', 'E', 'L' };
+
+		// フォーマットを変更したら増やす
+		constexpr uint32 ModelCacheVersion = 1;
+
+		constexpr uint32 NoMaterialID = 0xFFFF'FFFFu;
+
+		struct ModelCacheHeader
+		{
+			char magic[8];
+
+			uint32 version;
+
+			uint32 colorOption;
+
+			uint64 sourceHash;
+
+			uint64 payloadSize;
+
+			uint64 payloadHash;
+		};
+		static_assert(sizeof(ModelCacheHeader) == 40);
+
+		static_assert(std::is_trivially_copyable_v<Vertex3D> && (sizeof(Vertex3D) == 32));
+		static_assert(std::is_trivially_copyable_v<TriangleIndex32> && (sizeof(TriangleIndex32) == 12));
+
+		// ファイルの内容すべてについて f(data, size) を呼ぶ。通常のファイルはメモリマップする
+		template <class Fty>
+		[[nodiscard]]
+		static bool ReadFile(const FilePathView path, Fty f)
+		{
+			if (not FileSystem::IsResourcePath(path))
+			{
+				const MemoryMappedFileView view{ path };
+
+				if (view)
+				{
+					f(view.data(), view.mappedSize());
+					return true;
+				}
+			}
+
+			BinaryReader reader{ path };
+
+			if (not reader)
+			{
+				return false;
+			}
+
+			Array<Byte> data(static_cast<size_t>(reader.size()));
+
+			if (reader.read(data.data(), static_cast<int64>(data.size())) != static_cast<int64>(data.size()))
+			{
+				return false;
+			}
+
+			f(data.data(), data.size());
+			return true;
+		}
+
+		// OBJ ファイルの `mtllib` で参照されている MTL ファイルのパス一覧を返す
+		[[nodiscard]]
+		static Array<FilePath> FindMaterialLibraries(const std::string_view obj, const FilePathView parentPath)
+		{
+			Array<FilePath> results;
+
+			size_t pos = 0;
+
+			while (pos < obj.size())
+			{
+				const size_t lineEnd = Min(obj.find('\n', pos), obj.size());
+				std::string_view line = obj.substr(pos, (lineEnd - pos));
+				pos = (lineEnd + 1);
+
+				while ((not line.empty()) && ((line.front() == ' ') || (line.front() == '\t')))
+				{
+					line.remove_prefix(1);
+				}
+
+				if ((not line.starts_with("mtllib")) || (line.size() < 7)
+					|| ((line[6] != ' ') && (line[6] != '\t')))
+				{
+					continue;
+				}
+
+				line.remove_prefix(7);
+
+				while (not line.empty())
+				{
+					const size_t nameBegin = line.find_first_not_of(" \t\r");
+
+					if (nameBegin == std::string_view::npos)
+					{
+						break;
+					}
+
+					const size_t nameEnd = Min(line.find_first_of(" \t\r", nameBegin), line.size());
+					results << (parentPath + Unicode::FromUTF8(line.substr(nameBegin, (nameEnd - nameBegin))));
+					line.remove_prefix(nameEnd);
+				}
+			}
+
+			return results;
+		}
+
+		class ModelCacheWriter
+		{
+		public:
+
+			void write(const void* src, const size_t size)
+			{
+				const Byte* p = static_cast<const Byte*>(src);
+				m_data.insert(m_data.end(), p, (p + size));
+			}
+
+			template <class Type>
+			void write(const Type& value)
+			{
+				static_assert(std::is_trivially_copyable_v<Type>);
+				write(&value, sizeof(Type));
+			}
+
+			void writeString(const StringView s)
+			{
+				const std::string utf8 = Unicode::ToUTF8(s);
+				write(static_cast<uint32>(utf8.size()));
+				write(utf8.data(), utf8.size());
+			}
+
+			template <class Type>
+			void writeArray(const Array<Type>& values)
+			{
+				write(static_cast<uint32>(values.size()));
+				write(values.data(), (values.size() * sizeof(Type)));
+			}
+
+			[[nodiscard]]
+			const Array<Byte>& data() const noexcept
+			{
+				return m_data;
+			}
+
+		private:
+
+			Array<Byte> m_data;
+		};
+
+		class ModelCacheReader
+		{
+		public:
+
+			ModelCacheReader(const Byte* data, const size_t size) noexcept
+				: m_p{ data }
+				, m_end{ data + size } {}
+
+			[[nodiscard]]
+			bool read(void* dst, const size_t size) noexcept
+			{
+				if (static_cast<size_t>(m_end - m_p) < size)
+				{
+					return false;
+				}
+
+				std::memcpy(dst, m_p, size);
+				m_p += size;
+				return true;
+			}
+
+			template <class Type>
+			[[nodiscard]]
+			bool read(Type& value) noexcept
+			{
+				static_assert(std::is_trivially_copyable_v<Type>);
+				return read(&value, sizeof(Type));
+			}
+
+			[[nodiscard]]
+			bool readString(String& s)
+			{
+				uint32 size = 0;
+
+				if ((not read(size)) || (static_cast<size_t>(m_end - m_p) < size))
+				{
+					return false;
+				}
+
+				s = Unicode::FromUTF8(std::string_view{ reinterpret_cast<const char*>(m_p), size });
+				m_p += size;
+				return true;
+			}
+
+			template <class Type>
+			[[nodiscard]]
+			bool readArray(Array<Type>& values)
+			{
+				uint32 count = 0;
+
+				if ((not read(count)) || ((static_cast<size_t>(m_end - m_p) / sizeof(Type)) < count))
+				{
+					return false;
+				}
+
+				values.resize(count);
+				return read(values.data(), (count * sizeof(Type)));
+			}
+
+			[[nodiscard]]
+			bool isEnd() const noexcept
+			{
+				return (m_p == m_end);
+			}
+
+		private:
+
+			const Byte* m_p;
+
+			const Byte* m_end;
+		};
+
+		static void WriteMaterial(ModelCacheWriter& writer, const Material& material)
+		{
+			writer.writeString(material.name);
+			writer.write(material.ambient);
+			writer.write(material.diffuse);
+			writer.write(material.specular);
+			writer.write(material.transmittance);
+			writer.write(material.emission);
+			writer.write(material.shininess);
+			writer.write(material.ior);
+			writer.write(material.dissolve);
+			writer.write(material.illum);
+			writer.writeString(material.ambientTextureName);
+			writer.writeString(material.diffuseTextureName);
+			writer.writeString(material.specularTextureName);
+			writer.writeString(material.normalTextureName);
+		}
+
+		[[nodiscard]]
+		static bool ReadMaterial(ModelCacheReader& reader, Material& material)
+		{
+			return (reader.readString(material.name)
+				&& reader.read(material.ambient)
+				&& reader.read(material.diffuse)
+				&& reader.read(material.specular)
+				&& reader.read(material.transmittance)
+				&& reader.read(material.emission)
+				&& reader.read(material.shininess)
+				&& reader.read(material.ior)
+				&& reader.read(material.dissolve)
+				&& reader.read(material.illum)
+				&& reader.readString(material.ambientTextureName)
+				&& reader.readString(material.diffuseTextureName)
+				&& reader.readString(material.specularTextureName)
+				&& reader.readString(material.normalTextureName));
+		}
+
+		[[nodiscard]]
+		static bool ReadPayload(ModelCacheReader& reader, ModelSource& source)
+		{
+			uint32 materialCount = 0;
+
+			if (not reader.read(materialCount))
+			{
+				return false;
+			}
+
+			source.materials.resize(materialCount);
+
+			for (auto& material : source.materials)
+			{
+				if (not ReadMaterial(reader, material))
+				{
+					return false;
+				}
+			}
+
+			uint32 objectCount = 0;
+
+			if ((not reader.read(source.boundingSphere))
+				|| (not reader.read(source.boundingBox))
+				|| (not reader.read(objectCount)))
+			{
+				return false;
+			}
+
+			source.objects.resize(objectCount);
+
+			for (auto& object : source.objects)
+			{
+				uint32 partCount = 0;
+
+				if ((not reader.readString(object.name))
+					|| (not reader.read(object.boundingSphere))
+					|| (not reader.read(object.boundingBox))
+					|| (not reader.read(partCount)))
+				{
+					return false;
+				}
+
+				object.parts.resize(partCount);
+
+				for (auto& part : object.parts)
+				{
+					uint32 materialID = NoMaterialID;
+
+					if ((not reader.read(materialID))
+						|| (not reader.readArray(part.meshData.vertices))
+						|| (not reader.readArray(part.meshData.indices)))
+					{
+						return false;
+					}
+
+					if (materialID != NoMaterialID)
+					{
+						if (materialCount <= materialID)
+						{
+							return false;
+						}
+
+						part.materialID = materialID;
+					}
+				}
+			}
+
+			return reader.isEnd();
+		}
+	}
+
+	namespace ModelCache
+	{
+		Optional<uint64> ComputeSourceHash(const FilePathView path)
+		{
+			if (not FileSystem::Exists(path))
+			{
+				return none;
+			}
+
+			uint64 hash = 0;
+
+			Array<FilePath> materialLibraries;
+
+			const bool result = detail::ReadFile(path, [&](const Byte* data, const size_t size)
+			{
+				hash = Hash::XXHash3(data, size);
+				materialLibraries = detail::FindMaterialLibraries(std::string_view{ reinterpret_cast<const char*>(data), size }, FileSystem::ParentPath(path));
+			});
+
+			if (not result)
+			{
+				return none;
+			}
+
+			// MTL ファイルの変更もキャッシュの更新が必要になるため、ハッシュに含める
+			for (const auto& materialLibrary : materialLibraries)
+			{
+				uint64 materialHash = 0;
+
+				if (FileSystem::Exists(materialLibrary))
+				{
+					(void)detail::ReadFile(materialLibrary, [&](const Byte* data, const size_t size)
+					{
+						materialHash = Hash::XXHash3(data, size);
+					});
+				}
+
+				const uint64 hashes[2] = { hash, materialHash };
+				hash = Hash::XXHash3(hashes, sizeof(hashes));
+			}
+
+			return hash;
+		}
+
+		bool Save(const FilePathView cachePath, const ModelSource& source, const uint64 sourceHash, const ColorOption colorOption)
+		{
+			detail::ModelCacheWriter writer;
+
+			writer.write(static_cast<uint32>(source.materials.size()));
+
+			for (const auto& material : source.materials)
+			{
+				detail::WriteMaterial(writer, material);
+			}
+
+			writer.write(source.boundingSphere);
+			writer.write(source.boundingBox);
+			writer.write(static_cast<uint32>(source.objects.size()));
+
+			for (const auto& object : source.objects)
+			{
+				writer.writeString(object.name);
+				writer.write(object.boundingSphere);
+				writer.write(object.boundingBox);
+				writer.write(static_cast<uint32>(object.parts.size()));
+
+				for (const auto& part : object.parts)
+				{
+					writer.write(part.materialID ? static_cast<uint32>(*part.materialID) : detail::NoMaterialID);
+					writer.writeArray(part.meshData.vertices);
+					writer.writeArray(part.meshData.indices);
+				}
+			}
+
+			const Array<Byte>& payload = writer.data();
+
+			detail::ModelCacheHeader header{};
+			std::memcpy(header.magic, detail::ModelCacheMagic, sizeof(header.magic));
+			header.version = detail::ModelCacheVersion;
+			header.colorOption = static_cast<uint32>(FromEnum(colorOption));
+			header.sourceHash = sourceHash;
+			header.payloadSize = payload.size();
+			header.payloadHash = Hash::XXHash3(payload.data(), payload.size());
+
+			BinaryWriter file{ cachePath };
+
+			if (not file)
+			{
+				LOG_FAIL(U"ModelCache::Save(): Failed to open `{}`"_fmt(cachePath));
+				return false;
+			}
+
+			return (file.write(header)
+				&& (file.write(payload.data(), static_cast<int64>(payload.size())) == static_cast<int64>(payload.size())));
+		}
+
+		Optional<ModelSource> Load(const FilePathView cachePath, const Optional<uint64>& sourceHash, const ColorOption colorOption)
+		{
+			if (not FileSystem::Exists(cachePath))
+			{
+				return none;
+			}
+
+			Optional<ModelSource> result;
+
+			(void)detail::ReadFile(cachePath, [&](const Byte* data, const size_t size)
+			{
+				detail::ModelCacheHeader header;
+
+				if ((size < sizeof(header))
+					|| (not detail::ModelCacheReader{ data, size }.read(header))
+					|| (std::memcmp(header.magic, detail::ModelCacheMagic, sizeof(header.magic)) != 0)
+					|| (header.version != detail::ModelCacheVersion)
+					|| (header.colorOption != static_cast<uint32>(FromEnum(colorOption))))
+				{
+					LOG_INFO(U"ModelCache: `{}` was created with a different format or options"_fmt(cachePath));
+					return;
+				}
+
+				if (sourceHash && (header.sourceHash != *sourceHash))
+				{
+					LOG_INFO(U"ModelCache: `{}` is outdated"_fmt(cachePath));
+					return;
+				}
+
+				const Byte* payload = (data + sizeof(header));
+
+				if ((header.payloadSize != (size - sizeof(header)))
+					|| (Hash::XXHash3(payload, static_cast<size_t>(header.payloadSize)) != header.payloadHash))
+				{
+					LOG_FAIL(U"ModelCache: `{}` is broken"_fmt(cachePath));
+					return;
+				}
+
+				detail::ModelCacheReader reader{ payload, static_cast<size_t>(header.payloadSize) };
+
+				ModelSource source;
+
+				if (not detail::ReadPayload(reader, source))
+				{
+					LOG_FAIL(U"ModelCache: `{}` is broken"_fmt(cachePath));
+					return;
+				}
+
+				result = std::move(source);
+			});
+
+			return result;
+		}
+	}
+}
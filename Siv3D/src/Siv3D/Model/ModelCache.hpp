@@ -0,0 +1,39 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Optional.hpp>
+# include "ModelData.hpp"
+
+namespace s3d
+{
+	// 3D モデルのバイナリキャッシュ
+	//
+	// [ヘッダ]
+	//	magic "S3DMODEL", version, colorOption, 元のファイルのハッシュ, 本体のサイズ, 本体のハッシュ
+	// [本体]
+	//	マテリアル一覧, モデルのバウンディングボリューム,
+	//	オブジェクト一覧（名前, バウンディングボリューム, パーツ一覧（マテリアル ID, Vertex3D 配列, TriangleIndex32 配列））
+	namespace ModelCache
+	{
+		// OBJ ファイルと、それが参照する MTL ファイルの内容から計算したハッシュを返す。OBJ ファイルが読めない場合は none
+		[[nodiscard]]
+		Optional<uint64> ComputeSourceHash(FilePathView path);
+
+		// モデルデータをキャッシュファイルに書き出す
+		bool Save(FilePathView cachePath, const ModelSource& source, uint64 sourceHash, ColorOption colorOption);
+
+		// キャッシュファイルからモデルデータを読み込む。sourceHash が none の場合は元のファイルとの一致を確認しない
+		[[nodiscard]]
+		Optional<ModelSource> Load(FilePathView cachePath, const Optional<uint64>& sourceHash, ColorOption colorOption);
+	}
+}
@@ -29,6 +29,53 @@ namespace s3d
 
 	ModelData::ModelData(const FilePathView path, const ColorOption colorOption)
 	{
+		if (const auto source = LoadOBJ(path, colorOption))
+		{
+			init(*source);
+		}
+	}
+
+	ModelData::ModelData(const ModelSource& source)
+	{
+		init(source);
+	}
+
+	void ModelData::init(const ModelSource& source)
+	{
+		m_materials = source.materials;
+		m_boundingSphere = source.boundingSphere;
+		m_boundingBox = source.boundingBox;
+		m_objects.resize(source.objects.size());
+
+		for (size_t i = 0; i < source.objects.size(); ++i)
+		{
+			const auto& objectSource = source.objects[i];
+			auto& object = m_objects[i];
+
+			object.name = objectSource.name;
+			object.boundingSphere = objectSource.boundingSphere;
+			object.boundingBox = objectSource.boundingBox;
+			object.parts.reserve(objectSource.parts.size());
+
+			for (const auto& partSource : objectSource.parts)
+			{
+				ModelMeshPart part
+				{
+					.mesh = Mesh{ partSource.meshData },
+					.materialID = partSource.materialID,
+				};
+
+				object.parts.push_back(std::move(part));
+			}
+		}
+
+		m_initialized = true;
+	}
+
+	Optional<ModelSource> ModelData::LoadOBJ(const FilePathView path, const ColorOption colorOption)
+	{
+		ModelSource source;
+
 		tinyobj::ObjReaderConfig reader_config;
 		{
 			reader_config.vertex_color = false;
@@ -43,7 +90,7 @@ namespace s3d
 				{
 					LOG_FAIL(U"TinyObjReader: " + Unicode::Widen(reader.Error()));
 
-					return;
+					return none;
 				}
 			}
 
@@ -55,7 +102,7 @@ namespace s3d
 
 		{
 			const auto& materials = reader.GetMaterials();
-			m_materials.reserve(materials.size());
+			source.materials.reserve(materials.size());
 
 			for (const auto& m : materials)
 			{
@@ -99,21 +146,21 @@ namespace s3d
 					mtl.normalTextureName = Unicode::FromUTF8(reader_config.mtl_search_path + m.normal_texname);
 				}
 
-				m_materials << mtl;
+				source.materials << mtl;
 			}
 		}
 
 		{
 			const auto& attrib = reader.GetAttrib();
 			const auto& shapes = reader.GetShapes();
-			m_objects.resize(shapes.size());
+			source.objects.resize(shapes.size());
 
 			for (size_t s = 0; s < shapes.size(); ++s)
 			{
 				const auto& shape = shapes[s];
-				m_objects[s].name = Unicode::FromUTF8(shape.name);
+				source.objects[s].name = Unicode::FromUTF8(shape.name);
 
-				Array<MeshData> objMeshes(m_materials.size());
+				Array<MeshData> objMeshes(source.materials.size());
 				MeshData noMaterialObjMesh;
 				Vertex3D::IndexType index_offset = 0;
 
@@ -184,7 +231,7 @@ namespace s3d
 					index_offset += fv;
 				}
 
-				for (size_t materialID = 0; materialID < m_materials.size(); ++materialID)
+				for (size_t materialID = 0; materialID < source.materials.size(); ++materialID)
 				{
 					auto& meshData = objMeshes[materialID];
 
@@ -195,13 +242,7 @@ namespace s3d
 							meshData.computeNormals();
 						}
 
-						ModelMeshPart part
-						{
-							.mesh = Mesh{ meshData },
-							.materialID = materialID,
-						};
-
-						m_objects[s].parts.push_back(std::move(part));
+						source.objects[s].parts.push_back({ std::move(meshData), materialID });
 					}
 				}
 
@@ -213,33 +254,27 @@ namespace s3d
 							noMaterialObjMesh.computeNormals();
 						}
 
-						ModelMeshPart part
-						{
-							.mesh = Mesh{ noMaterialObjMesh },
-							.materialID = none,
-						};
-
-						m_objects[s].parts.push_back(std::move(part));
+						source.objects[s].parts.push_back({ std::move(noMaterialObjMesh), none });
 					}
 				}
 			}
 		}
 
 		// bounding spheres & boxes (per object)
-		for (auto& object : m_objects)
+		for (auto& object : source.objects)
 		{
 			if (object.parts)
 			{
 				DirectX::BoundingSphere sphere = 
-					detail::FromSphere(object.parts[0].mesh.boundingSphere());
+					detail::FromSphere(object.parts[0].meshData.computeBoundingSphere());
 				DirectX::BoundingBox box =
-					detail::FromBox(object.parts[0].mesh.boundingBox());
+					detail::FromBox(object.parts[0].meshData.computeBoundingBox());
 
 				for (size_t i = 1; i < object.parts.size(); ++i)
 				{
-					const auto& mesh = object.parts[i].mesh;
-					const DirectX::BoundingSphere currentSphere = detail::FromSphere(mesh.boundingSphere());	
-					const DirectX::BoundingBox currentBox = detail::FromBox(mesh.boundingBox());
+					const auto& meshData = object.parts[i].meshData;
+					const DirectX::BoundingSphere currentSphere = detail::FromSphere(meshData.computeBoundingSphere());
+					const DirectX::BoundingBox currentBox = detail::FromBox(meshData.computeBoundingBox());
 
 					DirectX::BoundingSphere::CreateMerged(sphere, sphere, currentSphere);
 					DirectX::BoundingBox::CreateMerged(box, box, currentBox);
@@ -252,16 +287,16 @@ namespace s3d
 
 		// bounding spheres & boxes (model)
 		{
-			if (m_objects)
+			if (source.objects)
 			{
 				DirectX::BoundingSphere sphere =
-					detail::FromSphere(m_objects[0].boundingSphere);
+					detail::FromSphere(source.objects[0].boundingSphere);
 				DirectX::BoundingBox box =
-					detail::FromBox(m_objects[0].boundingBox);
+					detail::FromBox(source.objects[0].boundingBox);
 
-				for (size_t i = 1; i < m_objects.size(); ++i)
+				for (size_t i = 1; i < source.objects.size(); ++i)
 				{
-					const auto& object = m_objects[i];
+					const auto& object = source.objects[i];
 					const DirectX::BoundingSphere currentSphere = detail::FromSphere(object.boundingSphere);
 					const DirectX::BoundingBox currentBox = detail::FromBox(object.boundingBox);
 
@@ -269,12 +304,12 @@ namespace s3d
 					DirectX::BoundingBox::CreateMerged(box, box, currentBox);
 				}
 
-				m_boundingSphere = detail::ToSphere(sphere);
-				m_boundingBox = detail::ToBox(box);
+				source.boundingSphere = detail::ToSphere(sphere);
+				source.boundingBox = detail::ToBox(box);
 			}
 		}
 
-		m_initialized = true;
+		return source;
 	}
 
 	ModelData::~ModelData()
@@ -15,9 +15,40 @@
 # include <Siv3D/ModelObject.hpp>
 # include <Siv3D/Material.hpp>
 # include <Siv3D/ColorOption.hpp>
+# include <Siv3D/MeshData.hpp>
 
 namespace s3d
 {
+	// GPU のメッシュを作成する前の、CPU 側のモデルデータ
+	struct ModelSource
+	{
+		struct Part
+		{
+			MeshData meshData;
+
+			Optional<size_t> materialID;
+		};
+
+		struct Object
+		{
+			String name;
+
+			Array<Part> parts;
+
+			Sphere boundingSphere{ 0.0 };
+
+			Box boundingBox{ 0.0 };
+		};
+
+		Array<Object> objects;
+
+		Array<Material> materials;
+
+		Sphere boundingSphere{ 0.0 };
+
+		Box boundingBox{ 0.0 };
+	};
+
 	class ModelData
 	{
 	public:
@@ -28,6 +59,9 @@ namespace s3d
 		SIV3D_NODISCARD_CXX20
 		ModelData(FilePathView path, ColorOption colorOption);
 
+		SIV3D_NODISCARD_CXX20
+		explicit ModelData(const ModelSource& source);
+
 		~ModelData();
 
 		[[nodiscard]]
@@ -45,6 +79,10 @@ namespace s3d
 		[[nodiscard]]
 		const Box& getBoundingBox() const noexcept;
 
+		// Wavefront OBJ ファイルを読み込み、法線とバウンディングボリュームを計算する
+		[[nodiscard]]
+		static Optional<ModelSource> LoadOBJ(FilePathView path, ColorOption colorOption);
+
 	private:
 
 		Array<ModelObject> m_objects;
@@ -56,5 +94,7 @@ namespace s3d
 		Box m_boundingBox{ 0.0 };
 
 		bool m_initialized = false;
+
+		void init(const ModelSource& source);
 	};
 }
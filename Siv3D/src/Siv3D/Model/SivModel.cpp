@@ -13,6 +13,8 @@
 # include <Siv3D/TextureAsset.hpp>
 # include <Siv3D/Transformer3D.hpp>
 # include <Siv3D/Model/IModel.hpp>
+# include <Siv3D/Model/ModelData.hpp>
+# include <Siv3D/Model/ModelCache.hpp>
 # include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
 # include <Siv3D/Renderer3D/IRenderer3D.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
@@ -60,6 +62,12 @@ namespace s3d
 		SIV3D_ENGINE(AssetMonitor)->created();
 	}
 
+	Model::Model(Cached, const FilePathView path, const FilePathView cachePath, const ColorOption colorOption)
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Model)->createCached(path, cachePath, colorOption))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
+
 	Model::~Model() {}
 
 	const Array<ModelObject>& Model::objects() const noexcept
@@ -139,6 +147,16 @@ namespace s3d
 		}
 	}
 
+	void Model::drawInstanced(const Array<Mat4x4>& transforms) const
+	{
+		const auto& _materials = materials();
+
+		for (const auto& object : objects())
+		{
+			object.drawInstanced(transforms, _materials);
+		}
+	}
+
 	void Model::swap(Model& other) noexcept
 	{
 		m_handle.swap(other.m_handle);
@@ -158,4 +176,28 @@ namespace s3d
 
 		return result;
 	}
+
+	bool Model::Bake(const FilePathView path, const FilePathView cachePath, const ColorOption colorOption)
+	{
+		const Optional<uint64> sourceHash = ModelCache::ComputeSourceHash(path);
+
+		if (not sourceHash)
+		{
+			return false;
+		}
+
+		const auto source = ModelData::LoadOBJ(path, colorOption);
+
+		if (not source)
+		{
+			return false;
+		}
+
+		return ModelCache::Save(cachePath, *source, *sourceHash, colorOption);
+	}
+
+	Model Model::LoadCached(const FilePathView path, const FilePathView cachePath, const ColorOption colorOption)
+	{
+		return Model{ Cached{}, path, cachePath, colorOption };
+	}
 }
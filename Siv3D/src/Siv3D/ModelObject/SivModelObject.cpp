@@ -34,4 +34,24 @@ namespace s3d
 			}
 		}
 	}
+
+	void ModelObject::drawInstanced(const Array<Mat4x4>& transforms, const Array<Material>& materials) const
+	{
+		for (const auto& part : parts)
+		{
+			assert((not part.materialID) || (part.materialID < materials.size()));
+
+			const Material material = (part.materialID ? materials[*part.materialID] : Material{});
+
+			if (material.diffuseTextureName)
+			{
+				part.mesh.drawInstanced(transforms, TextureAsset(material.diffuseTextureName),
+					PhongMaterial{ material, HasDiffuseTexture::Yes });
+			}
+			else
+			{
+				part.mesh.drawInstanced(transforms, PhongMaterial{ material, HasDiffuseTexture::No });
+			}
+		}
+	}
 }
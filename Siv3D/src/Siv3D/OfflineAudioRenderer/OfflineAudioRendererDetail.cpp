@@ -0,0 +1,142 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cstring>
+# include <Siv3D/Error.hpp>
+# include "OfflineAudioRendererDetail.hpp"
+# include <ThirdParty/soloud/include/soloud_bus.h>
+
+namespace s3d
+{
+	OfflineAudioRenderer::OfflineAudioRendererDetail::OfflineAudioRendererDetail(const uint32 sampleRate)
+		: m_soloud{ std::make_unique<SoLoud::Soloud>() }
+		, m_buffer(ChunkSamples * 2)
+	{
+		if (SoLoud::SO_NO_ERROR != m_soloud->init(SoLoud::Soloud::CLIP_ROUNDOFF, SoLoud::Soloud::NULLDRIVER, sampleRate, (ChunkSamples * 2), 2))
+		{
+			throw EngineError{ U"OfflineAudioRenderer: Failed to initialize audio engine" };
+		}
+
+		m_soloud->setMaxActiveVoiceCount(MaxActiveVoiceCount);
+	}
+
+	OfflineAudioRenderer::OfflineAudioRendererDetail::~OfflineAudioRendererDetail()
+	{
+		// CAudio と同じく、音源、バス、SoLoud の順に破棄する
+		m_sources.clear();
+
+		for (auto& bus : m_buses)
+		{
+			bus.reset();
+		}
+
+		m_soloud->deinit();
+	}
+
+	uint32 OfflineAudioRenderer::OfflineAudioRendererDetail::sampleRate() const noexcept
+	{
+		return m_soloud->mSamplerate;
+	}
+
+	uint64 OfflineAudioRenderer::OfflineAudioRendererDetail::posSample() const noexcept
+	{
+		return m_posSample;
+	}
+
+	void OfflineAudioRenderer::OfflineAudioRendererDetail::play(std::unique_ptr<SoLoud::AudioSource>&& source, const uint64 startSample, const size_t busIndex, const double volume, const double pan, const double speed)
+	{
+		Voice voice;
+		voice.startSample	= Max(startSample, m_posSample);
+		voice.source		= source.get();
+		voice.busIndex		= busIndex;
+		voice.volume		= static_cast<float>(volume);
+		voice.pan			= static_cast<float>(pan);
+		voice.speed			= static_cast<float>(speed);
+
+		// 再生前にバスを作成しておく
+		getBus(busIndex);
+
+		m_sources << std::move(source);
+
+		m_pendingVoices << voice;
+	}
+
+	void OfflineAudioRenderer::OfflineAudioRendererDetail::setVolume(const double volume)
+	{
+		m_soloud->setGlobalVolume(static_cast<float>(volume));
+	}
+
+	AudioBus& OfflineAudioRenderer::OfflineAudioRendererDetail::getBus(const size_t busIndex)
+	{
+		assert(busIndex < Audio::MaxBusCount);
+
+		if (not m_buses[busIndex])
+		{
+			m_buses[busIndex] = std::make_unique<AudioBus>(m_soloud.get());
+		}
+
+		return *m_buses[busIndex];
+	}
+
+	void OfflineAudioRenderer::OfflineAudioRendererDetail::render(Wave& wave, const size_t samples)
+	{
+		wave.resize(samples);
+
+		WaveSample* pDst = wave.data();
+
+		for (size_t samplesLeft = samples; samplesLeft;)
+		{
+			const uint32 chunk = static_cast<uint32>(Min<size_t>(samplesLeft, ChunkSamples));
+
+			startVoices(m_posSample + chunk);
+
+			m_soloud->mix(m_buffer.data(), chunk);
+
+			// WaveSample は left, right の順に並んだ float なので、インタリーブの出力をそのままコピーできる
+			std::memcpy(pDst, m_buffer.data(), (sizeof(WaveSample) * chunk));
+
+			pDst += chunk;
+			samplesLeft -= chunk;
+			m_posSample += chunk;
+		}
+	}
+
+	void OfflineAudioRenderer::OfflineAudioRendererDetail::startVoices(const uint64 chunkEnd)
+	{
+		if (m_pendingVoices.isEmpty())
+		{
+			return;
+		}
+
+		m_pendingVoices.remove_if([&](const Voice& voice)
+			{
+				if (chunkEnd <= voice.startSample)
+				{
+					return false;
+				}
+
+				const SoLoud::handle handle = m_buses[voice.busIndex]->getBus()
+					.play(*voice.source, voice.volume, voice.pan, true);
+
+				if (voice.speed != 1.0f)
+				{
+					m_soloud->setRelativePlaySpeed(handle, voice.speed);
+				}
+
+				// チャンクの途中から始まるボイスは、サンプル単位で開始を遅らせる
+				m_soloud->setDelaySamples(handle, static_cast<uint32>(voice.startSample - m_posSample));
+
+				m_soloud->setPause(handle, false);
+
+				return true;
+			});
+	}
+}
@@ -0,0 +1,85 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <array>
+# include <memory>
+# include <Siv3D/OfflineAudioRenderer.hpp>
+# include <Siv3D/Audio.hpp>
+# include <Siv3D/Audio/AudioBus.hpp>
+# include <ThirdParty/soloud/include/soloud.h>
+
+namespace s3d
+{
+	class OfflineAudioRenderer::OfflineAudioRendererDetail
+	{
+	public:
+
+		explicit OfflineAudioRendererDetail(uint32 sampleRate);
+
+		~OfflineAudioRendererDetail();
+
+		[[nodiscard]]
+		uint32 sampleRate() const noexcept;
+
+		[[nodiscard]]
+		uint64 posSample() const noexcept;
+
+		// source を startSample から再生する。startSample が過去の場合は次のレンダリングの先頭から再生する
+		void play(std::unique_ptr<SoLoud::AudioSource>&& source, uint64 startSample, size_t busIndex, double volume, double pan, double speed);
+
+		void setVolume(double volume);
+
+		AudioBus& getBus(size_t busIndex);
+
+		void render(Wave& wave, size_t samples);
+
+	private:
+
+		// 一度の SoLoud::Soloud::mix() で処理するサンプル数
+		static constexpr uint32 ChunkSamples = 1024;
+
+		// CAudio と同じ
+		static constexpr uint32 MaxActiveVoiceCount = 72;
+
+		struct Voice
+		{
+			uint64 startSample = 0;
+
+			SoLoud::AudioSource* source = nullptr;
+
+			size_t busIndex = 0;
+
+			float volume = 1.0f;
+
+			float pan = 0.0f;
+
+			float speed = 1.0f;
+		};
+
+		// 出力デバイスを持たない SoLoud。ミキサーのスレッドは無く、render() で直接ミックスする
+		std::unique_ptr<SoLoud::Soloud> m_soloud;
+
+		std::array<std::unique_ptr<AudioBus>, Audio::MaxBusCount> m_buses;
+
+		Array<std::unique_ptr<SoLoud::AudioSource>> m_sources;
+
+		// まだ再生を開始していないボイス
+		Array<Voice> m_pendingVoices;
+
+		uint64 m_posSample = 0;
+
+		// SoLoud::Soloud::mix() の出力（インタリーブ）
+		Array<float> m_buffer;
+
+		void startVoices(uint64 chunkEnd);
+	};
+}
@@ -0,0 +1,184 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/OfflineAudioRenderer.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Audio/IAudio.hpp>
+# include <Siv3D/Audio/SharedWav.hpp>
+# include <Siv3D/Audio/DynamicAudioSource.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+# include "OfflineAudioRendererDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		static uint64 ToSamples(const Duration& time, const uint32 sampleRate)
+		{
+			return static_cast<uint64>(Max(time.count(), 0.0) * sampleRate);
+		}
+	}
+
+	OfflineAudioRenderer::OfflineAudioRenderer()
+		: OfflineAudioRenderer{ Arg::sampleRate = Wave::DefaultSampleRate } {}
+
+	OfflineAudioRenderer::OfflineAudioRenderer(const Arg::sampleRate_<uint32> sampleRate)
+		: pImpl{ std::make_shared<OfflineAudioRendererDetail>(*sampleRate) } {}
+
+	uint32 OfflineAudioRenderer::sampleRate() const noexcept
+	{
+		return pImpl->sampleRate();
+	}
+
+	uint64 OfflineAudioRenderer::posSample() const noexcept
+	{
+		return pImpl->posSample();
+	}
+
+	double OfflineAudioRenderer::posSec() const noexcept
+	{
+		return (static_cast<double>(pImpl->posSample()) / pImpl->sampleRate());
+	}
+
+	OfflineAudioRenderer& OfflineAudioRenderer::play(const Wave& wave, const Duration& startTime, const MixBus busIndex, const double volume, const double pan, const double speed)
+	{
+		if (wave.isEmpty())
+		{
+			return *this;
+		}
+
+		Wave deinterleaved = wave;
+		deinterleaved.deinterleave();
+
+		pImpl->play(std::make_unique<SharedWav>(std::make_shared<const Wave>(std::move(deinterleaved))),
+			detail::ToSamples(startTime, pImpl->sampleRate()), FromEnum(busIndex), volume, pan, speed);
+
+		return *this;
+	}
+
+	OfflineAudioRenderer& OfflineAudioRenderer::play(const Audio& audio, const Duration& startTime, const MixBus busIndex, const double volume, const double pan, const double speed)
+	{
+		if (audio.isEmpty() || audio.isStreaming())
+		{
+			return *this;
+		}
+
+		const std::shared_ptr<const Wave> wave = SIV3D_ENGINE(Audio)->getSharedWave(audio.id());
+
+		if ((not wave) || wave->isEmpty())
+		{
+			return *this;
+		}
+
+		auto source = std::make_unique<SharedWav>(wave);
+
+		if (audio.isLoop())
+		{
+			source->setLooping(true);
+			source->setLoopPoint(static_cast<double>(audio.getLoopTiming().beginPos) / wave->sampleRate());
+		}
+
+		pImpl->play(std::move(source),
+			detail::ToSamples(startTime, pImpl->sampleRate()), FromEnum(busIndex), volume, pan, speed);
+
+		return *this;
+	}
+
+	OfflineAudioRenderer& OfflineAudioRenderer::play(const std::shared_ptr<IAudioStream>& pAudioStream, const Arg::sampleRate_<uint32> sampleRate, const Duration& startTime, const MixBus busIndex, const double volume)
+	{
+		if (not pAudioStream)
+		{
+			return *this;
+		}
+
+		pImpl->play(std::make_unique<DynamicAudioSource>(pAudioStream, *sampleRate),
+			detail::ToSamples(startTime, pImpl->sampleRate()), FromEnum(busIndex), volume, 0.0, 1.0);
+
+		return *this;
+	}
+
+	void OfflineAudioRenderer::setVolume(const double volume)
+	{
+		pImpl->setVolume(volume);
+	}
+
+	void OfflineAudioRenderer::busSetVolume(const MixBus busIndex, const double volume)
+	{
+		pImpl->getBus(FromEnum(busIndex)).setVolume(volume);
+	}
+
+	void OfflineAudioRenderer::busClearFilter(const MixBus busIndex, const size_t filterIndex)
+	{
+		pImpl->getBus(FromEnum(busIndex)).clearFilter(filterIndex);
+	}
+
+	void OfflineAudioRenderer::busSetLowPassFilter(const MixBus busIndex, const size_t filterIndex, const double cutoffFrequency, const double resonance, const double wet)
+	{
+		pImpl->getBus(FromEnum(busIndex)).setLowPassFilter(filterIndex, cutoffFrequency, resonance, wet);
+	}
+
+	void OfflineAudioRenderer::busSetHighPassFilter(const MixBus busIndex, const size_t filterIndex, const double cutoffFrequency, const double resonance, const double wet)
+	{
+		pImpl->getBus(FromEnum(busIndex)).setHighPassFilter(filterIndex, cutoffFrequency, resonance, wet);
+	}
+
+	void OfflineAudioRenderer::busSetEchoFilter(const MixBus busIndex, const size_t filterIndex, const double delay, const double decay, const double wet)
+	{
+		pImpl->getBus(FromEnum(busIndex)).setEchoFilter(filterIndex, delay, decay, wet);
+	}
+
+	void OfflineAudioRenderer::busSetReverbFilter(const MixBus busIndex, const size_t filterIndex, const bool freeze, const double roomSize, const double damp, const double width, const double wet)
+	{
+		pImpl->getBus(FromEnum(busIndex)).setReverbFilter(filterIndex, freeze, roomSize, damp, width, wet);
+	}
+
+	void OfflineAudioRenderer::busSetPitchShiftFilter(const MixBus busIndex, const size_t filterIndex, const double pitchShift)
+	{
+		pImpl->getBus(FromEnum(busIndex)).setPitchShiftFilter(filterIndex, pitchShift);
+	}
+
+	Wave OfflineAudioRenderer::render(const Duration& length)
+	{
+		Wave wave{ Arg::sampleRate = pImpl->sampleRate() };
+
+		render(wave, static_cast<size_t>(detail::ToSamples(length, pImpl->sampleRate())));
+
+		return wave;
+	}
+
+	void OfflineAudioRenderer::render(Wave& wave, const size_t samples)
+	{
+		wave.setSampleRate(pImpl->sampleRate());
+
+		pImpl->render(wave, samples);
+	}
+
+	Array<Wave> OfflineAudioRenderer::RenderMany(const size_t count, const std::function<void(size_t, OfflineAudioRenderer&)>& setup, const Duration& length, const Arg::sampleRate_<uint32> sampleRate)
+	{
+		Array<Wave> results(count);
+
+		// レンダラーはそれぞれ独立した SoLoud を持つので、ロックなしで並列に処理できる
+		Threading::ParallelFor(0, count, [&](const size_t i)
+			{
+				OfflineAudioRenderer renderer{ sampleRate };
+
+				if (setup)
+				{
+					setup(i, renderer);
+				}
+
+				results[i] = renderer.render(length);
+			}, 1);
+
+		return results;
+	}
+}
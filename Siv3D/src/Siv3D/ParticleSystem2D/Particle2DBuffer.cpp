@@ -0,0 +1,282 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/Threading.hpp>
+# include "Particle2DBuffer.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 1 回のタスクで更新するパーティクルの最小数
+		constexpr size_t ParticleUpdateGrainSize = 8192;
+
+		template <class Fty>
+		static void ForEachRange(const size_t count, Fty f)
+		{
+			if (count < Particle2DBuffer::ParallelUpdateThreshold)
+			{
+				f(0, count);
+			}
+			else
+			{
+				Threading::ParallelFor(0, count, f, ParticleUpdateGrainSize);
+			}
+		}
+
+		[[nodiscard]]
+		static float DefaultSizeOverLifeTime(const float startSize, const float startLifeTime, const float remainingLifeTime) noexcept
+		{
+			return startSize * (remainingLifeTime / startLifeTime);
+		}
+	}
+
+	size_t Particle2DBuffer::size() const noexcept
+	{
+		return (positionX.size() - head);
+	}
+
+	bool Particle2DBuffer::isEmpty() const noexcept
+	{
+		return (size() == 0);
+	}
+
+	void Particle2DBuffer::clear()
+	{
+		resize(0);
+		head = 0;
+	}
+
+	void Particle2DBuffer::push_back(const Particle2D& particle, const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc)
+	{
+		positionX.push_back(particle.position.x);
+		positionY.push_back(particle.position.y);
+		velocityX.push_back(particle.velocity.x);
+		velocityY.push_back(particle.velocity.y);
+		rotation.push_back(particle.rotation);
+		angularVelocity.push_back(particle.startAngularVelocity);
+		startSize.push_back(particle.startSize);
+		startLifeTime.push_back(particle.startLifeTime);
+		remainingLifeTime.push_back(particle.remainingLifeTime);
+		startColor.push_back(particle.startColor);
+
+		currentSize.push_back(sizeOverLifeTimeFunc
+			? sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime)
+			: detail::DefaultSizeOverLifeTime(particle.startSize, particle.startLifeTime, particle.remainingLifeTime));
+	}
+
+	void Particle2DBuffer::pop_front_N(const size_t n)
+	{
+		head += Min(n, size());
+
+		if (size() <= head)
+		{
+			compact();
+		}
+	}
+
+	void Particle2DBuffer::update(const float deltaTime, const Float2& deltaVelocity, const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc)
+	{
+		detail::ForEachRange(size(), [&](const size_t beginIndex, const size_t endIndex)
+			{
+				updateRange((head + beginIndex), (head + endIndex), deltaTime, deltaVelocity, sizeOverLifeTimeFunc);
+			});
+	}
+
+	void Particle2DBuffer::updateSizes(const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc)
+	{
+		detail::ForEachRange(size(), [&](const size_t beginIndex, const size_t endIndex)
+			{
+				updateSizesRange((head + beginIndex), (head + endIndex), sizeOverLifeTimeFunc);
+			});
+	}
+
+	void Particle2DBuffer::removeDead()
+	{
+		const size_t count = positionX.size();
+		const float* const pRemaining = remainingLifeTime.data();
+
+		// 寿命は生成順に尽きることが多いので、先頭からまとめて取り除ける場合を先に調べる
+		size_t frontDead = head;
+
+		while ((frontDead < count) && (pRemaining[frontDead] < 0.0f))
+		{
+			++frontDead;
+		}
+
+		size_t i = frontDead;
+
+		while ((i < count) && (0.0f <= pRemaining[i]))
+		{
+			++i;
+		}
+
+		if (i == count)
+		{
+			pop_front_N(frontDead - head);
+			return;
+		}
+
+		size_t dst = 0;
+
+		for (size_t src = frontDead; src < count; ++src)
+		{
+			if (pRemaining[src] < 0.0f)
+			{
+				continue;
+			}
+
+			if (dst != src)
+			{
+				positionX[dst]			= positionX[src];
+				positionY[dst]			= positionY[src];
+				velocityX[dst]			= velocityX[src];
+				velocityY[dst]			= velocityY[src];
+				rotation[dst]			= rotation[src];
+				angularVelocity[dst]	= angularVelocity[src];
+				startSize[dst]			= startSize[src];
+				currentSize[dst]		= currentSize[src];
+				startLifeTime[dst]		= startLifeTime[src];
+				remainingLifeTime[dst]	= remainingLifeTime[src];
+				startColor[dst]			= startColor[src];
+			}
+
+			++dst;
+		}
+
+		resize(dst);
+		head = 0;
+	}
+
+	void Particle2DBuffer::updateRange(const size_t beginIndex, const size_t endIndex, const float deltaTime, const Float2& deltaVelocity, const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc)
+	{
+		float* const pPositionX		= positionX.data();
+		float* const pPositionY		= positionY.data();
+		float* const pVelocityX		= velocityX.data();
+		float* const pVelocityY		= velocityY.data();
+		float* const pRotation		= rotation.data();
+		const float* const pAngularVelocity = angularVelocity.data();
+		const float* const pStartSize = startSize.data();
+		float* const pCurrentSize	= currentSize.data();
+		const float* const pStartLifeTime = startLifeTime.data();
+		float* const pRemaining		= remainingLifeTime.data();
+
+		const bool defaultSize = (not sizeOverLifeTimeFunc);
+
+		const __m128 dt = _mm_set1_ps(deltaTime);
+		const __m128 dvx = _mm_set1_ps(deltaVelocity.x);
+		const __m128 dvy = _mm_set1_ps(deltaVelocity.y);
+
+		size_t i = beginIndex;
+
+		for (; (i + 4) <= endIndex; i += 4)
+		{
+			const __m128 remaining = _mm_sub_ps(_mm_loadu_ps(pRemaining + i), dt);
+			_mm_storeu_ps((pRemaining + i), remaining);
+
+			const __m128 vx = _mm_add_ps(_mm_loadu_ps(pVelocityX + i), dvx);
+			const __m128 vy = _mm_add_ps(_mm_loadu_ps(pVelocityY + i), dvy);
+			_mm_storeu_ps((pVelocityX + i), vx);
+			_mm_storeu_ps((pVelocityY + i), vy);
+
+			_mm_storeu_ps((pPositionX + i), _mm_add_ps(_mm_loadu_ps(pPositionX + i), _mm_mul_ps(vx, dt)));
+			_mm_storeu_ps((pPositionY + i), _mm_add_ps(_mm_loadu_ps(pPositionY + i), _mm_mul_ps(vy, dt)));
+			_mm_storeu_ps((pRotation + i), _mm_add_ps(_mm_loadu_ps(pRotation + i), _mm_mul_ps(_mm_loadu_ps(pAngularVelocity + i), dt)));
+
+			if (defaultSize)
+			{
+				const __m128 lifeRatio = _mm_div_ps(remaining, _mm_loadu_ps(pStartLifeTime + i));
+				_mm_storeu_ps((pCurrentSize + i), _mm_mul_ps(_mm_loadu_ps(pStartSize + i), lifeRatio));
+			}
+		}
+
+		for (; i < endIndex; ++i)
+		{
+			pRemaining[i] -= deltaTime;
+			pVelocityX[i] += deltaVelocity.x;
+			pVelocityY[i] += deltaVelocity.y;
+			pPositionX[i] += (pVelocityX[i] * deltaTime);
+			pPositionY[i] += (pVelocityY[i] * deltaTime);
+			pRotation[i] += (pAngularVelocity[i] * deltaTime);
+
+			if (defaultSize)
+			{
+				pCurrentSize[i] = detail::DefaultSizeOverLifeTime(pStartSize[i], pStartLifeTime[i], pRemaining[i]);
+			}
+		}
+
+		if (not defaultSize)
+		{
+			updateSizesRange(beginIndex, endIndex, sizeOverLifeTimeFunc);
+		}
+	}
+
+	void Particle2DBuffer::updateSizesRange(const size_t beginIndex, const size_t endIndex, const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc)
+	{
+		const float* const pStartSize = startSize.data();
+		const float* const pStartLifeTime = startLifeTime.data();
+		const float* const pRemaining = remainingLifeTime.data();
+		float* const pCurrentSize = currentSize.data();
+
+		if (sizeOverLifeTimeFunc)
+		{
+			for (size_t i = beginIndex; i < endIndex; ++i)
+			{
+				pCurrentSize[i] = sizeOverLifeTimeFunc(pStartSize[i], pStartLifeTime[i], pRemaining[i]);
+			}
+		}
+		else
+		{
+			for (size_t i = beginIndex; i < endIndex; ++i)
+			{
+				pCurrentSize[i] = detail::DefaultSizeOverLifeTime(pStartSize[i], pStartLifeTime[i], pRemaining[i]);
+			}
+		}
+	}
+
+	void Particle2DBuffer::resize(const size_t n)
+	{
+		positionX.resize(n);
+		positionY.resize(n);
+		velocityX.resize(n);
+		velocityY.resize(n);
+		rotation.resize(n);
+		angularVelocity.resize(n);
+		startSize.resize(n);
+		currentSize.resize(n);
+		startLifeTime.resize(n);
+		remainingLifeTime.resize(n);
+		startColor.resize(n);
+	}
+
+	void Particle2DBuffer::compact()
+	{
+		if (head == 0)
+		{
+			return;
+		}
+
+		positionX.pop_front_N(head);
+		positionY.pop_front_N(head);
+		velocityX.pop_front_N(head);
+		velocityY.pop_front_N(head);
+		rotation.pop_front_N(head);
+		angularVelocity.pop_front_N(head);
+		startSize.pop_front_N(head);
+		currentSize.pop_front_N(head);
+		startLifeTime.pop_front_N(head);
+		remainingLifeTime.pop_front_N(head);
+		startColor.pop_front_N(head);
+
+		head = 0;
+	}
+}
@@ -0,0 +1,89 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/PointVector.hpp>
+# include <Siv3D/Particle2D.hpp>
+# include <Siv3D/ParticleSystem2DParameters.hpp>
+
+namespace s3d
+{
+	// パーティクルを要素ごとの配列 (SoA) で保持する
+	// 更新処理は各配列を 4 要素ずつ SIMD 命令で処理し、数が多い場合は複数のスレッドで分担する
+	// 有効なパーティクルは各配列の [head, positionX.size()) の範囲にある
+	struct Particle2DBuffer
+	{
+		// この数以上のパーティクルは、複数のスレッドで更新する
+		static constexpr size_t ParallelUpdateThreshold = 32768;
+
+		// 先頭から取り除かれた要素の数。毎フレームの配列の詰め直しを避けるため、有効な要素の数以上になった時点でまとめて詰める
+		size_t head = 0;
+
+		Array<float> positionX;
+
+		Array<float> positionY;
+
+		Array<float> velocityX;
+
+		Array<float> velocityY;
+
+		Array<float> rotation;
+
+		Array<float> angularVelocity;
+
+		Array<float> startSize;
+
+		// 現在の大きさ。update() で計算される
+		Array<float> currentSize;
+
+		Array<float> startLifeTime;
+
+		Array<float> remainingLifeTime;
+
+		Array<Float4> startColor;
+
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		void clear();
+
+		void push_back(const Particle2D& particle, const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc);
+
+		// 古いものから n 個を取り除く
+		void pop_front_N(size_t n);
+
+		// 時間を進め、現在の大きさを計算する
+		// sizeOverLifeTimeFunc が空の場合は startSize * (remainingLifeTime / startLifeTime) を使う
+		void update(float deltaTime, const Float2& deltaVelocity, const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc);
+
+		// 時間を進めずに、現在の大きさを計算し直す
+		void updateSizes(const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc);
+
+		// 寿命が尽きたパーティクルを、順序を保って取り除く
+		void removeDead();
+
+	private:
+
+		void updateRange(size_t beginIndex, size_t endIndex, float deltaTime, const Float2& deltaVelocity, const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc);
+
+		void updateSizesRange(size_t beginIndex, size_t endIndex, const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc);
+
+		void resize(size_t n);
+
+		// 先頭から取り除かれた要素を配列から消去する
+		void compact();
+	};
+}
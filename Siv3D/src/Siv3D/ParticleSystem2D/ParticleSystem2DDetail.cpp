@@ -17,21 +17,6 @@
 
 namespace s3d
 {
-	namespace detail
-	{
-		[[nodiscard]]
-		static float DefaultSizeOverLifeTimeFunc(float startSize, float startLifeTime, float remainingLifeTime)
-		{
-			return startSize * (remainingLifeTime / startLifeTime);
-		};
-
-		[[nodiscard]]
-		static Float4 DefaultColorOverLifeTimeFunc(const Float4& startColor, float, float)
-		{
-			return startColor;
-		};
-	}
-
 	ParticleSystem2D::ParticleSystem2DDetail::ParticleSystem2DDetail() {}
 
 	ParticleSystem2D::ParticleSystem2DDetail::ParticleSystem2DDetail(const Vec2& position, const Vec2& force)
@@ -66,6 +51,8 @@ namespace s3d
 	void ParticleSystem2D::ParticleSystem2DDetail::setParameters(const ParticleSystem2DParameters& parameters)
 	{
 		m_parameters = parameters;
+
+		m_particles.updateSizes(m_parameters.sizeOverLifeTimeFunc);
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::setTexture(const Texture& texture) noexcept
@@ -122,11 +109,11 @@ namespace s3d
 
 		if (m_particleTexture)
 		{
-			drawTexturedParticle();
+			SIV3D_ENGINE(Renderer2D)->addTexturedParticles(m_particleTexture, m_particles, m_parameters.colorOverLifeTimeFunc);
 		}
 		else
 		{
-			drawParticle();
+			SIV3D_ENGINE(Renderer2D)->addParticles(m_particles, m_parameters.colorOverLifeTimeFunc);
 		}
 	}
 
@@ -146,12 +133,9 @@ namespace s3d
 	{
 		const Float2 deltaVelocity = (m_force * deltaTime);
 
-		for (auto& particle : m_particles)
-		{
-			particle.update(deltaTime, deltaVelocity);
-		}
+		m_particles.update(deltaTime, deltaVelocity, m_parameters.sizeOverLifeTimeFunc);
 
-		m_particles.remove_if([](const Particle2D& p) { return p.isDead(); });
+		m_particles.removeDead();
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::addParticles(const ParticleSystem2DParameters& params)
@@ -183,57 +167,27 @@ namespace s3d
 
 			const float perParticledeltaTime = (particle.startLifeTime - particle.remainingLifeTime);
 			particle.advance(perParticledeltaTime, m_force * perParticledeltaTime);
-			m_particles << particle;
+			m_particles.push_back(particle, params.sizeOverLifeTimeFunc);
 		}
 
 		if (const size_t maxParticles = static_cast<size_t>(params.maxParticles); m_particles.size() > maxParticles)
 		{
-			m_particles.erase(m_particles.begin(), m_particles.begin() + (m_particles.size() - maxParticles));
-		}
-	}
-
-	void ParticleSystem2D::ParticleSystem2DDetail::drawParticle() const
-	{
-		const ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc =
-			m_parameters.sizeOverLifeTimeFunc ? m_parameters.sizeOverLifeTimeFunc : detail::DefaultSizeOverLifeTimeFunc;
-		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
-			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
-
-		for (const auto& particle : m_particles)
-		{
-			const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
-			const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
-
-			RectF{ Arg::center = particle.position, size }
-				.rotated(particle.rotation)
-				.draw(ColorF{ color });
+			m_particles.pop_front_N(m_particles.size() - maxParticles);
 		}
 	}
 
-	void ParticleSystem2D::ParticleSystem2DDetail::drawTexturedParticle() const
-	{
-		const ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc =
-			m_parameters.sizeOverLifeTimeFunc ? m_parameters.sizeOverLifeTimeFunc : detail::DefaultSizeOverLifeTimeFunc;
-		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
-			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
-
-		SIV3D_ENGINE(Renderer2D)->addTexturedParticles(m_particleTexture, m_particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc);
-	}
-
 	void ParticleSystem2D::ParticleSystem2DDetail::drawDebugParticle() const
 	{
-		const ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc =
-			m_parameters.sizeOverLifeTimeFunc ? m_parameters.sizeOverLifeTimeFunc : detail::DefaultSizeOverLifeTimeFunc;
-		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
-			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
+		const auto& colorOverLifeTimeFunc = m_parameters.colorOverLifeTimeFunc;
 
-		for (const auto& particle : m_particles)
+		for (size_t n = m_particles.head; n < m_particles.positionX.size(); ++n)
 		{
-			const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
-			const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
+			const Float4 color = (colorOverLifeTimeFunc
+				? colorOverLifeTimeFunc(m_particles.startColor[n], m_particles.startLifeTime[n], m_particles.remainingLifeTime[n])
+				: m_particles.startColor[n]);
 
-			RectF{ Arg::center = particle.position, size }
-				.rotated(particle.rotation)
+			RectF{ Arg::center = Float2{ m_particles.positionX[n], m_particles.positionY[n] }, m_particles.currentSize[n] }
+				.rotated(m_particles.rotation[n])
 				.drawFrame(1, ColorF{ color });
 		}
 	}
@@ -36,7 +36,14 @@ namespace s3d
 		const P2Body::P2BodyDetail* pBodyB = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureB()->GetBody()->GetUserData().pBody);
 		const P2ContactPair pair{ pBodyA->id(), pBodyB->id() };
 
-		auto& collision = m_collisions.find(pair)->second;
+		auto it = m_collisions.find(pair);
+
+		if (it == m_collisions.end())
+		{
+			return;
+		}
+
+		auto& collision = it->second;
 		const uint32 current_num_contacts = static_cast<uint32>(contact->GetManifold()->pointCount);
 		collision.m_num_contacts = Max(collision.m_num_contacts, current_num_contacts);
 
@@ -94,4 +101,62 @@ namespace s3d
 			collision.m_contacts[1].tangentImpulse = 0.0;
 		}
 	}
+
+	void detail::P2ContactListener::clear()
+	{
+		m_collisions.clear();
+	}
+
+	void detail::P2ContactListener::addTouchingContacts(b2World& world)
+	{
+		for (b2Contact* contact = world.GetContactList(); contact; contact = contact->GetNext())
+		{
+			if (contact->IsTouching())
+			{
+				BeginContact(contact);
+			}
+		}
+	}
+
+	void detail::P2ContactListener::CollectContactRecords(b2World& world, Array<P2ContactRecord>& records)
+	{
+		records.clear();
+
+		for (b2Contact* contact = world.GetContactList(); contact; contact = contact->GetNext())
+		{
+			if (not contact->IsTouching())
+			{
+				continue;
+			}
+
+			const P2Body::P2BodyDetail* pBodyA = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureA()->GetBody()->GetUserData().pBody);
+			const P2Body::P2BodyDetail* pBodyB = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureB()->GetBody()->GetUserData().pBody);
+
+			P2ContactRecord& record = records.emplace_back();
+			record.pair = P2ContactPair{ pBodyA->id(), pBodyB->id() };
+
+			// センサーの接触は接触点を持たない
+			const b2Manifold* manifold = contact->GetManifold();
+			const uint32 num_contacts = static_cast<uint32>(manifold->pointCount);
+
+			P2Collision& collision = record.collision;
+			collision.m_num_contacts = num_contacts;
+
+			if (num_contacts)
+			{
+				b2WorldManifold worldManifold;
+				contact->GetWorldManifold(&worldManifold);
+				collision.m_normal = detail::ToVec2(worldManifold.normal);
+
+				// 直前のステップで解いた力が多様体に残っている
+				for (uint32 i = 0; i < num_contacts; ++i)
+				{
+					auto& c = collision.m_contacts[i];
+					c.point = detail::ToVec2(worldManifold.points[i]);
+					c.normalImpulse = manifold->points[i].normalImpulse;
+					c.tangentImpulse = manifold->points[i].tangentImpulse;
+				}
+			}
+		}
+	}
 }
@@ -13,6 +13,7 @@
 # include <Siv3D/HashTable.hpp>
 # include <Siv3D/Physics2D/P2ContactPair.hpp>
 # include <Siv3D/Physics2D/P2Collision.hpp>
+# include <Siv3D/Physics2D/P2ContactRecord.hpp>
 # include "P2Common.hpp"
 
 namespace s3d
@@ -27,6 +28,14 @@ namespace s3d
 
 			void clearContacts();
 
+			void clear();
+
+			// 収集を途中から始めるときに、既に接触している部品のペアを登録する
+			void addTouchingContacts(b2World& world);
+
+			// ワールドで接触している部品のペアごとの接触情報を records に集める
+			static void CollectContactRecords(b2World& world, Array<P2ContactRecord>& records);
+
 		private:
 
 			HashTable<P2ContactPair, P2Collision> m_collisions;
@@ -255,4 +255,19 @@ namespace s3d
 	{
 		return pImpl->getCollisions();
 	}
+
+	void P2World::setCollisionMode(const P2CollisionMode mode)
+	{
+		pImpl->setCollisionMode(mode);
+	}
+
+	P2CollisionMode P2World::getCollisionMode() const noexcept
+	{
+		return pImpl->getCollisionMode();
+	}
+
+	const Array<P2ContactRecord>& P2World::getContactRecords() const noexcept
+	{
+		return pImpl->getContactRecords();
+	}
 }
@@ -23,9 +23,17 @@ namespace s3d
 
 	void detail::P2WorldDetail::update(const double timeStep, const int32 velocityIterations, const int32 positionIterations)
 	{
-		m_contactListner.clearContacts();
+		if (m_collisionMode == P2CollisionMode::PerBodyPair)
+		{
+			m_contactListner.clearContacts();
+		}
 
 		m_world.Step(static_cast<float>(timeStep), velocityIterations, positionIterations);
+
+		if (m_collisionMode == P2CollisionMode::FlatArray)
+		{
+			P2ContactListener::CollectContactRecords(m_world, m_contactRecords);
+		}
 	}
 
 	P2Body detail::P2WorldDetail::createPlaceholder(const std::shared_ptr<P2WorldDetail>& world, const P2BodyType bodyType, const Vec2& center)
@@ -207,6 +215,40 @@ namespace s3d
 		return m_contactListner.getCollisions();
 	}
 
+	void detail::P2WorldDetail::setCollisionMode(const P2CollisionMode mode)
+	{
+		if (mode == m_collisionMode)
+		{
+			return;
+		}
+
+		m_contactListner.clear();
+		m_contactRecords.clear();
+
+		if (mode == P2CollisionMode::PerBodyPair)
+		{
+			m_world.SetContactListener(&m_contactListner);
+			m_contactListner.addTouchingContacts(m_world);
+		}
+		else
+		{
+			// 接触ごとのコールバックを呼ばないようにする
+			m_world.SetContactListener(nullptr);
+		}
+
+		m_collisionMode = mode;
+	}
+
+	P2CollisionMode detail::P2WorldDetail::getCollisionMode() const noexcept
+	{
+		return m_collisionMode;
+	}
+
+	const Array<P2ContactRecord>& detail::P2WorldDetail::getContactRecords() const noexcept
+	{
+		return m_contactRecords;
+	}
+
 	b2World& detail::P2WorldDetail::getData() noexcept
 	{
 		return m_world;
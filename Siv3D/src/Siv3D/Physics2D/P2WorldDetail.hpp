@@ -93,6 +93,14 @@ namespace s3d
 		[[nodiscard]]
 		const HashTable<P2ContactPair, P2Collision>& getCollisions() const noexcept;
 
+		void setCollisionMode(P2CollisionMode mode);
+
+		[[nodiscard]]
+		P2CollisionMode getCollisionMode() const noexcept;
+
+		[[nodiscard]]
+		const Array<P2ContactRecord>& getContactRecords() const noexcept;
+
 		[[nodiscard]]
 		b2World& getData() noexcept;
 
@@ -108,6 +116,11 @@ namespace s3d
 
 		P2ContactListener m_contactListner;
 
+		P2CollisionMode m_collisionMode = P2CollisionMode::PerBodyPair;
+
+		// P2CollisionMode::FlatArray の場合に update() ごとに作り直す。容量は再利用する
+		Array<P2ContactRecord> m_contactRecords;
+
 		std::atomic<P2BodyID> m_currentID = { 0 };
 
 		[[nodiscard]]
@@ -0,0 +1,60 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Physics2D/P2WorldGroup.hpp>
+# include <Siv3D/Threading.hpp>
+
+namespace s3d
+{
+	void P2WorldGroup::add(const P2World& world)
+	{
+		m_worlds << world;
+	}
+
+	void P2WorldGroup::remove(const size_t index)
+	{
+		m_worlds.remove_at(index);
+	}
+
+	void P2WorldGroup::clear()
+	{
+		m_worlds.clear();
+	}
+
+	size_t P2WorldGroup::size() const noexcept
+	{
+		return m_worlds.size();
+	}
+
+	bool P2WorldGroup::isEmpty() const noexcept
+	{
+		return m_worlds.isEmpty();
+	}
+
+	const P2World& P2WorldGroup::operator [](const size_t index) const
+	{
+		return m_worlds[index];
+	}
+
+	const Array<P2World>& P2WorldGroup::worlds() const noexcept
+	{
+		return m_worlds;
+	}
+
+	void P2WorldGroup::update(const double timeStep, const int32 velocityIterations, const int32 positionIterations) const
+	{
+		// ワールドごとに更新の重さが大きく異なるため、1 つずつスレッドに割り当てる
+		Threading::ParallelFor(0, m_worlds.size(), [&](const size_t i)
+			{
+				m_worlds[i].update(timeStep, velocityIterations, positionIterations);
+			}, 1);
+	}
+}
@@ -0,0 +1,234 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/String.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/TextWriter.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "ProfileZoneRecorder.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static void AppendEscaped(String& s, const StringView text)
+		{
+			for (const char32 ch : text)
+			{
+				switch (ch)
+				{
+				case U'"':
+					s.append(U"\\\"");
+					break;
+				case U'\\':
+					s.append(U"\\\\");
+					break;
+				case U'\n':
+					s.append(U"\\n");
+					break;
+				case U'\t':
+					s.append(U"\\t");
+					break;
+				default:
+					if (ch < 0x20)
+					{
+						s.append(U"\\u{:04x}"_fmt(static_cast<uint32>(ch)));
+					}
+					else
+					{
+						s.push_back(ch);
+					}
+				}
+			}
+		}
+
+		// ナノ秒をマイクロ秒の文字列にする
+		[[nodiscard]]
+		static String ToMicrosec(const uint64 nanosec)
+		{
+			return U"{}.{:0>3}"_fmt((nanosec / 1000), (nanosec % 1000));
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ProfileZoneBuffer
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProfileZoneBuffer::ProfileZoneBuffer(const uint32 threadIndex)
+		: m_events{ std::make_unique<ProfileZoneEvent[]>(Capacity) }
+		, m_threadIndex{ threadIndex } {}
+
+	void ProfileZoneBuffer::push(const ProfileZoneEvent& event) noexcept
+	{
+		const uint64 head = m_head.load(std::memory_order_relaxed);
+
+		m_events[head & Mask] = event;
+
+		m_head.store((head + 1), std::memory_order_release);
+	}
+
+	void ProfileZoneBuffer::read(Array<ProfileZoneEvent>& out) const
+	{
+		const uint64 head = m_head.load(std::memory_order_acquire);
+		const uint64 tail = m_tail.load(std::memory_order_relaxed);
+		const uint64 begin = Max(tail, ((Capacity < head) ? (head - Capacity) : 0));
+
+		const size_t offset = out.size();
+
+		for (uint64 i = begin; i < head; ++i)
+		{
+			out.push_back(m_events[i & Mask]);
+		}
+
+		// 読み出している間に書き込みスレッドが上書きした可能性のある古いイベントを取り除く
+		const uint64 headAfter = m_head.load(std::memory_order_acquire);
+
+		if (Capacity <= headAfter)
+		{
+			const uint64 validBegin = (headAfter - Capacity + 1);
+
+			if (begin < validBegin)
+			{
+				const size_t overwritten = static_cast<size_t>(Min((validBegin - begin), (head - begin)));
+				out.erase((out.begin() + offset), (out.begin() + offset + overwritten));
+			}
+		}
+	}
+
+	void ProfileZoneBuffer::clear() noexcept
+	{
+		m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_relaxed);
+	}
+
+	uint32 ProfileZoneBuffer::getThreadIndex() const noexcept
+	{
+		return m_threadIndex;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ProfileZoneRecorder
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProfileZoneRecorder& ProfileZoneRecorder::Get()
+	{
+		// 他のグローバルオブジェクトのデストラクタ中に使われることがあるため、解放しない
+		static ProfileZoneRecorder* recorder = new ProfileZoneRecorder;
+		return *recorder;
+	}
+
+	void ProfileZoneRecorder::setEnabled(const bool enabled) noexcept
+	{
+		m_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	ProfileZoneBuffer& ProfileZoneRecorder::getThreadBuffer()
+	{
+		// スレッドが終了した後もイベントを書き出せるように、バッファは共有で保持する
+		thread_local std::shared_ptr<ProfileZoneBuffer> buffer = [this]()
+		{
+			std::lock_guard lock{ m_mutex };
+
+			auto newBuffer = std::make_shared<ProfileZoneBuffer>(static_cast<uint32>(m_buffers.size()));
+			m_buffers.push_back(newBuffer);
+
+			return newBuffer;
+		}();
+
+		return *buffer;
+	}
+
+	void ProfileZoneRecorder::clear()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		for (auto& buffer : m_buffers)
+		{
+			buffer->clear();
+		}
+	}
+
+	bool ProfileZoneRecorder::saveChromeTrace(const FilePathView path)
+	{
+		Array<std::pair<uint32, Array<ProfileZoneEvent>>> threads;
+		{
+			std::lock_guard lock{ m_mutex };
+
+			for (const auto& buffer : m_buffers)
+			{
+				Array<ProfileZoneEvent> events;
+				buffer->read(events);
+				threads.emplace_back(buffer->getThreadIndex(), std::move(events));
+			}
+		}
+
+		uint64 origin = Largest<uint64>;
+
+		for (const auto& thread : threads)
+		{
+			for (const auto& event : thread.second)
+			{
+				origin = Min(origin, event.beginNanosec);
+			}
+		}
+
+		TextWriter writer{ path, TextEncoding::UTF8_NO_BOM };
+
+		if (not writer)
+		{
+			LOG_FAIL(U"Profiler::SaveChromeTrace(): Failed to open `{}`"_fmt(path));
+			return false;
+		}
+
+		writer.write(U"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+		String line;
+		bool first = true;
+
+		for (const auto& thread : threads)
+		{
+			const uint32 threadIndex = thread.first;
+
+			// スレッド名のメタデータ
+			line.clear();
+			line.append(first ? U"" : U",\n");
+			line.append(U"{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":\"Thread {0}\"}}}}"_fmt(threadIndex));
+			writer.write(line);
+			first = false;
+
+			for (const auto& event : thread.second)
+			{
+				line.assign(U",\n{\"name\":\"");
+				detail::AppendEscaped(line, event.site->name);
+				line.append(U"\",\"cat\":\"siv3d\",\"ph\":\"X\",\"pid\":1,\"tid\":");
+				line.append(Format(threadIndex));
+				line.append(U",\"ts\":");
+				line.append(detail::ToMicrosec(event.beginNanosec - origin));
+				line.append(U",\"dur\":");
+				line.append(detail::ToMicrosec(event.endNanosec - event.beginNanosec));
+				line.append(U",\"args\":{\"file\":\"");
+				detail::AppendEscaped(line, Unicode::Widen(event.site->file));
+				line.append(U"\",\"line\":");
+				line.append(Format(event.site->line));
+				line.append(U"}}");
+				writer.write(line);
+			}
+		}
+
+		writer.write(U"\n]}\n");
+
+		return true;
+	}
+}
@@ -0,0 +1,102 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <mutex>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/StringView.hpp>
+# include <Siv3D/ProfileZone.hpp>
+
+namespace s3d
+{
+	struct ProfileZoneEvent
+	{
+		const ProfileZoneSite* site = nullptr;
+
+		uint64 beginNanosec = 0;
+
+		uint64 endNanosec = 0;
+	};
+
+	/// @brief 1 つのスレッドが書き込むゾーンのリングバッファ
+	/// @remark 書き込みは所有スレッドのみが行い、読み出しは任意のスレッドから行えます。
+	class ProfileZoneBuffer
+	{
+	public:
+
+		/// @brief バッファに保持するイベントの最大数
+		static constexpr uint64 Capacity = (1 << 16);
+
+		SIV3D_NODISCARD_CXX20
+		explicit ProfileZoneBuffer(uint32 threadIndex);
+
+		void push(const ProfileZoneEvent& event) noexcept;
+
+		// 記録されているイベントを out に追加する
+		void read(Array<ProfileZoneEvent>& out) const;
+
+		// 記録されているイベントを読み出し対象から外す
+		void clear() noexcept;
+
+		[[nodiscard]]
+		uint32 getThreadIndex() const noexcept;
+
+	private:
+
+		static constexpr uint64 Mask = (Capacity - 1);
+
+		std::unique_ptr<ProfileZoneEvent[]> m_events;
+
+		// 次に書き込む位置（単調増加）
+		std::atomic<uint64> m_head{ 0 };
+
+		// clear() された位置
+		std::atomic<uint64> m_tail{ 0 };
+
+		uint32 m_threadIndex = 0;
+	};
+
+	/// @brief すべてのスレッドのゾーンのリングバッファを管理するクラス
+	class ProfileZoneRecorder
+	{
+	public:
+
+		[[nodiscard]]
+		static ProfileZoneRecorder& Get();
+
+		[[nodiscard]]
+		bool isEnabled() const noexcept
+		{
+			return m_enabled.load(std::memory_order_relaxed);
+		}
+
+		void setEnabled(bool enabled) noexcept;
+
+		// 現在のスレッドのバッファを返す（初回は登録する）
+		[[nodiscard]]
+		ProfileZoneBuffer& getThreadBuffer();
+
+		void clear();
+
+		[[nodiscard]]
+		bool saveChromeTrace(FilePathView path);
+
+	private:
+
+		std::atomic<bool> m_enabled{ false };
+
+		std::mutex m_mutex;
+
+		Array<std::shared_ptr<ProfileZoneBuffer>> m_buffers;
+	};
+}
@@ -0,0 +1,38 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ProfileZone.hpp>
+# include <Siv3D/Time.hpp>
+# include "ProfileZoneRecorder.hpp"
+
+namespace s3d
+{
+	ProfileZone::ProfileZone(const ProfileZoneSite* site) noexcept
+	{
+		if (ProfileZoneRecorder::Get().isEnabled())
+		{
+			m_site = site;
+			m_beginNanosec = Time::GetNanosec();
+		}
+	}
+
+	ProfileZone::~ProfileZone()
+	{
+		if (not m_site)
+		{
+			return;
+		}
+
+		const uint64 endNanosec = Time::GetNanosec();
+
+		ProfileZoneRecorder::Get().getThreadBuffer().push({ m_site, m_beginNanosec, endNanosec });
+	}
+}
@@ -13,6 +13,7 @@
 # include <Siv3D/Profiler/IProfiler.hpp>
 # include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
+# include "ProfileZoneRecorder.hpp"
 
 namespace s3d
 {
@@ -32,5 +33,25 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(Profiler)->getStat();
 		}
+
+		void EnableZoneProfiling(const bool enabled)
+		{
+			ProfileZoneRecorder::Get().setEnabled(enabled);
+		}
+
+		bool IsZoneProfilingEnabled() noexcept
+		{
+			return ProfileZoneRecorder::Get().isEnabled();
+		}
+
+		void ClearZones()
+		{
+			ProfileZoneRecorder::Get().clear();
+		}
+
+		bool SaveChromeTrace(const FilePathView path)
+		{
+			return ProfileZoneRecorder::Get().saveChromeTrace(path);
+		}
 	}
 }
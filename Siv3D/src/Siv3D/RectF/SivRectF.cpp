@@ -576,6 +576,18 @@ namespace s3d
 		return *this;
 	}
 
+	void RectF::DrawBatch(const Array<RectF>& rects, const ColorF& color)
+	{
+		SIV3D_ENGINE(Renderer2D)->addRects(rects.data(), rects.size(), nullptr, color.toFloat4());
+	}
+
+	void RectF::DrawBatch(const Array<RectF>& rects, const Array<ColorF>& colors)
+	{
+		assert(rects.size() == colors.size());
+
+		SIV3D_ENGINE(Renderer2D)->addRects(rects.data(), Min(rects.size(), colors.size()), colors.data(), Float4{ 1.0f, 1.0f, 1.0f, 1.0f });
+	}
+
 	const RectF& RectF::draw(const ColorF(&colors)[4]) const
 	{
 		SIV3D_ENGINE(Renderer2D)->addRect(FloatRect{ x, y, (x + w), (y + h) },
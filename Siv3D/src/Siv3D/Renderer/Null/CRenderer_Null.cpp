@@ -16,8 +16,8 @@
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/Shader/IShader.hpp>
 # include <Siv3D/Mesh/IMesh.hpp>
-# include <Siv3D/Renderer2D/Null/CRenderer2D_Null.hpp>
-# include <Siv3D/Texture/Null/CTexture_Null.hpp>
+# include <Siv3D/Renderer2D/Software/CRenderer2D_Software.hpp>
+# include <Siv3D/Texture/Software/CTexture_Software.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 
 namespace s3d
@@ -41,8 +41,11 @@ namespace s3d
 	{
 		LOG_SCOPED_TRACE(U"CRenderer_Null::init()");
 
-		pTexture = static_cast<CTexture_Null*>(SIV3D_ENGINE(Texture));
-		pRenderer2D = static_cast<CRenderer2D_Null*>(SIV3D_ENGINE(Renderer2D));
+		pTexture = static_cast<CTexture_Software*>(SIV3D_ENGINE(Texture));
+		pRenderer2D = static_cast<CRenderer2D_Software*>(SIV3D_ENGINE(Renderer2D));
+
+		pTexture->init();
+		pRenderer2D->resizeScene(m_sceneSize);
 
 		SIV3D_ENGINE(Shader)->init();
 		SIV3D_ENGINE(Mesh)->init();
@@ -58,12 +61,14 @@ namespace s3d
 
 	void CRenderer_Null::clear()
 	{
+		pRenderer2D->clearScene(m_backgroundColor);
+
 		pRenderer2D->update();
 	}
 
 	void CRenderer_Null::flush()
 	{
-		// do nothing
+		pRenderer2D->flush();
 	}
 
 	bool CRenderer_Null::present()
@@ -83,13 +88,12 @@ namespace s3d
 
 	void CRenderer_Null::captureScreenshot()
 	{
-		// do nothing
+		m_screenCapture = pRenderer2D->getScene();
 	}
 
 	const Image& CRenderer_Null::getScreenCapture() const
 	{
-		static const Image emptyImage{};
-		return emptyImage;
+		return m_screenCapture;
 	}
 
 	void CRenderer_Null::setSceneResizeMode(ResizeMode)
@@ -102,14 +106,21 @@ namespace s3d
 		return(Scene::DefaultResizeMode);
 	}
 
-	void CRenderer_Null::setSceneBufferSize(Size)
+	void CRenderer_Null::setSceneBufferSize(const Size size)
 	{
-		// do nothing
+		if ((size.x <= 0) || (size.y <= 0))
+		{
+			return;
+		}
+
+		m_sceneSize = size;
+
+		pRenderer2D->resizeScene(m_sceneSize);
 	}
 
 	Size CRenderer_Null::getSceneBufferSize() const noexcept
 	{
-		return Size{ 0, 0 };
+		return m_sceneSize;
 	}
 
 	void CRenderer_Null::setSceneTextureFilter(const TextureFilter)
@@ -122,15 +133,14 @@ namespace s3d
 		return Scene::DefaultTextureFilter;
 	}
 
-	void CRenderer_Null::setBackgroundColor(const ColorF&)
+	void CRenderer_Null::setBackgroundColor(const ColorF& color)
 	{
-		// do nothing
+		m_backgroundColor = color;
 	}
 
 	const ColorF& CRenderer_Null::getBackgroundColor() const noexcept
 	{
-		static constexpr ColorF backgroundColor = Scene::DefaultBackgroundColor;
-		return backgroundColor;
+		return m_backgroundColor;
 	}
 
 	void CRenderer_Null::setLetterboxColor(const ColorF&)
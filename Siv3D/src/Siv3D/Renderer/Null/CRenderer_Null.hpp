@@ -11,19 +11,29 @@
 
 # pragma once
 # include <Siv3D/Common.hpp>
+# include <Siv3D/Scene.hpp>
+# include <Siv3D/Image.hpp>
 # include <Siv3D/Renderer/IRenderer.hpp>
 
 namespace s3d
 {
-	class CRenderer2D_Null;
-	class CTexture_Null;
+	class CRenderer2D_Software;
+	class CTexture_Software;
 
+	/// @brief Headless 用のレンダラ
+	/// @remark 2D 描画は CRenderer2D_Software によって CPU 上のシーン Image に描画されます。
 	class CRenderer_Null final : public ISiv3DRenderer
 	{
 	private:
 
-		CRenderer2D_Null* pRenderer2D = nullptr;
-		CTexture_Null* pTexture = nullptr;
+		CRenderer2D_Software* pRenderer2D = nullptr;
+		CTexture_Software* pTexture = nullptr;
+
+		Size m_sceneSize = Scene::DefaultSceneSize;
+
+		ColorF m_backgroundColor = Scene::DefaultBackgroundColor;
+
+		Image m_screenCapture;
 
 	public:
 
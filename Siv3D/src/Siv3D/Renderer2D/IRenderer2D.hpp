@@ -29,13 +29,13 @@
 # include <Siv3D/RenderTexture.hpp>
 # include <Siv3D/ConstantBuffer.hpp>
 # include <Siv3D/Mat3x2.hpp>
-# include <Siv3D/Particle2D.hpp>
 # include <Siv3D/ParticleSystem2DParameters.hpp>
 
 namespace s3d
 {
 	struct FloatRect;
 	struct ColorF;
+	struct Particle2DBuffer;
 
 	struct Renderer2DStat
 	{
@@ -67,12 +67,16 @@ namespace s3d
 
 		virtual void addRect(const FloatRect& rect, const Float4(&colors)[4]) = 0;
 
+		virtual void addRects(const RectF* rects, size_t count, const ColorF* colors, const Float4& color) = 0;
+
 		virtual void addRectFrame(const FloatRect& rect, float thickness, const Float4& innerColor, const Float4& outerColor) = 0;
 
 		virtual void addRectFrameTB(const FloatRect& rect, float thickness, const Float4& topColor, const Float4& bottomColor) = 0;
 
 		virtual void addCircle(const Float2& center, float r, const Float4& innerColor, const Float4& outerColor) = 0;
 
+		virtual void addCircles(const Circle* circles, size_t count, const ColorF* colors, const Float4& color) = 0;
+
 		virtual void addCircleFrame(const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor) = 0;
 
 		virtual void addCirclePie(const Float2& center, float r, float startAngle, float angle, const Float4& innerColor, const Float4& outerColor) = 0;
@@ -129,9 +133,9 @@ namespace s3d
 
 		virtual void addRoundRectShadow(const RoundRect& roundRect, float blur, const Float4& color, bool fill) = 0;
 
-		virtual void addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
-			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
-			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) = 0;
+		virtual void addParticles(const Particle2DBuffer& particles, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc) = 0;
+
+		virtual void addTexturedParticles(const Texture& texture, const Particle2DBuffer& particles, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc) = 0;
 
 
 		virtual Float4 getColorMul() const = 0;
@@ -0,0 +1,803 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "CRenderer2D_Software.hpp"
+# include <Siv3D/Error.hpp>
+# include <Siv3D/Resource.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ScopeGuard.hpp>
+# include <Siv3D/ProfileZone.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+# include <Siv3D/Renderer2D/CurrentBatchStateChanges.hpp>
+# include <Siv3D/Texture/Software/CTexture_Software.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		template <class Type>
+		static void GrowArray(Array<Type>& array, const size_t target)
+		{
+			if (target <= array.size())
+			{
+				return;
+			}
+
+			size_t newSize = Max<size_t>(array.size() * 2, 4096);
+
+			while (newSize < target)
+			{
+				newSize *= 2;
+			}
+
+			array.resize(newSize);
+		}
+	}
+
+	CRenderer2D_Software::CRenderer2D_Software()
+	{
+		// do nothing
+	}
+
+	CRenderer2D_Software::~CRenderer2D_Software()
+	{
+		LOG_SCOPED_TRACE(U"CRenderer2D_Software::~CRenderer2D_Software()");
+	}
+
+	void CRenderer2D_Software::init()
+	{
+		LOG_SCOPED_TRACE(U"CRenderer2D_Software::init()");
+
+		pTexture = static_cast<CTexture_Software*>(SIV3D_ENGINE(Texture));
+
+		// バッファ作成関数を作成
+		m_bufferCreator = [this](Vertex2D::IndexType vertexSize, Vertex2D::IndexType indexSize)
+		{
+			return requestBuffer(vertexSize, indexSize);
+		};
+
+		// シャドウ画像を作成
+		{
+			const Image boxShadowImage{ Resource(U"engine/texture/box-shadow/256.png") };
+
+			m_boxShadowTexture = std::make_unique<Texture>(boxShadowImage);
+
+			// GPU が無い環境でも起動できるように、失敗しても続行する
+			if (m_boxShadowTexture->isEmpty())
+			{
+				LOG_FAIL(U"CRenderer2D_Software: Failed to create a box-shadow texture");
+			}
+		}
+	}
+
+	void CRenderer2D_Software::update()
+	{
+		m_stat = {};
+	}
+
+	const Renderer2DStat& CRenderer2D_Software::getStat() const
+	{
+		return m_stat;
+	}
+
+	void CRenderer2D_Software::addLine(const LineStyle& style, const Float2& begin, const Float2& end, const float thickness, const Float4(&colors)[2])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildLine(style, m_bufferCreator, begin, end, thickness, colors, getMaxScaling()))
+		{
+			if (style.hasSquareDot())
+			{
+				pushDraw(indexCount, SoftwarePixelShader::SquareDot);
+			}
+			else if (style.hasRoundDot())
+			{
+				pushDraw(indexCount, SoftwarePixelShader::RoundDot);
+			}
+			else
+			{
+				pushDraw(indexCount, SoftwarePixelShader::Shape);
+			}
+		}
+	}
+
+	void CRenderer2D_Software::addTriangle(const Float2(&points)[3], const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(m_bufferCreator, points, color))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addTriangle(const Float2(&points)[3], const Float4(&colors)[3])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(m_bufferCreator, points, colors))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addRect(const FloatRect& rect, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(m_bufferCreator, rect, color))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addRect(const FloatRect& rect, const Float4(&colors)[4])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(m_bufferCreator, rect, colors))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addRects(const RectF* rects, size_t count, const ColorF* colors, const Float4& color)
+	{
+		while (count)
+		{
+			size_t numBuilt = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildRects(m_bufferCreator, rects, count, colors, color, numBuilt))
+			{
+				pushDraw(indexCount, SoftwarePixelShader::Shape);
+			}
+
+			if (numBuilt == 0)
+			{
+				break;
+			}
+
+			rects += numBuilt;
+			count -= numBuilt;
+
+			if (colors)
+			{
+				colors += numBuilt;
+			}
+		}
+	}
+
+	void CRenderer2D_Software::addRectFrame(const FloatRect& rect, const float thickness, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRectFrame(m_bufferCreator, rect, thickness, innerColor, outerColor))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addRectFrameTB(const FloatRect& rect, const float thickness, const Float4& topColor, const Float4& bottomColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRectFrameTB(m_bufferCreator, rect, thickness, topColor, bottomColor))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addCircle(const Float2& center, const float r, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircle(m_bufferCreator, center, r, innerColor, outerColor, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addCircles(const Circle* circles, size_t count, const ColorF* colors, const Float4& color)
+	{
+		const float scale = getMaxScaling();
+
+		while (count)
+		{
+			size_t numBuilt = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildCircles(m_bufferCreator, circles, count, colors, color, scale, numBuilt))
+			{
+				pushDraw(indexCount, SoftwarePixelShader::Shape);
+			}
+
+			if (numBuilt == 0)
+			{
+				break;
+			}
+
+			circles += numBuilt;
+			count -= numBuilt;
+
+			if (colors)
+			{
+				colors += numBuilt;
+			}
+		}
+	}
+
+	void CRenderer2D_Software::addCircleFrame(const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleFrame(m_bufferCreator, center, rInner, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addCirclePie(const Float2& center, const float r, const float startAngle, const float angle, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCirclePie(m_bufferCreator, center, r, startAngle, angle, innerColor, outerColor, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addCircleArc(const LineStyle& style, const Float2& center, const float rInner, const float startAngle, const float angle, const float thickness, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleArc(m_bufferCreator, style, center, rInner, startAngle, angle, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addCircleSegment(const Float2& center, const float r, const float startAngle, const float angle, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleSegment(m_bufferCreator, center, r, startAngle, angle, color, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addEllipse(const Float2& center, const float a, const float b, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipse(m_bufferCreator, center, a, b, innerColor, outerColor, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addEllipseFrame(const Float2& center, const float aInner, const float bInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipseFrame(m_bufferCreator, center, aInner, bInner, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addQuad(const FloatQuad& quad, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(m_bufferCreator, quad, color))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addQuad(const FloatQuad& quad, const Float4(&colors)[4])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(m_bufferCreator, quad, colors))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRect(const FloatRect& rect, const float w, const float h, const float r, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, color, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRect(const FloatRect& rect, const float w, const float h, const float r, const Float4& topColor, const Float4& bottomColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, topColor, bottomColor, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRectFrame(const RoundRect& outer, const RoundRect& inner, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(m_bufferCreator, m_buffer, outer, inner, color, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRectFrame(const RoundRect& outer, const RoundRect& inner, const Float4& topColor, const Float4& bottomColor)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(m_bufferCreator, m_buffer, outer, inner, topColor, bottomColor, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addLineString(const LineStyle& style, const Vec2* points, const size_t size, const Optional<Float2>& offset, const float thickness, const bool inner, const Float4& color, const CloseRing closeRing)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildLineString(m_bufferCreator, m_buffer, style, points, size, offset, thickness, inner, color, closeRing, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addLineString(const Vec2* points, const ColorF* colors, size_t size, const Optional<Float2>& offset, const float thickness, const bool inner, const CloseRing closeRing)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildDefaultLineString(m_bufferCreator, points, colors, size, offset, thickness, inner, closeRing, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addPolygon(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Optional<Float2>& offset, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, indices, offset, color))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addPolygon(const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addPolygonTransformed(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, float s, float c, const Float2& offset, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygonTransformed(m_bufferCreator, vertices, indices, s, c, offset, color))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addPolygonFrame(const Float2* points, const size_t size, const float thickness, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygonFrame(m_bufferCreator, m_buffer, points, size, thickness, color, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Shape);
+		}
+	}
+
+	void CRenderer2D_Software::addNullVertices(const uint32)
+	{
+		// 頂点をカスタム頂点シェーダで生成する描画は再現できないので何もしない
+	}
+
+	void CRenderer2D_Software::addTextureRegion(const Texture& texture, const FloatRect& rect, const FloatRect& uv, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTextureRegion(m_bufferCreator, rect, uv, color))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, texture);
+		}
+	}
+
+	void CRenderer2D_Software::addTextureRegion(const Texture& texture, const FloatRect& rect, const FloatRect& uv, const Float4(&colors)[4])
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTextureRegion(m_bufferCreator, rect, uv, colors))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, texture);
+		}
+	}
+
+	void CRenderer2D_Software::addTexturedCircle(const Texture& texture, const Circle& circle, const FloatRect& uv, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedCircle(m_bufferCreator, circle, uv, color, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, texture);
+		}
+	}
+
+	void CRenderer2D_Software::addTexturedQuad(const Texture& texture, const FloatQuad& quad, const FloatRect& uv, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedQuad(m_bufferCreator, quad, uv, color))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, texture);
+		}
+	}
+
+	void CRenderer2D_Software::addTexturedRoundRect(const Texture& texture, const FloatRect& rect, const float w, const float h, const float r, const FloatRect& uvRect, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, uvRect, color, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, texture);
+		}
+	}
+
+	void CRenderer2D_Software::addTexturedVertices(const Texture& texture, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedVertices(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, texture);
+		}
+	}
+
+	void CRenderer2D_Software::addRectShadow(const FloatRect& rect, const float blur, const Float4& color, const bool fill)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRectShadow(m_bufferCreator, rect, blur, color, fill))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, getBoxShadowTexture());
+		}
+	}
+
+	void CRenderer2D_Software::addCircleShadow(const Circle& circle, const float blur, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleShadow(m_bufferCreator, circle, blur, color, getMaxScaling()))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, getBoxShadowTexture());
+		}
+	}
+
+	void CRenderer2D_Software::addRoundRectShadow(const RoundRect& roundRect, const float blur, const Float4& color, const bool fill)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectShadow(m_bufferCreator, roundRect, blur, color, getMaxScaling(), fill))
+		{
+			pushDraw(indexCount, SoftwarePixelShader::Texture, getBoxShadowTexture());
+		}
+	}
+
+	void CRenderer2D_Software::addParticles(const Particle2DBuffer& particles, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
+	{
+		Vertex2DBuilder::BuildParticles(m_bufferCreator, particles, colorOverLifeTimeFunc, [&](const Vertex2D::IndexType indexCount)
+			{
+				pushDraw(indexCount, SoftwarePixelShader::Shape);
+			});
+	}
+
+	void CRenderer2D_Software::addTexturedParticles(const Texture& texture, const Particle2DBuffer& particles, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
+	{
+		Vertex2DBuilder::BuildParticles(m_bufferCreator, particles, colorOverLifeTimeFunc, [&](const Vertex2D::IndexType indexCount)
+			{
+				pushDraw(indexCount, SoftwarePixelShader::Texture, texture);
+			});
+	}
+
+
+	Float4 CRenderer2D_Software::getColorMul() const
+	{
+		return m_currentState.colorMul;
+	}
+
+	Float4 CRenderer2D_Software::getColorAdd() const
+	{
+		return m_currentState.colorAdd;
+	}
+
+	void CRenderer2D_Software::setColorMul(const Float4& color)
+	{
+		m_currentState.colorMul = color;
+	}
+
+	void CRenderer2D_Software::setColorAdd(const Float4& color)
+	{
+		m_currentState.colorAdd = color;
+	}
+
+	BlendState CRenderer2D_Software::getBlendState() const
+	{
+		return m_currentState.blendState;
+	}
+
+	RasterizerState CRenderer2D_Software::getRasterizerState() const
+	{
+		return m_currentState.rasterizerState;
+	}
+
+	SamplerState CRenderer2D_Software::getSamplerState(const ShaderStage shaderStage, const uint32 slot) const
+	{
+		if (shaderStage == ShaderStage::Vertex)
+		{
+			return m_currentVSSamplerStates[slot];
+		}
+		else
+		{
+			return m_currentPSSamplerStates[slot];
+		}
+	}
+
+	void CRenderer2D_Software::setBlendState(const BlendState& state)
+	{
+		m_currentState.blendState = state;
+	}
+
+	void CRenderer2D_Software::setRasterizerState(const RasterizerState& state)
+	{
+		m_currentState.rasterizerState = state;
+	}
+
+	void CRenderer2D_Software::setSamplerState(const ShaderStage shaderStage, const uint32 slot, const SamplerState& state)
+	{
+		if (shaderStage == ShaderStage::Vertex)
+		{
+			m_currentVSSamplerStates[slot] = state;
+		}
+		else
+		{
+			m_currentPSSamplerStates[slot] = state;
+
+			// 標準のピクセルシェーダが使うのはスロット 0 のみ
+			if (slot == 0)
+			{
+				m_currentState.samplerState = state;
+			}
+		}
+	}
+
+	void CRenderer2D_Software::setScissorRect(const Rect& rect)
+	{
+		m_currentState.scissorRect = rect;
+	}
+
+	Rect CRenderer2D_Software::getScissorRect() const
+	{
+		return m_currentState.scissorRect;
+	}
+
+	void CRenderer2D_Software::setViewport(const Optional<Rect>& viewport)
+	{
+		m_currentState.viewport = viewport;
+	}
+
+	Optional<Rect> CRenderer2D_Software::getViewport() const
+	{
+		return m_currentState.viewport;
+	}
+
+	void CRenderer2D_Software::setSDFParameters(const std::array<Float4, 3>& params)
+	{
+		m_currentSDFParams = params;
+	}
+
+	void CRenderer2D_Software::setInternalPSConstants(const Float4& value)
+	{
+		m_currentInternalPSConstants = value;
+	}
+
+	Optional<VertexShader> CRenderer2D_Software::getCustomVS() const
+	{
+		return m_currentCustomVS;
+	}
+
+	Optional<PixelShader> CRenderer2D_Software::getCustomPS() const
+	{
+		return m_currentCustomPS;
+	}
+
+	void CRenderer2D_Software::setCustomVS(const Optional<VertexShader>& vs)
+	{
+		if (vs && (not vs->isEmpty()))
+		{
+			m_currentCustomVS = *vs;
+		}
+		else
+		{
+			m_currentCustomVS.reset();
+		}
+	}
+
+	void CRenderer2D_Software::setCustomPS(const Optional<PixelShader>& ps)
+	{
+		if (ps && (not ps->isEmpty()))
+		{
+			m_currentCustomPS = *ps;
+		}
+		else
+		{
+			m_currentCustomPS.reset();
+		}
+	}
+
+	const Mat3x2& CRenderer2D_Software::getLocalTransform() const
+	{
+		return m_currentLocalTransform;
+	}
+
+	const Mat3x2& CRenderer2D_Software::getCameraTransform() const
+	{
+		return m_currentCameraTransform;
+	}
+
+	void CRenderer2D_Software::setLocalTransform(const Mat3x2& matrix)
+	{
+		m_currentLocalTransform = matrix;
+		m_currentState.transform = (m_currentLocalTransform * m_currentCameraTransform);
+		m_currentMaxScaling = detail::CalculateMaxScaling(m_currentState.transform);
+	}
+
+	void CRenderer2D_Software::setCameraTransform(const Mat3x2& matrix)
+	{
+		m_currentCameraTransform = matrix;
+		m_currentState.transform = (m_currentLocalTransform * m_currentCameraTransform);
+		m_currentMaxScaling = detail::CalculateMaxScaling(m_currentState.transform);
+	}
+
+	float CRenderer2D_Software::getMaxScaling() const noexcept
+	{
+		return m_currentMaxScaling;
+	}
+
+	void CRenderer2D_Software::setVSTexture(const uint32, const Optional<Texture>&)
+	{
+		// カスタムシェーダを実行しないので何もしない
+	}
+
+	void CRenderer2D_Software::setPSTexture(const uint32, const Optional<Texture>&)
+	{
+		// 標準のピクセルシェーダは描画時に指定されたテクスチャのみを使う
+	}
+
+	void CRenderer2D_Software::setRenderTarget(const Optional<RenderTexture>& rt)
+	{
+		m_currentRT = rt;
+	}
+
+	Optional<RenderTexture> CRenderer2D_Software::getRenderTarget() const
+	{
+		return m_currentRT;
+	}
+
+	void CRenderer2D_Software::setConstantBuffer(ShaderStage, uint32, const ConstantBufferBase&, const float*, uint32)
+	{
+		// カスタムシェーダを実行しないので何もしない
+	}
+
+	const Texture& CRenderer2D_Software::getBoxShadowTexture() const noexcept
+	{
+		return *m_boxShadowTexture;
+	}
+
+	void CRenderer2D_Software::flush()
+	{
+		SIV3D_PROFILE_SCOPE(U"Renderer2D::flush");
+
+		ScopeGuard cleanUp = [this]()
+		{
+			m_vertexCount = 0;
+			m_indexCount = 0;
+			m_baseVertex = 0;
+			m_commands.clear();
+			m_states.clear();
+			m_passes.clear();
+			m_reservedTextures.clear();
+			m_currentCustomVS.reset();
+			m_currentCustomPS.reset();
+		};
+
+		if (not m_commands)
+		{
+			return;
+		}
+
+		// 状態ごとに、ピクセルシェーダが参照するテクスチャを解決する
+		Array<const Image*> textures(m_states.size(), nullptr);
+
+		for (size_t i = 0; i < m_states.size(); ++i)
+		{
+			const auto& state = m_states[i];
+
+			if ((state.pixelShader == SoftwarePixelShader::Texture)
+				&& (not state.textureID.isInvalid()))
+			{
+				textures[i] = &pTexture->getTexture(state.textureID)->getImage();
+			}
+		}
+
+		for (const auto& pass : m_passes)
+		{
+			Image* pTarget = &m_scene;
+
+			if (pass.rt)
+			{
+				SoftwareTexture* rt = pTexture->getTexture(pass.rt->id());
+
+				if (not rt->isRenderTarget())
+				{
+					continue;
+				}
+
+				pTarget = &rt->getImage();
+			}
+
+			const size_t num_commands = (pass.commandEnd - pass.commandBegin);
+
+			m_rasterizer.draw(*pTarget, m_vertices.data(), m_indices.data(),
+				(m_commands.data() + pass.commandBegin), num_commands, m_states, textures);
+
+			for (size_t i = pass.commandBegin; i < pass.commandEnd; ++i)
+			{
+				++m_stat.drawCalls;
+				m_stat.triangleCount += (m_commands[i].indexCount / 3);
+			}
+		}
+	}
+
+	void CRenderer2D_Software::resizeScene(const Size& size)
+	{
+		m_scene.resize(size);
+	}
+
+	void CRenderer2D_Software::clearScene(const ColorF& color)
+	{
+		m_scene.fill(Color{ color });
+	}
+
+	const Image& CRenderer2D_Software::getScene() const noexcept
+	{
+		return m_scene;
+	}
+
+	Vertex2DBufferPointer CRenderer2D_Software::requestBuffer(const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize)
+	{
+		// インデックスは m_baseVertex からの相対値なので、Vertex2D::IndexType で表せなくなったら区切りを進める
+		if ((Largest<Vertex2D::IndexType> + 1u) < ((m_vertexCount - m_baseVertex) + vertexSize))
+		{
+			m_baseVertex = m_vertexCount;
+		}
+
+		detail::GrowArray(m_vertices, (m_vertexCount + vertexSize));
+		detail::GrowArray(m_indices, (m_indexCount + indexSize));
+
+		Vertex2D* const pVertex = (m_vertices.data() + m_vertexCount);
+		Vertex2D::IndexType* const pIndex = (m_indices.data() + m_indexCount);
+		const auto indexOffset = static_cast<Vertex2D::IndexType>(m_vertexCount - m_baseVertex);
+
+		m_vertexCount += vertexSize;
+		m_indexCount += indexSize;
+
+		return{ pVertex, pIndex, indexOffset };
+	}
+
+	void CRenderer2D_Software::pushDraw(const Vertex2D::IndexType indexCount, const SoftwarePixelShader pixelShader)
+	{
+		m_currentState.pixelShader = pixelShader;
+		m_currentState.textureID = Texture::IDType::InvalidValue();
+		pushCommand(indexCount);
+	}
+
+	void CRenderer2D_Software::pushDraw(const Vertex2D::IndexType indexCount, const SoftwarePixelShader pixelShader, const Texture& texture)
+	{
+		// flush() までテクスチャが解放されないように保持する
+		m_reservedTextures.try_emplace(texture.id(), texture);
+
+		m_currentState.pixelShader = pixelShader;
+		m_currentState.textureID = texture.id();
+		pushCommand(indexCount);
+	}
+
+	void CRenderer2D_Software::pushCommand(const Vertex2D::IndexType indexCount)
+	{
+		if ((not m_states) || (m_states.back() != m_currentState))
+		{
+			m_states.push_back(m_currentState);
+		}
+
+		if ((not m_passes) || (m_passes.back().rt != m_currentRT))
+		{
+			const uint32 commandIndex = static_cast<uint32>(m_commands.size());
+			m_passes.push_back({ m_currentRT, commandIndex, commandIndex });
+		}
+
+		RenderPass& pass = m_passes.back();
+		const uint32 stateIndex = static_cast<uint32>(m_states.size() - 1);
+		const uint32 startIndex = (m_indexCount - indexCount);
+
+		// 直前のコマンドと状態が同じで、インデックスが連続していればまとめる
+		if (pass.commandBegin < pass.commandEnd)
+		{
+			SoftwareDrawCommand& last = m_commands.back();
+
+			if ((last.stateIndex == stateIndex)
+				&& (last.baseVertex == m_baseVertex)
+				&& ((last.startIndex + last.indexCount) == startIndex))
+			{
+				last.indexCount += indexCount;
+				return;
+			}
+		}
+
+		m_commands.push_back({ stateIndex, m_baseVertex, startIndex, indexCount });
+		pass.commandEnd = static_cast<uint32>(m_commands.size());
+	}
+}
@@ -11,17 +11,25 @@
 
 # pragma once
 # include <Siv3D/Common.hpp>
+# include <Siv3D/HashTable.hpp>
 # include <Siv3D/Renderer2D/IRenderer2D.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+# include "SoftwareRasterizer.hpp"
 
 namespace s3d
 {
-	class CRenderer2D_Null final : public ISiv3DRenderer2D
+	class CTexture_Software;
+
+	/// @brief Headless モードで使われる、CPU でラスタライズする 2D レンダラ
+	/// @remark 頂点とインデックスは GPU バックエンドと同じ Vertex2DBuilder で生成し、flush() で SoftwareRasterizer に渡します。
+	/// @remark カスタムシェーダは実行できないため、標準のピクセルシェーダ（shape, texture, square_dot, round_dot）で代用します。
+	class CRenderer2D_Software final : public ISiv3DRenderer2D
 	{
 	public:
 
-		CRenderer2D_Null();
+		CRenderer2D_Software();
 
-		~CRenderer2D_Null() override;
+		~CRenderer2D_Software() override;
 
 		void init() override;
 
@@ -39,12 +47,16 @@ namespace s3d
 
 		void addRect(const FloatRect& rect, const Float4(&colors)[4]) override;
 
+		void addRects(const RectF* rects, size_t count, const ColorF* colors, const Float4& color) override;
+
 		void addRectFrame(const FloatRect& rect, float thickness, const Float4& innerColor, const Float4& outerColor) override;
 
 		void addRectFrameTB(const FloatRect& rect, float thickness, const Float4& topColor, const Float4& bottomColor) override;
 
 		void addCircle(const Float2& center, float r, const Float4& innerColor, const Float4& outerColor) override;
 
+		void addCircles(const Circle* circles, size_t count, const ColorF* colors, const Float4& color) override;
+
 		void addCircleFrame(const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor) override;
 
 		void addCirclePie(const Float2& center, float r, float startAngle, float angle, const Float4& innerColor, const Float4& outerColor) override;
@@ -101,9 +113,9 @@ namespace s3d
 
 		void addRoundRectShadow(const RoundRect& roundRect, float blur, const Float4& color, bool fill) override;
 
-		void addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
-			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
-			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) override;
+		void addParticles(const Particle2DBuffer& particles, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc) override;
+
+		void addTexturedParticles(const Texture& texture, const Particle2DBuffer& particles, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc) override;
 
 
 		Float4 getColorMul() const override;
@@ -178,10 +190,82 @@ namespace s3d
 
 		void flush() override;
 
+		//
+		// Software
+		//
+
+		/// @brief シーンのサイズを変更します。
+		void resizeScene(const Size& size);
+
+		/// @brief シーンを指定した色で塗りつぶします。
+		void clearScene(const ColorF& color);
+
+		/// @brief シーンの Image を返します。
+		[[nodiscard]]
+		const Image& getScene() const noexcept;
+
 	private:
 
-		std::unique_ptr<Texture> m_emptyTexture;
+		struct RenderPass
+		{
+			Optional<RenderTexture> rt;
+
+			uint32 commandBegin = 0;
+
+			uint32 commandEnd = 0;
+		};
+
+		CTexture_Software* pTexture = nullptr;
+
+		// 頂点とインデックス
+		Array<Vertex2D> m_vertices;
+		uint32 m_vertexCount = 0;
+
+		Array<Vertex2D::IndexType> m_indices;
+		uint32 m_indexCount = 0;
+
+		// 現在の頂点バッファの区切りの先頭。インデックスはここからの相対値
+		uint32 m_baseVertex = 0;
+
+		Array<SoftwareDrawCommand> m_commands;
+		Array<SoftwareDrawState> m_states;
+		Array<RenderPass> m_passes;
+		BufferCreatorFunc m_bufferCreator;
+
+		// current
+		SoftwareDrawState m_currentState;
+		Mat3x2 m_currentLocalTransform	= Mat3x2::Identity();
+		Mat3x2 m_currentCameraTransform	= Mat3x2::Identity();
+		float m_currentMaxScaling		= 1.0f;
+		Optional<RenderTexture> m_currentRT;
+		Optional<VertexShader> m_currentCustomVS;
+		Optional<PixelShader> m_currentCustomPS;
+		std::array<SamplerState, SamplerState::MaxSamplerCount> m_currentVSSamplerStates;
+		std::array<SamplerState, SamplerState::MaxSamplerCount> m_currentPSSamplerStates;
+		Float4 m_currentInternalPSConstants{ 0.0f, 0.0f, 0.0f, 0.0f };
+		std::array<Float4, 3> m_currentSDFParams = { Float4{ 0.5f, 0.5f, 0.0f, 0.0f }, Float4{ 0.0f, 0.0f, 0.0f, 1.0f }, Float4{ 0.0f, 0.0f, 0.0f, 0.5f } };
+
+		// reserved
+		HashTable<Texture::IDType, Texture> m_reservedTextures;
+
+		SoftwareRasterizer m_rasterizer;
+
+		Image m_scene;
+
+		// VertexBuilder でのメモリアロケーションを避けるためのバッファ
+		Array<Float2> m_buffer;
+
+		std::unique_ptr<Texture> m_boxShadowTexture;
 
 		Renderer2DStat m_stat;
+
+		[[nodiscard]]
+		Vertex2DBufferPointer requestBuffer(Vertex2D::IndexType vertexSize, Vertex2D::IndexType indexSize);
+
+		void pushDraw(Vertex2D::IndexType indexCount, SoftwarePixelShader pixelShader);
+
+		void pushDraw(Vertex2D::IndexType indexCount, SoftwarePixelShader pixelShader, const Texture& texture);
+
+		void pushCommand(Vertex2D::IndexType indexCount);
 	};
 }
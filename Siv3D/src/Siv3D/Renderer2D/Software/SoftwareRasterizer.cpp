@@ -0,0 +1,521 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "SoftwareRasterizer.hpp"
+# include <Siv3D/Threading.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		inline constexpr float Saturate(const float x) noexcept
+		{
+			return ((x < 0.0f) ? 0.0f : ((1.0f < x) ? 1.0f : x));
+		}
+
+		// GLSL の mod()
+		[[nodiscard]]
+		inline float Mod(const float x, const float y) noexcept
+		{
+			return (x - y * std::floor(x / y));
+		}
+
+		[[nodiscard]]
+		inline float SmoothStep(const float edge0, const float edge1, const float x) noexcept
+		{
+			if (edge1 <= edge0)
+			{
+				return ((x < edge0) ? 0.0f : 1.0f);
+			}
+
+			const float t = Saturate((x - edge0) / (edge1 - edge0));
+			return (t * t * (3.0f - 2.0f * t));
+		}
+
+		[[nodiscard]]
+		inline Float4 ToFloat4(const Color c) noexcept
+		{
+			constexpr float s = (1.0f / 255.0f);
+			return{ (c.r * s), (c.g * s), (c.b * s), (c.a * s) };
+		}
+
+		[[nodiscard]]
+		inline uint8 ToUint8(const float x) noexcept
+		{
+			return static_cast<uint8>(Saturate(x) * 255.0f + 0.5f);
+		}
+
+		// テクスチャ座標をテクセルのインデックスに変換する。範囲外で境界色を使う場合は -1
+		[[nodiscard]]
+		inline int32 ResolveAddress(const int32 i, const int32 size, const TextureAddressMode mode) noexcept
+		{
+			switch (mode)
+			{
+			case TextureAddressMode::Repeat:
+				return (((i % size) + size) % size);
+			case TextureAddressMode::Mirror:
+				{
+					const int32 period = (size * 2);
+					const int32 m = (((i % period) + period) % period);
+					return ((m < size) ? m : (period - 1 - m));
+				}
+			case TextureAddressMode::Border:
+				return (((i < 0) || (size <= i)) ? -1 : i);
+			default:
+				return ((i < 0) ? 0 : ((size <= i) ? (size - 1) : i));
+			}
+		}
+
+		[[nodiscard]]
+		inline Float4 FetchTexel(const Image& image, const SamplerState& sampler, const int32 x, const int32 y) noexcept
+		{
+			const int32 ix = ResolveAddress(x, image.width(), sampler.addressU);
+			const int32 iy = ResolveAddress(y, image.height(), sampler.addressV);
+
+			if ((ix < 0) || (iy < 0))
+			{
+				return sampler.borderColor;
+			}
+
+			return ToFloat4(image.data()[iy * image.width() + ix]);
+		}
+
+		[[nodiscard]]
+		inline Float4 Sample(const Image& image, const SamplerState& sampler, const Float2 uv) noexcept
+		{
+			const float x = (uv.x * image.width());
+			const float y = (uv.y * image.height());
+
+			if (sampler.mag == TextureFilter::Nearest)
+			{
+				return FetchTexel(image, sampler, static_cast<int32>(std::floor(x)), static_cast<int32>(std::floor(y)));
+			}
+
+			const float fx = (x - 0.5f);
+			const float fy = (y - 0.5f);
+			const float x0 = std::floor(fx);
+			const float y0 = std::floor(fy);
+			const float tx = (fx - x0);
+			const float ty = (fy - y0);
+			const int32 ix = static_cast<int32>(x0);
+			const int32 iy = static_cast<int32>(y0);
+
+			const Float4 c00 = FetchTexel(image, sampler, ix, iy);
+			const Float4 c10 = FetchTexel(image, sampler, (ix + 1), iy);
+			const Float4 c01 = FetchTexel(image, sampler, ix, (iy + 1));
+			const Float4 c11 = FetchTexel(image, sampler, (ix + 1), (iy + 1));
+
+			return (c00.lerp(c10, tx)).lerp(c01.lerp(c11, tx), ty);
+		}
+
+		[[nodiscard]]
+		inline float RoundDotDistance(const Float2 uv) noexcept
+		{
+			const float t = Mod(uv.x, 2.0f);
+			const Float2 tex{ (std::abs(1.0f - t) * 2.0f), uv.y };
+			return (tex.dot(tex) * 0.5f);
+		}
+
+		[[nodiscard]]
+		inline Float4 GetBlendFactor(const Blend blend, const Float4& src, const Float4& dst) noexcept
+		{
+			switch (blend)
+			{
+			case Blend::Zero:
+				return{ 0.0f, 0.0f, 0.0f, 0.0f };
+			case Blend::SrcColor:
+			case Blend::Src1Color:
+				return src;
+			case Blend::InvSrcColor:
+			case Blend::InvSrc1Color:
+				return{ (1.0f - src.x), (1.0f - src.y), (1.0f - src.z), (1.0f - src.w) };
+			case Blend::SrcAlpha:
+			case Blend::Src1Alpha:
+				return{ src.w, src.w, src.w, src.w };
+			case Blend::InvSrcAlpha:
+			case Blend::InvSrc1Alpha:
+				return{ (1.0f - src.w), (1.0f - src.w), (1.0f - src.w), (1.0f - src.w) };
+			case Blend::DestAlpha:
+				return{ dst.w, dst.w, dst.w, dst.w };
+			case Blend::InvDestAlpha:
+				return{ (1.0f - dst.w), (1.0f - dst.w), (1.0f - dst.w), (1.0f - dst.w) };
+			case Blend::DestColor:
+				return dst;
+			case Blend::InvDestColor:
+				return{ (1.0f - dst.x), (1.0f - dst.y), (1.0f - dst.z), (1.0f - dst.w) };
+			case Blend::SrcAlphaSat:
+				{
+					const float f = Min(src.w, (1.0f - dst.w));
+					return{ f, f, f, 1.0f };
+				}
+			case Blend::InvBlendFactor:
+				// ブレンドファクターは常に (1, 1, 1, 1)
+				return{ 0.0f, 0.0f, 0.0f, 0.0f };
+			default: // One, BlendFactor
+				return{ 1.0f, 1.0f, 1.0f, 1.0f };
+			}
+		}
+
+		[[nodiscard]]
+		inline float ApplyBlendOp(const BlendOp op, const float src, const float dst, const float srcFactor, const float dstFactor) noexcept
+		{
+			switch (op)
+			{
+			case BlendOp::Subtract:
+				return ((src * srcFactor) - (dst * dstFactor));
+			case BlendOp::RevSubtract:
+				return ((dst * dstFactor) - (src * srcFactor));
+			case BlendOp::Min:
+				return Min(src, dst);
+			case BlendOp::Max:
+				return Max(src, dst);
+			default:
+				return ((src * srcFactor) + (dst * dstFactor));
+			}
+		}
+
+		inline void WritePixel(Color& pixel, const Float4& src, const BlendState& blendState) noexcept
+		{
+			Float4 result = src;
+
+			if (blendState.enable)
+			{
+				const Float4 dst = ToFloat4(pixel);
+				const Float4 srcFactor = GetBlendFactor(blendState.src, src, dst);
+				const Float4 dstFactor = GetBlendFactor(blendState.dst, src, dst);
+				const float srcAlphaFactor = GetBlendFactor(blendState.srcAlpha, src, dst).w;
+				const float dstAlphaFactor = GetBlendFactor(blendState.dstAlpha, src, dst).w;
+
+				result.x = ApplyBlendOp(blendState.op, src.x, dst.x, srcFactor.x, dstFactor.x);
+				result.y = ApplyBlendOp(blendState.op, src.y, dst.y, srcFactor.y, dstFactor.y);
+				result.z = ApplyBlendOp(blendState.op, src.z, dst.z, srcFactor.z, dstFactor.z);
+				result.w = ApplyBlendOp(blendState.opAlpha, src.w, dst.w, srcAlphaFactor, dstAlphaFactor);
+			}
+
+			if (blendState.writeR)
+			{
+				pixel.r = ToUint8(result.x);
+			}
+
+			if (blendState.writeG)
+			{
+				pixel.g = ToUint8(result.y);
+			}
+
+			if (blendState.writeB)
+			{
+				pixel.b = ToUint8(result.z);
+			}
+
+			if (blendState.writeA)
+			{
+				pixel.a = ToUint8(result.w);
+			}
+		}
+
+		// 辺 a -> b の関数値。三角形の内側で正になるように頂点を並べる
+		[[nodiscard]]
+		inline float EdgeFunction(const Float2& a, const Float2& b, const float px, const float py) noexcept
+		{
+			return ((b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x));
+		}
+
+		// ピクセル中心が辺上にあるときは、上辺と左辺のみを塗る（隣接する三角形で二重に塗らないため）
+		[[nodiscard]]
+		inline bool IsTopLeft(const Float2& a, const Float2& b) noexcept
+		{
+			const float dx = (b.x - a.x);
+			const float dy = (b.y - a.y);
+			return ((dy < 0.0f) || ((dy == 0.0f) && (0.0f < dx)));
+		}
+
+		// ピクセル中心 (x + 0.5) が v 以上になる最初の x
+		[[nodiscard]]
+		inline int32 PixelBegin(const float v, const int32 limit) noexcept
+		{
+			return static_cast<int32>(Clamp(std::ceil(v - 0.5f), -1.0f, static_cast<float>(limit)));
+		}
+
+		// ピクセル中心 (x + 0.5) が v 以下になる最後の x の次
+		[[nodiscard]]
+		inline int32 PixelEnd(const float v, const int32 limit) noexcept
+		{
+			return static_cast<int32>(Clamp((std::floor(v - 0.5f) + 1.0f), -1.0f, static_cast<float>(limit)));
+		}
+
+		[[nodiscard]]
+		inline bool IsInside(const float w, const bool topLeft) noexcept
+		{
+			return ((0.0f < w) || ((w == 0.0f) && topLeft));
+		}
+	}
+
+	size_t SoftwareRasterizer::draw(Image& target, const Vertex2D* vertices, const Vertex2D::IndexType* indices,
+		const SoftwareDrawCommand* commands, const size_t num_commands,
+		const Array<SoftwareDrawState>& states, const Array<const Image*>& textures)
+	{
+		if ((not target) || (num_commands == 0))
+		{
+			return 0;
+		}
+
+		const Rect targetRect{ target.size() };
+		const int32 tileCountX = ((targetRect.w + TileSize - 1) / TileSize);
+		const int32 tileCountY = ((targetRect.h + TileSize - 1) / TileSize);
+		const size_t tileCount = (static_cast<size_t>(tileCountX) * tileCountY);
+
+		// 状態ごとのクリッピング矩形（描画先 ∩ ビューポート ∩ シザー矩形）
+		m_clipRects.resize(states.size());
+
+		for (size_t i = 0; i < states.size(); ++i)
+		{
+			const auto& state = states[i];
+			Rect clip = targetRect;
+
+			if (state.viewport)
+			{
+				clip = clip.getOverlap(*state.viewport);
+			}
+
+			if (state.rasterizerState.scissorEnable)
+			{
+				clip = clip.getOverlap(state.scissorRect);
+			}
+
+			m_clipRects[i] = clip;
+		}
+
+		m_triangles.clear();
+
+		if (m_bins.size() < tileCount)
+		{
+			m_bins.resize(tileCount);
+		}
+
+		for (size_t i = 0; i < tileCount; ++i)
+		{
+			m_bins[i].clear();
+		}
+
+		// 三角形のセットアップとタイルへの振り分け
+		for (size_t commandIndex = 0; commandIndex < num_commands; ++commandIndex)
+		{
+			const SoftwareDrawCommand& command = commands[commandIndex];
+			const SoftwareDrawState& state = states[command.stateIndex];
+			const Rect& clip = m_clipRects[command.stateIndex];
+
+			if ((clip.w <= 0) || (clip.h <= 0))
+			{
+				continue;
+			}
+
+			const Float2 offset = (state.viewport ? Float2{ state.viewport->pos } : Float2{ 0.0f, 0.0f });
+			const CullMode cullMode = state.rasterizerState.cullMode;
+			const Vertex2D::IndexType* pIndex = (indices + command.startIndex);
+
+			for (uint32 t = 0; t < (command.indexCount / 3); ++t)
+			{
+				Triangle triangle;
+				triangle.i0 = (command.baseVertex + pIndex[t * 3 + 0]);
+				triangle.i1 = (command.baseVertex + pIndex[t * 3 + 1]);
+				triangle.i2 = (command.baseVertex + pIndex[t * 3 + 2]);
+				triangle.p0 = (state.transform.transformPoint(vertices[triangle.i0].pos) + offset);
+				triangle.p1 = (state.transform.transformPoint(vertices[triangle.i1].pos) + offset);
+				triangle.p2 = (state.transform.transformPoint(vertices[triangle.i2].pos) + offset);
+				triangle.stateIndex = command.stateIndex;
+
+				const float area = detail::EdgeFunction(triangle.p0, triangle.p1, triangle.p2.x, triangle.p2.y);
+
+				if ((area == 0.0f) || (not std::isfinite(area)))
+				{
+					continue;
+				}
+
+				// 画面上で時計回りの面を表とする
+				if (((cullMode == CullMode::Back) && (area < 0.0f))
+					|| ((cullMode == CullMode::Front) && (0.0f < area)))
+				{
+					continue;
+				}
+
+				if (area < 0.0f)
+				{
+					std::swap(triangle.p1, triangle.p2);
+					std::swap(triangle.i1, triangle.i2);
+				}
+
+				const float minX = Min({ triangle.p0.x, triangle.p1.x, triangle.p2.x });
+				const float minY = Min({ triangle.p0.y, triangle.p1.y, triangle.p2.y });
+				const float maxX = Max({ triangle.p0.x, triangle.p1.x, triangle.p2.x });
+				const float maxY = Max({ triangle.p0.y, triangle.p1.y, triangle.p2.y });
+
+				triangle.minX = Max(clip.x, detail::PixelBegin(minX, targetRect.w));
+				triangle.minY = Max(clip.y, detail::PixelBegin(minY, targetRect.h));
+				triangle.maxX = Min((clip.x + clip.w), detail::PixelEnd(maxX, targetRect.w));
+				triangle.maxY = Min((clip.y + clip.h), detail::PixelEnd(maxY, targetRect.h));
+
+				if ((triangle.maxX <= triangle.minX) || (triangle.maxY <= triangle.minY))
+				{
+					continue;
+				}
+
+				const uint32 triangleIndex = static_cast<uint32>(m_triangles.size());
+				m_triangles.push_back(triangle);
+
+				const int32 tileX0 = (triangle.minX / TileSize);
+				const int32 tileY0 = (triangle.minY / TileSize);
+				const int32 tileX1 = ((triangle.maxX - 1) / TileSize);
+				const int32 tileY1 = ((triangle.maxY - 1) / TileSize);
+
+				for (int32 tileY = tileY0; tileY <= tileY1; ++tileY)
+				{
+					for (int32 tileX = tileX0; tileX <= tileX1; ++tileX)
+					{
+						m_bins[static_cast<size_t>(tileY) * tileCountX + tileX].push_back(triangleIndex);
+					}
+				}
+			}
+		}
+
+		if (not m_triangles)
+		{
+			return 0;
+		}
+
+		// タイルごとに並列に塗りつぶす
+		Threading::ParallelFor(0, tileCount, [&](const size_t tileIndex)
+		{
+			const auto& bin = m_bins[tileIndex];
+
+			if (not bin)
+			{
+				return;
+			}
+
+			const int32 tileX = static_cast<int32>(tileIndex % tileCountX);
+			const int32 tileY = static_cast<int32>(tileIndex / tileCountX);
+			const Rect tile = Rect{ (tileX * TileSize), (tileY * TileSize), TileSize }.getOverlap(targetRect);
+
+			rasterizeTile(target, tile, bin, vertices, states, textures);
+		}, 1);
+
+		return m_triangles.size();
+	}
+
+	void SoftwareRasterizer::rasterizeTile(Image& target, const Rect& tile, const Array<uint32>& bin,
+		const Vertex2D* vertices, const Array<SoftwareDrawState>& states, const Array<const Image*>& textures) const
+	{
+		Color* const pixels = target.data();
+		const int32 width = target.width();
+
+		for (const uint32 triangleIndex : bin)
+		{
+			const Triangle& triangle = m_triangles[triangleIndex];
+			const SoftwareDrawState& state = states[triangle.stateIndex];
+			const Image* pTexture = textures[triangle.stateIndex];
+
+			const int32 x0 = Max(triangle.minX, tile.x);
+			const int32 y0 = Max(triangle.minY, tile.y);
+			const int32 x1 = Min(triangle.maxX, (tile.x + tile.w));
+			const int32 y1 = Min(triangle.maxY, (tile.y + tile.h));
+
+			if ((x1 <= x0) || (y1 <= y0))
+			{
+				continue;
+			}
+
+			const Float2& p0 = triangle.p0;
+			const Float2& p1 = triangle.p1;
+			const Float2& p2 = triangle.p2;
+			const float invArea = (1.0f / detail::EdgeFunction(p0, p1, p2.x, p2.y));
+
+			const bool topLeft0 = detail::IsTopLeft(p1, p2);
+			const bool topLeft1 = detail::IsTopLeft(p2, p0);
+			const bool topLeft2 = detail::IsTopLeft(p0, p1);
+
+			// 頂点シェーダ: Color = (VertexColor * g_colorMul)
+			const Vertex2D& v0 = vertices[triangle.i0];
+			const Vertex2D& v1 = vertices[triangle.i1];
+			const Vertex2D& v2 = vertices[triangle.i2];
+			const Float4 c0 = (v0.color * state.colorMul);
+			const Float4 c1 = (v1.color * state.colorMul);
+			const Float4 c2 = (v2.color * state.colorMul);
+
+			// x, y 方向に 1 ピクセル進んだときの重心座標の変化量
+			const float db0dx = (-(p2.y - p1.y) * invArea), db0dy = ((p2.x - p1.x) * invArea);
+			const float db1dx = (-(p0.y - p2.y) * invArea), db1dy = ((p0.x - p2.x) * invArea);
+			const float db2dx = (-(p1.y - p0.y) * invArea), db2dy = ((p1.x - p0.x) * invArea);
+			const Float2 duvdx = (v0.tex * db0dx + v1.tex * db1dx + v2.tex * db2dx);
+			const Float2 duvdy = (v0.tex * db0dy + v1.tex * db1dy + v2.tex * db2dy);
+
+			for (int32 y = y0; y < y1; ++y)
+			{
+				const float py = (y + 0.5f);
+				const float px0 = (x0 + 0.5f);
+				float w0 = detail::EdgeFunction(p1, p2, px0, py);
+				float w1 = detail::EdgeFunction(p2, p0, px0, py);
+				float w2 = detail::EdgeFunction(p0, p1, px0, py);
+				const float dw0 = -(p2.y - p1.y);
+				const float dw1 = -(p0.y - p2.y);
+				const float dw2 = -(p1.y - p0.y);
+
+				Color* pDst = (pixels + static_cast<size_t>(y) * width + x0);
+
+				for (int32 x = x0; x < x1; ++x, ++pDst, w0 += dw0, w1 += dw1, w2 += dw2)
+				{
+					if (not (detail::IsInside(w0, topLeft0)
+						&& detail::IsInside(w1, topLeft1)
+						&& detail::IsInside(w2, topLeft2)))
+					{
+						continue;
+					}
+
+					const float b0 = (w0 * invArea);
+					const float b1 = (w1 * invArea);
+					const float b2 = (w2 * invArea);
+					Float4 color = (c0 * b0 + c1 * b1 + c2 * b2);
+					const Float2 uv = (v0.tex * b0 + v1.tex * b1 + v2.tex * b2);
+
+					switch (state.pixelShader)
+					{
+					case SoftwarePixelShader::Texture:
+						if (pTexture)
+						{
+							color *= detail::Sample(*pTexture, state.samplerState, uv);
+						}
+						break;
+					case SoftwarePixelShader::SquareDot:
+						{
+							const float tr = uv.y;
+							const float d = std::abs(detail::Mod(uv.x, 3.0f) - 1.0f);
+							const float range = (1.0f - tr);
+							color.w *= ((d < range) ? 1.0f : (d < 1.0f) ? ((1.0f - d) / tr) : 0.0f);
+							break;
+						}
+					case SoftwarePixelShader::RoundDot:
+						{
+							const float dist = detail::RoundDotDistance(uv);
+							const float delta = (std::abs(detail::RoundDotDistance(uv + duvdx) - dist)
+								+ std::abs(detail::RoundDotDistance(uv + duvdy) - dist));
+							color.w *= (1.0f - detail::SmoothStep((0.5f - delta), 0.5f, dist));
+							break;
+						}
+					default:
+						break;
+					}
+
+					detail::WritePixel(*pDst, (color + state.colorAdd), state.blendState);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,143 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/Vertex2D.hpp>
+# include <Siv3D/BlendState.hpp>
+# include <Siv3D/RasterizerState.hpp>
+# include <Siv3D/SamplerState.hpp>
+# include <Siv3D/Texture.hpp>
+# include <Siv3D/Mat3x2.hpp>
+
+namespace s3d
+{
+	/// @brief ソフトウェアレンダラが再現する標準ピクセルシェーダ
+	enum class SoftwarePixelShader : uint8
+	{
+		// shape.frag
+		Shape,
+
+		// texture.frag
+		Texture,
+
+		// square_dot.frag
+		SquareDot,
+
+		// round_dot.frag
+		RoundDot,
+	};
+
+	/// @brief 描画コマンドごとのパイプラインの状態
+	struct SoftwareDrawState
+	{
+		Mat3x2 transform = Mat3x2::Identity();
+
+		Float4 colorMul{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+		Float4 colorAdd{ 0.0f, 0.0f, 0.0f, 0.0f };
+
+		BlendState blendState = BlendState::Default2D;
+
+		RasterizerState rasterizerState = RasterizerState::Default2D;
+
+		SamplerState samplerState = SamplerState::Default2D;
+
+		Rect scissorRect{ 0 };
+
+		Optional<Rect> viewport;
+
+		Texture::IDType textureID = Texture::IDType::InvalidValue();
+
+		SoftwarePixelShader pixelShader = SoftwarePixelShader::Shape;
+
+		[[nodiscard]]
+		friend bool operator ==(const SoftwareDrawState& lhs, const SoftwareDrawState& rhs) noexcept
+		{
+			return (lhs.transform == rhs.transform)
+				&& (lhs.colorMul == rhs.colorMul)
+				&& (lhs.colorAdd == rhs.colorAdd)
+				&& (lhs.blendState == rhs.blendState)
+				&& (lhs.rasterizerState == rhs.rasterizerState)
+				&& (lhs.samplerState == rhs.samplerState)
+				&& (lhs.scissorRect == rhs.scissorRect)
+				&& (lhs.viewport == rhs.viewport)
+				&& (lhs.textureID == rhs.textureID)
+				&& (lhs.pixelShader == rhs.pixelShader);
+		}
+	};
+
+	/// @brief 1 回の描画コマンド
+	struct SoftwareDrawCommand
+	{
+		uint32 stateIndex = 0;
+
+		uint32 baseVertex = 0;
+
+		uint32 startIndex = 0;
+
+		uint32 indexCount = 0;
+	};
+
+	/// @brief タイルベースのソフトウェアラスタライザ
+	/// @remark 描画先をタイルに分割し、三角形をタイルごとに振り分けたあと、タイル単位でエンジンのスレッドプールで並列に塗りつぶします。
+	/// @remark 各タイルは描画コマンドの順番どおりに三角形を処理するため、ブレンドの結果は GPU と同じ順序になります。
+	/// @remark FillMode::Wireframe とマルチサンプルは再現せず、常に塗りつぶしで描画します。
+	class SoftwareRasterizer
+	{
+	public:
+
+		/// @brief タイルの一辺のピクセル数
+		static constexpr int32 TileSize = 64;
+
+		/// @brief 描画コマンドを描画先の Image に描画します。
+		/// @param target 描画先
+		/// @param vertices 頂点配列
+		/// @param indices インデックス配列
+		/// @param commands 描画コマンドの配列
+		/// @param num_commands 描画コマンドの個数
+		/// @param states 描画コマンドが参照する状態の配列
+		/// @param textures states と同じ並びの、ピクセルシェーダが参照するテクスチャ（無い場合は nullptr）
+		/// @return 描画した三角形の個数
+		size_t draw(Image& target, const Vertex2D* vertices, const Vertex2D::IndexType* indices,
+			const SoftwareDrawCommand* commands, size_t num_commands,
+			const Array<SoftwareDrawState>& states, const Array<const Image*>& textures);
+
+	private:
+
+		struct Triangle
+		{
+			Float2 p0, p1, p2;
+
+			uint32 i0, i1, i2;
+
+			uint32 stateIndex;
+
+			// 塗りつぶすピクセルの範囲 [min, max)
+			int32 minX, minY, maxX, maxY;
+		};
+
+		Array<Triangle> m_triangles;
+
+		// タイルごとの三角形のインデックス
+		Array<Array<uint32>> m_bins;
+
+		// 状態ごとのクリッピング矩形
+		Array<Rect> m_clipRects;
+
+		void rasterizeTile(Image& target, const Rect& tile, const Array<uint32>& bin,
+			const Vertex2D* vertices, const Array<SoftwareDrawState>& states, const Array<const Image*>& textures) const;
+	};
+}
@@ -13,6 +13,8 @@
 # include <Siv3D/FastMath.hpp>
 # include <Siv3D/Math.hpp>
 # include <Siv3D/OffsetCircular.hpp>
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/Threading.hpp>
 
 namespace s3d
 {
@@ -116,6 +118,82 @@ namespace s3d
 				: r <= 12.0f ? 8
 				: static_cast<Vertex2D::IndexType>(Min(64.0f, r * 0.2f + 6));
 		}
+
+		// バッチ描画で 1 回のバッファ要求に含める頂点数とインデックス数の上限
+		static constexpr uint32 MaxBatchVertexCount = 16384;
+
+		static constexpr uint32 MaxBatchIndexCount = (16384 * 3);
+
+		// 円の三角形ファン (i + 1, 0, i + 2) のインデックス。最後の三角形 (quality, 0, 1) は含まない
+		static const std::array<Vertex2D::IndexType, 768> CircleFanIndexTable = []()
+		{
+			std::array<Vertex2D::IndexType, 768> results{};
+
+			for (Vertex2D::IndexType i = 0; i < 254; ++i)
+			{
+				results[i * 3 + 0] = (i + 1);
+				results[i * 3 + 1] = 0;
+				results[i * 3 + 2] = (i + 2);
+			}
+
+			return results;
+		}();
+
+		[[nodiscard]]
+		inline __m128 LoadColor(const ColorF& color) noexcept
+		{
+			const __m128 rg = _mm_cvtpd_ps(_mm_loadu_pd(&color.r));
+			const __m128 ba = _mm_cvtpd_ps(_mm_loadu_pd(&color.b));
+			return _mm_movelh_ps(rg, ba);
+		}
+
+		// posTex: (x, y, u, v)
+		inline void StoreVertex(Vertex2D* pDst, const __m128 posTex, const __m128 color) noexcept
+		{
+			float* p = &pDst->pos.x;
+			_mm_storeu_ps(p, posTex);
+			_mm_storeu_ps((p + 4), color);
+		}
+
+		// この数以上のパーティクルは、頂点を複数のスレッドで書き込む
+		constexpr size_t ParallelParticleBuildThreshold = 4096;
+
+		// 1 回のタスクで頂点を書き込むパーティクルの最小数
+		constexpr size_t ParticleBuildGrainSize = 2048;
+
+		// Vertex2DBuilder::MaxParticlesPerBuffer 個のパーティクル（四角形）のインデックス
+		static const std::array<Vertex2D::IndexType, (Vertex2DBuilder::MaxParticlesPerBuffer * 6)> ParticleIndexTable = []()
+		{
+			std::array<Vertex2D::IndexType, (Vertex2DBuilder::MaxParticlesPerBuffer * 6)> results;
+
+			for (size_t n = 0; n < Vertex2DBuilder::MaxParticlesPerBuffer; ++n)
+			{
+				for (size_t i = 0; i < 6; ++i)
+				{
+					results[n * 6 + i] = static_cast<Vertex2D::IndexType>(n * 4 + RectIndexTable[i]);
+				}
+			}
+
+			return results;
+		}();
+
+		// pSrc の値に offset を加えて pDst に書き込む
+		inline void WriteIndicesWithOffset(Vertex2D::IndexType* pDst, const Vertex2D::IndexType* pSrc, const size_t count, const Vertex2D::IndexType offset) noexcept
+		{
+			const __m128i offset8 = _mm_set1_epi16(static_cast<short>(offset));
+			size_t i = 0;
+
+			for (; (i + 8) <= count; i += 8)
+			{
+				const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), _mm_add_epi16(src, offset8));
+			}
+
+			for (; i < count; ++i)
+			{
+				pDst[i] = static_cast<Vertex2D::IndexType>(pSrc[i] + offset);
+			}
+		}
 	}
 
 	namespace Vertex2DBuilder
@@ -416,6 +494,54 @@ namespace s3d
 			return indexSize;
 		}
 
+		Vertex2D::IndexType BuildRects(const BufferCreatorFunc& bufferCreator, const RectF* rects, const size_t count, const ColorF* colors, const Float4& color, size_t& numBuilt)
+		{
+			numBuilt = 0;
+
+			const size_t num = Min<size_t>(count, (detail::MaxBatchVertexCount / 4));
+
+			if (num == 0)
+			{
+				return 0;
+			}
+
+			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(num * 4), indexSize = static_cast<Vertex2D::IndexType>(num * 6);
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
+
+			if (not pVertex)
+			{
+				return 0;
+			}
+
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 commonColor = _mm_loadu_ps(&color.x);
+
+			for (size_t k = 0; k < num; ++k)
+			{
+				const RectF& rect = rects[k];
+				const __m128 col = (colors ? detail::LoadColor(colors[k]) : commonColor);
+				const __m128 lt = _mm_cvtpd_ps(_mm_loadu_pd(&rect.x)); // (l, t, 0, 0)
+				const __m128 wh = _mm_cvtpd_ps(_mm_loadu_pd(&rect.w)); // (w, h, 0, 0)
+				const __m128 ltrb = _mm_movelh_ps(lt, _mm_add_ps(lt, wh)); // (l, t, r, b)
+
+				detail::StoreVertex(pVertex++, lt, col);
+				detail::StoreVertex(pVertex++, _mm_shuffle_ps(ltrb, zero, _MM_SHUFFLE(0, 0, 1, 2)), col);
+				detail::StoreVertex(pVertex++, _mm_shuffle_ps(ltrb, zero, _MM_SHUFFLE(0, 0, 3, 0)), col);
+				detail::StoreVertex(pVertex++, _mm_movehl_ps(zero, ltrb), col);
+
+				const Vertex2D::IndexType vertexBase = static_cast<Vertex2D::IndexType>(indexOffset + k * 4);
+
+				for (Vertex2D::IndexType i = 0; i < 6; ++i)
+				{
+					*pIndex++ = (vertexBase + detail::RectIndexTable[i]);
+				}
+			}
+
+			numBuilt = num;
+
+			return indexSize;
+		}
+
 		Vertex2D::IndexType BuildRectFrame(const BufferCreatorFunc& bufferCreator, const FloatRect& rect, float thickness, const Float4& innerColor, const Float4& outerColor)
 		{
 			constexpr Vertex2D::IndexType vertexSize = 8, indexSize = 24;
@@ -556,6 +682,109 @@ namespace s3d
 			return indexSize;
 		}
 
+		Vertex2D::IndexType BuildCircles(const BufferCreatorFunc& bufferCreator, const Circle* circles, const size_t count, const ColorF* colors, const Float4& color, const float scale, size_t& numBuilt)
+		{
+			numBuilt = 0;
+
+			// 1 回のバッファ要求に収まる個数を求める
+			uint32 vertexSize = 0, indexSize = 0;
+			size_t num = 0;
+
+			for (; num < count; ++num)
+			{
+				const Vertex2D::IndexType quality = detail::CalculateCircleQuality(Abs(static_cast<float>(circles[num].r)) * scale);
+
+				if ((detail::MaxBatchVertexCount < (vertexSize + quality + 1))
+					|| (detail::MaxBatchIndexCount < (indexSize + quality * 3)))
+				{
+					break;
+				}
+
+				vertexSize += (quality + 1);
+				indexSize += (quality * 3);
+			}
+
+			if (num == 0)
+			{
+				return 0;
+			}
+
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(static_cast<Vertex2D::IndexType>(vertexSize), static_cast<Vertex2D::IndexType>(indexSize));
+
+			if (not pVertex)
+			{
+				return 0;
+			}
+
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 commonColor = _mm_loadu_ps(&color.x);
+			Vertex2D::IndexType vertexBase = indexOffset;
+
+			for (size_t k = 0; k < num; ++k)
+			{
+				const Circle& circle = circles[k];
+				const float r = static_cast<float>(circle.r);
+				const Vertex2D::IndexType quality = detail::CalculateCircleQuality(Abs(r) * scale);
+				const __m128 col = (colors ? detail::LoadColor(colors[k]) : commonColor);
+				const __m128 center = _mm_cvtpd_ps(_mm_loadu_pd(&circle.x)); // (cx, cy, 0, 0)
+				const __m128 center2 = _mm_movelh_ps(center, center);
+
+				// 中心
+				detail::StoreVertex(pVertex++, center, col);
+
+				// 周
+				if (quality <= detail::MaxSinCosTableQuality)
+				{
+					const float* pCS = &detail::GetSinCosTableStartPtr(quality)->x;
+					const __m128 r4 = _mm_set1_ps(r);
+					Vertex2D::IndexType i = 0;
+
+					for (; (i + 2) <= quality; i += 2)
+					{
+						const __m128 p = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(pCS + (i * 2)), r4), center2);
+						detail::StoreVertex(pVertex++, _mm_movelh_ps(p, zero), col);
+						detail::StoreVertex(pVertex++, _mm_movehl_ps(zero, p), col);
+					}
+
+					if (i < quality)
+					{
+						const __m128 cs = _mm_setr_ps(pCS[i * 2], pCS[i * 2 + 1], 0.0f, 0.0f);
+						detail::StoreVertex(pVertex++, _mm_add_ps(_mm_mul_ps(cs, r4), center), col);
+					}
+				}
+				else
+				{
+					const float radDelta = Math::TwoPiF / quality;
+					const float centerX = static_cast<float>(circle.x);
+					const float centerY = static_cast<float>(circle.y);
+
+					for (Vertex2D::IndexType i = 0; i < quality; ++i)
+					{
+						const float rad = (radDelta * i);
+						const auto [s, c] = FastMath::SinCos(rad);
+						detail::StoreVertex(pVertex++, _mm_setr_ps((centerX + r * c), (centerY - r * s), 0.0f, 0.0f), col);
+					}
+				}
+
+				// インデックス
+				{
+					const size_t fanIndexCount = ((quality - 1) * 3);
+					detail::WriteIndicesWithOffset(pIndex, detail::CircleFanIndexTable.data(), fanIndexCount, vertexBase);
+					pIndex += fanIndexCount;
+
+					*pIndex++ = (vertexBase + quality);
+					*pIndex++ = vertexBase;
+					*pIndex++ = (vertexBase + 1);
+				}
+
+				vertexBase += (quality + 1);
+			}
+
+			numBuilt = num;
+
+			return static_cast<Vertex2D::IndexType>(indexSize);
+		}
+
 		Vertex2D::IndexType BuildCircleFrame(const BufferCreatorFunc& bufferCreator, const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor, const float scale)
 		{
 			const float rOuter = (rInner + thickness);
@@ -3512,54 +3741,69 @@ namespace s3d
 			return indexCount;
 		}
 
-		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Array<Particle2D>& particles,
-			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
+		void BuildParticles(const BufferCreatorFunc& bufferCreator, const Particle2DBuffer& particles,
+			const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc, const std::function<void(Vertex2D::IndexType)>& onBuffer)
 		{
-			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(particles.size() * 4);
-			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(particles.size() * 6);
-			auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
+			const size_t head = particles.head;
+			const float* const pPositionX = (particles.positionX.data() + head);
+			const float* const pPositionY = (particles.positionY.data() + head);
+			const float* const pRotation = (particles.rotation.data() + head);
+			const float* const pSize = (particles.currentSize.data() + head);
+			const float* const pStartLifeTime = (particles.startLifeTime.data() + head);
+			const float* const pRemaining = (particles.remainingLifeTime.data() + head);
+			const Float4* const pStartColor = (particles.startColor.data() + head);
 
-			if (not pVertex)
-			{
-				return 0;
-			}
+			const size_t particleCount = particles.size();
 
-			for (const auto& particle : particles)
+			for (size_t offset = 0; offset < particleCount; offset += MaxParticlesPerBuffer)
 			{
-				const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
-				const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
+				const size_t count = Min((particleCount - offset), MaxParticlesPerBuffer);
+				const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(count * 4);
+				const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(count * 6);
+				auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
 
-				const float size_half = (size * 0.5f);
-				const float cx = particle.position.x;
-				const float cy = particle.position.y;
-
-				const float x = size_half;
-				const auto [s, c] = FastMath::SinCos(particle.rotation);
-				const float xc = x * c;
-				const float xs = x * s;
-
-				pVertex[0].set({ -xc + xs + cx, -xs - xc + cy }, 0.0f, 0.0f, color);
-				pVertex[1].set({ xc + xs + cx, xs - xc + cy }, 1.0f, 0.0f, color);
-				pVertex[2].set({ -xc - xs + cx, -xs + xc + cy }, 0.0f, 1.0f, color);
-				pVertex[3].set({ xc - xs + cx, xs + xc + cy }, 1.0f, 1.0f, color);
-				pVertex += 4;
-			}
-
-			{
-				Vertex2D::IndexType indexBase = indexOffset;
+				if (not pVertex)
+				{
+					return;
+				}
 
-				for (Vertex2D::IndexType n = 0; n < particles.size(); ++n)
+				const auto writeVertices = [&, pVertex = pVertex](const size_t beginIndex, const size_t endIndex)
 				{
-					for (Vertex2D::IndexType i = 0; i < 6; ++i)
+					for (size_t i = beginIndex; i < endIndex; ++i)
 					{
-						*pIndex++ = (indexBase + detail::RectIndexTable[i]);
+						const size_t n = (offset + i);
+						const Float4 color = (colorOverLifeTimeFunc
+							? colorOverLifeTimeFunc(pStartColor[n], pStartLifeTime[n], pRemaining[n]) : pStartColor[n]);
+						const __m128 col = _mm_loadu_ps(&color.x);
+
+						const float cx = pPositionX[n];
+						const float cy = pPositionY[n];
+						const float x = (pSize[n] * 0.5f);
+						const auto [s, c] = FastMath::SinCos(pRotation[n]);
+						const float xc = x * c;
+						const float xs = x * s;
+
+						Vertex2D* pDst = (pVertex + (i * 4));
+						detail::StoreVertex(pDst + 0, _mm_setr_ps((-xc + xs + cx), (-xs - xc + cy), 0.0f, 0.0f), col);
+						detail::StoreVertex(pDst + 1, _mm_setr_ps((xc + xs + cx), (xs - xc + cy), 1.0f, 0.0f), col);
+						detail::StoreVertex(pDst + 2, _mm_setr_ps((-xc - xs + cx), (-xs + xc + cy), 0.0f, 1.0f), col);
+						detail::StoreVertex(pDst + 3, _mm_setr_ps((xc - xs + cx), (xs + xc + cy), 1.0f, 1.0f), col);
 					}
+				};
 
-					indexBase += 4;
+				if (count < detail::ParallelParticleBuildThreshold)
+				{
+					writeVertices(0, count);
+				}
+				else
+				{
+					Threading::ParallelFor(0, count, writeVertices, detail::ParticleBuildGrainSize);
 				}
-			}
 
-			return indexSize;
+				detail::WriteIndicesWithOffset(pIndex, detail::ParticleIndexTable.data(), indexSize, indexOffset);
+
+				onBuffer(indexSize);
+			}
 		}
 	}
 }
@@ -20,8 +20,8 @@
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/YesNo.hpp>
 # include <Siv3D/PredefinedYesNo.hpp>
-# include <Siv3D/Particle2D.hpp>
 # include <Siv3D/ParticleSystem2DParameters.hpp>
+# include <Siv3D/ParticleSystem2D/Particle2DBuffer.hpp>
 # include "Vertex2DBufferPointer.hpp"
 
 namespace s3d
@@ -60,6 +60,13 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRect(const BufferCreatorFunc& bufferCreator, const FloatRect& rect, const Float4(&colors)[4]);
 
+		/// @brief 複数の長方形の頂点を 1 回のバッファ要求でまとめて作成します。
+		/// @param colors 長方形ごとの色。nullptr の場合はすべて color を使う
+		/// @param numBuilt 作成した長方形の個数。count より少ない場合、残りは再度呼び出して作成する
+		/// @return 作成したインデックスの個数
+		[[nodiscard]]
+		Vertex2D::IndexType BuildRects(const BufferCreatorFunc& bufferCreator, const RectF* rects, size_t count, const ColorF* colors, const Float4& color, size_t& numBuilt);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRectFrame(const BufferCreatorFunc& bufferCreator, const FloatRect& rect, float thickness, const Float4& innerColor, const Float4& outerColor);
 
@@ -69,6 +76,13 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildCircle(const BufferCreatorFunc& bufferCreator, const Float2& center, float r, const Float4& innerColor, const Float4& outerColor, float scale);
 
+		/// @brief 複数の円の頂点を 1 回のバッファ要求でまとめて作成します。
+		/// @param colors 円ごとの色。nullptr の場合はすべて color を使う
+		/// @param numBuilt 作成した円の個数。count より少ない場合、残りは再度呼び出して作成する
+		/// @return 作成したインデックスの個数
+		[[nodiscard]]
+		Vertex2D::IndexType BuildCircles(const BufferCreatorFunc& bufferCreator, const Circle* circles, size_t count, const ColorF* colors, const Float4& color, float scale, size_t& numBuilt);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildCircleFrame(const BufferCreatorFunc& bufferCreator, const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor, float scale);
 
@@ -165,8 +179,12 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRoundRectShadow(const BufferCreatorFunc& bufferCreator, const RoundRect& roundRect, float blur, const Float4& color, float scale, bool fill);
 
-		[[nodiscard]]
-		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Array<Particle2D>& particles,
-			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc);
+		// 1 回のバッファ確保で書き込むパーティクルの最大数（インデックスの数が Vertex2D::IndexType に収まる数）
+		inline constexpr size_t MaxParticlesPerBuffer = 10920;
+
+		// パーティクルの頂点をバッファに直接書き込む。MaxParticlesPerBuffer 個ごとにバッファを確保し、そのたびに onBuffer(インデックスの数) を呼ぶ
+		// パーティクルが多い場合は、頂点を複数のスレッドで書き込む
+		void BuildParticles(const BufferCreatorFunc& bufferCreator, const Particle2DBuffer& particles,
+			const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc, const std::function<void(Vertex2D::IndexType)>& onBuffer);
 	}
 }
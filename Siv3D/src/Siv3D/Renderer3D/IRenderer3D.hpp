@@ -53,6 +53,10 @@ namespace s3d
 
 		virtual void addTexturedMesh(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const TextureRegion& textureRegion, const PhongMaterial& material) = 0;
 
+		virtual void addMeshInstances(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, size_t count) = 0;
+
+		virtual void addTexturedMeshInstances(uint32 startIndex, uint32 indexCount, const Mesh& mesh, const Texture& texture, const PhongMaterial& material, const Mat4x4* transforms, const ColorF* colors, size_t count) = 0;
+
 		virtual void addLine3D(const Float3& begin, const Float3& end, const Float4(&colors)[2]) = 0;
 
 
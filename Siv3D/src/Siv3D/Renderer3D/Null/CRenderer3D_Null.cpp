@@ -38,6 +38,10 @@ namespace s3d
 
 	void CRenderer3D_Null::addTexturedMesh(uint32, uint32, const Mesh&, const TextureRegion&, const PhongMaterial&) {}
 
+	void CRenderer3D_Null::addMeshInstances(uint32, uint32, const Mesh&, const PhongMaterial&, const Mat4x4*, const ColorF*, size_t) {}
+
+	void CRenderer3D_Null::addTexturedMeshInstances(uint32, uint32, const Mesh&, const Texture&, const PhongMaterial&, const Mat4x4*, const ColorF*, size_t) {}
+
 	void CRenderer3D_Null::addLine3D(const Float3&, const Float3&, const Float4(&)[2]) {}
 
 	BlendState CRenderer3D_Null::getBlendState() const
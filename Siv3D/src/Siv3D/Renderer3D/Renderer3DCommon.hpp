@@ -33,6 +33,16 @@ namespace s3d
 		Float4 uvTransform = Float4{ 1.0f, 1.0f, 0.0f, 0.0f };
 	};
 
+	struct VSPerInstanceConstants3D // (VS slot-4)
+	{
+		// 1 回のインスタンス描画で送るインスタンスの最大数（uniform block の最小保証サイズ 16KB に収まる数）
+		static constexpr uint32 MaxInstances = 128;
+
+		Mat4x4 localToWorld[MaxInstances];
+
+		Float4 diffuseColor[MaxInstances];
+	};
+
 	struct PSPerFrameConstants3D // (PS slot-0)
 	{
 		Float4 globalAmbientColor = Float4{ Graphics3D::DefaultGlobalAmbientColor.rgb(), 0.0f };
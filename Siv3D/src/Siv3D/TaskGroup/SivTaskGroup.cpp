@@ -0,0 +1,39 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/TaskGroup.hpp>
+# include "TaskGroupDetail.hpp"
+
+namespace s3d
+{
+	TaskGroup::TaskGroup()
+		: pImpl{ std::make_shared<TaskGroupDetail>() } {}
+
+	TaskGroup::~TaskGroup()
+	{
+		pImpl->wait(false);
+	}
+
+	void TaskGroup::run(std::function<void()> task)
+	{
+		pImpl->run(std::move(task));
+	}
+
+	void TaskGroup::wait()
+	{
+		pImpl->wait(true);
+	}
+
+	size_t TaskGroup::num_pending() const noexcept
+	{
+		return pImpl->num_pending();
+	}
+}
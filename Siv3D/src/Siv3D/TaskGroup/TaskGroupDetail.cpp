@@ -0,0 +1,104 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <thread>
+# include <utility>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+# include <Siv3D/Threading/IThreading.hpp>
+# include "TaskGroupDetail.hpp"
+
+namespace s3d
+{
+	TaskGroup::TaskGroupDetail::TaskGroupDetail()
+	{
+		// do nothing
+	}
+
+	TaskGroup::TaskGroupDetail::~TaskGroupDetail()
+	{
+		// do nothing
+	}
+
+	void TaskGroup::TaskGroupDetail::run(std::function<void()> task)
+	{
+		if (not task)
+		{
+			return;
+		}
+
+		++m_pendingCount;
+
+		if (Siv3DEngine::isActive())
+		{
+			// タスクがグループより長生きしても安全なように、自身を共有する
+			auto self = shared_from_this();
+
+			if (SIV3D_ENGINE(Threading)->pushTask([self, task = std::move(task)]() { self->execute(task); }))
+			{
+				return;
+			}
+		}
+
+		execute(task);
+	}
+
+	void TaskGroup::TaskGroupDetail::wait(const bool rethrow)
+	{
+		while (m_pendingCount.load(std::memory_order_acquire) != 0)
+		{
+			if ((not Siv3DEngine::isActive())
+				|| (not SIV3D_ENGINE(Threading)->runPendingTask()))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		if (not rethrow)
+		{
+			return;
+		}
+
+		std::exception_ptr exception;
+		{
+			std::lock_guard lock{ m_exceptionMutex };
+			exception = std::exchange(m_exception, nullptr);
+		}
+
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+
+	size_t TaskGroup::TaskGroupDetail::num_pending() const noexcept
+	{
+		return m_pendingCount.load(std::memory_order_acquire);
+	}
+
+	void TaskGroup::TaskGroupDetail::execute(const std::function<void()>& task)
+	{
+		try
+		{
+			task();
+		}
+		catch (...)
+		{
+			std::lock_guard lock{ m_exceptionMutex };
+
+			if (not m_exception)
+			{
+				m_exception = std::current_exception();
+			}
+		}
+
+		m_pendingCount.fetch_sub(1, std::memory_order_acq_rel);
+	}
+}
@@ -0,0 +1,45 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <exception>
+# include <mutex>
+# include <Siv3D/TaskGroup.hpp>
+
+namespace s3d
+{
+	class TaskGroup::TaskGroupDetail : public std::enable_shared_from_this<TaskGroup::TaskGroupDetail>
+	{
+	public:
+
+		TaskGroupDetail();
+
+		~TaskGroupDetail();
+
+		void run(std::function<void()> task);
+
+		void wait(bool rethrow);
+
+		[[nodiscard]]
+		size_t num_pending() const noexcept;
+
+	private:
+
+		std::atomic<size_t> m_pendingCount = 0;
+
+		std::mutex m_exceptionMutex;
+
+		std::exception_ptr m_exception;
+
+		void execute(const std::function<void()>& task);
+	};
+}
@@ -0,0 +1,140 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/TextLayout.hpp>
+# include <Siv3D/Char.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/Font/IFont.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+
+namespace s3d
+{
+	TextLayout::TextLayout(const Font& font, String text)
+		: TextLayout{ font, std::move(text), static_cast<double>(font.fontSize()) } {}
+
+	TextLayout::TextLayout(const Font& font, String text, const double fontSize, const double lineHeightScale)
+		: m_font{ font }
+		, m_text{ std::move(text) }
+		, m_clusters{ m_font.getGlyphClusters(m_text) }
+		, m_fontSize{ fontSize }
+		, m_lineHeightScale{ lineHeightScale }
+	{
+		const Array<double> xAdvances = SIV3D_ENGINE(Font)->getXAdvances(m_font.id(), m_text, m_clusters, m_fontSize);
+		const double lineHeight = (m_font.height(m_fontSize) * m_lineHeightScale);
+
+		Line line;
+		line.region.h = lineHeight;
+
+		for (size_t i = 0; i < m_clusters.size(); ++i)
+		{
+			if (m_text[m_clusters[i].pos] == U'\n')
+			{
+				line.clusterEnd = i;
+				m_lines << line;
+
+				line.clusterBegin = (i + 1);
+				line.region.y += lineHeight;
+				line.region.w = 0.0;
+				continue;
+			}
+
+			if (i < xAdvances.size())
+			{
+				line.region.w += xAdvances[i];
+			}
+		}
+
+		line.clusterEnd = m_clusters.size();
+		m_lines << line;
+
+		m_size = SIV3D_ENGINE(Font)->region(m_font.id(), m_text, m_clusters, Vec2{ 0, 0 }, m_fontSize, m_lineHeightScale).size;
+	}
+
+	bool TextLayout::isEmpty() const noexcept
+	{
+		return m_text.isEmpty();
+	}
+
+	TextLayout::operator bool() const noexcept
+	{
+		return (not m_text.isEmpty());
+	}
+
+	const Font& TextLayout::font() const noexcept
+	{
+		return m_font;
+	}
+
+	const String& TextLayout::text() const noexcept
+	{
+		return m_text;
+	}
+
+	const Array<GlyphCluster>& TextLayout::clusters() const noexcept
+	{
+		return m_clusters;
+	}
+
+	double TextLayout::fontSize() const noexcept
+	{
+		return m_fontSize;
+	}
+
+	double TextLayout::lineHeightScale() const noexcept
+	{
+		return m_lineHeightScale;
+	}
+
+	const Array<TextLayout::Line>& TextLayout::lines() const noexcept
+	{
+		return m_lines;
+	}
+
+	SizeF TextLayout::size() const noexcept
+	{
+		return m_size;
+	}
+
+	RectF TextLayout::region(const Vec2& pos) const noexcept
+	{
+		return{ pos, m_size };
+	}
+
+	RectF TextLayout::regionAt(const Vec2& center) const noexcept
+	{
+		return{ Arg::center = center, m_size };
+	}
+
+	RectF TextLayout::draw(const Vec2& pos, const ColorF& color) const
+	{
+		return draw(TextStyle::Default(), pos, color);
+	}
+
+	RectF TextLayout::draw(const TextStyle& textStyle, const Vec2& pos, const ColorF& color) const
+	{
+		if (m_text.isEmpty())
+		{
+			return region(pos);
+		}
+
+		return SIV3D_ENGINE(Font)->draw(m_font.id(), m_text, m_clusters, pos, m_fontSize, textStyle, color, m_lineHeightScale);
+	}
+
+	RectF TextLayout::drawAt(const Vec2& center, const ColorF& color) const
+	{
+		return draw(TextStyle::Default(), regionAt(center).pos, color);
+	}
+
+	RectF TextLayout::drawAt(const TextStyle& textStyle, const Vec2& center, const ColorF& color) const
+	{
+		return draw(textStyle, regionAt(center).pos, color);
+	}
+}
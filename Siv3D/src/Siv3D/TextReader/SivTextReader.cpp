@@ -97,6 +97,11 @@ namespace s3d
 		return pImpl->readAll(s);
 	}
 
+	bool TextReader::readLineViews(String& buffer, Array<StringView>& lines)
+	{
+		return pImpl->readLineViews(buffer, lines);
+	}
+
 	TextEncoding TextReader::encoding() const noexcept
 	{
 		return pImpl->encoding();
@@ -15,9 +15,134 @@
 # include <Siv3D/Endian.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/UnicodeConverter.hpp>
+# include <Siv3D/SIMD.hpp>
 
 namespace s3d
 {
+	namespace detail
+	{
+		// [first, last) がすべて ASCII であるかを返す
+		[[nodiscard]]
+		static bool IsASCII(const uint8* first, const uint8* const last) noexcept
+		{
+		# if SIV3D_INTRINSIC(SSE)
+
+			for (; 16 <= (last - first); first += 16)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+
+				if (_mm_movemask_epi8(v))
+				{
+					return false;
+				}
+			}
+
+		# else
+
+			for (; 8 <= (last - first); first += 8)
+			{
+				uint64 v;
+				std::memcpy(&v, first, 8);
+
+				if (v & 0x8080808080808080ull)
+				{
+					return false;
+				}
+			}
+
+		# endif
+
+			for (; first != last; ++first)
+			{
+				if (0x80 <= *first)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// [first, last) で最初の改行または NUL の位置を返す。無い場合は last
+		[[nodiscard]]
+		static const uint8* FindLineEnd(const uint8* first, const uint8* last) noexcept
+		{
+			if (const void* p = std::memchr(first, '\n', (last - first)))
+			{
+				last = static_cast<const uint8*>(p);
+			}
+
+			if (const void* p = std::memchr(first, '\0', (last - first)))
+			{
+				last = static_cast<const uint8*>(p);
+			}
+
+			return last;
+		}
+
+		// [first, last) の末尾で、途中で途切れている UTF-8 の文字の先頭を返す。途切れていない場合は last
+		[[nodiscard]]
+		static const uint8* FindIncompleteTail(const uint8* first, const uint8* last) noexcept
+		{
+			for (int32 i = 1; (i <= 3) && ((last - first) >= i); ++i)
+			{
+				const uint8 c = *(last - i);
+
+				if ((c & 0xC0) == 0x80) // 後続バイト
+				{
+					continue;
+				}
+
+				const int32 length = ((c & 0xE0) == 0xC0) ? 2
+					: ((c & 0xF0) == 0xE0) ? 3
+					: ((c & 0xF8) == 0xF0) ? 4 : 1;
+
+				return ((i < length) ? (last - i) : last);
+			}
+
+			return last;
+		}
+
+		// UTF-8 の [first, last) を s の末尾に追加する。'\r' は取り除く
+		static void AppendUTF8(String& s, const uint8* first, const uint8* last)
+		{
+			const size_t oldSize = s.size();
+
+			if (IsASCII(first, last))
+			{
+				s.resize(oldSize + (last - first));
+
+				char32* pDst = (s.data() + oldSize);
+
+				if (std::memchr(first, '\r', (last - first)))
+				{
+					for (; first != last; ++first)
+					{
+						if (*first != '\r')
+						{
+							*pDst++ = *first;
+						}
+					}
+
+					s.resize(pDst - s.data());
+				}
+				else
+				{
+					for (; first != last; ++first)
+					{
+						*pDst++ = *first;
+					}
+				}
+			}
+			else
+			{
+				s.append(Unicode::FromUTF8(std::string_view{ reinterpret_cast<const char*>(first), static_cast<size_t>(last - first) }));
+
+				s.erase(std::remove((s.begin() + oldSize), s.end(), U'\r'), s.end());
+			}
+		}
+	}
+
 	TextReader::TextReaderDetail::TextReaderDetail()
 	{
 		// do nothing
@@ -103,6 +228,10 @@ namespace s3d
 		m_reader.reset();
 
 		m_info = {};
+
+		m_buffer.clear();
+		m_bufferPos = 0;
+		m_bufferSize = 0;
 	}
 
 	bool TextReader::TextReaderDetail::isOpen() const noexcept
@@ -146,65 +275,21 @@ namespace s3d
 
 		String line;
 
-		for (;;)
+		if (not appendLine(line))
 		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
-			{
-				if (line)
-				{
-					return line;
-				}
-
-				return none;
-			}
-
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
-			{
-				return line;
-			}
-			else if (codePoint != U'\r')
-			{
-				line.push_back(codePoint);
-			}
+			return none;
 		}
+
+		return line;
 	}
 
 	Array<String> TextReader::TextReaderDetail::readLines()
 	{
-		if (not m_info.isOpen) SIV3D_UNLIKELY
-		{
-			return{};
-		}
-
 		Array<String> lines;
-		String line;
-
-		for (;;)
-		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
-			{
-				if (line)
-				{
-					lines.push_back(std::move(line));
-				}
 
-				return lines;
-			}
+		readLines(lines);
 
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
-			{
-				lines.push_back(line);
-				line.clear();
-			}
-			else if (codePoint != U'\r')
-			{
-				line.push_back(codePoint);
-			}
-		}
+		return lines;
 	}
 
 	String TextReader::TextReaderDetail::readAll()
@@ -216,24 +301,9 @@ namespace s3d
 
 		String s;
 
-		for (;;)
-		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
-			{
-				return s;
-			}
+		appendAll(s, true);
 
-			if (codePoint == U'\0')
-			{
-				return s;
-			}
-			else if (codePoint != U'\r')
-			{
-				s.push_back(codePoint);
-			}
-		}
+		return s;
 	}
 
 	bool TextReader::TextReaderDetail::readChar(char32& ch)
@@ -275,29 +345,7 @@ namespace s3d
 			return false;
 		}
 
-		for (;;)
-		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
-			{
-				if (line)
-				{
-					return true;
-				}
-
-				return false;
-			}
-
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
-			{
-				return true;
-			}
-			else if (codePoint != U'\r')
-			{
-				line.push_back(codePoint);
-			}
-		}
+		return appendLine(line);
 	}
 
 	bool TextReader::TextReaderDetail::readLines(Array<String>& lines)
@@ -311,69 +359,63 @@ namespace s3d
 
 		String line;
 
-		for (;;)
+		while (appendLine(line))
 		{
-			char32 codePoint;
+			lines.push_back(line);
+			line.clear();
+		}
 
-			if (not readCodePoint(codePoint))
-			{
-				if (line)
-				{
-					lines.push_back(std::move(line));
-				}
+		return (not lines.isEmpty());
+	}
 
-				if (not lines)
-				{
-					return false;
-				}
+	bool TextReader::TextReaderDetail::readAll(String& s)
+	{
+		s.clear();
 
-				return true;
-			}
+		if (not m_info.isOpen) SIV3D_UNLIKELY
+		{
+			return false;
+		}
 
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
-			{
-				lines.push_back(line);
-				line.clear();
-			}
-			else if (codePoint != U'\r')
-			{
-				line.push_back(codePoint);
-			}
+		if (appendAll(s, true))
+		{
+			return true;
 		}
+
+		return (not s.isEmpty());
 	}
 
-	bool TextReader::TextReaderDetail::readAll(String& s)
+	bool TextReader::TextReaderDetail::readLineViews(String& buffer, Array<StringView>& lines)
 	{
-		s.clear();
+		buffer.clear();
+		lines.clear();
 
 		if (not m_info.isOpen) SIV3D_UNLIKELY
 		{
 			return false;
 		}
 
-		for (;;)
-		{
-			char32 codePoint;
+		// 残りのテキストをすべて変換してから、改行と NUL で区切る
+		appendAll(buffer, false);
 
-			if (not readCodePoint(codePoint))
-			{
-				if (not s)
-				{
-					return false;
-				}
+		const char32* first = buffer.data();
+		const char32* const last = (first + buffer.size());
 
-				return true;
-			}
+		while (first != last)
+		{
+			const char32* lineEnd = std::find_if(first, last, [](const char32 ch) { return ((ch == U'\n') || (ch == U'\0')); });
 
-			if (codePoint == U'\0')
-			{
-				return true;
-			}
-			else if (codePoint != U'\r')
+			lines.emplace_back(first, (lineEnd - first));
+
+			if (lineEnd == last)
 			{
-				s.push_back(codePoint);
+				break;
 			}
+
+			first = (lineEnd + 1);
 		}
+
+		return (not lines.isEmpty());
 	}
 
 	TextEncoding TextReader::TextReaderDetail::encoding() const noexcept
@@ -388,12 +430,32 @@ namespace s3d
 
 	bool TextReader::TextReaderDetail::readByte(uint8& c)
 	{
-		return m_reader->read(c);
+		if ((m_bufferPos == m_bufferSize)
+			&& (not fillBuffer()))
+		{
+			return false;
+		}
+
+		c = m_buffer[m_bufferPos++];
+
+		return true;
 	}
 
 	bool TextReader::TextReaderDetail::readTwoBytes(uint16& c)
 	{
-		return m_reader->read(c);
+		while ((m_bufferSize - m_bufferPos) < 2)
+		{
+			if (not fillBuffer())
+			{
+				m_bufferPos = m_bufferSize;
+				return false;
+			}
+		}
+
+		std::memcpy(&c, (m_buffer.data() + m_bufferPos), 2);
+		m_bufferPos += 2;
+
+		return true;
 	}
 
 	bool TextReader::TextReaderDetail::readUTF8(char32& c)
@@ -505,6 +567,172 @@ namespace s3d
 		return true;
 	}
 
+	bool TextReader::TextReaderDetail::fillBuffer()
+	{
+		const size_t remaining = (m_bufferSize - m_bufferPos);
+
+		if (m_buffer.size() < BufferSize)
+		{
+			m_buffer.resize(BufferSize);
+		}
+
+		if (remaining && m_bufferPos)
+		{
+			std::memmove(m_buffer.data(), (m_buffer.data() + m_bufferPos), remaining);
+		}
+
+		m_bufferPos = 0;
+		m_bufferSize = remaining;
+
+		const int64 readSize = m_reader->read((m_buffer.data() + remaining), static_cast<int64>(m_buffer.size() - remaining));
+
+		if (readSize <= 0)
+		{
+			return false;
+		}
+
+		m_bufferSize += static_cast<size_t>(readSize);
+
+		return true;
+	}
+
+	bool TextReader::TextReaderDetail::isUTF16() const noexcept
+	{
+		return ((m_info.encoding == TextEncoding::UTF16LE)
+			|| (m_info.encoding == TextEncoding::UTF16BE));
+	}
+
+	bool TextReader::TextReaderDetail::appendLine(String& line)
+	{
+		if (not isUTF16())
+		{
+			return appendLineUTF8(line);
+		}
+
+		const size_t oldSize = line.size();
+
+		for (;;)
+		{
+			char32 codePoint;
+
+			if (not readCodePoint(codePoint))
+			{
+				return (oldSize < line.size());
+			}
+
+			if ((codePoint == U'\n') || (codePoint == U'\0'))
+			{
+				return true;
+			}
+			else if (codePoint != U'\r')
+			{
+				line.push_back(codePoint);
+			}
+		}
+	}
+
+	bool TextReader::TextReaderDetail::appendAll(String& s, const bool stopAtNull)
+	{
+		if (not isUTF16())
+		{
+			return appendAllUTF8(s, stopAtNull);
+		}
+
+		for (;;)
+		{
+			char32 codePoint;
+
+			if (not readCodePoint(codePoint))
+			{
+				return false;
+			}
+
+			if (stopAtNull && (codePoint == U'\0'))
+			{
+				return true;
+			}
+			else if (codePoint != U'\r')
+			{
+				s.push_back(codePoint);
+			}
+		}
+	}
+
+	bool TextReader::TextReaderDetail::appendLineUTF8(String& line)
+	{
+		const size_t oldSize = line.size();
+
+		for (;;)
+		{
+			if ((m_bufferPos == m_bufferSize)
+				&& (not fillBuffer()))
+			{
+				return (oldSize < line.size());
+			}
+
+			const uint8* const first = (m_buffer.data() + m_bufferPos);
+			const uint8* const last = (m_buffer.data() + m_bufferSize);
+			const uint8* const lineEnd = detail::FindLineEnd(first, last);
+
+			if (lineEnd != last)
+			{
+				detail::AppendUTF8(line, first, lineEnd);
+				m_bufferPos += ((lineEnd - first) + 1);
+				return true;
+			}
+
+			// バッファの末尾で途切れている文字は、次に読み込んだバイトと合わせて変換する
+			const uint8* const tail = detail::FindIncompleteTail(first, last);
+			detail::AppendUTF8(line, first, tail);
+			m_bufferPos += (tail - first);
+
+			if ((tail != last) && (not fillBuffer()))
+			{
+				// ファイルの終端で途切れている
+				detail::AppendUTF8(line, (m_buffer.data() + m_bufferPos), (m_buffer.data() + m_bufferSize));
+				m_bufferPos = m_bufferSize;
+				return (oldSize < line.size());
+			}
+		}
+	}
+
+	bool TextReader::TextReaderDetail::appendAllUTF8(String& s, const bool stopAtNull)
+	{
+		for (;;)
+		{
+			if ((m_bufferPos == m_bufferSize)
+				&& (not fillBuffer()))
+			{
+				return false;
+			}
+
+			const uint8* const first = (m_buffer.data() + m_bufferPos);
+			const uint8* const last = (m_buffer.data() + m_bufferSize);
+
+			if (stopAtNull)
+			{
+				if (const void* p = std::memchr(first, '\0', (last - first)))
+				{
+					const uint8* const nullPos = static_cast<const uint8*>(p);
+					detail::AppendUTF8(s, first, nullPos);
+					m_bufferPos += ((nullPos - first) + 1);
+					return true;
+				}
+			}
+
+			const uint8* const tail = detail::FindIncompleteTail(first, last);
+			detail::AppendUTF8(s, first, tail);
+			m_bufferPos += (tail - first);
+
+			if ((tail != last) && (not fillBuffer()))
+			{
+				detail::AppendUTF8(s, (m_buffer.data() + m_bufferPos), (m_buffer.data() + m_bufferSize));
+				m_bufferPos = m_bufferSize;
+				return false;
+			}
+		}
+	}
+
 	bool TextReader::TextReaderDetail::readCodePoint(char32& codePoint)
 	{
 		if (m_info.encoding == TextEncoding::UTF16LE)
@@ -18,6 +18,9 @@ namespace s3d
 	{
 	private:
 
+		// ファイルから一度に読み込むバイト数
+		static constexpr size_t BufferSize = (64 * 1024);
+
 		std::unique_ptr<IReader> m_reader;
 
 		struct Info
@@ -27,6 +30,32 @@ namespace s3d
 			bool isOpen = false;
 		} m_info;
 
+		// 読み込み済みで、まだ文字に変換していないバイト列 [m_bufferPos, m_bufferSize)
+		Array<uint8> m_buffer;
+
+		size_t m_bufferPos = 0;
+
+		size_t m_bufferSize = 0;
+
+		// 未処理のバイトをバッファの先頭に移し、残りをファイルから読み込む。新たに読み込めなかった場合は false
+		[[nodiscard]]
+		bool fillBuffer();
+
+		[[nodiscard]]
+		bool isUTF16() const noexcept;
+
+		// 1 行を line の末尾に追加する。行末（改行または NUL）に達するか 1 文字以上読めた場合 true
+		[[nodiscard]]
+		bool appendLine(String& line);
+
+		// 残りのテキストを s の末尾に追加する。stopAtNull が true の場合 NUL で読み込みを終える。NUL に達した場合 true
+		bool appendAll(String& s, bool stopAtNull);
+
+		[[nodiscard]]
+		bool appendLineUTF8(String& line);
+
+		bool appendAllUTF8(String& s, bool stopAtNull);
+
 		[[nodiscard]]
 		bool readByte(uint8& c);
 
@@ -84,6 +113,8 @@ namespace s3d
 
 		bool readAll(String& s);
 
+		bool readLineViews(String& buffer, Array<StringView>& lines);
+
 		[[nodiscard]]
 		TextEncoding encoding() const noexcept;
 
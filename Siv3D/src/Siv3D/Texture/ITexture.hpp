@@ -23,7 +23,9 @@ namespace s3d
 
 		virtual ~ISiv3DTexture() = default;
 
-		virtual void updateAsyncTextureLoad(size_t maxUpdate) = 0;
+		// メインスレッド以外から要求されたテクスチャを作成し、作成したテクスチャのデータサイズ（バイト）を返す
+		// 少なくとも 1 つは作成し、合計が maxUploadBytes を超えた時点で終了する。Largest<size_t> の場合は作成せずにすべての要求を破棄する
+		virtual size_t updateAsyncTextureLoad(size_t maxUploadBytes) = 0;
 
 		virtual size_t getTextureCount() const = 0;
 
@@ -47,6 +49,12 @@ namespace s3d
 
 		virtual Texture::IDType createMSRT(const Size& size, const TextureFormat& format, HasDepth hasDepth, HasMipMap hasMipMap) = 0;
 
+		// 任意のスレッドから呼べる。GPU への転送は updateAsyncTextureLoad() で後のフレームに行われる
+		virtual Texture::IDType createDeferred(Image&& image, TextureDesc desc) = 0;
+
+		// createDeferred() で作成したテクスチャの転送が完了しているかを返す
+		virtual bool isReady(Texture::IDType handleID) = 0;
+
 		virtual void release(Texture::IDType handleID) = 0;
 
 		virtual Size getSize(Texture::IDType handleID) = 0;
@@ -64,7 +72,9 @@ namespace s3d
 		virtual bool fill(Texture::IDType handleID, const void* src, uint32 stride, bool wait) = 0;
 
 		virtual bool fillRegion(Texture::IDType handleID, const void* src, uint32 stride, const Rect& rect, bool wait) = 0;
-	
+
+		// 動的テクスチャの更新を予約する。同じテクスチャに対する未転送の更新は新しいもので置き換えられる
+		virtual bool fillAsync(Texture::IDType handleID, Image&& image) = 0;
 
 		virtual void clearRT(Texture::IDType handleID, const ColorF& color) = 0;
 
@@ -94,6 +94,12 @@ namespace s3d
 	Texture::Texture(const Icon& icon, const int32 size, const TextureDesc desc)
 		: Texture{ (detail::CheckEngine(), Icon::CreateImage(icon.type, icon.code, size)), desc } {}
 
+	Texture::Texture(DeferredUpload, Image&& image, const TextureDesc desc)
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Texture)->createDeferred(std::move(image), desc))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
+
 	Texture::~Texture() {}
 
 	int32 Texture::width() const
@@ -141,6 +147,11 @@ namespace s3d
 		return SIV3D_ENGINE(Texture)->hasDepth(m_handle->id());
 	}
 
+	bool Texture::isReady() const
+	{
+		return SIV3D_ENGINE(Texture)->isReady(m_handle->id());
+	}
+
 	Rect Texture::region(const int32 x, const int32 y) const
 	{
 		return{ x, y, size() };
@@ -12,20 +12,22 @@
 # pragma once
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Texture/ITexture.hpp>
+# include <Siv3D/AssetHandleManager/AssetHandleManager.hpp>
+# include "SoftwareTexture.hpp"
 
 namespace s3d
 {
-	class CTexture_Null final : public ISiv3DTexture
+	class CTexture_Software final : public ISiv3DTexture
 	{
-	private:
-
 	public:
 
-		CTexture_Null();
+		CTexture_Software();
+
+		~CTexture_Software() override;
 
-		~CTexture_Null() override;
+		void init();
 
-		void updateAsyncTextureLoad(size_t maxUpdate) override;
+		size_t updateAsyncTextureLoad(size_t maxUploadBytes) override;
 
 		size_t getTextureCount() const override;
 
@@ -49,6 +51,10 @@ namespace s3d
 
 		Texture::IDType createMSRT(const Size& size, const TextureFormat& format, HasDepth hasDepth, HasMipMap hasMipMap) override;
 
+		Texture::IDType createDeferred(Image&& image, TextureDesc desc) override;
+
+		bool isReady(Texture::IDType handleID) override;
+
 		void release(Texture::IDType handleID) override;
 
 		Size getSize(Texture::IDType handleID) override;
@@ -67,6 +73,8 @@ namespace s3d
 
 		bool fillRegion(Texture::IDType handleID, const void* src, uint32 stride, const Rect& rect, bool wait) override;
 
+		bool fillAsync(Texture::IDType handleID, Image&& image) override;
+
 
 		void clearRT(Texture::IDType handleID, const ColorF& color) override;
 
@@ -81,5 +89,17 @@ namespace s3d
 		void readRT(Texture::IDType handleID, Grid<Float4>& image) override;
 
 		void resolveMSRT(Texture::IDType handleID) override;
+
+		//
+		// Software
+		//
+
+		[[nodiscard]]
+		SoftwareTexture* getTexture(Texture::IDType handleID);
+
+	private:
+
+		// Texture の管理
+		AssetHandleManager<Texture::IDType, SoftwareTexture> m_textures{ U"Texture" };
 	};
 }
@@ -0,0 +1,216 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "SoftwareTexture.hpp"
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/Texture/TextureCommon.hpp>
+
+namespace s3d
+{
+	SoftwareTexture::SoftwareTexture(const Image& image, const TextureDesc desc)
+		: m_image{ image }
+		, m_format{ detail::IsSRGB(desc) ? TextureFormat::R8G8B8A8_Unorm_SRGB : TextureFormat::R8G8B8A8_Unorm }
+		, m_textureDesc{ desc }
+		, m_type{ TextureType::Default }
+		, m_initialized{ true } {}
+
+	SoftwareTexture::SoftwareTexture(const Image& image, const Array<Image>&, const TextureDesc desc)
+		: SoftwareTexture{ image, desc } {}
+
+	SoftwareTexture::SoftwareTexture(Dynamic, const Size& size, const void* pData, const uint32 stride, const TextureFormat& format, const TextureDesc desc)
+		: m_image{ size }
+		, m_format{ format }
+		, m_textureDesc{ desc }
+		, m_type{ TextureType::Dynamic }
+	{
+		if (not isRGBA8())
+		{
+			LOG_FAIL(U"SoftwareTexture: DynamicTexture is not supported in this format");
+			return;
+		}
+
+		if (pData)
+		{
+			FillByImage(m_image.data(), size, m_image.stride(), pData, stride, format);
+		}
+
+		m_initialized = true;
+	}
+
+	SoftwareTexture::SoftwareTexture(Render, const Size& size, const TextureFormat& format, const TextureDesc desc, const HasDepth hasDepth)
+		: m_image{ size, Color{ 0, 0 } }
+		, m_format{ format }
+		, m_textureDesc{ desc }
+		, m_type{ TextureType::Render }
+		, m_hasDepth{ hasDepth.getBool() }
+	{
+		if (not isRGBA8())
+		{
+			LOG_FAIL(U"SoftwareTexture: RenderTexture is not supported in this format");
+			return;
+		}
+
+		m_initialized = true;
+	}
+
+	SoftwareTexture::SoftwareTexture(Render, const Image& image, const TextureFormat& format, const TextureDesc desc, const HasDepth hasDepth)
+		: m_image{ image }
+		, m_format{ format }
+		, m_textureDesc{ desc }
+		, m_type{ TextureType::Render }
+		, m_hasDepth{ hasDepth.getBool() }
+		, m_initialized{ true } {}
+
+	SoftwareTexture::SoftwareTexture(MSRender, const Size& size, const TextureFormat& format, const TextureDesc desc, const HasDepth hasDepth)
+		: SoftwareTexture{ Render{}, size, format, desc, hasDepth }
+	{
+		m_type = TextureType::MSRender;
+	}
+
+	bool SoftwareTexture::isInitialized() const noexcept
+	{
+		return m_initialized;
+	}
+
+	bool SoftwareTexture::isRenderTarget() const noexcept
+	{
+		return ((m_type == TextureType::Render)
+			|| (m_type == TextureType::MSRender));
+	}
+
+	Size SoftwareTexture::getSize() const noexcept
+	{
+		return m_image.size();
+	}
+
+	TextureDesc SoftwareTexture::getDesc() const noexcept
+	{
+		return m_textureDesc;
+	}
+
+	TextureFormat SoftwareTexture::getFormat() const noexcept
+	{
+		return m_format;
+	}
+
+	bool SoftwareTexture::hasDepth() const noexcept
+	{
+		return m_hasDepth;
+	}
+
+	bool SoftwareTexture::fill(const ColorF& color)
+	{
+		if (m_type != TextureType::Dynamic)
+		{
+			return false;
+		}
+
+		m_image.fill(Color{ color });
+
+		return true;
+	}
+
+	bool SoftwareTexture::fillRegion(const ColorF& color, const Rect& rect)
+	{
+		if (m_type != TextureType::Dynamic)
+		{
+			return false;
+		}
+
+		const Size size = m_image.size();
+
+		if ((size.x < (rect.x + rect.w))
+			|| (size.y < (rect.y + rect.h)))
+		{
+			return false;
+		}
+
+		FillRegionByColor(m_image.data(), size, m_image.stride(), rect, color, m_format);
+
+		return true;
+	}
+
+	bool SoftwareTexture::fill(const void* src, const uint32 stride)
+	{
+		if (m_type != TextureType::Dynamic)
+		{
+			return false;
+		}
+
+		FillByImage(m_image.data(), m_image.size(), m_image.stride(), src, stride, m_format);
+
+		return true;
+	}
+
+	bool SoftwareTexture::fillRegion(const void* src, const uint32 stride, const Rect& rect)
+	{
+		if (m_type != TextureType::Dynamic)
+		{
+			return false;
+		}
+
+		const Size size = m_image.size();
+
+		if ((size.x < (rect.x + rect.w))
+			|| (size.y < (rect.y + rect.h)))
+		{
+			return false;
+		}
+
+		FillRegionByImage(m_image.data(), size, m_image.stride(), src, stride, rect, m_format);
+
+		return true;
+	}
+
+	void SoftwareTexture::clearRT(const ColorF& color)
+	{
+		if (not isRenderTarget())
+		{
+			return;
+		}
+
+		if (m_format.isSRGB())
+		{
+			m_image.fill(Color{ color.applySRGBCurve() });
+		}
+		else
+		{
+			m_image.fill(Color{ color });
+		}
+	}
+
+	void SoftwareTexture::readRT(Image& image) const
+	{
+		if (not isRenderTarget())
+		{
+			return;
+		}
+
+		image = m_image;
+	}
+
+	Image& SoftwareTexture::getImage() noexcept
+	{
+		return m_image;
+	}
+
+	const Image& SoftwareTexture::getImage() const noexcept
+	{
+		return m_image;
+	}
+
+	bool SoftwareTexture::isRGBA8() const noexcept
+	{
+		return ((m_format == TextureFormat::R8G8B8A8_Unorm)
+			|| (m_format == TextureFormat::R8G8B8A8_Unorm_SRGB));
+	}
+}
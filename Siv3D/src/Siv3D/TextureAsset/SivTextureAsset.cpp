@@ -173,7 +173,17 @@ namespace s3d
 
 	void TextureAsset::LoadAsync(const AssetNameView name)
 	{
-		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Texture, name, {});
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Texture, name, {}, AssetLoadPriority::Normal);
+	}
+
+	void TextureAsset::LoadAsync(const AssetNameView name, const AssetLoadPriority priority)
+	{
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Texture, name, {}, priority);
+	}
+
+	bool TextureAsset::CancelLoadAsync(const AssetNameView name)
+	{
+		return SIV3D_ENGINE(Asset)->cancelLoadAsync(AssetType::Texture, name);
 	}
 
 	void TextureAsset::Wait(const AssetNameView name)
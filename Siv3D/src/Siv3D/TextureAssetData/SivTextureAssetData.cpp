@@ -10,6 +10,8 @@
 //-----------------------------------------------
 
 # include <Siv3D/TextureAssetData.hpp>
+# include <Siv3D/ProfileZone.hpp>
+# include <Siv3D/MemoryReader.hpp>
 
 namespace s3d
 {
@@ -45,6 +47,8 @@ namespace s3d
 
 	bool TextureAssetData::load(const String& hint)
 	{
+		SIV3D_PROFILE_SCOPE(U"TextureAsset::load");
+
 		if (isUninitialized())
 		{
 			if (onLoad(*this, hint))
@@ -71,21 +75,26 @@ namespace s3d
 	{
 		if (isUninitialized())
 		{
-			setState(AssetState::AsyncLoading);
+			std::function<uint64()> read;
+
+			// 既定のロード関数でファイルから読み込む場合は、ファイルの読み込みを I/O ステージで行う
+			if (const auto pLoad = onLoad.target<bool(*)(TextureAssetData&, const String&)>();
+				pLoad && (*pLoad == DefaultLoad) && path && (not secondaryPath) && (not texture))
+			{
+				read = [this]()
+					{
+						m_fileData = Blob{ path };
+						return static_cast<uint64>(m_fileData.size());
+					};
+			}
 
-			m_task = Async([this, hint = hint]()
-				{
-					setState(onLoad(*this, hint) ? AssetState::Loaded : AssetState::Failed);
-				});
+			requestAsyncLoad(std::move(read), [this, hint = hint]() { return onLoad(*this, hint); });
 		}
 	}
 
 	void TextureAssetData::wait()
 	{
-		if (m_task.isValid())
-		{
-			m_task.get();
-		}
+		waitAsyncLoad();
 	}
 
 	void TextureAssetData::release()
@@ -97,6 +106,13 @@ namespace s3d
 
 		if (isAsyncLoading())
 		{
+			// 開始していないロードは取り消す
+			if (cancelAsync())
+			{
+				m_fileData.release();
+				return;
+			}
+
 			wait();
 		}
 
@@ -112,7 +128,12 @@ namespace s3d
 			return true;
 		}
 
-		if (asset.path)
+		if (asset.m_fileData)
+		{
+			asset.texture = Texture{ MemoryReader{ std::move(asset.m_fileData) }, asset.desc };
+			asset.m_fileData = Blob{};
+		}
+		else if (asset.path)
 		{
 			if (asset.secondaryPath)
 			{
@@ -0,0 +1,206 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "CThreading.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		// 1 スレッドあたりのチャンク数の目安（負荷の偏りを盗み合いで均す）
+		constexpr size_t ChunksPerThread = 4;
+
+		struct ParallelForState
+		{
+			const std::function<void(size_t, size_t)>* f = nullptr;
+
+			size_t beginIndex = 0;
+
+			size_t endIndex = 0;
+
+			size_t grainSize = 1;
+
+			size_t numChunks = 0;
+
+			std::atomic<size_t> nextChunk = 0;
+
+			std::atomic<size_t> finishedChunks = 0;
+
+			std::atomic<bool> failed = false;
+
+			std::mutex exceptionMutex;
+
+			std::exception_ptr exception;
+
+			void run()
+			{
+				for (;;)
+				{
+					const size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+
+					if (numChunks <= chunk)
+					{
+						return;
+					}
+
+					if (not failed.load(std::memory_order_relaxed))
+					{
+						const size_t chunkBegin = (beginIndex + chunk * grainSize);
+						const size_t chunkEnd = Min((chunkBegin + grainSize), endIndex);
+
+						try
+						{
+							(*f)(chunkBegin, chunkEnd);
+						}
+						catch (...)
+						{
+							std::lock_guard lock{ exceptionMutex };
+
+							if (not exception)
+							{
+								exception = std::current_exception();
+							}
+
+							failed = true;
+						}
+					}
+
+					finishedChunks.fetch_add(1, std::memory_order_acq_rel);
+				}
+			}
+		};
+	}
+
+	CThreading::CThreading()
+	{
+		// do nothing
+	}
+
+	CThreading::~CThreading()
+	{
+		LOG_SCOPED_TRACE(U"CThreading::~CThreading()");
+
+		m_workerCount = 0;
+
+		m_pool.stop();
+	}
+
+	void CThreading::init()
+	{
+		LOG_SCOPED_TRACE(U"CThreading::init()");
+
+	# if SIV3D_PLATFORM(WEB) && !defined(__EMSCRIPTEN_PTHREADS__)
+
+		const size_t numWorkers = 0;
+
+	# else
+
+		// 呼び出し元のスレッドも処理に参加するため、ワーカーは 1 つ少なくする
+		const size_t numWorkers = (Threading::GetConcurrency() - 1);
+
+	# endif
+
+		m_pool.start(numWorkers);
+
+		m_workerCount = m_pool.num_workers();
+
+		LOG_INFO(U"ℹ️ Thread pool started with {} worker threads"_fmt(m_workerCount.load()));
+	}
+
+	size_t CThreading::getWorkerCount() const noexcept
+	{
+		return m_workerCount.load(std::memory_order_relaxed);
+	}
+
+	void CThreading::parallelFor(const size_t beginIndex, const size_t endIndex, const std::function<void(size_t, size_t)>& f, size_t grainSize)
+	{
+		if (endIndex <= beginIndex)
+		{
+			return;
+		}
+
+		const size_t count = (endIndex - beginIndex);
+		const size_t numWorkers = getWorkerCount();
+
+		if (numWorkers == 0)
+		{
+			f(beginIndex, endIndex);
+			return;
+		}
+
+		if (grainSize == 0)
+		{
+			grainSize = Max<size_t>(1, (count / ((numWorkers + 1) * ChunksPerThread)));
+		}
+
+		const size_t numChunks = ((count + (grainSize - 1)) / grainSize);
+
+		if (numChunks <= 1)
+		{
+			f(beginIndex, endIndex);
+			return;
+		}
+
+		// 呼び出し元が先に戻っても、遅れて実行されたタスクが安全に終了できるよう共有する
+		auto state = std::make_shared<ParallelForState>();
+		state->f = &f;
+		state->beginIndex = beginIndex;
+		state->endIndex = endIndex;
+		state->grainSize = grainSize;
+		state->numChunks = numChunks;
+
+		const size_t numHelpers = Min(numWorkers, (numChunks - 1));
+
+		for (size_t i = 0; i < numHelpers; ++i)
+		{
+			m_pool.push([state]() { state->run(); });
+		}
+
+		state->run();
+
+		while (state->finishedChunks.load(std::memory_order_acquire) < numChunks)
+		{
+			if (not m_pool.runPendingTask())
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		if (state->exception)
+		{
+			std::rethrow_exception(state->exception);
+		}
+	}
+
+	bool CThreading::pushTask(std::function<void()> task)
+	{
+		if (getWorkerCount() == 0)
+		{
+			return false;
+		}
+
+		m_pool.push(std::move(task));
+
+		return true;
+	}
+
+	bool CThreading::runPendingTask()
+	{
+		if (getWorkerCount() == 0)
+		{
+			return false;
+		}
+
+		return m_pool.runPendingTask();
+	}
+}
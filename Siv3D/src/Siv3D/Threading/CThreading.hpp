@@ -0,0 +1,43 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include "IThreading.hpp"
+# include "WorkStealingThreadPool.hpp"
+
+namespace s3d
+{
+	class CThreading final : public ISiv3DThreading
+	{
+	public:
+
+		CThreading();
+
+		~CThreading() override;
+
+		void init() override;
+
+		size_t getWorkerCount() const noexcept override;
+
+		void parallelFor(size_t beginIndex, size_t endIndex, const std::function<void(size_t, size_t)>& f, size_t grainSize) override;
+
+		bool pushTask(std::function<void()> task) override;
+
+		bool runPendingTask() override;
+
+	private:
+
+		WorkStealingThreadPool m_pool;
+
+		std::atomic<size_t> m_workerCount = 0;
+	};
+}
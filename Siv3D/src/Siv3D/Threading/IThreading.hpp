@@ -0,0 +1,36 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <functional>
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	class SIV3D_NOVTABLE ISiv3DThreading
+	{
+	public:
+
+		static ISiv3DThreading* Create();
+
+		virtual ~ISiv3DThreading() = default;
+
+		virtual void init() = 0;
+
+		virtual size_t getWorkerCount() const noexcept = 0;
+
+		virtual void parallelFor(size_t beginIndex, size_t endIndex, const std::function<void(size_t, size_t)>& f, size_t grainSize) = 0;
+
+		virtual bool pushTask(std::function<void()> task) = 0;
+
+		virtual bool runPendingTask() = 0;
+	};
+}
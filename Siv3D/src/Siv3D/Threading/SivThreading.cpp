@@ -12,6 +12,8 @@
 # include <thread>
 # include <Siv3D/Threading.hpp>
 # include <Siv3D/Utility.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+# include "IThreading.hpp"
 
 namespace s3d
 {
@@ -22,5 +24,29 @@ namespace s3d
 			static const size_t n = Max<size_t>(1, std::thread::hardware_concurrency());
 			return n;
 		}
+
+		size_t GetWorkerCount() noexcept
+		{
+			if (not Siv3DEngine::isActive())
+			{
+				return 0;
+			}
+
+			return SIV3D_ENGINE(Threading)->getWorkerCount();
+		}
+
+		namespace detail
+		{
+			void ParallelForImpl(const size_t beginIndex, const size_t endIndex, const std::function<void(size_t, size_t)>& f, const size_t grainSize)
+			{
+				if (not Siv3DEngine::isActive())
+				{
+					f(beginIndex, endIndex);
+					return;
+				}
+
+				SIV3D_ENGINE(Threading)->parallelFor(beginIndex, endIndex, f, grainSize);
+			}
+		}
 	}
 }
@@ -0,0 +1,206 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "WorkStealingThreadPool.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 現在のスレッドが属するスレッドプールと、そのワーカー番号
+		static thread_local const WorkStealingThreadPool* tlsPool = nullptr;
+
+		static thread_local size_t tlsWorkerIndex = 0;
+	}
+
+	WorkStealingThreadPool::~WorkStealingThreadPool()
+	{
+		stop();
+	}
+
+	void WorkStealingThreadPool::start(const size_t numWorkers)
+	{
+		if (m_threads || (numWorkers == 0))
+		{
+			return;
+		}
+
+		m_stop = false;
+
+		for (size_t i = 0; i < numWorkers; ++i)
+		{
+			m_queues.push_back(std::make_unique<WorkerQueue>());
+		}
+
+		for (size_t i = 0; i < numWorkers; ++i)
+		{
+			m_threads.emplace_back([this, i]() { workerLoop(i); });
+		}
+	}
+
+	void WorkStealingThreadPool::stop()
+	{
+		if (not m_threads)
+		{
+			return;
+		}
+
+		{
+			std::lock_guard lock{ m_sleepMutex };
+			m_stop = true;
+		}
+
+		m_condition.notify_all();
+
+		for (auto& thread : m_threads)
+		{
+			thread.join();
+		}
+
+		m_threads.clear();
+		m_queues.clear();
+		m_pendingCount = 0;
+	}
+
+	size_t WorkStealingThreadPool::num_workers() const noexcept
+	{
+		return m_threads.size();
+	}
+
+	void WorkStealingThreadPool::push(Task task)
+	{
+		const size_t queueIndex = (detail::tlsPool == this)
+			? detail::tlsWorkerIndex
+			: (m_nextQueueIndex.fetch_add(1, std::memory_order_relaxed) % m_queues.size());
+
+		{
+			auto& queue = *m_queues[queueIndex];
+			std::lock_guard lock{ queue.mutex };
+			queue.tasks.push_back(std::move(task));
+		}
+
+		{
+			// m_sleepMutex の下で更新し、待機中のワーカーの起こし損ねを防ぐ
+			std::lock_guard lock{ m_sleepMutex };
+			++m_pendingCount;
+		}
+
+		m_condition.notify_one();
+	}
+
+	bool WorkStealingThreadPool::runPendingTask()
+	{
+		if (m_pendingCount.load(std::memory_order_acquire) == 0)
+		{
+			return false;
+		}
+
+		const size_t startIndex = (detail::tlsPool == this) ? detail::tlsWorkerIndex : 0;
+
+		Task task;
+
+		if (not tryTake(startIndex, task))
+		{
+			return false;
+		}
+
+		task();
+
+		return true;
+	}
+
+	bool WorkStealingThreadPool::popLocal(const size_t queueIndex, Task& task)
+	{
+		auto& queue = *m_queues[queueIndex];
+		std::lock_guard lock{ queue.mutex };
+
+		if (queue.tasks.empty())
+		{
+			return false;
+		}
+
+		// 自分のキューは後ろから (LIFO)
+		task = std::move(queue.tasks.back());
+		queue.tasks.pop_back();
+		return true;
+	}
+
+	bool WorkStealingThreadPool::steal(const size_t thiefIndex, Task& task)
+	{
+		const size_t numQueues = m_queues.size();
+
+		for (size_t i = 1; i < numQueues; ++i)
+		{
+			auto& queue = *m_queues[(thiefIndex + i) % numQueues];
+			std::unique_lock lock{ queue.mutex, std::try_to_lock };
+
+			if ((not lock) || queue.tasks.empty())
+			{
+				continue;
+			}
+
+			// 他のキューからは前から (FIFO)
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			return true;
+		}
+
+		return false;
+	}
+
+	bool WorkStealingThreadPool::tryTake(const size_t queueIndex, Task& task)
+	{
+		if (popLocal(queueIndex, task) || steal(queueIndex, task))
+		{
+			m_pendingCount.fetch_sub(1, std::memory_order_acq_rel);
+			return true;
+		}
+
+		return false;
+	}
+
+	void WorkStealingThreadPool::workerLoop(const size_t workerIndex)
+	{
+		detail::tlsPool = this;
+		detail::tlsWorkerIndex = workerIndex;
+
+		Task task;
+
+		for (;;)
+		{
+			if (tryTake(workerIndex, task))
+			{
+				task();
+				task = nullptr;
+				continue;
+			}
+
+			std::unique_lock lock{ m_sleepMutex };
+
+			if (m_stop)
+			{
+				break;
+			}
+
+			if (m_pendingCount.load(std::memory_order_acquire) != 0)
+			{
+				// try_to_lock で盗めなかったタスクが残っている
+				lock.unlock();
+				std::this_thread::yield();
+				continue;
+			}
+
+			m_condition.wait(lock, [this]() { return (m_stop || (m_pendingCount.load(std::memory_order_acquire) != 0)); });
+		}
+
+		detail::tlsPool = nullptr;
+	}
+}
@@ -0,0 +1,89 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+
+namespace s3d
+{
+	/// @brief ワーカーごとのタスクキューを持ち、暇なワーカーが他のキューからタスクを盗むスレッドプール
+	class WorkStealingThreadPool
+	{
+	public:
+
+		using Task = std::function<void()>;
+
+		WorkStealingThreadPool() = default;
+
+		~WorkStealingThreadPool();
+
+		WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+
+		WorkStealingThreadPool& operator =(const WorkStealingThreadPool&) = delete;
+
+		void start(size_t numWorkers);
+
+		void stop();
+
+		[[nodiscard]]
+		size_t num_workers() const noexcept;
+
+		/// @brief タスクを追加します。
+		/// @remark ワーカースレッドから呼ばれた場合はそのワーカーのキューに、それ以外の場合は各キューに順番に積まれます。
+		void push(Task task);
+
+		/// @brief キューに積まれているタスクを 1 つ取り出して、呼び出し元のスレッドで実行します。
+		/// @return タスクを実行した場合 true, キューが空だった場合 false
+		bool runPendingTask();
+
+	private:
+
+		struct WorkerQueue
+		{
+			std::mutex mutex;
+
+			std::deque<Task> tasks;
+		};
+
+		Array<std::unique_ptr<WorkerQueue>> m_queues;
+
+		Array<std::thread> m_threads;
+
+		std::mutex m_sleepMutex;
+
+		std::condition_variable m_condition;
+
+		std::atomic<size_t> m_pendingCount = 0;
+
+		std::atomic<size_t> m_nextQueueIndex = 0;
+
+		bool m_stop = false;
+
+		[[nodiscard]]
+		bool popLocal(size_t queueIndex, Task& task);
+
+		[[nodiscard]]
+		bool steal(size_t thiefIndex, Task& task);
+
+		[[nodiscard]]
+		bool tryTake(size_t queueIndex, Task& task);
+
+		void workerLoop(size_t workerIndex);
+	};
+}
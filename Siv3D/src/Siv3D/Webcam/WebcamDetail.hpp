@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <thread>
 # include <Siv3D/Webcam.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 
@@ -11,6 +11,7 @@
 
 # include "ZIPReaderDetail.hpp"
 # include <Siv3D/FileSystem.hpp>
+# include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include <ThirdParty/minizip/mz.h>
 # include <ThirdParty/minizip/mz_strm.h>
@@ -109,14 +110,12 @@ namespace s3d
 			}
 			else
 			{
-				const std::string archivePathC = Unicode::Narrow(path);
-				err = ::mz_zip_reader_open_file(m_reader, archivePathC.c_str());
+				err = openFile(path);
 			}
 
 		# else
 
-			const std::string archivePathC = Unicode::Narrow(path);
-			err = ::mz_zip_reader_open_file(m_reader, archivePathC.c_str());
+			err = openFile(path);
 
 		# endif
 
@@ -178,6 +177,8 @@ namespace s3d
 		m_archiveFileFullPath.clear();
 
 		::mz_zip_reader_delete(&m_reader); // 内部で m_reader = nullptr;
+
+		m_mappedFile.close();
 	}
 
 	bool ZIPReader::ZIPReaderDetail::isOpen() const noexcept
@@ -290,4 +291,33 @@ namespace s3d
 
 		return Blob{ std::move(data) };
 	}
+
+	int32 ZIPReader::ZIPReaderDetail::openFile(const FilePathView path)
+	{
+	# if not SIV3D_PLATFORM(WEB)
+
+		// ファイルからストリームで読むかわりに、メモリマップしたアーカイブを minizip に渡す
+		if (const int64 fileSize = FileSystem::FileSize(path);
+			(BinaryReader::MemoryMapThreshold <= fileSize) && (fileSize <= INT32_MAX))
+		{
+			if (m_mappedFile.open(path) && (m_mappedFile.mappedSize() == static_cast<size_t>(fileSize)))
+			{
+				const int32 err = ::mz_zip_reader_open_buffer(m_reader,
+					reinterpret_cast<uint8*>(const_cast<Byte*>(m_mappedFile.data())),
+					static_cast<int32>(fileSize), 0);
+
+				if (err == MZ_OK)
+				{
+					return err;
+				}
+			}
+
+			m_mappedFile.close();
+		}
+
+	# endif
+
+		const std::string archivePathC = Unicode::Narrow(path);
+		return ::mz_zip_reader_open_file(m_reader, archivePathC.c_str());
+	}
 }
@@ -12,6 +12,7 @@
 # pragma once
 # include <Siv3D/ZIPReader.hpp>
 # include <Siv3D/Unicode.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
 
 # if SIV3D_PLATFORM(WINDOWS)
 
@@ -105,10 +106,16 @@ namespace s3d
 
 		Array<FilePath> m_paths;
 
+		// BinaryReader::MemoryMapThreshold 以上のアーカイブは、メモリマップしてから読み込む
+		MemoryMappedFileView m_mappedFile;
+
 	# if SIV3D_PLATFORM(WINDOWS)
 
 		ZIPResourceHolder m_resource;
 
 	# endif
+
+		[[nodiscard]]
+		int32 openFile(FilePathView path);
 	};
 }
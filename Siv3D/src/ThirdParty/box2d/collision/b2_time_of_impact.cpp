@@ -29,9 +29,10 @@
 
 #include <stdio.h>
 
-B2_API float b2_toiTime, b2_toiMaxTime;
-B2_API int32 b2_toiCalls, b2_toiIters, b2_toiMaxIters;
-B2_API int32 b2_toiRootIters, b2_toiMaxRootIters;
+// Siv3D: profiling counters are thread_local so that independent worlds can be stepped in parallel (P2WorldGroup)
+B2_API thread_local float b2_toiTime, b2_toiMaxTime;
+B2_API thread_local int32 b2_toiCalls, b2_toiIters, b2_toiMaxIters;
+B2_API thread_local int32 b2_toiRootIters, b2_toiMaxRootIters;
 
 //
 struct b2SeparationFunction
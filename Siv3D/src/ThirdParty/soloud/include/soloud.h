@@ -141,6 +141,16 @@ namespace SoLoud
 		// ctor
 		TinyAlignedFloatBuffer();
 	};
+
+	//	[Siv3D]
+	//	Receives the mixed samples on the mixer thread. Must not block or allocate.
+	//	aBuffer holds aChannels planar channels, aBufferSize floats apart.
+	class AudioTap
+	{
+	public:
+		virtual ~AudioTap() = default;
+		virtual void write(const float *aBuffer, unsigned int aSamples, unsigned int aBufferSize, unsigned int aChannels) = 0;
+	};
 };
 
 #include "soloud_filter.h"
@@ -561,6 +571,8 @@ namespace SoLoud
 		float mFFTData[256];
 		// Snapshot of wave data for visualization
 		float mWaveData[256];
+		//	[Siv3D] Receives the final output after clipping
+		AudioTap *mTap;
 
 		// 3d listener position
 		float m3dPosition[3];
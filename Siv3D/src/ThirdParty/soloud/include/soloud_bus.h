@@ -95,6 +95,8 @@ namespace SoLoud
 		float mFFTData[256];
 		// Snapshot of wave data for visualization
 		float mWaveData[256];
+		//	[Siv3D] Receives the output of the bus before its filters
+		AudioTap *mTap;
 		// Internal: find the bus' channel
 		void findBusHandle();
 	};
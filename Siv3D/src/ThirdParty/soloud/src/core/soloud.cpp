@@ -126,6 +126,7 @@ namespace SoLoud
 		mBackendID = 0;
 		mActiveVoiceDirty = true;
 		mActiveVoiceCount = 0;
+		mTap = 0;
 		int i;
 		for (i = 0; i < VOICE_COUNT; i++)
 			mActiveVoice[i] = 0;
@@ -562,6 +563,20 @@ namespace SoLoud
 			if (ret != 0)
 				return ret;			
 		}
+#else
+		//	[Siv3D]
+		//	WITH_NULL を定義しないビルドでも、オフラインレンダリングのために出力デバイスを持たない初期化を行えるようにする
+		if (!inited &&
+			(aBackend == Soloud::NULLDRIVER))
+		{
+			if (aChannels == 0 || buffersize < SAMPLE_GRANULARITY)
+				return INVALID_PARAMETER;
+
+			postinit_internal(samplerate, buffersize, aFlags, aChannels);
+			mBackendString = "null driver";
+			inited = 1;
+			mBackendID = Soloud::NULLDRIVER;
+		}
 #endif
 
 		if (!inited && aBackend != Soloud::AUTO)
@@ -2197,6 +2212,12 @@ namespace SoLoud
 		// The buffers should be large enough for it, we just may do a few bytes of unneccessary work.
 		clip_internal(mOutputScratch, mScratch, aStride, globalVolume[0], globalVolume[1]);
 
+		//	[Siv3D]
+		if (mTap)
+		{
+			mTap->write(mScratch.mData, aSamples, aStride, mChannels);
+		}
+
 		if (mFlags & ENABLE_VISUALIZATION)
 		{
 			for (i = 0; i < MAX_CHANNELS; i++)
@@ -56,6 +56,12 @@ namespace SoLoud
 		
 		s->mixBus_internal(aBuffer, aSamplesToRead, aBufferSize, mScratch.mData, handle, mSamplerate, mChannels, mParent->mResampler);
 
+		//	[Siv3D]
+		if (mParent->mTap)
+		{
+			mParent->mTap->write(aBuffer, aSamplesToRead, aBufferSize, mChannels);
+		}
+
 		int i;
 		if (mParent->mFlags & AudioSource::VISUALIZATION_DATA)
 		{
@@ -124,6 +130,7 @@ namespace SoLoud
 		mInstance = 0;
 		mChannels = 2;
 		mResampler = SOLOUD_DEFAULT_RESAMPLER;
+		mTap = 0;
 		for (int i = 0; i < 256; i++)
 		{
 			mFFTData[i] = 0;
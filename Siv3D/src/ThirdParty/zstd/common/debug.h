@@ -32,6 +32,11 @@
 #ifndef DEBUG_H_12987983217
 #define DEBUG_H_12987983217
 
+//	[Siv3D] enable worker threads for Compression (numWorkers)
+#if !defined(ZSTD_MULTITHREAD) && !defined(__EMSCRIPTEN__)
+#  define ZSTD_MULTITHREAD
+#endif
+
 #if defined (__cplusplus)
 extern "C" {
 #endif
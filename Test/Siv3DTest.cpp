@@ -16,8 +16,16 @@
 # include "Siv3DTest.hpp"
 # include <unordered_map>
 
+# if defined(SIV3D_TEST_HEADLESS)
+
+SIV3D_SET(EngineOption::Renderer::Headless) // Siv3DHeadlessTest: 2D 描画を CRenderer2D_Software で行う
+
+# else
+
 // SIV3D_SET(EngineOption::Renderer::Headless) // Force non-graphical mode
 
+# endif
+
 void Main()
 {
 	Console.open();
@@ -82,6 +82,51 @@ TEST_CASE("Array::parallel_map()")
 	}
 }
 
+TEST_CASE("Array::parallel_each()")
+{
+	for (const size_t grainSize : { 0, 1, 7, 4096 })
+	{
+		Array<uint32> v(64 * 1024);
+		for (size_t i = 0; i < v.size(); ++i)
+		{
+			v[i] = static_cast<uint32>(i);
+		}
+
+		v.parallel_each([](uint32& n) { n *= 2; }, grainSize);
+
+		REQUIRE(v.parallel_count_if([](uint32 n) { return (n % 2) == 0; }, grainSize) == v.size());
+		REQUIRE(v.back() == ((64 * 1024 - 1) * 2));
+	}
+}
+
+TEST_CASE("Threading::ParallelFor()")
+{
+	Array<int32> v(10000, 0);
+
+	Threading::ParallelFor(0, v.size(), [&](size_t i) { v[i] = static_cast<int32>(i); }, 100);
+
+	REQUIRE(v == Array<int32>::IndexedGenerate(v.size(), [](size_t i) { return static_cast<int32>(i); }));
+
+	REQUIRE_THROWS_AS(Threading::ParallelFor(0, 1000, [](size_t i) { if (i == 500) { throw Error{ U"ParallelFor" }; } }), Error);
+}
+
+TEST_CASE("TaskGroup")
+{
+	std::atomic<int32> sum = 0;
+
+	TaskGroup group;
+
+	for (int32 i = 1; i <= 100; ++i)
+	{
+		group.run([&sum, i]() { sum += i; });
+	}
+
+	group.wait();
+
+	REQUIRE(sum == 5050);
+	REQUIRE(group.num_pending() == 0);
+}
+
 # if defined(SIV3D_RUN_BENCHMARK)
 
 TEST_CASE("Array::parallel_count_if() : benchmark")
@@ -0,0 +1,41 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("TextureAsset::LoadAsync with priority")
+{
+	const FilePath path = (FileSystem::UniqueFilePath() + U".png");
+	REQUIRE(Image{ 64, 64, Palette::Orange }.save(path));
+
+	REQUIRE(TextureAsset::Register(U"AsyncTest.A", path));
+	REQUIRE(TextureAsset::Register(U"AsyncTest.B", path));
+
+	const uint64 completed = Asset::GetLoadStats().completed;
+
+	TextureAsset::LoadAsync(U"AsyncTest.A", AssetLoadPriority::High);
+	TextureAsset::LoadAsync(U"AsyncTest.B", AssetLoadPriority::Low);
+	TextureAsset::Wait(U"AsyncTest.A");
+	TextureAsset::Wait(U"AsyncTest.B");
+
+	REQUIRE(TextureAsset::IsReady(U"AsyncTest.A"));
+	REQUIRE(TextureAsset(U"AsyncTest.A").size() == Size{ 64, 64 });
+	REQUIRE(TextureAsset(U"AsyncTest.B").size() == Size{ 64, 64 });
+	REQUIRE(Asset::GetLoadStats().completed == (completed + 2));
+	REQUIRE(Asset::GetLoadQueueDepth() == 0);
+
+	// ロード済みのアセットは取り消せない
+	REQUIRE(not TextureAsset::CancelLoadAsync(U"AsyncTest.A"));
+
+	TextureAsset::Unregister(U"AsyncTest.A");
+	TextureAsset::Unregister(U"AsyncTest.B");
+	REQUIRE(FileSystem::Remove(path));
+}
@@ -10,6 +10,9 @@
 //-----------------------------------------------
 
 # include "Siv3DTest.hpp"
+# include <ThirdParty/soloud/include/soloud_wavstream.h>
+# include <Siv3D/Audio/BufferedStreamSource.hpp>
+# include <Siv3D/Audio/StreamDecodePool.hpp>
 
 TEST_CASE("Audio")
 {
@@ -57,3 +60,384 @@ TEST_CASE("Audio")
 		REQUIRE(wave.samples() == 87813);
 	}
 }
+
+TEST_CASE("Audio : decoded wave cache")
+{
+	const FilePathView path = U"test/audio/sample.wav";
+
+	GlobalAudio::ClearDecodedWaveCache();
+
+	SECTION("Audio from the same file shares the decoded samples")
+	{
+		const DecodedWaveCacheStats before = GlobalAudio::GetDecodedWaveCacheStats();
+
+		const Audio a{ path };
+		const Audio b{ path, Loop::Yes };
+
+		const DecodedWaveCacheStats stats = GlobalAudio::GetDecodedWaveCacheStats();
+		REQUIRE(stats.entries == 1);
+		REQUIRE(stats.hits == (before.hits + 1));
+		REQUIRE(stats.misses == (before.misses + 1));
+
+		REQUIRE(a.samples() == 87813);
+		REQUIRE(b.samples() == 87813);
+		REQUIRE(a.getSamples(0) == b.getSamples(0));
+		REQUIRE(a.getSamples(1) == b.getSamples(1));
+	}
+
+	SECTION("Loop end shorter than the file")
+	{
+		const Audio a{ path };
+		const Audio b{ path, Arg::loopBegin = 100, Arg::loopEnd = 1000 };
+
+		REQUIRE(b.samples() == 1000);
+		REQUIRE(std::equal(b.getSamples(0), (b.getSamples(0) + 1000), a.getSamples(0)));
+		REQUIRE(std::equal(b.getSamples(1), (b.getSamples(1) + 1000), a.getSamples(1)));
+	}
+
+	SECTION("Capacity")
+	{
+		const Audio a{ path };
+
+		GlobalAudio::SetDecodedWaveCacheCapacity(0);
+		REQUIRE(GlobalAudio::GetDecodedWaveCacheStats().entries == 0);
+		REQUIRE(GlobalAudio::GetDecodedWaveCacheStats().usedBytes == 0);
+
+		// キャッシュから取り除かれても、作成済みの Audio は影響を受けない
+		REQUIRE(a.samples() == 87813);
+		REQUIRE(a.getSamples(0) != nullptr);
+
+		const Audio b{ path };
+		REQUIRE(GlobalAudio::GetDecodedWaveCacheStats().entries == 0);
+		REQUIRE(b.samples() == 87813);
+
+		GlobalAudio::SetDecodedWaveCacheCapacity(64 << 20);
+	}
+
+	GlobalAudio::ClearDecodedWaveCache();
+}
+
+TEST_CASE("Audio : buffered streaming")
+{
+	const Audio audio{ Audio::Stream, U"test/audio/sample.ogg" };
+	REQUIRE(audio.isStreaming());
+	REQUIRE(audio.sampleRate() == 44100);
+	REQUIRE(audio.samples() == 83968);
+
+	const Audio loop{ Audio::Stream, U"test/audio/sample.ogg", Arg::loopBegin = 1000 };
+	REQUIRE(loop.isStreaming());
+	REQUIRE(loop.isLoop());
+	REQUIRE(loop.getLoopTiming().beginPos == 1000);
+}
+
+namespace
+{
+	// BufferedStreamSource のボイスから、チャンネルごとに frames 間隔で並べて読み出す
+	[[nodiscard]]
+	Array<float> Pull(SoLoud::AudioSourceInstance& voice, const uint32 frames)
+	{
+		Array<float> buffer(frames * voice.mChannels, -1.0f);
+		REQUIRE(voice.getAudio(buffer.data(), frames, frames) == frames);
+		return buffer;
+	}
+
+	// ワーカースレッドを使わず、テストのスレッドでデコードを進める BufferedStreamSource
+	struct BufferedStreamTest
+	{
+		StreamDecodePool pool{ 0 };
+
+		std::unique_ptr<BufferedStreamSource> source;
+
+		std::unique_ptr<SoLoud::AudioSourceInstance> voice;
+
+		Array<float> scratch;
+
+		// ループしない場合の全フレーム。チャンネルごとに lengthFrames 間隔で並ぶ
+		Array<float> reference;
+
+		uint32 channels = 0;
+
+		uint32 lengthFrames = 0;
+
+		explicit BufferedStreamTest(const char* path, const Optional<uint64>& loopBegin = none)
+		{
+			SoLoud::WavStream plain;
+			REQUIRE(plain.load(path) == SoLoud::SO_NO_ERROR);
+			channels = plain.mChannels;
+			lengthFrames = plain.mSampleCount;
+
+			const std::unique_ptr<SoLoud::AudioSourceInstance> decoder{ plain.createInstance() };
+			decoder->init(plain, 0);
+			reference.resize(channels * lengthFrames);
+			REQUIRE(decoder->getAudio(reference.data(), lengthFrames, lengthFrames) == lengthFrames);
+
+			auto stream = std::make_unique<SoLoud::WavStream>();
+			REQUIRE(stream->load(path) == SoLoud::SO_NO_ERROR);
+			source = std::make_unique<BufferedStreamSource>(std::move(stream), pool);
+
+			if (loopBegin)
+			{
+				// AudioData と同じく、ループの始点を秒で渡す
+				source->setLooping(true);
+				source->setLoopPoint(static_cast<float>(static_cast<double>(*loopBegin) / source->mBaseSamplerate));
+			}
+
+			voice.reset(source->createInstance());
+			voice->init(*source, 0);
+		}
+
+		~BufferedStreamTest()
+		{
+			// ボイスを閉じ、プールがストリームを手放してから BufferedStreamSource を破棄する
+			voice.reset();
+			pool.shutdown();
+		}
+
+		void fillAll()
+		{
+			while (pool.fill(scratch)) {}
+		}
+
+		// pulled の各チャンネルの [begin, begin + count) が、ファイルの from フレーム目からと一致するか
+		[[nodiscard]]
+		bool matches(const Array<float>& pulled, const uint32 begin, const uint32 count, const uint32 from) const
+		{
+			const uint32 frames = static_cast<uint32>(pulled.size() / channels);
+
+			for (uint32 ch = 0; ch < channels; ++ch)
+			{
+				const float* pPulled = (pulled.data() + (ch * frames) + begin);
+				const float* pReference = (reference.data() + (ch * lengthFrames) + from);
+
+				if (not std::equal(pPulled, (pPulled + count), pReference))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		[[nodiscard]]
+		static bool IsSilent(const Array<float>& pulled)
+		{
+			return pulled.all([](float sample) { return (sample == 0.0f); });
+		}
+	};
+}
+
+TEST_CASE("Audio : buffered streaming decode ring")
+{
+	BufferedStreamTest test{ "test/audio/sample.wav" };
+	REQUIRE(test.lengthFrames == 87813);
+
+	// ボイスの作成時に 4 チャンク分がデコードされている
+	REQUIRE(test.matches(Pull(*test.voice, 4096), 0, 4096, 0));
+
+	// デコードが追いつかない間は無音で埋め、読み出し位置は進めない
+	REQUIRE(BufferedStreamTest::IsSilent(Pull(*test.voice, 512)));
+	REQUIRE(not test.voice->hasEnded());
+
+	// リングバッファの容量まで先行してデコードする
+	test.fillAll();
+	REQUIRE(test.matches(Pull(*test.voice, (BufferedStream::CapacityFrames - BufferedStream::ChunkFrames)), 0, (BufferedStream::CapacityFrames - BufferedStream::ChunkFrames), 4096));
+
+	uint32 position = (4096 + BufferedStream::CapacityFrames - BufferedStream::ChunkFrames);
+
+	while (position < test.lengthFrames)
+	{
+		test.fillAll();
+
+		const uint32 frames = Min(BufferedStream::ChunkFrames, (test.lengthFrames - position));
+		REQUIRE(test.matches(Pull(*test.voice, frames), 0, frames, position));
+		position += frames;
+	}
+
+	// 末尾まで読み出したら、それ以上のフレームは返さない
+	test.fillAll();
+	REQUIRE(test.voice->hasEnded());
+
+	Array<float> buffer(256 * test.channels);
+	REQUIRE(test.voice->getAudio(buffer.data(), 256, 256) == 0);
+}
+
+TEST_CASE("Audio : buffered streaming seek")
+{
+	BufferedStreamTest test{ "test/audio/sample.wav" };
+
+	test.fillAll();
+	REQUIRE(test.matches(Pull(*test.voice, 1024), 0, 1024, 0));
+
+	const uint32 target = 44100;
+	test.voice->seek((static_cast<double>(target) / test.voice->mBaseSamplerate), nullptr, 0);
+
+	// シーク前にデコードしたフレームが残っていても、ワーカーが応じるまでは無音
+	REQUIRE(BufferedStreamTest::IsSilent(Pull(*test.voice, 512)));
+	REQUIRE(not test.voice->hasEnded());
+
+	// 応じた後は、シーク先のフレームから途切れずに読み出せる
+	test.fillAll();
+	const Array<float> pulled = Pull(*test.voice, 4096);
+	REQUIRE(test.matches(pulled, 0, 4096, target));
+}
+
+TEST_CASE("Audio : buffered streaming loop seam")
+{
+	const uint32 loopBegin = 1000;
+	BufferedStreamTest test{ "test/audio/sample.wav", loopBegin };
+
+	// 末尾の 300 フレーム手前にシークする
+	const uint32 target = (test.lengthFrames - 300);
+	test.voice->seek((static_cast<double>(target) / test.voice->mBaseSamplerate), nullptr, 0);
+	test.fillAll();
+
+	// 末尾の後に、ループの始点からのフレームが継ぎ目なく続く
+	const Array<float> pulled = Pull(*test.voice, 2048);
+	REQUIRE(test.matches(pulled, 0, 300, target));
+	REQUIRE(test.matches(pulled, 300, (2048 - 300), loopBegin));
+	REQUIRE(test.voice->mLoopCount == 1);
+	REQUIRE(not test.voice->hasEnded());
+}
+
+TEST_CASE("Audio : sample capture and FFT")
+{
+	SECTION("GetSamples")
+	{
+		Array<float> samples;
+
+		GlobalAudio::GetSamples(samples);
+		REQUIRE(samples.size() == 256);
+
+		GlobalAudio::GetSamples(samples, 4096);
+		REQUIRE(samples.size() == 4096);
+
+		GlobalAudio::BusGetSamples(MixBus0, samples, 1024);
+		REQUIRE(samples.size() == 1024);
+	}
+
+	SECTION("FFT::AnalyzeMany")
+	{
+		Array<Array<float>> inputs;
+
+		for (int32 k = 1; k <= 8; ++k)
+		{
+			Array<float> input(1024);
+
+			for (size_t i = 0; i < input.size(); ++i)
+			{
+				input[i] = static_cast<float>(std::sin(Math::TwoPi * (k * 100) * i / 44100.0));
+			}
+
+			inputs << std::move(input);
+		}
+
+		Array<FFTResult> results;
+		FFT::AnalyzeMany(results, inputs, 44100, FFTSampleLength::SL1K);
+		REQUIRE(results.size() == inputs.size());
+
+		for (size_t i = 0; i < inputs.size(); ++i)
+		{
+			FFTResult expected;
+			FFT::Analyze(expected, inputs[i].data(), inputs[i].size(), 44100, FFTSampleLength::SL1K);
+			REQUIRE(results[i].buffer == expected.buffer);
+		}
+
+		Array<FFTResult> busResults;
+		FFT::AnalyzeMany(busResults, Array<MixBus>{ MixBus0, MixBus1 }, FFTSampleLength::SL1K);
+		REQUIRE(busResults.size() == 2);
+		REQUIRE(busResults[0].buffer.size() == 512);
+	}
+}
+
+TEST_CASE("OfflineAudioRenderer")
+{
+	const Wave tone{ SecondsF{ 1.0 }, Arg::generator = [](double t) { return std::sin(t * Math::TwoPi * 440.0) * 0.5; } };
+
+	SECTION("Silence")
+	{
+		OfflineAudioRenderer renderer;
+		const Wave wave = renderer.render(SecondsF{ 0.5 });
+		REQUIRE(wave.size() == 22050);
+		REQUIRE(wave.sampleRate() == Wave::DefaultSampleRate);
+		REQUIRE(renderer.posSample() == 22050);
+		REQUIRE(wave.all([](const WaveSample& s) { return ((s.left == 0.0f) && (s.right == 0.0f)); }));
+	}
+
+	SECTION("Start time")
+	{
+		OfflineAudioRenderer renderer;
+		renderer.play(tone, SecondsF{ 0.25 });
+		renderer.busSetLowPassFilter(MixBus0, 0, 2000, 2);
+
+		const Wave wave = renderer.render(SecondsF{ 1.0 });
+		REQUIRE(wave.size() == 44100);
+
+		// 開始時刻まではサンプル単位で無音
+		for (size_t i = 0; i < 11025; ++i)
+		{
+			REQUIRE(wave[i].left == 0.0f);
+		}
+
+		REQUIRE(std::any_of((wave.begin() + 11025), wave.end(), [](const WaveSample& s) { return (s.left != 0.0f); }));
+	}
+
+	SECTION("RenderMany")
+	{
+		const auto setup = [&](size_t i, OfflineAudioRenderer& renderer)
+			{
+				renderer.play(tone, SecondsF{ i * 0.01 }, MixBus1, 0.5);
+				renderer.busSetEchoFilter(MixBus1, 0, 0.1, 0.5);
+			};
+
+		const Array<Wave> waves = OfflineAudioRenderer::RenderMany(8, setup, SecondsF{ 0.5 });
+		REQUIRE(waves.size() == 8);
+
+		for (size_t i = 0; i < waves.size(); ++i)
+		{
+			OfflineAudioRenderer renderer;
+			setup(i, renderer);
+			const Wave expected = renderer.render(SecondsF{ 0.5 });
+			REQUIRE(waves[i].size() == expected.size());
+			REQUIRE(std::memcmp(waves[i].data(), expected.data(), expected.size_bytes()) == 0);
+		}
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("OfflineAudioRenderer : benchmark")
+{
+	const Wave tone{ SecondsF{ 1.0 }, Arg::generator = [](double t) { return std::sin(t * Math::TwoPi * 440.0) * 0.5; } };
+
+	const auto setup = [&](size_t i, OfflineAudioRenderer& renderer)
+		{
+			for (int32 k = 0; k < 8; ++k)
+			{
+				renderer.play(tone, SecondsF{ k * 1.0 }, MixBus0, 0.5, 0.0, (1.0 + (i % 4) * 0.25));
+			}
+
+			renderer.busSetReverbFilter(MixBus0, 0, false, 0.5, 0.5, 1.0, 0.5);
+		};
+
+	// 10 秒 x 16 = 160 秒分の音声
+	BENCHMARK("OfflineAudioRenderer | 16 x 10s serial")
+	{
+		size_t samples = 0;
+
+		for (size_t i = 0; i < 16; ++i)
+		{
+			OfflineAudioRenderer renderer;
+			setup(i, renderer);
+			samples += renderer.render(SecondsF{ 10.0 }).size();
+		}
+
+		return samples;
+	};
+
+	BENCHMARK("OfflineAudioRenderer::RenderMany() | 16 x 10s")
+	{
+		return OfflineAudioRenderer::RenderMany(16, setup, SecondsF{ 10.0 }).size();
+	};
+}
+
+# endif
@@ -378,12 +378,80 @@ TEST_CASE("BinaryReader::skip()")
 	REQUIRE(reader.skip(100) == 0);
 }
 
+TEST_CASE("BinaryReader::readView()")
+{
+	SECTION("small")
+	{
+		BinaryReader reader(U"test/binary/small.bin");
+		REQUIRE(reader.isMemoryMapped() == false);
+		REQUIRE(reader.supportsReadView() == false);
+		REQUIRE(reader.readView(100).empty());
+		REQUIRE(reader.getPos() == 0);
+	}
+
+	SECTION("large")
+	{
+		BinaryReader reader(U"test/binary/large.bin");
+		REQUIRE(reader.isMemoryMapped() == true);
+		REQUIRE(reader.supportsReadView() == true);
+
+		Array<uint8> expected(reader.size());
+		REQUIRE(reader.read(expected.data(), reader.size()) == reader.size());
+		REQUIRE(reader.getPos() == reader.size());
+
+		reader.setPos(100);
+		const std::span<const Byte> view = reader.readView(1000);
+		REQUIRE(view.size() == 1000);
+		REQUIRE(reader.getPos() == 1100);
+		REQUIRE(std::memcmp(view.data(), &expected[100], view.size()) == 0);
+
+		uint8 next;
+		REQUIRE(reader.lookahead(next) == true);
+		REQUIRE(next == expected[1100]);
+
+		REQUIRE(reader.readView(reader.size()).size() == static_cast<size_t>(reader.size() - 1100));
+		REQUIRE(reader.getPos() == reader.size());
+		REQUIRE(reader.readView(1).empty());
+
+		reader.close();
+		REQUIRE(reader.isMemoryMapped() == false);
+		REQUIRE(reader.readView(1).empty());
+	}
+
+	SECTION("MemoryViewReader")
+	{
+		const std::array<uint8, 4> data = { 1, 2, 3, 4 };
+		MemoryViewReader reader{ data.data(), data.size() };
+		REQUIRE(reader.supportsReadView() == true);
+		REQUIRE(reader.readView(3).size() == 3);
+		REQUIRE(reader.readView(3).size() == 1);
+		REQUIRE(reader.getPos() == 4);
+	}
+}
+
 # if defined(SIV3D_RUN_BENCHMARK)
 
 TEST_CASE("BinaryReader : benchmark")
 {
 	Logger.disable();
 
+	BENCHMARK("BinaryReader | 4096 bytes / readView")
+	{
+		BinaryReader reader(U"test/binary/large.bin");
+		size_t sum = 0;
+		while (true)
+		{
+			const std::span<const Byte> view = reader.readView(4096);
+			if (view.empty())
+			{
+				break;
+			}
+			sum += static_cast<uint8>(view.front());
+		}
+
+		return sum;
+	};
+
 	BENCHMARK("BinaryReader | 4096 bytes / read")
 	{
 		BinaryReader reader(U"test/binary/large.bin");
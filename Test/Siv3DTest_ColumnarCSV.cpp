@@ -0,0 +1,39 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("ColumnarCSV")
+{
+	const FilePath path = FileSystem::UniqueFilePath();
+	{
+		TextWriter writer{ path, TextEncoding::UTF8_WITH_BOM };
+		writer << U"id,name,score";
+		writer << U"1,\"Siv3D, \"\"OpenSiv3D\"\"\",1.5";
+		writer << U"";
+		writer << U"+2,あいう,abc";
+		writer << U"3";
+	}
+
+	const ColumnarCSV csv{ path, { CSVColumnType::Int64, CSVColumnType::String, CSVColumnType::Double } };
+	REQUIRE(csv);
+	REQUIRE(csv.rows() == 3);
+	REQUIRE(csv.columns() == 3);
+	REQUIRE(csv.header() == Array<String>{ U"id", U"name", U"score" });
+	REQUIRE(csv.columnIndex(U"score") == 2);
+	REQUIRE(csv.getInt64Column(0) == Array<int64>{ 1, 2, 3 });
+	REQUIRE(csv.getStringColumn(1) == Array<String>{ U"Siv3D, \"OpenSiv3D\"", U"あいう", U"" });
+	REQUIRE(csv.getDoubleColumn(2) == Array<double>{ 1.5, 0.0, 0.0 });
+	REQUIRE(csv.invalidCellCount() == 1);
+	REQUIRE_THROWS(csv.getDoubleColumn(0));
+
+	REQUIRE(FileSystem::Remove(path));
+}
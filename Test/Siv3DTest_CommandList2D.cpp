@@ -0,0 +1,106 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("CommandList2D")
+{
+	CommandList2D list;
+	REQUIRE(list.isEmpty());
+
+	list.addRect(RectF{ 0, 0, 100, 100 }, Palette::White)
+		.addTriangle(Triangle{ 0, 0, 100, 0, 0, 100 }, Palette::White);
+
+	REQUIRE(list.num_vertices() == 7);
+	REQUIRE(list.num_triangles() == 3);
+	REQUIRE(list.segments().size() == 1);
+
+	list.clear();
+	REQUIRE(list.isEmpty());
+	REQUIRE(list.segments().isEmpty());
+}
+
+TEST_CASE("CommandList2D : move")
+{
+	CommandList2D list;
+	list.addRect(RectF{ 0, 0, 100, 100 }, Palette::White);
+
+	CommandList2D moved{ std::move(list) };
+	REQUIRE(moved.num_triangles() == 2);
+
+	CommandList2D assigned;
+	assigned = std::move(moved);
+	REQUIRE(assigned.num_triangles() == 2);
+
+	// 移動元も引き続き使える
+	moved.clear();
+	moved.addTriangle(Triangle{ 0, 0, 100, 0, 0, 100 }, Palette::White);
+	REQUIRE(moved.num_triangles() == 1);
+	list.addTriangle(Triangle{ 0, 0, 100, 0, 0, 100 }, Palette::White);
+	REQUIRE(list.num_triangles() == 1);
+}
+
+TEST_CASE("CommandList2D : segments")
+{
+	CommandList2D list;
+
+	for (int32 i = 0; i < 20000; ++i)
+	{
+		list.addCircle(Circle{ i, i, 30 }, Palette::White);
+	}
+
+	size_t vertexCount = 0;
+	size_t triangleCount = 0;
+
+	for (const auto& segment : list.segments())
+	{
+		REQUIRE(segment.vertexOffset == vertexCount);
+		REQUIRE(segment.triangleOffset == triangleCount);
+		REQUIRE(segment.vertexCount <= 65535);
+		REQUIRE((segment.triangleCount * 3) <= 65535);
+		vertexCount += segment.vertexCount;
+		triangleCount += segment.triangleCount;
+	}
+
+	REQUIRE(1 < list.segments().size());
+	REQUIRE(vertexCount == list.num_vertices());
+	REQUIRE(triangleCount == list.num_triangles());
+}
+
+TEST_CASE("CommandList2D : recording on multiple threads")
+{
+	constexpr size_t NumLists = 8;
+
+	Array<CommandList2D> lists(NumLists);
+
+	Threading::ParallelFor(0, NumLists, [&](const size_t i)
+	{
+		for (int32 k = 0; k < 1000; ++k)
+		{
+			lists[i].addCircle(Circle{ k, static_cast<double>(i), 10 }, Palette::White);
+			lists[i].addLine(Line{ 0, 0, k, static_cast<double>(i) }, 2.0, Palette::White);
+		}
+	});
+
+	CommandList2D reference;
+
+	for (int32 k = 0; k < 1000; ++k)
+	{
+		reference.addCircle(Circle{ k, 0, 10 }, Palette::White);
+		reference.addLine(Line{ 0, 0, k, 0 }, 2.0, Palette::White);
+	}
+
+	for (const auto& list : lists)
+	{
+		REQUIRE(list.num_vertices() == reference.num_vertices());
+		REQUIRE(list.num_triangles() == reference.num_triangles());
+	}
+}
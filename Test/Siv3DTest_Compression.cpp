@@ -0,0 +1,150 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	Blob MakeRecord(const size_t index)
+	{
+		const std::string s = Unicode::ToUTF8(U"{{\"player\":\"p{:0>5}\",\"hp\":{},\"mp\":{},\"level\":{},\"items\":[1,2,3]}}"_fmt(
+			index, (index * 3 % 97), (index * 5 % 31), (index % 50)));
+		return Blob{ s.data(), s.size() };
+	}
+}
+
+TEST_CASE("Compression")
+{
+	Blob large{ Arg::reserve = (4 << 20) };
+	for (size_t i = 0; large.size() < (4 << 20); ++i)
+	{
+		const Blob record = MakeRecord(i);
+		large.append(record.data(), record.size());
+	}
+
+	SECTION("stream")
+	{
+		for (const int32 numWorkers : { Compression::NoWorkers, 2, Compression::AutoWorkers })
+		{
+			MemoryViewReader reader{ large.data(), large.size() };
+			MemoryWriter compressed;
+			REQUIRE(Compression::Compress(reader, compressed, CompressionLevel::Fast, numWorkers));
+			REQUIRE(compressed.size() < static_cast<int64>(large.size() / 4));
+
+			// ストリームで圧縮したデータも、一度に展開できる
+			REQUIRE(Compression::Decompress(compressed.getBlob()) == large);
+
+			MemoryViewReader compressedReader{ compressed.getBlob().data(), compressed.getBlob().size() };
+			MemoryWriter decompressed;
+			REQUIRE(Compression::Decompress(compressedReader, decompressed));
+			REQUIRE(decompressed.getBlob() == large);
+		}
+	}
+
+	SECTION("truncated stream")
+	{
+		const Blob compressed = Compression::Compress(large, CompressionLevel::Fastest);
+		MemoryViewReader reader{ compressed.data(), (compressed.size() / 2) };
+		MemoryWriter decompressed;
+		REQUIRE(Compression::Decompress(reader, decompressed) == false);
+	}
+
+	SECTION("dictionary")
+	{
+		Array<Blob> samples;
+		for (size_t i = 0; i < 2000; ++i)
+		{
+			samples << MakeRecord(i);
+		}
+
+		const CompressionDictionary dictionary = CompressionDictionary::Train(samples, 4096);
+		REQUIRE(dictionary.isEmpty() == false);
+		REQUIRE(dictionary.getBlob().size() <= 4096);
+
+		const Blob record = MakeRecord(12345);
+		const Blob withDictionary = Compression::Compress(record, dictionary);
+		REQUIRE(withDictionary.size() < Compression::Compress(record).size());
+		REQUIRE(Compression::Decompress(withDictionary, dictionary) == record);
+
+		// 辞書が無いと展開できない
+		REQUIRE(Compression::Decompress(withDictionary).isEmpty());
+
+		MemoryViewReader reader{ large.data(), large.size() };
+		MemoryWriter compressed;
+		REQUIRE(Compression::Compress(reader, compressed, dictionary));
+
+		MemoryViewReader compressedReader{ compressed.getBlob().data(), compressed.getBlob().size() };
+		MemoryWriter decompressed;
+		REQUIRE(Compression::Decompress(compressedReader, decompressed, dictionary));
+		REQUIRE(decompressed.getBlob() == large);
+
+		const CompressionDictionary empty;
+		REQUIRE(Compression::Compress(record, empty).isEmpty());
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Compression : benchmark")
+{
+	Logger.disable();
+
+	Blob large{ Arg::reserve = (16 << 20) };
+	for (size_t i = 0; large.size() < (16 << 20); ++i)
+	{
+		const Blob record = MakeRecord(i);
+		large.append(record.data(), record.size());
+	}
+
+	BENCHMARK("Compression | 16 MiB / NoWorkers")
+	{
+		MemoryViewReader reader{ large.data(), large.size() };
+		MemoryWriter writer;
+		return Compression::Compress(reader, writer, CompressionLevel::Default, Compression::NoWorkers);
+	};
+
+	BENCHMARK("Compression | 16 MiB / AutoWorkers")
+	{
+		MemoryViewReader reader{ large.data(), large.size() };
+		MemoryWriter writer;
+		return Compression::Compress(reader, writer, CompressionLevel::Default, Compression::AutoWorkers);
+	};
+
+	Array<Blob> samples;
+	for (size_t i = 0; i < 2000; ++i)
+	{
+		samples << MakeRecord(i);
+	}
+
+	const CompressionDictionary dictionary = CompressionDictionary::Train(samples, 4096);
+
+	BENCHMARK("Compression | 1000 records / without dictionary")
+	{
+		size_t total = 0;
+		for (const auto& sample : samples.take(1000))
+		{
+			total += Compression::Compress(sample).size();
+		}
+		return total;
+	};
+
+	BENCHMARK("Compression | 1000 records / with dictionary")
+	{
+		size_t total = 0;
+		for (const auto& sample : samples.take(1000))
+		{
+			total += Compression::Compress(sample, dictionary).size();
+		}
+		return total;
+	};
+}
+
+# endif
@@ -0,0 +1,120 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	struct CountEffect : IEffect
+	{
+		int32& m_count;
+
+		int32 m_updates;
+
+		CountEffect(int32& count, int32 updates)
+			: m_count{ count }
+			, m_updates{ updates } {}
+
+		bool update(double) override
+		{
+			++m_count;
+			return (0 < --m_updates);
+		}
+	};
+}
+
+TEST_CASE("Effect")
+{
+	Effect effect;
+	int32 count = 0;
+
+	for (int32 i = 0; i < 300; ++i)
+	{
+		effect.add<CountEffect>(count, (i % 3 + 1));
+	}
+	REQUIRE(effect.num_effects() == 300);
+
+	// 終了したエフェクトは取り除かれ、残りは追加した順に更新される
+	effect.update();
+	REQUIRE(count == 300);
+	REQUIRE(effect.num_effects() == 200);
+
+	effect.update();
+	REQUIRE(count == 500);
+	REQUIRE(effect.num_effects() == 100);
+
+	// 更新中に追加されたエフェクトは同じフレームで更新される
+	effect.add([&](double)
+	{
+		effect.add<CountEffect>(count, 1);
+		return false;
+	});
+
+	effect.update();
+	REQUIRE(count == 601);
+	REQUIRE(effect.num_effects() == 0);
+
+	// 更新中に clear() できる
+	effect.add<CountEffect>(count, 10);
+	effect.add([&](double)
+	{
+		effect.clear();
+		return true;
+	});
+	effect.add<CountEffect>(count, 10);
+
+	effect.update();
+	REQUIRE(count == 602);
+	REQUIRE(effect.num_effects() == 0);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Effect : benchmark")
+{
+	Effect effect{ 1.0 };
+	int32 count = 0;
+
+	BENCHMARK("add | 10,000 effects")
+	{
+		for (int32 i = 0; i < 10'000; ++i)
+		{
+			effect.add<CountEffect>(count, 60);
+		}
+
+		effect.clear();
+		return count;
+	};
+
+	BENCHMARK("add + update | 10,000 effects per frame")
+	{
+		for (int32 i = 0; i < 10'000; ++i)
+		{
+			effect.add<CountEffect>(count, 1);
+		}
+
+		effect.update();
+		return effect.num_effects();
+	};
+
+	for (int32 i = 0; i < 100'000; ++i)
+	{
+		effect.add<CountEffect>(count, 1'000'000);
+	}
+
+	BENCHMARK("update | 100,000 effects")
+	{
+		effect.update();
+		return count;
+	};
+}
+
+# endif
@@ -0,0 +1,202 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Font : shared glyph atlas")
+{
+	const GlyphAtlasStats before = Font::GetGlyphAtlasStats(FontMethod::Bitmap);
+
+	const Font font1{ 20 };
+	const Font font2{ 40, Typeface::Bold };
+
+	REQUIRE(font1.preload(U"Siv3D"));
+	REQUIRE(font2.preload(U"Siv3D"));
+
+	const GlyphAtlasStats cached = Font::GetGlyphAtlasStats(FontMethod::Bitmap);
+	REQUIRE(before.glyphs < cached.glyphs);
+	REQUIRE(before.misses < cached.misses);
+	REQUIRE(1 <= cached.pages);
+	REQUIRE(0.0 < cached.occupancy());
+	REQUIRE(cached.occupancy() <= 1.0);
+
+	// 異なるフォントのグリフが同じテクスチャに格納される
+	REQUIRE(font1.getTexture().id() == font2.getTexture().id());
+
+	// 2 回目はアトラスから見つかる
+	REQUIRE(font1.preload(U"Siv3D"));
+	const GlyphAtlasStats hit = Font::GetGlyphAtlasStats(FontMethod::Bitmap);
+	REQUIRE(cached.misses == hit.misses);
+	REQUIRE(cached.hits < hit.hits);
+	REQUIRE(0.0 < hit.hitRate());
+
+	// フォントを破棄すると、そのフォントのグリフは解放される
+	{
+		const Font font3{ 30 };
+		REQUIRE(font3.preload(U"ABCDEFG"));
+		REQUIRE(hit.glyphs < Font::GetGlyphAtlasStats(FontMethod::Bitmap).glyphs);
+	}
+
+	REQUIRE(hit.glyphs == Font::GetGlyphAtlasStats(FontMethod::Bitmap).glyphs);
+}
+
+TEST_CASE("Font : baked glyph atlas")
+{
+	const FilePath path = U"test/runtime/font/baked.glyphs";
+	const String text = U"Siv3D グリフ";
+
+	{
+		const Font font{ FontMethod::MSDF, 32 };
+		REQUIRE(font.bakeAtlas(text, path));
+	}
+
+	const Font font{ FontMethod::MSDF, 32 };
+	REQUIRE(font.loadBakedAtlas(path));
+
+	// 大きさが異なるフォントでは読み込めない
+	REQUIRE_FALSE(Font{ FontMethod::MSDF, 40 }.loadBakedAtlas(path));
+	REQUIRE_FALSE(Font{ FontMethod::SDF, 32 }.loadBakedAtlas(path));
+
+	REQUIRE(font.preload(text));
+
+	const Font reference{ FontMethod::MSDF, 32 };
+	REQUIRE(reference.preload(text));
+
+	// 読み込んだグリフはレンダリングしたグリフと同じ
+	for (const auto& glyph : reference.getGlyphs(text))
+	{
+		const Glyph baked = font.getGlyphByGlyphIndex(glyph.glyphIndex);
+		REQUIRE(baked.xAdvance == glyph.xAdvance);
+		REQUIRE(baked.left == glyph.left);
+		REQUIRE(baked.top == glyph.top);
+		REQUIRE(baked.texture.size == glyph.texture.size);
+	}
+
+	FileSystem::Remove(path);
+}
+
+namespace
+{
+	[[nodiscard]]
+	bool SameClusters(const Array<GlyphCluster>& a, const Array<GlyphCluster>& b)
+	{
+		return (a.size() == b.size())
+			&& std::equal(a.begin(), a.end(), b.begin(), [](const GlyphCluster& x, const GlyphCluster& y)
+				{
+					return (x.glyphIndex == y.glyphIndex) && (x.fontIndex == y.fontIndex) && (x.pos == y.pos);
+				});
+	}
+}
+
+TEST_CASE("Font : shaped text cache")
+{
+	const Font font{ 24 };
+	const String text = U"Shaped text\nキャッシュ";
+
+	const Array<GlyphCluster> clusters = font.getGlyphClusters(text);
+	const RectF region = font(text).region();
+	const ShapedTextCacheStats before = Font::GetShapedTextCacheStats();
+
+	// 2 回目は整形せずにキャッシュから返す
+	REQUIRE(SameClusters(font.getGlyphClusters(text), clusters));
+	REQUIRE(font(text).region() == region);
+	REQUIRE(font(text).region(Vec2{ 10, 20 }) == region.movedBy(10, 20));
+
+	const ShapedTextCacheStats after = Font::GetShapedTextCacheStats();
+	REQUIRE(before.hits < after.hits);
+	REQUIRE(before.entries == after.entries);
+	REQUIRE(after.usedBytes <= after.capacityBytes);
+
+	// 容量を超えた分は取り除かれる
+	Font::SetShapedTextCacheCapacity(0);
+	REQUIRE(Font::GetShapedTextCacheStats().entries == 0);
+	REQUIRE(SameClusters(font.getGlyphClusters(text), clusters));
+	Font::SetShapedTextCacheCapacity(4 << 20);
+}
+
+TEST_CASE("TextLayout")
+{
+	const Font font{ 20 };
+	const String text = U"Siv3D\nOpenSiv3D";
+
+	const TextLayout layout{ font, text };
+	REQUIRE(layout.fontSize() == 20.0);
+	REQUIRE(layout.lines().size() == 2);
+	REQUIRE(layout.size() == font(text).region().size);
+
+	const auto& line0 = layout.lines()[0];
+	const auto& line1 = layout.lines()[1];
+	REQUIRE(line0.clusterBegin == 0);
+	REQUIRE(line0.clusterEnd == 5);
+	REQUIRE(line1.clusterBegin == 6);
+	REQUIRE(line1.clusterEnd == layout.clusters().size());
+	REQUIRE(line0.region.w < line1.region.w);
+	REQUIRE(line1.region.y == (font.height(20.0)));
+	REQUIRE(layout.regionAt(Vec2{ 100, 100 }).center() == Vec2{ 100, 100 });
+
+	REQUIRE(TextLayout{}.isEmpty());
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Font : glyph atlas benchmark")
+{
+	// 多数のサイズで同じ文字列を描く UI を想定する
+	Array<Font> fonts;
+
+	for (int32 size = 12; size <= 48; size += 4)
+	{
+		fonts.emplace_back(size);
+	}
+
+	String text;
+
+	for (char32 ch = U'あ'; ch <= U'ん'; ++ch)
+	{
+		text.push_back(ch);
+	}
+
+	BENCHMARK("Font::preload() cached")
+	{
+		bool result = true;
+
+		for (const auto& font : fonts)
+		{
+			result &= font.preload(text);
+		}
+
+		return result;
+	};
+
+	const Array<String> labels = Iota(1000).map([](int32 i) { return U"Item {}"_fmt(i); });
+
+	BENCHMARK("Font::operator()(text).region() cached")
+	{
+		double width = 0.0;
+
+		for (const auto& label : labels)
+		{
+			width += fonts.front()(label).region().w;
+		}
+
+		return width;
+	};
+
+	BENCHMARK("TextLayout construction")
+	{
+		return labels.map([&](const String& label) { return TextLayout{ fonts.front(), label }; });
+	};
+
+	const GlyphAtlasStats stats = Font::GetGlyphAtlasStats(FontMethod::Bitmap);
+	Console << U"pages: {}, glyphs: {}, occupancy: {:.3f}, hit rate: {:.3f}"_fmt(stats.pages, stats.glyphs, stats.occupancy(), stats.hitRate());
+}
+
+# endif
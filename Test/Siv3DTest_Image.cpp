@@ -201,3 +201,151 @@ TEST_CASE("Image")
 		}
 	}
 }
+
+TEST_CASE("Image : point operations")
+{
+	// 並列化と SIMD の端数処理を通るよう、幅を奇数にする
+	Image source{ 1023, 517 };
+
+	for (int32 y = 0; y < source.height(); ++y)
+	{
+		for (int32 x = 0; x < source.width(); ++x)
+		{
+			source[y][x] = Color(((x * 7 + y) & 255), ((x * 13 + y * 3) & 255), ((x ^ y) & 255), ((x + y * 5) & 255));
+		}
+	}
+
+	const auto check = [&](const Image& result, auto f)
+	{
+		REQUIRE(result.size() == source.size());
+
+		for (size_t i = 0; i < source.num_pixels(); ++i)
+		{
+			if (result.data()[i] != f(source.data()[i]))
+			{
+				FAIL("pixel " << i);
+			}
+		}
+	};
+
+	check(source.negated(), [](Color c) { return ~c; });
+
+	check(source.grayscaled(), [](Color c) { const uint8 gray = c.grayscale0_255(); return Color{ gray, gray, gray, c.a }; });
+
+	check(source.sepiaed(), [](Color c)
+	{
+		return Color{ static_cast<uint8>(Min(((0.393 * c.r) + (0.769 * c.g) + (0.189 * c.b)), 255.0)),
+			static_cast<uint8>(Min(((0.349 * c.r) + (0.686 * c.g) + (0.168 * c.b)), 255.0)),
+			static_cast<uint8>(Min(((0.272 * c.r) + (0.534 * c.g) + (0.131 * c.b)), 255.0)), c.a };
+	});
+
+	for (const int32 level : { -300, -40, 25, 255 })
+	{
+		check(source.brightened(level), [=](Color c)
+		{
+			return Color{ static_cast<uint8>(Clamp((c.r + level), 0, 255)),
+				static_cast<uint8>(Clamp((c.g + level), 0, 255)),
+				static_cast<uint8>(Clamp((c.b + level), 0, 255)), c.a };
+		});
+	}
+
+	check(Image{ source }.RGBAtoBGRA(), [](Color c) { return Color{ c.b, c.g, c.r, c.a }; });
+}
+
+TEST_CASE("Image : decoding")
+{
+	const FilePath pngPath = U"test/image/png/3x3.png";
+	const FilePath jpegPath = U"test/runtime/image/decoding_640x480.jpg";
+	REQUIRE(Image{ 640, 480, Palette::Orange }.saveJPEG(jpegPath));
+
+	SECTION("DecodeInto")
+	{
+		Image image{ 16, 16 };
+		const Color* const data = image.data();
+
+		// 容量が足りる場合はメモリを再利用する
+		REQUIRE(ImageDecoder::DecodeInto(pngPath, image));
+		REQUIRE(image == Image{ pngPath });
+		REQUIRE(image.data() == data);
+
+		REQUIRE(ImageDecoder::DecodeInto(jpegPath, image));
+		REQUIRE(image.size() == Size{ 640, 480 });
+
+		REQUIRE_FALSE(ImageDecoder::DecodeInto(U"test/image/not_found.png", image));
+	}
+
+	SECTION("DecodeMany")
+	{
+		const Array<FilePath> paths = { pngPath, jpegPath, U"test/image/not_found.png", U"test/image/bmp/3x3_24.bmp" };
+		const Array<Image> images = ImageDecoder::DecodeMany(paths);
+		REQUIRE(images.size() == 4);
+		REQUIRE(images[0] == Image{ pngPath });
+		REQUIRE(images[1].size() == Size{ 640, 480 });
+		REQUIRE(images[2].isEmpty());
+		REQUIRE(images[3] == Image{ U"test/image/bmp/3x3_24.bmp" });
+	}
+
+	SECTION("DecodeThumbnail")
+	{
+		// 縮小率は 1/8 単位なので、100x75 を下回らない最小の 1/4 でデコードされる
+		{
+			BinaryReader reader{ jpegPath };
+			REQUIRE(JPEGDecoder{}.decodeReduced(reader, jpegPath, Size{ 100, 100 }).size() == Size{ 160, 120 });
+		}
+
+		REQUIRE(ImageDecoder::DecodeThumbnail(jpegPath, Size{ 100, 100 }).size() == Size{ 100, 75 });
+		REQUIRE(ImageDecoder::DecodeThumbnail(jpegPath, Size{ 1000, 1000 }).size() == Size{ 640, 480 });
+		REQUIRE(ImageDecoder::DecodeThumbnail(pngPath, Size{ 100, 100 }).size() == Size{ 3, 3 });
+	}
+
+	FileSystem::Remove(jpegPath);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Image : point operations benchmark")
+{
+	for (const auto& [name, size] : { std::pair{ std::string{ "1K" }, Size{ 1024, 1024 } },
+		std::pair{ std::string{ "4K" }, Size{ 3840, 2160 } },
+		std::pair{ std::string{ "8K" }, Size{ 7680, 4320 } } })
+	{
+		Image image{ size, Color{ 40, 120, 200 } };
+
+		BENCHMARK("Image::negate() | " + name)
+		{
+			return image.negate().width();
+		};
+
+		BENCHMARK("Image::grayscale() | " + name)
+		{
+			return image.grayscale().width();
+		};
+
+		BENCHMARK("Image::sepia() | " + name)
+		{
+			return image.sepia().width();
+		};
+
+		BENCHMARK("Image::posterize() | " + name)
+		{
+			return image.posterize(4).width();
+		};
+
+		BENCHMARK("Image::brighten() | " + name)
+		{
+			return image.brighten(10).width();
+		};
+
+		BENCHMARK("Image::gammaCorrect() | " + name)
+		{
+			return image.gammaCorrect(1.2).width();
+		};
+
+		BENCHMARK("Image::RGBAtoBGRA() | " + name)
+		{
+			return image.RGBAtoBGRA().width();
+		};
+	}
+}
+
+# endif
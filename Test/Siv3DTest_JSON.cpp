@@ -0,0 +1,77 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("JSON::ParseUTF8")
+{
+	const JSON json = JSON::ParseUTF8("\xEF\xBB\xBF{\"name\":\"\xE3\x81\x82\",\"values\":[1,-2,3.5]}");
+	REQUIRE(json);
+	REQUIRE(json[U"name"].getString() == U"あ");
+	REQUIRE(json[U"values"].size() == 3);
+	REQUIRE(json[U"values"][1].get<int32>() == -2);
+
+	REQUIRE(not JSON::ParseUTF8("{\"name\":"));
+
+	// 不正な UTF-8 は置換文字に置き換えられる
+	const JSON invalid = JSON::ParseUTF8("{\"name\":\"a\xFF\"}");
+	REQUIRE(invalid);
+	REQUIRE(invalid[U"name"].getString() == U"a\uFFFD");
+
+	// 途中で途切れたマルチバイト文字やサロゲートの符号位置も置き換えられる
+	const JSON truncated = JSON::ParseUTF8("[\"\xE3\x81\",\"\xED\xA0\x80\"]");
+	REQUIRE(truncated);
+	REQUIRE(truncated[0].getString() == U"\uFFFD\uFFFD");
+	REQUIRE(truncated[1].getString() == U"\uFFFD\uFFFD\uFFFD");
+}
+
+TEST_CASE("JSON::Visit")
+{
+	struct Counter : JSONVisitor
+	{
+		size_t numbers = 0;
+
+		size_t arrays = 0;
+
+		String lastKey;
+
+		bool unsignedInteger(uint64) override { ++numbers; return true; }
+
+		bool signedInteger(int64) override { ++numbers; return true; }
+
+		bool floatingPoint(double) override { ++numbers; return true; }
+
+		bool startArray() override { ++arrays; return true; }
+
+		bool key(StringView key) override { lastKey = key; return true; }
+	};
+
+	{
+		Counter counter;
+		REQUIRE(JSON::VisitUTF8("{\"a\":[1,-2,3.5],\"b\":[[4]]}", counter));
+		REQUIRE(counter.numbers == 4);
+		REQUIRE(counter.arrays == 3);
+		REQUIRE(counter.lastKey == U"b");
+	}
+
+	{
+		Counter counter;
+		REQUIRE(not JSON::VisitUTF8("[1, 2,", counter));
+	}
+
+	// ParseUTF8() と同じく、不正な UTF-8 は置換文字に置き換えられる
+	{
+		Counter counter;
+		REQUIRE(JSON::VisitUTF8("{\"a\xFF\":[1]}", counter));
+		REQUIRE(counter.lastKey == U"a\uFFFD");
+		REQUIRE(counter.numbers == 1);
+	}
+}
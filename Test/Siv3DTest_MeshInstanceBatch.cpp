@@ -0,0 +1,37 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("MeshInstanceBatch")
+{
+	const Mesh box{ MeshData::Box(1.0) };
+	const Mesh sphere{ MeshData::Sphere(1.0) };
+
+	MeshInstanceBatch batch;
+
+	// 拡散反射色だけが異なるインスタンスは同じまとまりになる
+	batch.add(box, Mat4x4::Translate(0, 0, 0), Palette::Red);
+	batch.add(box, Mat4x4::Translate(2, 0, 0), Palette::Blue);
+	batch.add(sphere, Mat4x4::Translate(4, 0, 0));
+	REQUIRE(batch.num_instances() == 3);
+	REQUIRE(batch.num_batches() == 2);
+
+	// 視錐台の外のインスタンスは描画されない
+	const BasicCamera3D camera{ Size{ 800, 600 }, 30_deg, Vec3{ 0, 0, -10 }, Vec3{ 0, 0, 0 } };
+	batch.add(box, Mat4x4::Translate(0, 0, -100));
+	REQUIRE(batch.draw(ViewFrustum{ camera, 100.0 }) == 3);
+
+	batch.clear();
+	REQUIRE(batch.num_instances() == 0);
+	REQUIRE(batch.num_batches() == 0);
+	batch.draw();
+}
@@ -0,0 +1,45 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Model::Bake / Model::LoadCached")
+{
+	const FilePath directory = FileSystem::UniqueFilePath() + U'/';
+	const FilePath objPath = (directory + U"quad.obj");
+	const FilePath cachePath = (directory + U"quad.s3dmodel");
+	{
+		TextWriter writer{ objPath };
+		writer << U"o Quad";
+		writer << U"v 0 0 0";
+		writer << U"v 1 0 0";
+		writer << U"v 1 1 0";
+		writer << U"v 0 1 0";
+		writer << U"f 1 2 3 4";
+	}
+
+	REQUIRE(Model::Bake(objPath, cachePath));
+	REQUIRE(FileSystem::Exists(cachePath));
+
+	const Model original{ objPath };
+	const Model cached = Model::LoadCached(objPath, cachePath);
+	REQUIRE(cached);
+	REQUIRE(cached.objects().size() == original.objects().size());
+	REQUIRE(cached.objects()[0].name == U"Quad");
+	REQUIRE(cached.objects()[0].parts[0].mesh.num_triangles() == original.objects()[0].parts[0].mesh.num_triangles());
+	REQUIRE(cached.boundingBox().size == original.boundingBox().size);
+
+	// 元のファイルが無くても、キャッシュから読み込める
+	REQUIRE(FileSystem::Remove(objPath));
+	REQUIRE(Model::LoadCached(objPath, cachePath));
+
+	REQUIRE(FileSystem::Remove(directory));
+}
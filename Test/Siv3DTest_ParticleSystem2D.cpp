@@ -0,0 +1,63 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("ParticleSystem2D")
+{
+	ParticleSystem2DParameters parameters;
+	parameters.rate = 600;
+	parameters.maxParticles = 100;
+	parameters.startLifeTime = 1.0;
+
+	ParticleSystem2D particleSystem{ Vec2{ 0, 0 }, Vec2{ 0, 100 }, CircleEmitter2D{}, parameters, Texture{} };
+	REQUIRE(particleSystem.num_particles() == 0);
+
+	particleSystem.update(0.1);
+	REQUIRE(InRange<size_t>(particleSystem.num_particles(), 59, 60));
+
+	// 古いものから取り除かれる
+	particleSystem.update(0.1);
+	REQUIRE(particleSystem.num_particles() == 100);
+
+	// 寿命が尽きたものは取り除かれる
+	parameters.rate = 0.0;
+	particleSystem.setParameters(parameters);
+	particleSystem.update(1.5);
+	REQUIRE(particleSystem.num_particles() == 0);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("ParticleSystem2D : benchmark")
+{
+	ParticleSystem2DParameters parameters;
+	parameters.rate = 1'000'000;
+	parameters.maxParticles = 1'000'000;
+	parameters.startLifeTime = 2.0;
+
+	ParticleSystem2D particleSystem{ Vec2{ 400, 300 }, Vec2{ 0, 100 }, CircleEmitter2D{}, parameters, Texture{} };
+	particleSystem.prewarm();
+
+	BENCHMARK("update | 1,000,000 particles")
+	{
+		particleSystem.update(1.0 / 60.0);
+		return particleSystem.num_particles();
+	};
+
+	BENCHMARK("draw | 1,000,000 particles")
+	{
+		particleSystem.draw();
+		return particleSystem.num_particles();
+	};
+}
+
+# endif
@@ -0,0 +1,148 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	// 地面に箱を積んだワールドを作る
+	[[nodiscard]]
+	std::pair<P2World, Array<P2Body>> MakeStackWorld(const int32 numBoxes)
+	{
+		P2World world;
+		Array<P2Body> bodies;
+		bodies << world.createRect(P2Static, Vec2{ 0, 0 }, SizeF{ 2000, 10 });
+
+		for (int32 i = 0; i < numBoxes; ++i)
+		{
+			bodies << world.createRect(P2Dynamic, Vec2{ ((i % 10) * 25 - 125), (-20 - (i / 10) * 25) }, 20);
+		}
+
+		return{ world, bodies };
+	}
+}
+
+TEST_CASE("P2World : collision mode")
+{
+	auto [world, bodies] = MakeStackWorld(30);
+	REQUIRE(world.getCollisionMode() == P2CollisionMode::PerBodyPair);
+
+	for (int32 i = 0; i < 120; ++i)
+	{
+		world.update(1.0 / 60.0);
+	}
+
+	const size_t numCollisions = world.getCollisions().size();
+	REQUIRE(0 < numCollisions);
+	REQUIRE(world.getContactRecords().isEmpty());
+
+	// 同じ接触が配列で得られる
+	world.setCollisionMode(P2CollisionMode::FlatArray);
+	REQUIRE(world.getCollisions().empty());
+	world.update(1.0 / 60.0);
+
+	HashSet<std::pair<P2BodyID, P2BodyID>> pairs;
+
+	for (const auto& record : world.getContactRecords())
+	{
+		pairs.emplace(record.pair.a, record.pair.b);
+	}
+
+	REQUIRE(pairs.size() == numCollisions);
+
+	// 途中から収集を再開しても、既に接触している物体を取りこぼさない
+	world.setCollisionMode(P2CollisionMode::PerBodyPair);
+	REQUIRE(world.getCollisions().size() == numCollisions);
+	REQUIRE(world.getContactRecords().isEmpty());
+
+	world.setCollisionMode(P2CollisionMode::None);
+	world.update(1.0 / 60.0);
+	REQUIRE(world.getCollisions().empty());
+	REQUIRE(world.getContactRecords().isEmpty());
+}
+
+TEST_CASE("P2WorldGroup")
+{
+	constexpr int32 NumWorlds = 16;
+
+	P2WorldGroup group;
+	Array<Array<P2Body>> groupBodies;
+	Array<P2World> serialWorlds;
+	Array<Array<P2Body>> serialBodies;
+
+	for (int32 i = 0; i < NumWorlds; ++i)
+	{
+		auto [world1, bodies1] = MakeStackWorld(20 + i);
+		group.add(world1);
+		groupBodies << bodies1;
+
+		auto [world2, bodies2] = MakeStackWorld(20 + i);
+		serialWorlds << world2;
+		serialBodies << bodies2;
+	}
+
+	REQUIRE(group.size() == NumWorlds);
+
+	for (int32 step = 0; step < 60; ++step)
+	{
+		group.update(1.0 / 60.0);
+
+		for (const auto& world : serialWorlds)
+		{
+			world.update(1.0 / 60.0);
+		}
+	}
+
+	// ワールドは独立しているため、並列に更新しても結果は変わらない
+	for (int32 i = 0; i < NumWorlds; ++i)
+	{
+		for (size_t k = 0; k < groupBodies[i].size(); ++k)
+		{
+			REQUIRE(groupBodies[i][k].getPos() == serialBodies[i][k].getPos());
+		}
+	}
+
+	group.remove(0);
+	REQUIRE(group.size() == (NumWorlds - 1));
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("P2WorldGroup benchmark")
+{
+	constexpr int32 NumWorlds = 200;
+
+	P2WorldGroup group;
+	Array<Array<P2Body>> bodies;
+
+	for (int32 i = 0; i < NumWorlds; ++i)
+	{
+		auto [world, b] = MakeStackWorld(100);
+		world.setCollisionMode(P2CollisionMode::FlatArray);
+		group.add(world);
+		bodies << b;
+	}
+
+	BENCHMARK("P2World::update() x 200")
+	{
+		for (const auto& world : group.worlds())
+		{
+			world.update(1.0 / 60.0);
+		}
+	};
+
+	BENCHMARK("P2WorldGroup::update() x 200")
+	{
+		group.update(1.0 / 60.0);
+	};
+}
+
+# endif
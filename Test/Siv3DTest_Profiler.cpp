@@ -0,0 +1,45 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Profiler : zones")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/profiler/trace.json");
+
+	Profiler::ClearZones();
+	Profiler::EnableZoneProfiling(true);
+	REQUIRE(Profiler::IsZoneProfilingEnabled());
+
+	{
+		SIV3D_PROFILE_SCOPE(U"Test::Outer");
+		{
+			SIV3D_PROFILE_SCOPE(U"Test::\"Inner\"");
+		}
+	}
+
+	Profiler::EnableZoneProfiling(false);
+
+	{
+		SIV3D_PROFILE_SCOPE(U"Test::Disabled");
+	}
+
+	REQUIRE(Profiler::SaveChromeTrace(path));
+
+	const String trace = TextReader{ path }.readAll();
+	REQUIRE(trace.includes(U"\"name\":\"Test::Outer\""));
+	REQUIRE(trace.includes(U"\"name\":\"Test::\\\"Inner\\\"\""));
+	REQUIRE(not trace.includes(U"Test::Disabled"));
+
+	Profiler::ClearZones();
+	REQUIRE(Profiler::SaveChromeTrace(path));
+	REQUIRE(not TextReader{ path }.readAll().includes(U"Test::Outer"));
+}
@@ -0,0 +1,209 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+//
+// RenderTexture に描画して読み戻した結果を確かめる。
+// Headless モードではソフトウェアラスタライザ (CRenderer2D_Software) が、それ以外では GPU が同じ結果を返す必要がある。
+// Siv3DHeadlessTest は、このファイルのテストを Headless モードで実行する。
+//
+
+namespace
+{
+	// GPU とソフトウェアラスタライザでの、浮動小数点数から 8-bit への丸め方の違いを許容する
+	[[nodiscard]]
+	bool IsNear(const Color& a, const Color& b, const int32 tolerance = 1)
+	{
+		return ((Abs(a.r - b.r) <= tolerance)
+			&& (Abs(a.g - b.g) <= tolerance)
+			&& (Abs(a.b - b.b) <= tolerance)
+			&& (Abs(a.a - b.a) <= tolerance));
+	}
+
+	template <class Fty>
+	[[nodiscard]]
+	Image Render(const Size& size, const ColorF& background, Fty draw)
+	{
+		const RenderTexture renderTexture{ size, background };
+		{
+			const ScopedRenderTarget2D target{ renderTexture };
+
+			draw();
+		}
+
+		Graphics2D::Flush();
+
+		Image image;
+		renderTexture.readAsImage(image);
+		return image;
+	}
+
+	constexpr Color Background{ 0, 0, 0, 255 };
+
+	constexpr Color Gray{ 64, 64, 64, 255 };
+}
+
+TEST_CASE("Renderer2D : shapes")
+{
+	const Image image = Render(Size{ 64, 64 }, Background, []()
+	{
+		Rect{ 8, 8, 16, 16 }.draw(Palette::Red);
+		Circle{ 44, 44, 10 }.draw(Palette::Blue);
+		Triangle{ Vec2{ 8, 40 }, Vec2{ 24, 40 }, Vec2{ 8, 56 } }.draw(Palette::Lime);
+	});
+
+	REQUIRE(image.size() == Size{ 64, 64 });
+
+	// 矩形はピクセル中心が内側にあるピクセルだけを塗る
+	CHECK(image[8][8] == Color{ 255, 0, 0, 255 });
+	CHECK(image[23][23] == Color{ 255, 0, 0, 255 });
+	CHECK(image[7][7] == Background);
+	CHECK(image[24][24] == Background);
+	CHECK(image[8][24] == Background);
+
+	CHECK(image[44][44] == Color{ 0, 0, 255, 255 });
+	CHECK(image[36][44] == Color{ 0, 0, 255, 255 });
+	CHECK(image[35][35] == Background);
+	CHECK(image[56][56] == Background);
+
+	CHECK(image[42][10] == Color{ 0, 255, 0, 255 });
+	CHECK(image[54][22] == Background);
+}
+
+TEST_CASE("Renderer2D : texture")
+{
+	Image source{ 2, 2 };
+	source[0][0] = Color{ 255, 0, 0 };
+	source[0][1] = Color{ 0, 255, 0 };
+	source[1][0] = Color{ 0, 0, 255 };
+	source[1][1] = Color{ 255, 255, 255 };
+
+	const Texture texture{ source };
+
+	const Image image = Render(Size{ 64, 32 }, Background, [&]()
+	{
+		const ScopedRenderStates2D sampler{ SamplerState::ClampNearest };
+
+		texture.scaled(16).draw(0, 0);
+		texture.scaled(16).draw(32, 0, ColorF{ 0.5, 1.0, 1.0 });
+	});
+
+	CHECK(image[8][8] == Color{ 255, 0, 0, 255 });
+	CHECK(image[8][24] == Color{ 0, 255, 0, 255 });
+	CHECK(image[24][8] == Color{ 0, 0, 255, 255 });
+	CHECK(image[24][24] == Color{ 255, 255, 255, 255 });
+
+	// 頂点色との乗算
+	CHECK(IsNear(image[8][40], Color{ 128, 0, 0, 255 }));
+	CHECK(IsNear(image[24][56], Color{ 128, 255, 255, 255 }));
+}
+
+TEST_CASE("Renderer2D : dotted lines")
+{
+	SECTION("square dot")
+	{
+		const Image image = Render(Size{ 64, 64 }, Background, []()
+		{
+			Line{ 8, 32, 56, 32 }.draw(LineStyle::SquareDot, 8, Palette::White);
+		});
+
+		CHECK(image[32][12] == Palette::White);
+		CHECK(image[29][12] == Palette::White);
+		CHECK(image[34][12] == Palette::White);
+		CHECK(image[37][12] == Background);
+
+		// 点と点の間
+		CHECK(image[32][27] == Background);
+		CHECK(image[32][36] == Palette::White);
+
+		// 四角い点は角まで塗られる
+		CHECK(image[35][11] == Palette::White);
+	}
+
+	SECTION("round dot")
+	{
+		const Image image = Render(Size{ 64, 64 }, Background, []()
+		{
+			Line{ 8, 32, 56, 32 }.draw(LineStyle::RoundDot, 8, Palette::White);
+		});
+
+		CHECK(image[31][7] == Palette::White);
+		CHECK(image[32][8] == Palette::White);
+
+		// 点と点の間
+		CHECK(image[31][15] == Background);
+		CHECK(image[31][23] == Palette::White);
+
+		// 丸い点は角が塗られない
+		CHECK(image[35][11] == Background);
+	}
+}
+
+TEST_CASE("Renderer2D : DrawBatch")
+{
+	const Array<RectF> rects = { RectF{ 4, 4, 10, 6 }, RectF{ 20, 8, 6, 12 }, RectF{ 40, 30, 16, 16 } };
+	const Array<ColorF> colors = { Palette::Red, Palette::Lime, ColorF{ 0.0, 0.0, 1.0, 0.5 } };
+	const Array<Circle> circles = { Circle{ 12, 44, 6 }, Circle{ 30, 48, 8.5 }, Circle{ 44, 36, 10 } };
+
+	// まとめて描いた結果は、1 つずつ描いた結果と一致する
+	const Image batch = Render(Size{ 64, 64 }, Background, [&]()
+	{
+		Circle::DrawBatch(circles, Palette::Orange);
+		RectF::DrawBatch(rects, colors);
+	});
+
+	const Image each = Render(Size{ 64, 64 }, Background, [&]()
+	{
+		for (const auto& circle : circles)
+		{
+			circle.draw(Palette::Orange);
+		}
+
+		for (size_t i = 0; i < rects.size(); ++i)
+		{
+			rects[i].draw(colors[i]);
+		}
+	});
+
+	CHECK(batch[8][8] == Color{ 255, 0, 0, 255 });
+	CHECK(batch[44][12] == Palette::Orange);
+	CHECK(batch == each);
+}
+
+TEST_CASE("Renderer2D : blend states")
+{
+	const auto fill = [](const BlendState& blendState, const ColorF& color)
+	{
+		return Render(Size{ 16, 16 }, Gray, [&]()
+		{
+			const ScopedRenderStates2D blend{ blendState };
+
+			Rect{ 16 }.draw(color);
+		})[8][8];
+	};
+
+	CHECK(IsNear(fill(BlendState::Default2D, ColorF{ 1.0, 0.0, 0.0, 0.5 }), Color{ 160, 32, 32, 255 }));
+	CHECK(IsNear(fill(BlendState::Additive, ColorF{ 0.25, 0.5, 0.0, 0.5 }), Color{ 96, 128, 64, 255 }));
+	CHECK(IsNear(fill(BlendState::Subtractive, ColorF{ 0.25, 0.5, 0.0, 0.5 }), Color{ 32, 0, 64, 255 }));
+	CHECK(IsNear(fill(BlendState::Multiplicative, ColorF{ 0.5, 1.0, 0.0, 1.0 }), Color{ 32, 64, 0, 255 }));
+
+	// ブレンドを無効にすると、アルファも含めてそのまま書き込まれる
+	CHECK(IsNear(fill(BlendState::Opaque, ColorF{ 0.0, 1.0, 0.0, 0.5 }), Color{ 0, 255, 0, 128 }));
+
+	// 書き込みマスク
+	{
+		const BlendState redOnly{ true, Blend::SrcAlpha, Blend::InvSrcAlpha, BlendOp::Add,
+			Blend::Zero, Blend::One, BlendOp::Add, false, true, false, false, true };
+
+		CHECK(fill(redOnly, Palette::White) == Color{ 255, 64, 64, 255 });
+	}
+}
@@ -0,0 +1,195 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+# include <Siv3D/Renderer2D/Software/SoftwareRasterizer.hpp>
+
+//
+// Headless モードの CRenderer2D_Software が使う SoftwareRasterizer に、
+// 既知の頂点とインデックスを与えて、塗られるピクセルを確かめる。
+//
+
+namespace
+{
+	constexpr Color Background{ 0, 0, 0, 255 };
+
+	// Vertex2DBuilder::BuildRect() と同じ並びの頂点とインデックス
+	void AddQuad(Array<Vertex2D>& vertices, Array<Vertex2D::IndexType>& indices, const Rect& rect, const ColorF& color)
+	{
+		const Vertex2D::IndexType offset = static_cast<Vertex2D::IndexType>(vertices.size());
+		const Float4 c = color.toFloat4();
+
+		vertices << Vertex2D{ .pos = Float2{ rect.x, rect.y }, .tex = Float2{ 0, 0 }, .color = c };
+		vertices << Vertex2D{ .pos = Float2{ (rect.x + rect.w), rect.y }, .tex = Float2{ 1, 0 }, .color = c };
+		vertices << Vertex2D{ .pos = Float2{ rect.x, (rect.y + rect.h) }, .tex = Float2{ 0, 1 }, .color = c };
+		vertices << Vertex2D{ .pos = Float2{ (rect.x + rect.w), (rect.y + rect.h) }, .tex = Float2{ 1, 1 }, .color = c };
+
+		for (const Vertex2D::IndexType i : { 0, 1, 2, 2, 1, 3 })
+		{
+			indices << static_cast<Vertex2D::IndexType>(offset + i);
+		}
+	}
+
+	// rect の内側がすべて inside、外側がすべて Background であるか
+	[[nodiscard]]
+	bool IsFilled(const Image& image, const Rect& rect, const Color& inside)
+	{
+		for (int32 y = 0; y < image.height(); ++y)
+		{
+			for (int32 x = 0; x < image.width(); ++x)
+			{
+				if (image[y][x] != (rect.contains(Point{ x, y }) ? inside : Background))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
+TEST_CASE("SoftwareRasterizer : quad")
+{
+	// タイル (64x64) の境界をまたぐ長方形
+	const Rect rect{ 10, 20, 100, 60 };
+
+	Array<Vertex2D> vertices;
+	Array<Vertex2D::IndexType> indices;
+	AddQuad(vertices, indices, rect, ColorF{ 1.0, 0.25 });
+
+	const Array<SoftwareDrawState> states = { SoftwareDrawState{} };
+	const Array<const Image*> textures = { nullptr };
+	const SoftwareDrawCommand command{ .indexCount = 6 };
+
+	Image image{ 128, 128, Background };
+	SoftwareRasterizer rasterizer;
+
+	REQUIRE(rasterizer.draw(image, vertices.data(), indices.data(), &command, 1, states, textures) == 2);
+
+	// 対角線を共有する 2 つの三角形が、同じピクセルを二重にブレンドしない（トップレフトルール）
+	REQUIRE(IsFilled(image, rect, Color{ 64, 64, 64, 255 }));
+}
+
+TEST_CASE("SoftwareRasterizer : scissor and viewport")
+{
+	Array<Vertex2D> vertices;
+	Array<Vertex2D::IndexType> indices;
+	AddQuad(vertices, indices, Rect{ 0, 0, 128, 128 }, Palette::White);
+
+	const Array<const Image*> textures = { nullptr };
+	const SoftwareDrawCommand command{ .indexCount = 6 };
+
+	SECTION("scissor")
+	{
+		SoftwareDrawState state;
+		state.rasterizerState = RasterizerState::SolidCullNoneScissor;
+		state.scissorRect = Rect{ 50, 30, 40, 70 };
+
+		Image image{ 128, 128, Background };
+		SoftwareRasterizer{}.draw(image, vertices.data(), indices.data(), &command, 1, { state }, textures);
+
+		REQUIRE(IsFilled(image, state.scissorRect, Palette::White));
+	}
+
+	SECTION("viewport")
+	{
+		SoftwareDrawState state;
+		state.viewport = Rect{ 70, 10, 20, 30 };
+
+		Image image{ 128, 128, Background };
+		SoftwareRasterizer{}.draw(image, vertices.data(), indices.data(), &command, 1, { state }, textures);
+
+		REQUIRE(IsFilled(image, *state.viewport, Palette::White));
+	}
+}
+
+TEST_CASE("SoftwareRasterizer : commands")
+{
+	Array<Vertex2D> vertices;
+	Array<Vertex2D::IndexType> indices;
+	AddQuad(vertices, indices, Rect{ 0, 0, 128, 128 }, Palette::Red);
+	AddQuad(vertices, indices, Rect{ 40, 40, 50, 50 }, Palette::Blue);
+
+	// 2 つ目の長方形のインデックスを、区切りからの相対値にする
+	for (size_t i = 6; i < indices.size(); ++i)
+	{
+		indices[i] -= 4;
+	}
+
+	const Array<const Image*> textures = { nullptr, nullptr };
+
+	SECTION("baseVertex / startIndex")
+	{
+		const Array<SoftwareDrawState> states = { SoftwareDrawState{} };
+		const SoftwareDrawCommand command{ .baseVertex = 4, .startIndex = 6, .indexCount = 6 };
+
+		Image image{ 128, 128, Background };
+		REQUIRE(SoftwareRasterizer{}.draw(image, vertices.data(), indices.data(), &command, 1, states, textures) == 2);
+
+		REQUIRE(IsFilled(image, Rect{ 40, 40, 50, 50 }, Palette::Blue));
+	}
+
+	SECTION("order")
+	{
+		// タイルに分けて並列に塗っても、後のコマンドが上に描かれる
+		SoftwareDrawState second;
+		second.colorMul = Float4{ 0.0f, 1.0f, 1.0f, 1.0f };
+		second.colorAdd = Float4{ 0.0f, 1.0f, 0.0f, 0.0f };
+
+		const Array<SoftwareDrawState> states = { SoftwareDrawState{}, second };
+		const SoftwareDrawCommand commands[2] = {
+			{ .stateIndex = 0, .indexCount = 6 },
+			{ .stateIndex = 1, .baseVertex = 4, .startIndex = 6, .indexCount = 6 },
+		};
+
+		Image image{ 128, 128, Background };
+		REQUIRE(SoftwareRasterizer{}.draw(image, vertices.data(), indices.data(), commands, 2, states, textures) == 4);
+
+		for (int32 y = 0; y < image.height(); ++y)
+		{
+			for (int32 x = 0; x < image.width(); ++x)
+			{
+				const Color expected = (Rect{ 40, 40, 50, 50 }.contains(Point{ x, y }) ? Color{ 0, 255, 255, 255 } : Color{ Palette::Red });
+				REQUIRE(image[y][x] == expected);
+			}
+		}
+	}
+}
+
+TEST_CASE("SoftwareRasterizer : cull mode")
+{
+	// 画面上で時計回り（表）と反時計回り（裏）の三角形
+	const Array<Vertex2D> vertices = {
+		Vertex2D{ .pos = Float2{ 0, 0 }, .tex = Float2{ 0, 0 }, .color = Float4{ 1, 1, 1, 1 } },
+		Vertex2D{ .pos = Float2{ 64, 0 }, .tex = Float2{ 0, 0 }, .color = Float4{ 1, 1, 1, 1 } },
+		Vertex2D{ .pos = Float2{ 0, 64 }, .tex = Float2{ 0, 0 }, .color = Float4{ 1, 1, 1, 1 } },
+	};
+	const Array<Vertex2D::IndexType> indices = { 0, 1, 2, 0, 2, 1 };
+	const Array<const Image*> textures = { nullptr };
+
+	const auto count = [&](const RasterizerState& rasterizerState, const uint32 startIndex)
+	{
+		SoftwareDrawState state;
+		state.rasterizerState = rasterizerState;
+
+		const SoftwareDrawCommand command{ .startIndex = startIndex, .indexCount = 3 };
+		Image image{ 64, 64, Background };
+		return SoftwareRasterizer{}.draw(image, vertices.data(), indices.data(), &command, 1, { state }, textures);
+	};
+
+	REQUIRE(count(RasterizerState::SolidCullNone, 0) == 1);
+	REQUIRE(count(RasterizerState::SolidCullNone, 3) == 1);
+	REQUIRE(count(RasterizerState::SolidCullBack, 0) == 1);
+	REQUIRE(count(RasterizerState::SolidCullBack, 3) == 0);
+	REQUIRE(count(RasterizerState::SolidCullFront, 0) == 0);
+	REQUIRE(count(RasterizerState::SolidCullFront, 3) == 1);
+}
@@ -1416,4 +1416,30 @@ TEST_CASE("TextReader::readAll(String&) | LONG")
 	}
 }
 
+TEST_CASE("TextReader::readLineViews()")
+{
+	const Array<String> expected = { U"Siv3D" };
+
+	for (const auto name : { U"utf8_no_bom.txt", U"utf8_with_bom.txt", U"utf16_le.txt", U"utf16_be.txt" })
+	{
+		const FilePath path = FileSystem::FullPath(U"test/text/" + String{ name });
+		TextReader reader(path);
+		String buffer;
+		Array<StringView> lines;
+		REQUIRE(reader.readLineViews(buffer, lines) == true);
+		REQUIRE(lines.map([](StringView line) { return String{ line }; }) == expected);
+		REQUIRE(reader.readLineViews(buffer, lines) == false);
+		REQUIRE(lines.isEmpty());
+	}
+
+	{
+		const FilePath path = FileSystem::FullPath(U"test/text/long/utf8_no_bom.txt");
+		TextReader reader1(path), reader2(path);
+		String buffer;
+		Array<StringView> lines;
+		REQUIRE(reader1.readLineViews(buffer, lines) == true);
+		REQUIRE(lines.map([](StringView line) { return String{ line }; }) == reader2.readLines());
+	}
+}
+
 SIV3D_DISABLE_MSVC_WARNINGS_POP()
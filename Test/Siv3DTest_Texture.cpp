@@ -24,3 +24,156 @@ TEST_CASE("non-existent Texture (#44)")
 	REQUIRE_THAT(cout, Catch::Matchers::Contains("BinaryReader: Failed to open the file `example/windmill2.png`"));
 # endif
 }
+
+TEST_CASE("Texture : released ID is not reused")
+{
+	Logger.disable();
+
+	Texture a{ Image{ 16, 16, Palette::White } };
+	const auto oldID = a.id();
+	a.release();
+
+	const Texture b{ Image{ 32, 32, Palette::White } };
+	// 同じスロットが再利用されても、世代が異なるので ID は一致しない
+	REQUIRE(a.isEmpty());
+	REQUIRE(b.id() != oldID);
+
+	Logger.enable();
+}
+
+TEST_CASE("Texture : deferred upload")
+{
+	Texture texture;
+
+	// 任意のスレッドから作成できる
+	std::thread thread{ [&]()
+	{
+		texture = Texture{ Texture::Deferred, Image{ 256, 128, Palette::Skyblue }, TextureDesc::Mipped };
+	} };
+	thread.join();
+
+	REQUIRE(texture.size() == Size{ 256, 128 });
+
+	for (int32 i = 0; ((not texture.isReady()) && (i < 60)); ++i)
+	{
+		System::Update();
+	}
+
+	REQUIRE(texture.isReady());
+	REQUIRE(texture.hasMipMap());
+
+	DynamicTexture dynamicTexture{ Size{ 64, 64 } };
+	REQUIRE(dynamicTexture.fillAsync(Image{ 64, 64, Palette::Orange }));
+	REQUIRE(dynamicTexture.fillAsync(Image{ 64, 64, Palette::Seagreen }));
+
+	// 大きさが異なる画像では更新できない
+	REQUIRE(not dynamicTexture.fillAsync(Image{ 32, 32, Palette::Orange }));
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+namespace
+{
+	// 以前の AssetHandleManager と同じく、mutex で保護された HashTable から参照する
+	class LockedTable
+	{
+	public:
+
+		explicit LockedTable(const Array<Texture>& textures)
+		{
+			for (const auto& texture : textures)
+			{
+				m_data.emplace(texture.id().value(), std::make_unique<Size>(texture.size()));
+			}
+		}
+
+		[[nodiscard]]
+		const Size* operator [](const size_t id)
+		{
+			std::lock_guard lock{ m_mutex };
+			return m_data[id].get();
+		}
+
+	private:
+
+		HashTable<size_t, std::unique_ptr<Size>> m_data;
+
+		std::mutex m_mutex;
+	};
+
+	template <class Fty>
+	static void RunOnThreads(const size_t numThreads, Fty f)
+	{
+		Array<std::thread> threads;
+
+		for (size_t i = 0; i < numThreads; ++i)
+		{
+			threads.emplace_back(f);
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+	}
+}
+
+TEST_CASE("Texture lookup : benchmark")
+{
+	Logger.disable();
+
+	constexpr size_t LookupsPerThread = 100'000;
+
+	Array<Texture> textures;
+	for (int32 i = 0; i < 64; ++i)
+	{
+		textures.emplace_back(Image{ 4, 4, Palette::White });
+	}
+
+	LockedTable lockedTable{ textures };
+
+	for (const size_t numThreads : { 1, 4, 16 })
+	{
+		BENCHMARK(U"mutex + HashTable | {} threads"_fmt(numThreads).narrow())
+		{
+			std::atomic<int64> sum = 0;
+
+			RunOnThreads(numThreads, [&]()
+			{
+				int64 localSum = 0;
+
+				for (size_t i = 0; i < LookupsPerThread; ++i)
+				{
+					localSum += lockedTable[textures[i % textures.size()].id().value()]->x;
+				}
+
+				sum += localSum;
+			});
+
+			return sum.load();
+		};
+
+		BENCHMARK(U"AssetHandleManager | {} threads"_fmt(numThreads).narrow())
+		{
+			std::atomic<int64> sum = 0;
+
+			RunOnThreads(numThreads, [&]()
+			{
+				int64 localSum = 0;
+
+				for (size_t i = 0; i < LookupsPerThread; ++i)
+				{
+					localSum += textures[i % textures.size()].width();
+				}
+
+				sum += localSum;
+			});
+
+			return sum.load();
+		};
+	}
+
+	Logger.enable();
+}
+
+# endif
@@ -0,0 +1,362 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+
+//
+// RectF::DrawBatch() / Circle::DrawBatch() が使う BuildRects() / BuildCircles() が、
+// 1 つずつ描く BuildRect() / BuildCircle() と同じ頂点とインデックスを作ることを確かめる。
+//
+
+namespace
+{
+	// CRenderer2D_* の requestBuffer() と同じく、インデックスが Vertex2D::IndexType で表せなくなったら区切りを進めて頂点を記録する
+	class Vertex2DRecorder
+	{
+	public:
+
+		Vertex2DRecorder()
+			: m_bufferCreator{ [this](const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize) { return request(vertexSize, indexSize); } } {}
+
+		[[nodiscard]]
+		const BufferCreatorFunc& bufferCreator() const noexcept
+		{
+			return m_bufferCreator;
+		}
+
+		void clear()
+		{
+			m_vertices.clear();
+			m_indices.clear();
+			m_requests.clear();
+			m_baseVertex = 0;
+			m_segmentCount = 1;
+		}
+
+		[[nodiscard]]
+		const Array<Vertex2D>& vertices() const noexcept
+		{
+			return m_vertices;
+		}
+
+		// 区切りからの相対値を、先頭の頂点からの値に直したインデックス
+		[[nodiscard]]
+		Array<uint32> absoluteIndices() const
+		{
+			Array<uint32> results(m_indices.size());
+
+			for (const auto& request : m_requests)
+			{
+				for (size_t i = request.indexBegin; i < request.indexEnd; ++i)
+				{
+					results[i] = (request.baseVertex + m_indices[i]);
+				}
+			}
+
+			return results;
+		}
+
+		[[nodiscard]]
+		size_t requestCount() const noexcept
+		{
+			return m_requests.size();
+		}
+
+		// インデックスの区切りの数
+		[[nodiscard]]
+		size_t segmentCount() const noexcept
+		{
+			return m_segmentCount;
+		}
+
+	private:
+
+		struct Request
+		{
+			size_t indexBegin;
+
+			size_t indexEnd;
+
+			uint32 baseVertex;
+		};
+
+		BufferCreatorFunc m_bufferCreator;
+
+		Array<Vertex2D> m_vertices;
+
+		Array<Vertex2D::IndexType> m_indices;
+
+		Array<Request> m_requests;
+
+		uint32 m_baseVertex = 0;
+
+		size_t m_segmentCount = 1;
+
+		Vertex2DBufferPointer request(const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize)
+		{
+			const uint32 vertexCount = static_cast<uint32>(m_vertices.size());
+
+			if ((Largest<Vertex2D::IndexType> + 1u) < ((vertexCount - m_baseVertex) + vertexSize))
+			{
+				m_baseVertex = vertexCount;
+				++m_segmentCount;
+			}
+
+			const size_t indexCount = m_indices.size();
+
+			m_vertices.resize(vertexCount + vertexSize);
+			m_indices.resize(indexCount + indexSize);
+			m_requests << Request{ indexCount, (indexCount + indexSize), m_baseVertex };
+
+			return{ (m_vertices.data() + vertexCount), (m_indices.data() + indexCount), static_cast<Vertex2D::IndexType>(vertexCount - m_baseVertex) };
+		}
+	};
+
+	// BuildRects() は float で右下の座標を求めるので、double で求める RectF::draw() との誤差を許容する
+	[[nodiscard]]
+	bool IsNear(const Array<Vertex2D>& a, const Array<Vertex2D>& b)
+	{
+		if (a.size() != b.size())
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			if ((0.01f < a[i].pos.distanceFrom(b[i].pos))
+				|| (a[i].color != b[i].color))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	[[nodiscard]]
+	Array<RectF> MakeRects(const size_t count)
+	{
+		return Array<RectF>::IndexedGenerate(count, [](const size_t i)
+		{
+			return RectF{ ((i % 97) * 7.5), ((i / 97) * 3.25), (1.0 + (i % 13) * 2.5), (0.5 + (i % 7) * 4.0) };
+		});
+	}
+
+	[[nodiscard]]
+	Array<Circle> MakeCircles(const size_t count)
+	{
+		return Array<Circle>::IndexedGenerate(count, [](const size_t i)
+		{
+			// sin/cos のテーブルを使わない大きな円も含める
+			const double r = ((i % 500 == 0) ? 1200.0 : (0.5 + (i % 50) * 4.0));
+			return Circle{ ((i % 97) * 7.5), ((i / 97) * 3.25), r };
+		});
+	}
+
+	[[nodiscard]]
+	Array<ColorF> MakeColors(const size_t count)
+	{
+		return Array<ColorF>::IndexedGenerate(count, [](const size_t i)
+		{
+			return ColorF{ ((i % 3) / 2.0), ((i % 5) / 4.0), ((i % 7) / 6.0), (0.25 + (i % 4) * 0.25) };
+		});
+	}
+
+	// レンダラの addRects() と同じく、作成されなかった残りの長方形を繰り返し作成する
+	void BuildRectBatch(const Vertex2DRecorder& recorder, const Array<RectF>& rects, const Array<ColorF>& colors, const Float4& color)
+	{
+		const RectF* pRects = rects.data();
+		const ColorF* pColors = (colors ? colors.data() : nullptr);
+		size_t count = rects.size();
+
+		while (count)
+		{
+			size_t numBuilt = 0;
+
+			REQUIRE(Vertex2DBuilder::BuildRects(recorder.bufferCreator(), pRects, count, pColors, color, numBuilt) == (numBuilt * 6));
+			REQUIRE(numBuilt != 0);
+
+			pRects += numBuilt;
+			count -= numBuilt;
+
+			if (pColors)
+			{
+				pColors += numBuilt;
+			}
+		}
+	}
+
+	void BuildCircleBatch(const Vertex2DRecorder& recorder, const Array<Circle>& circles, const Array<ColorF>& colors, const Float4& color, const float scale)
+	{
+		const Circle* pCircles = circles.data();
+		const ColorF* pColors = (colors ? colors.data() : nullptr);
+		size_t count = circles.size();
+
+		while (count)
+		{
+			size_t numBuilt = 0;
+
+			REQUIRE(Vertex2DBuilder::BuildCircles(recorder.bufferCreator(), pCircles, count, pColors, color, scale, numBuilt) != 0);
+			REQUIRE(numBuilt != 0);
+
+			pCircles += numBuilt;
+			count -= numBuilt;
+
+			if (pColors)
+			{
+				pColors += numBuilt;
+			}
+		}
+	}
+
+	void BuildRectEach(const Vertex2DRecorder& recorder, const Array<RectF>& rects, const Array<ColorF>& colors, const Float4& color)
+	{
+		for (size_t i = 0; i < rects.size(); ++i)
+		{
+			const RectF& rect = rects[i];
+			const FloatRect floatRect{ rect.x, rect.y, (rect.x + rect.w), (rect.y + rect.h) };
+
+			REQUIRE(Vertex2DBuilder::BuildRect(recorder.bufferCreator(), floatRect, (colors ? colors[i].toFloat4() : color)) == 6);
+		}
+	}
+
+	void BuildCircleEach(const Vertex2DRecorder& recorder, const Array<Circle>& circles, const Array<ColorF>& colors, const Float4& color, const float scale)
+	{
+		for (size_t i = 0; i < circles.size(); ++i)
+		{
+			const Circle& circle = circles[i];
+			const Float4 c = (colors ? colors[i].toFloat4() : color);
+
+			REQUIRE(Vertex2DBuilder::BuildCircle(recorder.bufferCreator(), circle.center, static_cast<float>(circle.r), c, c, scale) != 0);
+		}
+	}
+}
+
+TEST_CASE("Vertex2DBuilder::BuildRects()")
+{
+	// 16-bit のインデックスに収まらず、区切りをまたぐ個数
+	const Array<RectF> rects = MakeRects(20000);
+	const Array<ColorF> colors = MakeColors(rects.size());
+	const Float4 color = ColorF{ 0.2, 0.4, 0.6, 0.8 }.toFloat4();
+
+	Vertex2DRecorder batch, each;
+
+	SECTION("single color")
+	{
+		BuildRectBatch(batch, rects, {}, color);
+		BuildRectEach(each, rects, {}, color);
+	}
+
+	SECTION("colors")
+	{
+		BuildRectBatch(batch, rects, colors, color);
+		BuildRectEach(each, rects, colors, color);
+	}
+
+	REQUIRE(batch.requestCount() < each.requestCount());
+	REQUIRE(1 < batch.requestCount());
+	REQUIRE(1 < batch.segmentCount());
+	REQUIRE(batch.segmentCount() == each.segmentCount());
+
+	REQUIRE(IsNear(batch.vertices(), each.vertices()));
+	REQUIRE(batch.absoluteIndices() == each.absoluteIndices());
+}
+
+TEST_CASE("Vertex2DBuilder::BuildCircles()")
+{
+	const Array<Circle> circles = MakeCircles(3000);
+	const Array<ColorF> colors = MakeColors(circles.size());
+	const Float4 color = ColorF{ 0.2, 0.4, 0.6, 0.8 }.toFloat4();
+
+	Vertex2DRecorder batch, each;
+
+	SECTION("single color")
+	{
+		BuildCircleBatch(batch, circles, {}, color, 1.0f);
+		BuildCircleEach(each, circles, {}, color, 1.0f);
+	}
+
+	SECTION("colors")
+	{
+		BuildCircleBatch(batch, circles, colors, color, 1.0f);
+		BuildCircleEach(each, circles, colors, color, 1.0f);
+	}
+
+	SECTION("scale")
+	{
+		BuildCircleBatch(batch, circles, colors, color, 2.5f);
+		BuildCircleEach(each, circles, colors, color, 2.5f);
+	}
+
+	REQUIRE(batch.requestCount() < each.requestCount());
+	REQUIRE(1 < batch.requestCount());
+	REQUIRE(1 < batch.segmentCount());
+
+	REQUIRE(IsNear(batch.vertices(), each.vertices()));
+	REQUIRE(batch.absoluteIndices() == each.absoluteIndices());
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Vertex2DBuilder::BuildRects() / BuildCircles() : benchmark")
+{
+	const Array<RectF> rects = MakeRects(10000);
+	const Array<Circle> circles = MakeCircles(10000);
+	const Array<ColorF> colors = MakeColors(10000);
+	const Float4 color = ColorF{ 0.2, 0.4, 0.6, 0.8 }.toFloat4();
+
+	Vertex2DRecorder recorder;
+
+	BENCHMARK("BuildRect() | 10K")
+	{
+		recorder.clear();
+		BuildRectEach(recorder, rects, {}, color);
+		return recorder.vertices().size();
+	};
+
+	BENCHMARK("BuildRects() | 10K")
+	{
+		recorder.clear();
+		BuildRectBatch(recorder, rects, {}, color);
+		return recorder.vertices().size();
+	};
+
+	BENCHMARK("BuildRects() with colors | 10K")
+	{
+		recorder.clear();
+		BuildRectBatch(recorder, rects, colors, color);
+		return recorder.vertices().size();
+	};
+
+	BENCHMARK("BuildCircle() | 10K")
+	{
+		recorder.clear();
+		BuildCircleEach(recorder, circles, {}, color, 1.0f);
+		return recorder.vertices().size();
+	};
+
+	BENCHMARK("BuildCircles() | 10K")
+	{
+		recorder.clear();
+		BuildCircleBatch(recorder, circles, {}, color, 1.0f);
+		return recorder.vertices().size();
+	};
+
+	BENCHMARK("BuildCircles() with colors | 10K")
+	{
+		recorder.clear();
+		BuildCircleBatch(recorder, circles, colors, color, 1.0f);
+		return recorder.vertices().size();
+	};
+}
+
+# endif